@@ -25,23 +25,50 @@
 
 #include "Application.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 #include <QApplication>
+#include <QDirIterator>
 #include <QFileDialog>
+#include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QFontDatabase>
+#include <QLocale>
 #include <QProcess>
+#include <QInputDialog>
+#include <QSettings>
+#include <QStandardPaths>
 #include <QMessageBox>
+#include <QElapsedTimer>
+
+#include <array>
+#include <chrono>
+#include <future>
 
 Application::Application(QObject *parent)
     : QObject(parent)
 {   
-    QFontDatabase::addApplicationFont(":/SourceCodePro-Italic.ttf");
-    QFontDatabase::addApplicationFont(":/SourceCodePro-Regular.ttf");
-    QFontDatabase::addApplicationFont(":/SourceSansPro-Light.ttf");
-    QFontDatabase::addApplicationFont(":/SourceSansPro-LightItalic.ttf");
-    QFontDatabase::addApplicationFont(":/SourceSansPro-Regular.ttf");
+    // Started first, so stalls during the startup are reported as well
+    const auto stallThreshold = QSettings().value("watchdog/stallThreshold", DEFAULT_STALL_THRESHOLD_MS).toInt();
+    if (stallThreshold > 0)
+    {
+        QObject::connect(&mStallWatchdog, &StallWatchdog::StallSignal, this, [&](qint64 pDurationMs, const QString& pSpans){
+            mMainWindow.Log(QString("The user interface was blocked for %0 ms in %1.").arg(pDurationMs).arg(pSpans), "rgb(249, 154, 0)");
+        });
+        mStallWatchdog.Start(stallThreshold, QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation) + "/stalls.log");
+    }
+
+    const TraceSpan span("Application::Application");
+
+    {
+        const TraceSpan fontSpan("LoadFonts");
+        QFontDatabase::addApplicationFont(":/SourceCodePro-Italic.ttf");
+        QFontDatabase::addApplicationFont(":/SourceCodePro-Regular.ttf");
+        QFontDatabase::addApplicationFont(":/SourceSansPro-Light.ttf");
+        QFontDatabase::addApplicationFont(":/SourceSansPro-LightItalic.ttf");
+        QFontDatabase::addApplicationFont(":/SourceSansPro-Regular.ttf");
+    }
 
     QObject::connect(&mMainWindow, &MainWindow::GenerateSignal, this, &Application::OnGenerate);
     QObject::connect(&mMainWindow, &MainWindow::SaveProjectSignal, this, &Application::OnSaveProject);
@@ -62,9 +89,51 @@ Application::Application(QObject *parent)
     QObject::connect(&mMainWindow, &MainWindow::UploadSignal, this, [&](){
         OnUpload(mMainWindow.GetEnvironment());
     });
+    QObject::connect(&mMainWindow, &MainWindow::ClearFirmwareCacheSignal, this, &Application::OnClearFirmwareCache);
+    QObject::connect(&mMainWindow, &MainWindow::ImportConfigurationsSignal, this, &Application::OnImportConfigurations);
+    QObject::connect(&mMainWindow, &MainWindow::QueryFleetSignal, this, &Application::OnQueryFleet);
+    QObject::connect(&mMainWindow, &MainWindow::AddFleetFolderSignal, this, &Application::OnAddFleetFolder);
+    QObject::connect(&mMainWindow, &MainWindow::CompareConfigurationsSignal, this, &Application::OnCompareConfigurations);
+    QObject::connect(&mMainWindow, &MainWindow::ExportComparisonSignal, this, &Application::OnExportComparison);
+    QObject::connect(&mMainWindow, &MainWindow::ExportTraceSignal, this, &Application::OnExportTrace);
+
+    // Re-evaluate the effective defines once the user stopped editing for a moment
+    mEffectiveDefinesTimer.setSingleShot(true);
+    mEffectiveDefinesTimer.setInterval(500);
+    QObject::connect(&mEffectiveDefinesTimer, &QTimer::timeout, this, &Application::OnEvaluateEffectiveDefines);
+    QObject::connect(&mMainWindow, &MainWindow::ConfigurationChangedSignal, &mEffectiveDefinesTimer, qOverload<>(&QTimer::start));
+    QObject::connect(&mMainWindow, &MainWindow::EffectiveDefinesRequestedSignal, &mEffectiveDefinesTimer, qOverload<>(&QTimer::start));
+
+    mRebuildScopeTimer.setSingleShot(true);
+    mRebuildScopeTimer.setInterval(300);
+    QObject::connect(&mRebuildScopeTimer, &QTimer::timeout, this, &Application::OnUpdateRebuildScope);
+    QObject::connect(&mMainWindow, &MainWindow::ConfigurationChangedSignal, &mRebuildScopeTimer, qOverload<>(&QTimer::start));
+
+    mPinConflictTimer.setSingleShot(true);
+    mPinConflictTimer.setInterval(200);
+    QObject::connect(&mPinConflictTimer, &QTimer::timeout, this, &Application::OnUpdatePinConflicts);
+    QObject::connect(&mMainWindow, &MainWindow::ConfigurationChangedSignal, &mPinConflictTimer, qOverload<>(&QTimer::start));
+
+    // Changes settling within the interval, e.g. held spin box arrows, are recorded once
+    mRecordChangesTimer.setSingleShot(true);
+    mRecordChangesTimer.setInterval(250);
+    QObject::connect(&mRecordChangesTimer, &QTimer::timeout, this, &Application::OnRecordChanges);
+    QObject::connect(&mRecordChangesTimer, &QTimer::timeout, this, &Application::OnUpdateDirtyFields);
+    QObject::connect(&mMainWindow, &MainWindow::ConfigurationChangedSignal, &mRecordChangesTimer, qOverload<>(&QTimer::start));
+
+    QObject::connect(&mMainWindow, &MainWindow::UndoSignal, this, &Application::OnUndo);
+    QObject::connect(&mMainWindow, &MainWindow::RedoSignal, this, &Application::OnRedo);
+    mUndoHistory.Reset(mMainWindow.TakeSnapshot().ToJson());
+
+    RegisterAutomationHandlers();
+    QObject::connect(&mMainWindow, &MainWindow::AutomationServerToggledSignal, this, &Application::OnToggleAutomationServer);
+    OnToggleAutomationServer(mMainWindow.IsAutomationServerEnabled());
 
     mMainWindow.Log("Reading template data...");
-    mTemplate = ReadTemplateFromFile(QFileInfo(TEMPLATE_PATH));
+    {
+        const TraceSpan templateSpan("ReadTemplateFromFile");
+        mTemplate = ReadTemplateFromFile(QFileInfo(TemplatePack::Directory(mTemplateVersion) + "/" + TEMPLATE_PATH));
+    }
 
     mMainWindow.show();
 
@@ -74,6 +143,8 @@ Application::Application(QObject *parent)
         return;
     }
 
+    mMainWindow.SetTemplateSize(TextBytes(mTemplate.value()));
+
     const auto platformIoVersion = GetPlatformIoVersion();
     if (!platformIoVersion.has_value())
     {
@@ -94,20 +165,37 @@ Application::Application(QObject *parent)
 }
 
 Application::~Application()
-{}
+{
+    // The workers of the automation server and the watchdog use the members, so they stop before any member is destroyed
+    mAutomationServer.Close();
+    mStallWatchdog.Stop();
+
+    if (nullptr != mImpactIndexThread)
+    {
+        mImpactIndexThread->wait();
+    }
+}
 
-void Application::OnGenerate()
+bool Application::OnGenerate()
 {
+    const TraceSpan span("Application::OnGenerate");
+
+    if (!CheckWorkspaceAvailable("generation"))
+    {
+        return false;
+    }
+    const WorkspaceJob job(mWorkspaceJobs);
+
     if (!mFolderInfo.has_value())
     {
         mMainWindow.Log(QString("Configuration failed: No Marlin workspace opened."), "red");
-        return;
+        return false;
     }
 
     if (!QDir(mFolderInfo.value().filePath() + "/Marlin").exists())
     {
         mMainWindow.Log(QString("Configuration failed: Subfolder %0 does not exist.").arg(mFolderInfo.value().filePath() + "/Marlin"), "red");
-        return;
+        return false;
     }
 
     if (mNewWorkspace)
@@ -119,7 +207,7 @@ void Application::OnGenerate()
         msgBox.setIcon(QMessageBox::Warning);
         if (msgBox.exec() == QMessageBox::Cancel)
         {
-            return;
+            return false;
         }
         mNewWorkspace = false;
     }
@@ -134,7 +222,7 @@ void Application::OnGenerate()
     if (!stringList.has_value())
     {
         mMainWindow.Log(QString("Could not generate file %0: no file template loaded.").arg(filePath), "red");
-        return;
+        return false;
     }
 
     QFile file(filePath);
@@ -150,16 +238,25 @@ void Application::OnGenerate()
     else
     {
         mMainWindow.Log(QString("Could not open configuration file %0").arg(filePath), "red");
-        return;
+        return false;
     }
 
     file.close();
 
     mMainWindow.Log(QString("Generation of %0 successful.").arg(filePath), "rgb(249, 154, 0)");
+
+    mChangeTracker.SetGenerated(mMainWindow.TakeSnapshot(), ChangeTracker::HashFile(filePath));
+    OnUpdateDirtyFields();
+
+    mRebuildScopeTimer.start();
+
+    return true;
 }
 
 void Application::OnSaveProject()
 {
+    const TraceSpan span("Application::OnSaveProject");
+
     if (!mFolderInfo.has_value())
     {
         mMainWindow.Log(QString("Saving workspace configuration failed: No Marlin workspace opened."), "red");
@@ -168,8 +265,21 @@ void Application::OnSaveProject()
 
     QFileInfo fileInfo{mFolderInfo.value().filePath() + "/configuration.json"};
 
-    const auto& config = mMainWindow.FetchConfiguration();
-    const auto& json = config.ToJson();
+    const auto configuration = mMainWindow.TakeSnapshot().ToJson();
+    auto json = mMainWindow.IsSparseConfigurationEnabled() ? Configuration::ToSparseJson(configuration) : configuration;
+
+    // A layered profile only stores what differs from its parent
+    if (mProfileParent.has_value())
+    {
+        const auto parent = mProfileResolver.Resolve(QDir(mFolderInfo.value().filePath()).absoluteFilePath(mProfileParent.value()));
+        if (!parent.has_value())
+        {
+            mMainWindow.Log(QString("Saving workspace configuration failed: %0").arg(mProfileResolver.LastError()), "red");
+            return;
+        }
+
+        json = ProfileResolver::MakeLayer(configuration, parent.value().configuration, mProfileParent.value());
+    }
 
     QFile file(fileInfo.filePath());
 
@@ -183,10 +293,24 @@ void Application::OnSaveProject()
 
     file.close();
 
+    // The binary copy only speeds up opening, configuration.json stays the file to share and merge.
+    // A layered profile depends on its parents, so a flattened copy would hide their changes.
+    if (mProfileParent.has_value())
+    {
+        QFile::remove(mFolderInfo.value().filePath() + "/" + BINARY_CONFIGURATION_FILE);
+    }
+    else if (!BinaryConfiguration::WriteFile(mFolderInfo.value().filePath() + "/" + BINARY_CONFIGURATION_FILE, Configuration::ToSparseJson(configuration)))
+    {
+        mMainWindow.Log(QString("Could not write binary workspace configuration %0").arg(BINARY_CONFIGURATION_FILE), "rgb(249, 154, 0)");
+    }
+
     mMainWindow.Log(QString("Saved workspace configuration as %0").arg(fileInfo.filePath()));
 
     mOpenFileInfo = fileInfo;
     mNewWorkspace = false;
+
+    // Saved changes need no recovery, the journal starts over from the saved state
+    mJournal.Open(mFolderInfo.value().filePath(), configuration);
 }
 
 void Application::OnCloseWorkspace()
@@ -200,10 +324,36 @@ void Application::OnCloseWorkspace()
     mMainWindow.Log(QString("Workspace %0 has been closed.").arg(mFolderInfo.value().filePath()));
     mFolderInfo = std::nullopt;
     mNewWorkspace = false;
+
+    mLastEffectiveDefines = std::nullopt;
+    mMainWindow.ShowEffectiveDefines(EffectiveDefines::Macros(), QSet<QString>());
+    mMainWindow.SetEffectiveDefinesStatus("Not evaluated");
+
+    mImpactIndex.reset();
+    mMainWindow.SetRebuildScope(QString(), QString());
+
+    mMainWindow.SetBoardEnvironments(QStringList(), QHash<QString, QStringList>());
+    mMainWindow.SetHardwareCatalogs(QStringList(), QStringList(), QStringList());
+
+    mPinDatabase = PinDatabase();
+    mPinConflicts.Clear();
+    mPinConflicts.TakeChanges();
+    mMainWindow.SetPinConflicts(QString(), QString());
+
+    mRecordChangesTimer.stop();
+    mJournal.Discard();
+
+    mChangeTracker.Clear();
+    mMainWindow.SetDirtyFields(QString(), QString());
+    mProfileParent = std::nullopt;
+    mUndoHistory.Reset(mMainWindow.TakeSnapshot().ToJson());
+    mMainWindow.SetUndoAvailable(false, false);
 }
 
 void Application::OpenConfigurationJson(const QFileInfo& pFilePath)
 {
+    const TraceSpan span("Application::OpenConfigurationJson", pFilePath.filePath());
+
     QFile file(pFilePath.filePath());
 
     if (!file.open(QIODevice::ReadOnly))
@@ -224,7 +374,37 @@ void Application::OpenConfigurationJson(const QFileInfo& pFilePath)
         return;
     }
 
-    if (!mMainWindow.LoadConfigurationFromJson(document.object()))
+    const auto version = document.object().value(CONFIGURATION_SCHEMA_VERSION_KEY).toInt();
+    if (version > CONFIGURATION_SCHEMA_VERSION)
+    {
+        mMainWindow.Log(QString("File %0 was written by a newer version of iMC (schema %1), unknown settings are ignored.").arg(pFilePath.filePath()).arg(version), "rgb(249, 154, 0)");
+    }
+
+    auto json = document.object();
+
+    mProfileParent = std::nullopt;
+    if (ProfileResolver::IsLayered(json))
+    {
+        const auto resolution = mProfileResolver.Resolve(pFilePath.filePath());
+        if (!resolution.has_value())
+        {
+            mMainWindow.Log(QString("Could not resolve profile %0: %1").arg(pFilePath.filePath(), mProfileResolver.LastError()), "red");
+            return;
+        }
+
+        QStringList chain;
+        for (const auto& path : resolution.value().chain)
+        {
+            chain.append(QFileInfo(path).fileName());
+        }
+
+        mMainWindow.Log(QString("Resolved profile %0 (%1 of %2 layers merged)").arg(chain.join(" -> ")).arg(resolution.value().resolvedLayers).arg(chain.size()));
+
+        json = resolution.value().configuration;
+        mProfileParent = document.object().value(PROFILE_PARENT_KEY).toString();
+    }
+
+    if (!mMainWindow.LoadConfigurationFromJson(json))
     {
         mMainWindow.Log(QString("Content of file %0 incomplete, proceed with caution.").arg(pFilePath.filePath()), "red");
     }
@@ -234,10 +414,43 @@ void Application::OpenConfigurationJson(const QFileInfo& pFilePath)
     mMainWindow.JumpToFirstConfigTab();
 }
 
-void Application::OnOpenWorkspace()
+bool Application::OpenConfigurationBinary(const QString& pWorkspacePath)
 {
-    QFileInfo folderInfo;
+    const TraceSpan span("Application::OpenConfigurationBinary", pWorkspacePath);
+
+    const QFileInfo binaryInfo(pWorkspacePath + "/" + BINARY_CONFIGURATION_FILE);
+    const QFileInfo jsonInfo(pWorkspacePath + "/configuration.json");
+
+    // configuration.json edited by hand or by another tool takes precedence
+    if (!binaryInfo.exists() || binaryInfo.lastModified() < jsonInfo.lastModified())
+    {
+        return false;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    const auto configuration = BinaryConfiguration::ReadConfigurationFile(binaryInfo.filePath());
+    if (!configuration.has_value())
+    {
+        mMainWindow.Log(QString("Could not read %0, falling back to configuration.json").arg(binaryInfo.filePath()), "rgb(249, 154, 0)");
+        return false;
+    }
+
+    if (!mMainWindow.LoadConfiguration(configuration.value()))
+    {
+        mMainWindow.Log(QString("Content of file %0 incomplete, proceed with caution.").arg(binaryInfo.filePath()), "red");
+    }
+
+    mMainWindow.Log(QString("Fetched configuration from file %0 in %1 ms").arg(binaryInfo.filePath()).arg(timer.elapsed()));
+
+    mMainWindow.JumpToFirstConfigTab();
+
+    return true;
+}
 
+void Application::OnOpenWorkspace()
+{
     QString folderName = QFileDialog::getExistingDirectory(&mMainWindow, tr("Open Workspace..."), QDir::homePath());
 
     if (folderName.isEmpty())
@@ -245,7 +458,14 @@ void Application::OnOpenWorkspace()
         return;
     }
 
-    folderInfo = QFileInfo(folderName);
+    OpenWorkspace(folderName);
+}
+
+void Application::OpenWorkspace(const QString& pFolderName)
+{
+    const TraceSpan span("Application::OpenWorkspace", pFolderName);
+
+    const QFileInfo folderInfo(pFolderName);
 
     if (!QFile(folderInfo.filePath() + "/platformio.ini").exists())
     {
@@ -253,26 +473,53 @@ void Application::OnOpenWorkspace()
         return;
     }
 
+    if (!SelectTemplatePack(folderInfo.filePath()))
+    {
+        return;
+    }
+
+    // New items must exist before the stored configuration selects them
+    LoadHardwareCatalogs(folderInfo.filePath());
+    LoadEnvironmentIndex(folderInfo.filePath());
+    mChangeTracker.Load(folderInfo.filePath());
+    mProfileParent = std::nullopt;
+
     if (!QFile(folderInfo.filePath() + "/configuration.json").exists())
     {
-        mMainWindow.Log("This workspace is not yet configured for use with iMC. Workspace configuration is set to default. Please make sure not to loose existing configuration data.", "red");
+        if (!ImportConfigurationHeader(folderInfo.filePath()))
+        {
+            mMainWindow.Log("This workspace is not yet configured for use with iMC. Workspace configuration is set to default. Please make sure not to loose existing configuration data.", "red");
+        }
         mNewWorkspace = true;
     }
-    else
+    else if (!OpenConfigurationBinary(folderInfo.filePath()))
     {
         OpenConfigurationJson(QFileInfo(folderInfo.filePath() + "/configuration.json"));
     }
 
+    RecoverJournal(folderInfo.filePath());
+
+    // Loading a workspace cannot be undone
+    mRecordChangesTimer.stop();
+    mUndoHistory.Reset(mMainWindow.TakeSnapshot().ToJson());
+    mMainWindow.SetUndoAvailable(false, false);
+
     mMainWindow.Log(QString("Opened Marlin workspace %0").arg(folderInfo.filePath()));
 
     mFolderInfo = folderInfo;
 
     mMainWindow.SetWorkspace(folderInfo.filePath());
     mMainWindow.OnWorkspaceOpened();
+
+    LoadImpactIndex();
+    mPinConflictTimer.start();
+    OnUpdateDirtyFields();
 }
 
 std::optional<QStringList> Application::GenerateCode()
 {
+    const TraceSpan span("Application::GenerateCode");
+
     if (mTemplate.has_value())
     {
         QStringList output = mTemplate.value();
@@ -286,26 +533,17 @@ std::optional<QStringList> Application::GenerateCode()
 
 void Application::OnBuildMarlin(const QString& pEnvironment)
 {
-    QMessageBox msgBox;
-    msgBox.setText("Regenerate the configuration before building?");
-    msgBox.setInformativeText("Marlin is built using the most recently generated configuration. This may not match the configuration currently displayed in the software.");
-    msgBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No | QMessageBox::Cancel);
-    msgBox.setIcon(QMessageBox::Question);
-    switch (msgBox.exec())
+    const TraceSpan span("Application::OnBuildMarlin", pEnvironment);
+
+    if (!CheckWorkspaceAvailable("build"))
     {
-        case QMessageBox::Yes:
-        {
-            OnGenerate();
-            break;
-        }
-        case QMessageBox::Cancel:
-        {
-            return;
-        }
-        default:
-        {
-            break;
-        }
+        return;
+    }
+    const WorkspaceJob job(mWorkspaceJobs);
+
+    if (!RegenerateIfChanged("building"))
+    {
+        return;
     }
 
     mMainWindow.ActivateCancelButton();
@@ -315,83 +553,42 @@ void Application::OnBuildMarlin(const QString& pEnvironment)
         return;
     }
 
-    mBuildSuccess = false;
-
-    QProcess process;
-    process.start("C:\\Windows\\system32\\cmd.exe");
-
-    if (false == process.waitForStarted())
+    if (!ConfirmEnvironment(pEnvironment))
     {
+        mMainWindow.DeactivateCancelButton();
         return;
     }
 
-    process.write(QString("cd %0\n").arg(mFolderInfo.value().filePath()).toLocal8Bit());
-
-    QObject::connect(&process, &QProcess::readyReadStandardOutput, this, [&](){
-        auto stream = QTextStream(process.readAllStandardOutput());
-        while (!stream.atEnd())
-        {
-            const auto& line = stream.readLine();
-
-            if (line.size() <= 2)
-            {
-                continue;
-            }
-
-            if (line.endsWith(">"))
-            {
-                mCurrent = line;
-                continue;
-            }
-
-            if (line.contains(">platformio"))
-            {
-                auto list = line.split(">");
-                mMainWindow.CompilerLog(list[0] + ">", list[1]);
-
-                continue;
-            }
-
-            if  (line.contains("1 succeeded"))
-            {
-                mBuildSuccess = true;
-            }
-
-            mMainWindow.CompilerLog(mCurrent, line);
-            mCurrent.clear();
-        }
-    });
-
-    QObject::connect(&process, &QProcess::readyReadStandardError, this, [&](){
-        auto stream = QTextStream(process.readAllStandardError());
-        while (!stream.atEnd())
-        {
-            mMainWindow.CompilerLog(std::nullopt, stream.readLine(), "red");
-        }
-    });
-
-    mMainWindow.Log(QString("Starting build for environment %0...").arg(pEnvironment));
-
-    process.write(QString("platformio run -e %0\n").arg(pEnvironment).toLocal8Bit());
+    const auto cacheKey = ComputeArtifactKey(pEnvironment);
 
-    process.write("exit\n");
+    if (mArtifactCache.Restore(cacheKey, mFolderInfo.value().filePath(), pEnvironment))
+    {
+        mMainWindow.Log(QString("Build inputs unchanged, reusing cached firmware %0 for environment %1.").arg(cacheKey.left(12), pEnvironment), "rgb(249, 154, 0)");
+        mBuildSuccess = true;
+        RecordBuild(pEnvironment);
+        mMainWindow.DeactivateCancelButton();
+        return;
+    }
 
-    while(process.state() == QProcess::ProcessState::Running)
+    if (!RunPreflight())
     {
-        QCoreApplication::processEvents();
-        if (mMainWindow.IsBuildCanceled())
-        {
-            process.close();
-        }
+        mMainWindow.DeactivateCancelButton();
+        return;
     }
 
-    process.waitForFinished();
-    process.close();
+    mMainWindow.Log(QString("Starting build for environment %0...").arg(pEnvironment));
+
+    RunPlatformIoCompile(QString("run -e %0").arg(pEnvironment));
 
-    mMainWindow.CompilerLog(std::nullopt, "");
     if (mBuildSuccess)
     {
         mMainWindow.Log("Build successful.", "rgb(249, 154, 0)");
+        RecordBuild(pEnvironment);
+
+        if (mArtifactCache.Store(cacheKey, mFolderInfo.value().filePath(), pEnvironment))
+        {
+            mMainWindow.Log(QString("Stored firmware in cache as %0.").arg(cacheKey.left(12)));
+        }
     }
     else if (mMainWindow.IsBuildCanceled())
     {
@@ -407,6 +604,14 @@ void Application::OnBuildMarlin(const QString& pEnvironment)
 
 bool Application::OnClean(const QString& pEnvironment)
 {
+    const TraceSpan span("Application::OnClean", pEnvironment);
+
+    if (!CheckWorkspaceAvailable("cleaning"))
+    {
+        return false;
+    }
+    const WorkspaceJob job(mWorkspaceJobs);
+
     mMainWindow.ActivateCancelButton();
     if (!mFolderInfo.has_value())
     {
@@ -414,107 +619,1251 @@ bool Application::OnClean(const QString& pEnvironment)
         return false;
     }
 
-    mBuildSuccess = false;
+    mMainWindow.Log(QString("Starting clean for environment %0...").arg(pEnvironment));
 
-    QProcess process;
-    process.start("C:\\Windows\\system32\\cmd.exe");
+    RunPlatformIo(QString("run --target clean -e %0").arg(pEnvironment));
 
-    if (false == process.waitForStarted())
+    if (mBuildSuccess)
+    {
+        mMainWindow.Log("Cleaning successful.", "rgb(249, 154, 0)");
+        mMainWindow.DeactivateCancelButton();
+        return true;
+    }
+    else if (mMainWindow.IsBuildCanceled())
     {
+        mMainWindow.Log("Cleaning canceled.", "red");
+        mMainWindow.DeactivateCancelButton();
         return false;
     }
-
-    if (mFolderInfo.has_value())
+    else
     {
-        process.write(QString("cd %0\n").arg(mFolderInfo.value().filePath()).toLocal8Bit());
+        mMainWindow.Log("Cleaning failed. See compiler outputs for more details.", "red");
+        mMainWindow.DeactivateCancelButton();
+        return false;
     }
+}
 
-    QObject::connect(&process, &QProcess::readyReadStandardOutput, this, [&](){
-        auto stream = QTextStream(process.readAllStandardOutput());
-        while (!stream.atEnd())
-        {
-            const auto& line = stream.readLine();
-
-            if (line.size() <= 2)
-            {
-                continue;
-            }
+void Application::OnUpload(const QString& pEnvironment)
+{
+    const TraceSpan span("Application::OnUpload", pEnvironment);
 
-            if (line.endsWith(">"))
-            {
-                mCurrent = line;
-                continue;
-            }
+    if (!CheckWorkspaceAvailable("upload"))
+    {
+        return;
+    }
+    const WorkspaceJob job(mWorkspaceJobs);
 
-            if (line.contains(">platformio"))
-            {
-                auto list = line.split(">");
-                mMainWindow.CompilerLog(list[0] + ">", list[1]);
+    if (!RegenerateIfChanged("uploading"))
+    {
+        return;
+    }
 
-                continue;
+    mMainWindow.ActivateCancelButton();
+    if (!mFolderInfo.has_value())
+    {
+        mMainWindow.Log("Could not start upload: No Marlin workspace opened.", "red");
+        return;
+    }
+
+    if (!ConfirmEnvironment(pEnvironment))
+    {
+        mMainWindow.DeactivateCancelButton();
+        return;
+    }
+
+    const auto cacheKey = ComputeArtifactKey(pEnvironment);
+
+    if (mArtifactCache.Restore(cacheKey, mFolderInfo.value().filePath(), pEnvironment))
+    {
+        // The nobuild target makes PlatformIO upload the restored image without compiling
+        mMainWindow.Log(QString("Build inputs unchanged, uploading cached firmware %0 for environment %1...").arg(cacheKey.left(12), pEnvironment));
+
+        RunPlatformIo(QString("run --target nobuild --target upload -e %0").arg(pEnvironment));
+    }
+    else
+    {
+        if (!RunPreflight())
+        {
+            mMainWindow.DeactivateCancelButton();
+            return;
+        }
+
+        mMainWindow.Log(QString("Starting upload for environment %0...").arg(pEnvironment));
+
+        RunPlatformIoCompile(QString("run --target upload -e %0").arg(pEnvironment));
+
+        if (mBuildSuccess)
+        {
+            mArtifactCache.Store(cacheKey, mFolderInfo.value().filePath(), pEnvironment);
+        }
+    }
+
+    if (mBuildSuccess)
+    {
+        mMainWindow.Log("Upload successful.", "rgb(249, 154, 0)");
+        RecordBuild(pEnvironment);
+    }
+    else if (mMainWindow.IsBuildCanceled())
+    {
+        mMainWindow.Log("Upload canceled.", "red");
+    }
+    else
+    {
+        mMainWindow.Log("Upload failed. See compiler outputs for more details.", "red");
+    }
+
+    mMainWindow.DeactivateCancelButton();
+}
+
+void Application::OnClearFirmwareCache()
+{
+    mArtifactCache.Clear();
+    mMainWindow.Log("Firmware cache cleared.", "rgb(249, 154, 0)");
+}
+
+void Application::OnEvaluateEffectiveDefines()
+{
+    const TraceSpan span("Application::OnEvaluateEffectiveDefines");
+
+    if (!mFolderInfo.has_value() || !mMainWindow.IsEffectiveDefinesVisible())
+    {
+        return;
+    }
+
+    if (IsRunningInBackground(BackgroundJob::EffectiveDefines))
+    {
+        mEffectiveDefinesTimer.start(); // Evaluate the latest changes after the running evaluation
+        return;
+    }
+
+    if (!HostPreprocessor::FindCompiler().has_value())
+    {
+        mMainWindow.SetEffectiveDefinesStatus("No host compiler found");
+        return;
+    }
+
+    const auto code = GenerateCode();
+    if (!code.has_value())
+    {
+        mMainWindow.SetEffectiveDefinesStatus("No template loaded");
+        return;
+    }
+
+    mMainWindow.SetEffectiveDefinesStatus("Evaluating...");
+
+    QElapsedTimer timer;
+    timer.start();
+
+    const auto workspacePath = mFolderInfo.value().filePath();
+
+    std::optional<EffectiveDefines::Macros> macros;
+    RunInBackground(BackgroundJob::EffectiveDefines, [this, &workspacePath, &code, &macros](){
+        macros = mEffectiveDefines.Evaluate(workspacePath, code.value());
+    });
+
+    if (!macros.has_value())
+    {
+        mMainWindow.SetEffectiveDefinesStatus("Evaluation failed");
+        return;
+    }
+
+    const auto changed = mLastEffectiveDefines.has_value() ? EffectiveDefines::Diff(mLastEffectiveDefines.value(), macros.value()) : QSet<QString>();
+
+    mMainWindow.ShowEffectiveDefines(macros.value(), changed);
+    mMainWindow.SetEffectiveDefinesStatus(QString("%0 macros, %1 changed (%2 ms)").arg(macros->size()).arg(changed.size()).arg(timer.elapsed()));
+
+    mLastEffectiveDefines = macros;
+}
+
+void Application::OnUpdateRebuildScope()
+{
+    const TraceSpan span("Application::OnUpdateRebuildScope");
+
+    if (!mFolderInfo.has_value() || !mImpactIndex)
+    {
+        return;
+    }
+
+    const auto code = GenerateCode();
+    if (!code.has_value())
+    {
+        return;
+    }
+
+    // The Configuration.h in the workspace is the one that was generated last
+    QStringList generated;
+    QFile file(mFolderInfo.value().filePath() + "/Marlin/Configuration.h");
+    if (file.open(QFile::ReadOnly | QFile::Text))
+    {
+        generated = QString::fromUtf8(file.readAll()).split('\n');
+    }
+
+    const auto changed = EffectiveDefines::Diff(ImpactIndex::ExtractDefines(generated), ImpactIndex::ExtractDefines(code.value()));
+
+    if (changed.isEmpty())
+    {
+        mMainWindow.SetRebuildScope("No pending changes", QString());
+        return;
+    }
+
+    const auto units = mImpactIndex->AffectedTranslationUnits(changed);
+
+    auto changedNames = changed.values();
+    changedNames.sort();
+
+    mMainWindow.SetRebuildScope(QString("Pending changes: %0 defines, %1 of %2 files to recompile").arg(changed.size()).arg(units.size()).arg(mImpactIndex->TranslationUnitCount()),
+                                QString("Changed defines:\n%0\n\nAffected files:\n%1").arg(changedNames.mid(0, 20).join('\n'), units.mid(0, 20).join('\n')));
+}
+
+void Application::OnUpdatePinConflicts()
+{
+    const TraceSpan span("Application::OnUpdatePinConflicts");
+
+    if (!mFolderInfo.has_value())
+    {
+        return;
+    }
+
+    const auto workspace = mFolderInfo.value().filePath();
+    const auto motherboard = mMainWindow.GetMotherboard();
+
+    if (mPinDatabase.Source() != QString("%0:%1").arg(workspace, motherboard))
+    {
+        // Conflicts of the previous motherboard are dropped without reporting them as resolved
+        mPinConflicts.Clear();
+        mPinConflicts.TakeChanges();
+
+        if (!mPinDatabase.Load(workspace, motherboard))
+        {
+            mMainWindow.Log(QString("Could not resolve the pins of %0, pin conflicts are not checked.").arg(motherboard), "rgb(249, 154, 0)");
+            mMainWindow.SetPinConflicts(QString(), QString());
+            return;
+        }
+
+        mMainWindow.Log(QString("Indexed %0 pins of %1 (%2).").arg(mPinDatabase.Pins().size()).arg(motherboard, mPinDatabase.PinsFile()));
+    }
+
+    if (!mPinDatabase.IsReady())
+    {
+        return;
+    }
+
+    const auto snapshot = mMainWindow.TakeSnapshot();
+
+    const auto claim = [&](QHash<QString, QString>& pClaims, const QString& pName)
+    {
+        const auto pin = mPinDatabase.Pin(pName);
+        if (!pin.isEmpty())
+        {
+            pClaims.insert(pName, pin);
+        }
+    };
+
+    // Pins every printer uses
+    QHash<QString, QString> board;
+    for (const auto& axis : QStringList{"X", "Y", "Z", "E0"})
+    {
+        claim(board, axis + "_STEP_PIN");
+        claim(board, axis + "_DIR_PIN");
+        claim(board, axis + "_ENABLE_PIN");
+    }
+    claim(board, "HEATER_0_PIN");
+    claim(board, "HEATER_BED_PIN");
+    claim(board, "FAN_PIN");
+    mPinConflicts.SetClaims("Motion and heaters", board);
+
+    QHash<QString, QString> endstops;
+    const auto endstopsJson = snapshot.PageJson(ConfigurationSnapshot::PageIndex("endstops").value());
+    for (const auto& axis : QStringList{"X", "Y", "Z", "I", "J", "K", "U", "V", "W"})
+    {
+        for (const auto& side : QStringList{"MIN", "MAX"})
+        {
+            if (endstopsJson[QString("USE_%0%1_PLUG").arg(axis, side)].toBool())
+            {
+                claim(endstops, QString("%0_%1_PIN").arg(axis, side));
+            }
+        }
+    }
+    mPinConflicts.SetClaims("Endstops", endstops);
+
+    // The configuration template defines Z_MIN_PROBE_USES_Z_MIN_ENDSTOP_PIN
+    QHash<QString, QString> probe;
+    const auto& leveling = snapshot.Page<BedLevelingConfiguration>();
+    if (leveling.AUTO_BED_LEVELING_3POINT || leveling.AUTO_BED_LEVELING_LINEAR || leveling.AUTO_BED_LEVELING_BILINEAR || leveling.AUTO_BED_LEVELING_UBL)
+    {
+        claim(probe, "Z_MIN_PIN");
+    }
+    mPinConflicts.SetClaims("Probe", probe);
+
+    QHash<QString, QString> runout;
+    if (snapshot.Page<FilamentRunoutSensorConfiguration>().FILAMENT_RUNOUT_SENSOR)
+    {
+        const auto sensors = snapshot.Page<FilamentRunoutSensorConfiguration>().NUM_RUNOUT_SENSORS.toInt();
+        claim(runout, "FIL_RUNOUT_PIN");
+        for (auto i = 2; i <= sensors; ++i)
+        {
+            claim(runout, QString("FIL_RUNOUT%0_PIN").arg(i));
+        }
+    }
+    mPinConflicts.SetClaims("Filament runout sensor", runout);
+
+    QHash<QString, QString> powerSupply;
+    if (snapshot.Page<PowerSupplyConfiguration>().PSU_CONTROL)
+    {
+        claim(powerSupply, "PS_ON_PIN");
+    }
+    mPinConflicts.SetClaims("Power supply", powerSupply);
+
+    const auto changes = mPinConflicts.TakeChanges();
+    for (const auto& conflict : changes.added)
+    {
+        mMainWindow.Log(QString("Pin conflict on pin %0: %1").arg(conflict.pin, conflict.users.join(", ")), "rgb(249, 154, 0)");
+    }
+    for (const auto& pin : changes.resolved)
+    {
+        mMainWindow.Log(QString("Pin conflict on pin %0 resolved.").arg(pin));
+    }
+
+    const auto conflicts = mPinConflicts.Conflicts();
+    if (conflicts.isEmpty())
+    {
+        mMainWindow.SetPinConflicts("No pin conflicts", QString("Pins file: %0").arg(mPinDatabase.PinsFile()));
+        return;
+    }
+
+    QStringList details;
+    for (const auto& conflict : conflicts)
+    {
+        details.append(QString("Pin %0: %1").arg(conflict.pin, conflict.users.join(", ")));
+    }
+    mMainWindow.SetPinConflicts(QString("Pin conflicts: %0").arg(conflicts.size()), details.join('\n'));
+}
+
+bool Application::SelectTemplatePack(const QString& pWorkspacePath)
+{
+    const auto workspaceVersion = TemplateCompatibility::ReadMarlinVersion(pWorkspacePath);
+    const auto version = TemplatePack::SelectVersion(workspaceVersion.value_or(mTemplateVersion)).value_or(mTemplateVersion);
+
+    // Only the configuration template of the selected pack is read, page templates follow on demand
+    const auto directory = TemplatePack::Directory(version);
+    const auto configurationTemplate = (version == mTemplateVersion) ? mTemplate : ReadTemplateFromFile(QFileInfo(directory + "/" + TEMPLATE_PATH));
+
+    if (!configurationTemplate.has_value())
+    {
+        mMainWindow.Log(QString("Could not load the template pack for Marlin v%0.").arg(version), "red");
+        return true;
+    }
+
+    if (!CheckTemplateCompatibility(pWorkspacePath, configurationTemplate.value(), version))
+    {
+        return false;
+    }
+
+    if (version != mTemplateVersion)
+    {
+        mTemplate = configurationTemplate;
+        mTemplateVersion = version;
+        mMainWindow.SetTemplateSize(configurationTemplate.has_value() ? TextBytes(configurationTemplate.value()) : 0);
+        mMainWindow.SetTemplatePack(directory, version);
+        mMainWindow.Log(QString("Using the template pack for Marlin v%0.").arg(version));
+    }
+
+    return true;
+}
+
+bool Application::CheckTemplateCompatibility(const QString& pWorkspacePath, const QStringList& pTemplate, const QString& pMarlinVersion)
+{
+    const auto report = TemplateCompatibility::Check(pWorkspacePath, pTemplate);
+    if (!report.has_value())
+    {
+        mMainWindow.Log("Could not check template compatibility: Marlin/Configuration.h not found.", "red");
+        return true;
+    }
+
+    if (report->IsCompatible(pMarlinVersion))
+    {
+        mMainWindow.Log(QString("Workspace matches the configuration template for Marlin v%0 (checked in %1 ms).").arg(pMarlinVersion).arg(report->elapsedMs));
+        return true;
+    }
+
+    constexpr auto maxListedNames = 10;
+
+    const auto workspaceVersion = report->workspaceVersion.isEmpty() ? QString("an unknown version") : QString("v%0").arg(report->workspaceVersion);
+
+    mMainWindow.Log(QString("Workspace is Marlin %0, the configuration template was made for v%1.").arg(workspaceVersion, pMarlinVersion), "red");
+
+    if (report->workspaceConfigurationVersion != report->templateConfigurationVersion)
+    {
+        mMainWindow.Log(QString("CONFIGURATION_H_VERSION differs: workspace %0, template %1.").arg(report->workspaceConfigurationVersion, report->templateConfigurationVersion), "red");
+    }
+
+    if (!report->unknownTags.isEmpty())
+    {
+        mMainWindow.Log(QString("%0 template defines are unknown to the workspace: %1").arg(report->unknownTags.size()).arg(report->unknownTags.mid(0, maxListedNames).join(", ")), "red");
+    }
+
+    if (!report->untemplatedDefines.isEmpty())
+    {
+        mMainWindow.Log(QString("%0 workspace defines are missing from the template: %1").arg(report->untemplatedDefines.size()).arg(report->untemplatedDefines.mid(0, maxListedNames).join(", ")), "red");
+    }
+
+    QMessageBox msgBox;
+    msgBox.setText(QString("This workspace is Marlin %0, but iMC's configuration template was made for v%1.").arg(workspaceVersion, pMarlinVersion));
+    msgBox.setInformativeText(QString("%0 template defines are unknown to the workspace and %1 workspace defines are missing from the template. A generated configuration may not compile or may silently drop settings. Open the workspace anyway?")
+                              .arg(report->unknownTags.size()).arg(report->untemplatedDefines.size()));
+    msgBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No);
+    msgBox.setDefaultButton(QMessageBox::No);
+    msgBox.setIcon(QMessageBox::Warning);
+
+    return msgBox.exec() == QMessageBox::Yes;
+}
+
+std::array<QStringList, 3> Application::ReadHardwareCatalogs(const QString& pWorkspacePath, QStringList& pUnreadable, int32_t& pParsedHeaders)
+{
+    std::array<QStringList, 3> items;
+
+    const std::array<HardwareCatalog::Kind, 3> kinds{HardwareCatalog::Kind::Motherboards, HardwareCatalog::Kind::Thermistors, HardwareCatalog::Kind::Drivers};
+    for (size_t i = 0; i < kinds.size(); ++i)
+    {
+        const auto entries = mHardwareCatalog.Load(pWorkspacePath, kinds[i]);
+        if (!entries.has_value())
+        {
+            pUnreadable.append(HardwareCatalog::HeaderPath(kinds[i]));
+            continue;
+        }
+
+        if (!mHardwareCatalog.WasCached())
+        {
+            ++pParsedHeaders;
+        }
+
+        for (const auto& entry : entries.value())
+        {
+            // Driver types are listed by name only, all other items carry their identifier in square brackets
+            items[i].append(kinds[i] == HardwareCatalog::Kind::Drivers ? entry.id : QString("%0 [%1]").arg(entry.description, entry.id));
+        }
+    }
+
+    return items;
+}
+
+void Application::LoadHardwareCatalogs(const QString& pWorkspacePath)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    QStringList unreadable;
+    int32_t parsedHeaders = 0;
+    const auto items = ReadHardwareCatalogs(pWorkspacePath, unreadable, parsedHeaders);
+
+    for (const auto& header : unreadable)
+    {
+        mMainWindow.Log(QString("Could not read %0, the built-in list is used.").arg(header), "rgb(249, 154, 0)");
+    }
+
+    const auto added = mMainWindow.SetHardwareCatalogs(items[0], items[1], items[2]);
+
+    mMainWindow.Log(QString("Hardware catalogs: %0 motherboards, %1 thermistor types, %2 driver types, %3 new (%4 header(s) parsed, %5 ms)")
+                    .arg(items[0].size()).arg(items[1].size()).arg(items[2].size()).arg(added).arg(parsedHeaders).arg(timer.elapsed()));
+}
+
+bool Application::ImportConfigurationHeader(const QString& pWorkspacePath)
+{
+    const auto headerPath = pWorkspacePath + "/Marlin/Configuration.h";
+    if (!QFile::exists(headerPath))
+    {
+        return false;
+    }
+
+    QMessageBox msgBox;
+    msgBox.setText("Import the existing Marlin configuration?");
+    msgBox.setInformativeText("This workspace has no configuration.json yet. iMC can take over the settings of Marlin/Configuration.h instead of starting from the defaults. Defines without a matching setting are listed in the console.");
+    msgBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No);
+    msgBox.setIcon(QMessageBox::Question);
+    if (msgBox.exec() != QMessageBox::Yes)
+    {
+        return false;
+    }
+
+    const auto result = ConfigurationImporter::ImportFile(headerPath);
+    if (!result.success)
+    {
+        mMainWindow.Log(QString("Could not import %0.").arg(headerPath), "red");
+        return false;
+    }
+
+    mMainWindow.LoadConfigurationFromJson(result.configuration);
+
+    mMainWindow.Log(QString("Imported %0 settings from %1.").arg(result.mapped).arg(headerPath), "rgb(249, 154, 0)");
+    if (!result.unmapped.isEmpty())
+    {
+        mMainWindow.Log(QString("%0 active defines have no iMC setting and are lost when generating: %1").arg(result.unmapped.size()).arg(result.unmapped.join(", ")), "rgb(249, 154, 0)");
+    }
+    if (!result.invalid.isEmpty())
+    {
+        mMainWindow.Log(QString("%0 values could not be converted and were reset to default: %1").arg(result.invalid.size()).arg(result.invalid.join(", ")), "rgb(249, 154, 0)");
+    }
+
+    return true;
+}
+
+void Application::RecoverJournal(const QString& pWorkspacePath)
+{
+    const auto recovery = ConfigurationJournal::Recover(pWorkspacePath);
+    const auto current = mMainWindow.TakeSnapshot().ToJson();
+
+    if (recovery.has_value() && Configuration::ToSparseJson(Configuration::ExpandSparseJson(recovery.value().configuration)) != Configuration::ToSparseJson(current))
+    {
+        QMessageBox msgBox;
+        msgBox.setText("Restore unsaved changes?");
+        msgBox.setInformativeText(QString("The last session ended without saving this workspace. %0 changes up to %1 can be restored, otherwise they are discarded.")
+                                      .arg(recovery.value().changes).arg(QLocale().toString(recovery.value().lastChange, QLocale::ShortFormat)));
+        msgBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No);
+        msgBox.setIcon(QMessageBox::Question);
+        if (msgBox.exec() == QMessageBox::Yes)
+        {
+            mMainWindow.LoadConfigurationFromJson(recovery.value().configuration);
+            mMainWindow.Log(QString("Restored %0 unsaved changes of the last session.").arg(recovery.value().changes), "rgb(249, 154, 0)");
+        }
+    }
+
+    if (!mJournal.Open(pWorkspacePath, mMainWindow.TakeSnapshot().ToJson()))
+    {
+        mMainWindow.Log("Could not create the autosave journal, unsaved changes are lost if iMC terminates unexpectedly.", "rgb(249, 154, 0)");
+    }
+}
+
+void Application::OnRecordChanges()
+{
+    const TraceSpan span("Application::OnRecordChanges");
+
+    const auto json = mMainWindow.TakeSnapshot().ToJson();
+
+    if (mUndoHistory.Record(json))
+    {
+        mMainWindow.SetUndoAvailable(mUndoHistory.CanUndo(), mUndoHistory.CanRedo());
+    }
+
+    if (mJournal.IsOpen())
+    {
+        mJournal.Record(json);
+    }
+}
+
+void Application::OnUndo()
+{
+    // Changes still waiting for the timer belong to the step to undo
+    if (mRecordChangesTimer.isActive())
+    {
+        mRecordChangesTimer.stop();
+        OnRecordChanges();
+    }
+
+    const auto changes = mUndoHistory.Undo();
+    if (changes.has_value() && !mMainWindow.ApplyConfigurationChanges(changes.value()))
+    {
+        mMainWindow.Log("Undo: Not all fields could be restored, please check the configuration.", "rgb(249, 154, 0)");
+    }
+
+    mMainWindow.SetUndoAvailable(mUndoHistory.CanUndo(), mUndoHistory.CanRedo());
+}
+
+void Application::OnRedo()
+{
+    if (mRecordChangesTimer.isActive())
+    {
+        mRecordChangesTimer.stop();
+        OnRecordChanges();
+    }
+
+    const auto changes = mUndoHistory.Redo();
+    if (changes.has_value() && !mMainWindow.ApplyConfigurationChanges(changes.value()))
+    {
+        mMainWindow.Log("Redo: Not all fields could be restored, please check the configuration.", "rgb(249, 154, 0)");
+    }
+
+    mMainWindow.SetUndoAvailable(mUndoHistory.CanUndo(), mUndoHistory.CanRedo());
+}
+
+void Application::OnImportConfigurations()
+{
+    if (IsRunningInBackground(BackgroundJob::ImportConfigurations))
+    {
+        mMainWindow.Log("Could not import configurations: Another import is running.", "red");
+        return;
+    }
+
+    const auto folderName = QFileDialog::getExistingDirectory(&mMainWindow, tr("Import Configurations..."), QDir::homePath());
+    if (folderName.isEmpty())
+    {
+        return;
+    }
+
+    QStringList paths;
+    QDirIterator it(folderName, QStringList{"Configuration.h"}, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext())
+    {
+        paths.append(it.next());
+    }
+
+    if (paths.isEmpty())
+    {
+        mMainWindow.Log(QString("No Configuration.h files found below %0.").arg(folderName), "red");
+        return;
+    }
+
+    mMainWindow.Log(QString("Importing %0 configurations...").arg(paths.size()));
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QList<ConfigurationImporter::Result> results;
+
+    mMainWindow.SetImportAvailable(false);
+    RunInBackground(BackgroundJob::ImportConfigurations, [&paths, &results](){ results = ConfigurationImporter::ImportFiles(paths); });
+    mMainWindow.SetImportAvailable(true);
+
+    // Existing configuration.json files are never overwritten
+    int32_t imported = 0;
+    int32_t skipped = 0;
+    QStringList report;
+    for (const auto& result : results)
+    {
+        const auto jsonPath = ConfigurationImporter::ConfigurationJsonPath(result.path);
+
+        if (!result.success)
+        {
+            report.append(QString("FAILED\t%0").arg(result.path));
+            continue;
+        }
+
+        if (QFile::exists(jsonPath))
+        {
+            ++skipped;
+            report.append(QString("SKIPPED\t%0\t%1 exists").arg(result.path, jsonPath));
+            continue;
+        }
+
+        QFile file(jsonPath);
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            report.append(QString("FAILED\t%0\tcould not write %1").arg(result.path, jsonPath));
+            continue;
+        }
+        file.write(QJsonDocument(mMainWindow.IsSparseConfigurationEnabled() ? Configuration::ToSparseJson(result.configuration) : result.configuration).toJson());
+        ++imported;
+
+        report.append(QString("IMPORTED\t%0\t%1 settings\tunmapped: %2\tinvalid: %3").arg(result.path).arg(result.mapped).arg(result.unmapped.join(' '), result.invalid.join("; ")));
+    }
+
+    const auto reportPath = folderName + "/imc_import_report.txt";
+    QFile reportFile(reportPath);
+    if (reportFile.open(QIODevice::WriteOnly | QIODevice::Text))
+    {
+        reportFile.write(report.join('\n').toUtf8());
+    }
+
+    mMainWindow.Log(QString("Imported %0 of %1 configurations in %2 ms, %3 skipped because a configuration.json exists. See %4 for unmapped defines.")
+                    .arg(imported).arg(paths.size()).arg(timer.elapsed()).arg(skipped).arg(reportPath), "rgb(249, 154, 0)");
+}
+
+void Application::OnQueryFleet()
+{
+    if (IsRunningInBackground(BackgroundJob::FleetRefresh))
+    {
+        mMainWindow.Log("Could not query the fleet: The fleet catalog is being refreshed.", "red");
+        return;
+    }
+
+    auto roots = QSettings().value("fleet/roots").toStringList();
+    if (roots.isEmpty())
+    {
+        OnAddFleetFolder();
+        roots = QSettings().value("fleet/roots").toStringList();
+        if (roots.isEmpty())
+        {
+            return;
+        }
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    FleetCatalog::RefreshResult refresh{};
+
+    mMainWindow.SetFleetQueryAvailable(false);
+    RunInBackground(BackgroundJob::FleetRefresh, [this, &roots, &refresh](){ refresh = mFleetCatalog.Refresh(roots); });
+    mMainWindow.SetFleetQueryAvailable(true);
+
+    mMainWindow.Log(QString("Fleet catalog: %0 workspaces, %1 indexed, %2 removed in %3 ms")
+                    .arg(refresh.workspaces).arg(refresh.indexed).arg(refresh.removed).arg(timer.elapsed()));
+    for (const auto& workspacePath : refresh.failed)
+    {
+        mMainWindow.Log(QString("Fleet catalog: Could not resolve the configuration of %0").arg(workspacePath), "rgb(249, 154, 0)");
+    }
+
+    bool accepted = false;
+    const auto query = QInputDialog::getText(&mMainWindow, tr("Query Fleet..."),
+                                             tr("Conditions joined by \"and\", e.g. PIDTEMPBED == off and GRID_MAX_POINTS_X > 7:"),
+                                             QLineEdit::Normal, QSettings().value("fleet/lastQuery").toString(), &accepted);
+    if (!accepted || query.trimmed().isEmpty())
+    {
+        return;
+    }
+    QSettings().setValue("fleet/lastQuery", query);
+
+    const auto matches = mFleetCatalog.Query(query);
+    if (!matches.has_value())
+    {
+        mMainWindow.Log(QString("Fleet query failed: %0").arg(mFleetCatalog.LastError()), "red");
+        return;
+    }
+
+    mMainWindow.Log(QString("Fleet query \"%0\" matches %1 of %2 workspaces").arg(query).arg(matches.value().size()).arg(mFleetCatalog.Size()));
+
+    QStringList items;
+    for (const auto& match : matches.value())
+    {
+        items.append(QString("%0    (%1)").arg(match.workspacePath, match.values.join(", ")));
+        mMainWindow.Log(items.last());
+    }
+
+    if (items.isEmpty())
+    {
+        return;
+    }
+
+    const auto item = QInputDialog::getItem(&mMainWindow, tr("Query Fleet..."), tr("Open workspace:"), items, 0, false, &accepted);
+    if (accepted)
+    {
+        OpenWorkspace(matches.value().at(items.indexOf(item)).workspacePath);
+    }
+}
+
+void Application::OnAddFleetFolder()
+{
+    const auto folderName = QFileDialog::getExistingDirectory(&mMainWindow, tr("Add Fleet Folder..."), QDir::homePath());
+    if (folderName.isEmpty())
+    {
+        return;
+    }
+
+    auto roots = QSettings().value("fleet/roots").toStringList();
+    if (!roots.contains(folderName))
+    {
+        roots.append(folderName);
+        QSettings().setValue("fleet/roots", roots);
+    }
+
+    mMainWindow.Log(QString("Fleet folders: %0").arg(roots.join(", ")));
+}
+
+void Application::OnCompareConfigurations()
+{
+    const auto folderName = QFileDialog::getExistingDirectory(&mMainWindow, tr("Compare Configurations..."), QDir::homePath());
+    if (folderName.isEmpty())
+    {
+        return;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QList<ConfigurationComparison::Column> columns;
+    if (mFolderInfo.has_value())
+    {
+        columns.append(ConfigurationComparison::Column{"Current", mMainWindow.TakeSnapshot().ToJson()});
+    }
+
+    const QDir folder(folderName);
+    QDirIterator it(folderName, QStringList{"configuration.json"}, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext())
+    {
+        const auto path = it.next();
+
+        // Sparse and layered files are compared with all their settings
+        const auto resolution = mProfileResolver.Resolve(path);
+        if (!resolution.has_value())
+        {
+            mMainWindow.Log(QString("Could not compare %0: %1").arg(path, mProfileResolver.LastError()), "rgb(249, 154, 0)");
+            continue;
+        }
+
+        const auto label = folder.relativeFilePath(QFileInfo(path).path());
+        columns.append(ConfigurationComparison::Column{label == "." ? QFileInfo(folderName).fileName() : label, resolution.value().configuration});
+    }
+
+    if (columns.size() < 2)
+    {
+        mMainWindow.Log(QString("Comparing failed: Less than two configurations found below %0.").arg(folderName), "red");
+        return;
+    }
+
+    mComparison = ConfigurationComparison::Compare(columns);
+
+    QList<QStringList> rows;
+    for (const auto& row : mComparison.value().Rows())
+    {
+        QStringList cells{row.page, row.field};
+        for (const auto& value : row.values)
+        {
+            cells.append(ConfigurationComparison::ToText(value));
+        }
+        rows.append(cells);
+    }
+
+    const auto summary = QString("%0 configurations, %1 differing fields on %2 pages, %3 identical pages skipped")
+            .arg(columns.size()).arg(rows.size()).arg(mComparison.value().ComparedPages().size()).arg(mComparison.value().IdenticalPages().size());
+
+    mMainWindow.Log(QString("Compared %0 in %1 ms").arg(summary).arg(timer.elapsed()));
+    mMainWindow.ShowComparison(mComparison.value().Labels(), rows, summary);
+}
+
+void Application::OnExportComparison(const QString& pPath)
+{
+    if (!mComparison.has_value())
+    {
+        return;
+    }
+
+    QFile file(pPath);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        mMainWindow.Log(QString("Could not open file %0").arg(pPath), "red");
+        return;
+    }
+
+    file.write(pPath.endsWith(".json", Qt::CaseInsensitive) ? mComparison.value().ToJson() : mComparison.value().ToCsv());
+
+    mMainWindow.Log(QString("Exported comparison to %0").arg(pPath));
+}
+
+void Application::OnExportTrace()
+{
+    const auto count = Trace::EventCount();
+    if (count == 0)
+    {
+        mMainWindow.Log("No trace recorded: Enable Help > Record Trace or start iMC with IMC_TRACE set.", "rgb(249, 154, 0)");
+        return;
+    }
+
+    const auto path = QFileDialog::getSaveFileName(&mMainWindow, tr("Export Trace..."), QDir::homePath() + "/imc-trace.json", tr("Trace (*.json)"));
+    if (path.isEmpty())
+    {
+        return;
+    }
+
+    if (!Trace::Export(path))
+    {
+        mMainWindow.Log(QString("Could not write trace file %0").arg(path), "red");
+        return;
+    }
+
+    mMainWindow.Log(QString("Exported %0 trace spans to %1, open it in chrome://tracing or ui.perfetto.dev").arg(count).arg(path));
+}
+
+void Application::OnToggleAutomationServer(bool pEnabled)
+{
+    if (!pEnabled)
+    {
+        if (mAutomationServer.IsListening())
+        {
+            mAutomationServer.Close();
+            mMainWindow.Log("Automation server stopped.");
+        }
+        return;
+    }
+
+    if (!mAutomationServer.Listen())
+    {
+        mMainWindow.Log(QString("Could not start the automation server: %0").arg(mAutomationServer.ErrorString()), "red");
+        return;
+    }
+
+    mMainWindow.Log(QString("Automation server listening on %0").arg(mAutomationServer.FullServerName()));
+}
+
+void Application::RegisterAutomationHandlers()
+{
+    mAutomationServer.SetHandler("validate", [](const QJsonObject& pRequest){
+        const auto problems = Configuration::Validate(pRequest.value("configuration").toObject());
+        return QJsonObject{{"valid", problems.isEmpty()}, {"problems", QJsonArray::fromStringList(problems)}};
+    });
+
+    mAutomationServer.SetHandler("fingerprint", [](const QJsonObject& pRequest){
+        const auto configuration = Configuration::ExpandSparseJson(pRequest.value("configuration").toObject());
+        return QJsonObject{{"fingerprint", QString(Configuration::Fingerprint(configuration).toHex())}};
+    });
+
+    // Rendering uses the hidden pages of the renderer, so it is the only step that runs on the GUI thread
+    mAutomationServer.SetHandler("render", [this](const QJsonObject& pRequest){
+        const auto json = pRequest.value("configuration").toObject();
+
+        const auto problems = Configuration::Validate(json);
+        if (!problems.isEmpty())
+        {
+            return AutomationServer::Error(problems.join("; "));
+        }
+
+        const auto configuration = Configuration::FromJson(json);
+        if (!configuration.has_value())
+        {
+            return AutomationServer::Error("The configuration could not be read");
+        }
+
+        bool hasTemplate = false;
+        ConfigurationRenderer::Result result;
+        if (!mAutomationServer.RunOnMainThread([&](){
+            hasTemplate = mTemplate.has_value();
+            if (hasTemplate)
+            {
+                result = RenderConfiguration(mTemplate.value(), configuration.value(), mFolderInfo.has_value() ? mFolderInfo.value().filePath() : QString());
             }
+        }))
+        {
+            return AutomationServer::Error("The automation server is stopping");
+        }
+
+        if (!hasTemplate)
+        {
+            return AutomationServer::Error("No Configuration.h template loaded");
+        }
+
+        if (!result.code.has_value())
+        {
+            return AutomationServer::Error(QString("Values not available on the configuration pages: %0").arg(result.unmappedFields.join(", ")));
+        }
+
+        return QJsonObject{{"header", result.code.value().join('\n') + '\n'}, {"renderedOnGuiThread", true}};
+    });
+
+    mAutomationServer.SetHandler("build", [this](const QJsonObject& pRequest){
+        return RunAutomationBuild(pRequest);
+    });
+}
+
+ConfigurationRenderer::Result Application::RenderConfiguration(const QStringList& pTemplate, const Configuration& pConfiguration, const QString& pWorkspacePath)
+{
+    const TraceSpan span("Application::RenderConfiguration", pWorkspacePath);
+
+    // Created on the first request, so that iMC does not build a second set of pages without the automation server
+    if (!mRenderer)
+    {
+        mRenderer = std::make_unique<ConfigurationRenderer>();
+    }
+
+    // The items of each workspace are kept until its catalog headers change, the pages are only refilled on a switch
+    QString stamps;
+    if (!pWorkspacePath.isEmpty())
+    {
+        stamps = FileStamps(pWorkspacePath, {HardwareCatalog::HeaderPath(HardwareCatalog::Kind::Motherboards),
+                                             HardwareCatalog::HeaderPath(HardwareCatalog::Kind::Thermistors),
+                                             HardwareCatalog::HeaderPath(HardwareCatalog::Kind::Drivers)});
+
+        auto& catalogs = mWorkspaceCatalogs[pWorkspacePath];
+        if (catalogs.stamps != stamps)
+        {
+            QStringList unreadable;
+            int32_t parsedHeaders = 0;
+            catalogs.items = ReadHardwareCatalogs(pWorkspacePath, unreadable, parsedHeaders);
+            catalogs.stamps = stamps;
+        }
+    }
+
+    const auto key = pWorkspacePath + '\n' + stamps;
+    if (mRendererCatalogs != key)
+    {
+        const auto items = mWorkspaceCatalogs.value(pWorkspacePath).items;
+        mRenderer->SetHardwareCatalogs(items[0], items[1], items[2]);
+        mRendererCatalogs = key;
+    }
+
+    return mRenderer->Render(pTemplate, pConfiguration);
+}
+
+QJsonObject Application::RunAutomationBuild(const QJsonObject& pRequest)
+{
+    const TraceSpan span("Application::RunAutomationBuild", pRequest.value("environment").toString());
+
+    const auto workspace = pRequest.value("workspace").toString();
+    const auto environment = pRequest.value("environment").toString();
+
+    if (workspace.isEmpty() || !QFile::exists(workspace + "/platformio.ini") || !QDir(workspace + "/Marlin").exists())
+    {
+        return AutomationServer::Error("\"workspace\" is not a Marlin base folder");
+    }
+
+    if (environment.isEmpty())
+    {
+        return AutomationServer::Error("\"environment\" is missing");
+    }
+
+    // Like generating in the GUI, a Configuration.h of a workspace iMC does not manage is only replaced on request
+    if (!QFile::exists(workspace + "/configuration.json") && !pRequest.value("overwrite").toBool())
+    {
+        return AutomationServer::Error("The workspace has no configuration.json, set \"overwrite\" to replace its Configuration.h");
+    }
+
+    const auto json = pRequest.value("configuration").toObject();
+    const auto problems = Configuration::Validate(json);
+    if (!problems.isEmpty())
+    {
+        return AutomationServer::Error(problems.join("; "));
+    }
+
+    const auto configuration = Configuration::FromJson(json);
+    if (!configuration.has_value())
+    {
+        return AutomationServer::Error("The configuration could not be read");
+    }
+
+    QString error;
+    const auto configurationTemplate = ReadWorkspaceTemplate(workspace, error);
+    if (!configurationTemplate.has_value())
+    {
+        return AutomationServer::Error(error);
+    }
+
+    ConfigurationRenderer::Result result;
+    if (!mAutomationServer.RunOnMainThread([&](){ result = RenderConfiguration(configurationTemplate.value(), configuration.value(), workspace); }))
+    {
+        return AutomationServer::Error("The automation server is stopping");
+    }
+
+    if (!result.code.has_value())
+    {
+        return AutomationServer::Error(QString("Values not available on the configuration pages: %0").arg(result.unmappedFields.join(", ")));
+    }
+
+    // Builds of the same workspace share Configuration.h and the build folder, builds of different workspaces run in parallel
+    const auto canonicalWorkspace = QFileInfo(workspace).canonicalFilePath();
+    std::shared_ptr<std::mutex> workspaceMutex;
+    {
+        std::lock_guard<std::mutex> lock(mAutomationBuildMutex);
+        auto& mutex = mWorkspaceBuildMutexes[canonicalWorkspace];
+        if (!mutex)
+        {
+            mutex = std::make_shared<std::mutex>();
+        }
+        workspaceMutex = mutex;
+    }
+    std::lock_guard<std::mutex> lock(*workspaceMutex);
+
+    // GUI jobs read Configuration.h, the build folder and the artifact cache of the open workspace while processing events
+    bool claimed = false;
+    if (!mAutomationServer.RunOnMainThread([&](){
+        claimed = (0 == mWorkspaceJobs) || !IsOpenWorkspace(workspace);
+        if (claimed)
+        {
+            mAutomationWorkspaces.insert(canonicalWorkspace);
+        }
+    }))
+    {
+        return AutomationServer::Error("The automation server is stopping");
+    }
+
+    if (!claimed)
+    {
+        return AutomationServer::Error("iMC is generating, building or uploading in this workspace, try again when it finished");
+    }
+
+    auto buildResult = BuildInWorkspace(workspace, environment, result.code.value());
+
+    QMetaObject::invokeMethod(this, [this, canonicalWorkspace](){ mAutomationWorkspaces.remove(canonicalWorkspace); }, Qt::QueuedConnection);
+
+    // Rendering uses widgets, so requests are rendered one at a time on the GUI thread, see ConfigurationRenderer
+    buildResult["renderedOnGuiThread"] = true;
+    return buildResult;
+}
+
+QJsonObject Application::BuildInWorkspace(const QString& pWorkspacePath, const QString& pEnvironment, const QStringList& pCode)
+{
+    // The main window lives on the GUI thread, its state is set through queued calls
+    const auto setBuildJobState = [this](const QString& pState)
+    {
+        QMetaObject::invokeMethod(&mMainWindow, [this, pState](){ mMainWindow.SetBuildJobState(pState); }, Qt::QueuedConnection);
+    };
+
+    QElapsedTimer buildTimer;
+    buildTimer.start();
+    setBuildJobState(QString("Automation: platformio run -e %0").arg(pEnvironment));
 
-            if  (line.contains("1 succeeded"))
-            {
-                mBuildSuccess = true;
-            }
+    QFile file(pWorkspacePath + "/Marlin/Configuration.h");
+    if (!file.open(QFile::WriteOnly | QFile::Text))
+    {
+        return AutomationServer::Error(QString("Could not open %0").arg(file.fileName()));
+    }
+    file.write((pCode.join('\n') + '\n').toUtf8());
+    file.close();
 
-            mMainWindow.CompilerLog(mCurrent, line);
-            mCurrent.clear();
-        }
-    });
+    // The header was generated from the checked template, so it does not need another check
+    UpdateWorkspaceTemplateStamps(pWorkspacePath);
 
-    QObject::connect(&process, &QProcess::readyReadStandardError, this, [&](){
-        auto stream = QTextStream(process.readAllStandardError());
-        while (!stream.atEnd())
+    QProcess process;
+    process.setProcessChannelMode(QProcess::MergedChannels);
+    process.setWorkingDirectory(pWorkspacePath);
+    process.start("platformio", QStringList{"run", "-e", pEnvironment});
+
+    if (!process.waitForStarted())
+    {
+        setBuildJobState("Idle (automation build could not be started)");
+        return AutomationServer::Error("PlatformIO could not be started");
+    }
+
+    while (process.state() != QProcess::NotRunning && !process.waitForFinished(100))
+    {
+        if (mAutomationServer.IsStopping())
         {
-            mMainWindow.CompilerLog(std::nullopt, stream.readLine(), "red");
+            process.kill();
+            process.waitForFinished();
+            setBuildJobState("Idle (automation build canceled)");
+            return AutomationServer::Error("The build was canceled");
         }
-    });
+    }
 
-    mMainWindow.Log(QString("Starting clean for environment %0...").arg(pEnvironment));
+    auto log = QString::fromLocal8Bit(process.readAll()).split('\n');
+    constexpr auto maxLogLines = 200;
+    if (log.size() > maxLogLines)
+    {
+        log = log.mid(log.size() - maxLogLines);
+    }
 
-    process.write(QString("platformio run --target clean -e %0\n").arg(pEnvironment).toLocal8Bit());
+    const auto success = (process.exitStatus() == QProcess::NormalExit) && (process.exitCode() == 0);
+    setBuildJobState(QString("Idle (automation build %0 after %1 s)").arg(success ? "succeeded" : "failed").arg(buildTimer.elapsed() / 1000.0, 0, 'f', 1));
+    return QJsonObject{{"success", success}, {"exitCode", process.exitCode()}, {"log", QJsonArray::fromStringList(log)}};
+}
 
-    process.write("exit\n");
+std::optional<QStringList> Application::ReadWorkspaceTemplate(const QString& pWorkspacePath, QString& pError)
+{
+    // The template pack follows from the version headers, the compatibility from Configuration.h
+    const auto stamps = FileStamps(pWorkspacePath, {"Marlin/Version.h", "Marlin/src/inc/Version.h", "Marlin/Configuration.h"});
+    const auto key = QFileInfo(pWorkspacePath).canonicalFilePath();
 
-    while(process.state() == QProcess::ProcessState::Running)
     {
-        QCoreApplication::processEvents();
-        if (mMainWindow.IsBuildCanceled())
+        std::lock_guard<std::mutex> lock(mAutomationBuildMutex);
+        const auto cached = mWorkspaceTemplates.constFind(key);
+        if (cached != mWorkspaceTemplates.constEnd() && cached->stamps == stamps)
         {
-            process.close();
+            pError = cached->error;
+            return cached->configurationTemplate;
         }
     }
 
-    process.waitForFinished();
-    process.close();
+    WorkspaceTemplate checked{stamps, CheckWorkspaceTemplate(pWorkspacePath, pError), QString()};
+    checked.error = pError;
 
-    mMainWindow.CompilerLog(std::nullopt, "");
-    if (mBuildSuccess)
+    std::lock_guard<std::mutex> lock(mAutomationBuildMutex);
+    mWorkspaceTemplates.insert(key, checked);
+    return checked.configurationTemplate;
+}
+
+void Application::UpdateWorkspaceTemplateStamps(const QString& pWorkspacePath)
+{
+    const auto stamps = FileStamps(pWorkspacePath, {"Marlin/Version.h", "Marlin/src/inc/Version.h", "Marlin/Configuration.h"});
+
+    std::lock_guard<std::mutex> lock(mAutomationBuildMutex);
+    const auto cached = mWorkspaceTemplates.find(QFileInfo(pWorkspacePath).canonicalFilePath());
+    if (cached != mWorkspaceTemplates.end() && cached->configurationTemplate.has_value())
     {
-        mMainWindow.Log("Cleaning successful.", "rgb(249, 154, 0)");
-        mMainWindow.DeactivateCancelButton();
-        return true;
+        cached->stamps = stamps;
     }
-    else if (mMainWindow.IsBuildCanceled())
+}
+
+QString Application::FileStamps(const QString& pWorkspacePath, const QStringList& pFiles)
+{
+    QStringList stamps;
+    for (const auto& file : pFiles)
     {
-        mMainWindow.Log("Cleaning canceled.", "red");
-        mMainWindow.DeactivateCancelButton();
-        return false;
+        const QFileInfo info(pWorkspacePath + "/" + file);
+        stamps.append(QString("%0:%1:%2").arg(file).arg(info.size()).arg(info.exists() ? info.lastModified().toMSecsSinceEpoch() : 0));
     }
-    else
+    return stamps.join('\n');
+}
+
+std::optional<QStringList> Application::CheckWorkspaceTemplate(const QString& pWorkspacePath, QString& pError)
+{
+    const auto workspaceVersion = TemplateCompatibility::ReadMarlinVersion(pWorkspacePath);
+    const auto version = TemplatePack::SelectVersion(workspaceVersion.value_or(MARLIN_VERSION)).value_or(MARLIN_VERSION);
+
+    const auto configurationTemplate = ReadTemplateFromFile(QFileInfo(TemplatePack::Directory(version) + "/" + TEMPLATE_PATH));
+    if (!configurationTemplate.has_value())
     {
-        mMainWindow.Log("Cleaning failed. See compiler outputs for more details.", "red");
-        mMainWindow.DeactivateCancelButton();
+        pError = QString("Could not load the template pack for Marlin v%0").arg(version);
+        return std::nullopt;
+    }
+
+    const auto report = TemplateCompatibility::Check(pWorkspacePath, configurationTemplate.value());
+    if (!report.has_value())
+    {
+        pError = "Could not check template compatibility: Marlin/Configuration.h not found";
+        return std::nullopt;
+    }
+
+    if (!report->IsCompatible(version))
+    {
+        pError = QString("The workspace (Marlin %0) does not match the template pack for v%1: %2 template defines are unknown to the workspace, %3 workspace defines are missing from the template")
+                 .arg(report->workspaceVersion.isEmpty() ? QString("unknown version") : QString("v%0").arg(report->workspaceVersion), version)
+                 .arg(report->unknownTags.size()).arg(report->untemplatedDefines.size());
+        return std::nullopt;
+    }
+
+    return configurationTemplate;
+}
+
+bool Application::IsOpenWorkspace(const QString& pWorkspacePath) const
+{
+    return mFolderInfo.has_value() && (QFileInfo(pWorkspacePath).canonicalFilePath() == mFolderInfo.value().canonicalFilePath());
+}
+
+bool Application::CheckWorkspaceAvailable(const QString& pJob)
+{
+    if (mFolderInfo.has_value() && mAutomationWorkspaces.contains(mFolderInfo.value().canonicalFilePath()))
+    {
+        mMainWindow.Log(QString("Could not start %0: An automation build is running in this workspace.").arg(pJob), "red");
         return false;
     }
+
+    return true;
 }
 
-void Application::OnUpload(const QString& pEnvironment)
+void Application::LoadEnvironmentIndex(const QString& pWorkspacePath)
+{
+    if (!mEnvironmentIndex.Load(pWorkspacePath))
+    {
+        mMainWindow.Log("Could not index the environments of this workspace, motherboard compatibility is not checked.", "rgb(249, 154, 0)");
+        mMainWindow.SetBoardEnvironments(QStringList(), QHash<QString, QStringList>());
+        return;
+    }
+
+    mMainWindow.SetBoardEnvironments(mEnvironmentIndex.Environments(), mEnvironmentIndex.EnvironmentsByBoard());
+    mMainWindow.Log(QString("Environment index: %0 environments, %1 motherboards with recommendations%2")
+                    .arg(mEnvironmentIndex.Environments().size()).arg(mEnvironmentIndex.EnvironmentsByBoard().size())
+                    .arg(mEnvironmentIndex.WasCached() ? " (cached)" : ""));
+}
+
+bool Application::RegenerateIfChanged(const QString& pJob)
 {
+    if (mFolderInfo.has_value())
+    {
+        const auto headerPath = mFolderInfo.value().filePath() + "/Marlin/Configuration.h";
+
+        // A file iMC generated can be compared with the displayed configuration without asking
+        if (mChangeTracker.IsHeaderGenerated(ChangeTracker::HashFile(headerPath)))
+        {
+            const auto changes = mChangeTracker.Changes(ChangeTracker::Baseline::Generated, mMainWindow.TakeSnapshot());
+            if (changes.isEmpty())
+            {
+                mMainWindow.Log("Configuration.h matches the displayed configuration, no regeneration needed.");
+                return true;
+            }
+
+            mMainWindow.Log(QString("%0 settings changed since the last generation, regenerating Configuration.h...").arg(changes.size()));
+            return OnGenerate();
+        }
+    }
+
     QMessageBox msgBox;
-    msgBox.setText("Regenerate the configuration before uploading?");
+    msgBox.setText(QString("Regenerate the configuration before %0?").arg(pJob));
     msgBox.setInformativeText("Marlin is built using the most recently generated configuration. This may not match the configuration currently displayed in the software.");
     msgBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No | QMessageBox::Cancel);
     msgBox.setIcon(QMessageBox::Question);
@@ -522,12 +1871,11 @@ void Application::OnUpload(const QString& pEnvironment)
     {
         case QMessageBox::Yes:
         {
-            OnGenerate();
-            break;
+            return OnGenerate();
         }
         case QMessageBox::Cancel:
         {
-            return;
+            return false;
         }
         default:
         {
@@ -535,27 +1883,295 @@ void Application::OnUpload(const QString& pEnvironment)
         }
     }
 
-    mMainWindow.ActivateCancelButton();
-    if (!mFolderInfo.has_value())
+    return true;
+}
+
+void Application::RecordBuild(const QString& pEnvironment)
+{
+    // Builds of a Configuration.h edited outside iMC say nothing about the displayed configuration
+    if (mChangeTracker.IsHeaderGenerated(ChangeTracker::HashFile(mFolderInfo.value().filePath() + "/Marlin/Configuration.h")))
+    {
+        mChangeTracker.SetBuilt(pEnvironment);
+    }
+    OnUpdateDirtyFields();
+}
+
+void Application::OnUpdateDirtyFields()
+{
+    static constexpr auto maxListedChanges = 25;
+
+    if (!mFolderInfo.has_value() || !mChangeTracker.HasBaseline(ChangeTracker::Baseline::Generated))
+    {
+        mMainWindow.SetDirtyFields(QString(), QString());
+        return;
+    }
+
+    if (!mChangeTracker.IsHeaderGenerated(ChangeTracker::HashFile(mFolderInfo.value().filePath() + "/Marlin/Configuration.h")))
+    {
+        mMainWindow.SetDirtyFields("Configuration.h modified outside iMC", "Configuration.h differs from the file iMC generated last.");
+        return;
+    }
+
+    const auto snapshot = mMainWindow.TakeSnapshot();
+
+    const auto describe = [](const QList<ChangeTracker::Change>& pChanges)
+    {
+        QStringList lines;
+        for (const auto& change : pChanges.mid(0, maxListedChanges))
+        {
+            lines.append(QString("%0 / %1: %2 -> %3").arg(change.page, change.field, change.before.toVariant().toString(), change.after.toVariant().toString()));
+        }
+        if (pChanges.size() > maxListedChanges)
+        {
+            lines.append(QString("... and %0 more").arg(pChanges.size() - maxListedChanges));
+        }
+        return lines.join("\n");
+    };
+
+    const auto generated = mChangeTracker.Changes(ChangeTracker::Baseline::Generated, snapshot);
+    auto text = generated.isEmpty() ? QString("Configuration.h up to date") : QString("%0 changes not generated").arg(generated.size());
+    auto toolTip = generated.isEmpty() ? QString() : QString("Changed since the last generation:\n%0").arg(describe(generated));
+
+    if (mChangeTracker.HasBaseline(ChangeTracker::Baseline::Built))
+    {
+        const auto built = mChangeTracker.Changes(ChangeTracker::Baseline::Built, snapshot);
+        text += QString(", %0 not built (%1)").arg(built.size()).arg(mChangeTracker.BuiltEnvironment());
+        if (!built.isEmpty())
+        {
+            toolTip += QString("%0Changed since the last build:\n%1").arg(QString(toolTip.isEmpty() ? "" : "\n\n"), describe(built));
+        }
+    }
+
+    mMainWindow.SetDirtyFields(text, toolTip);
+}
+
+bool Application::ConfirmEnvironment(const QString& pEnvironment)
+{
+    const auto motherboard = mMainWindow.GetMotherboard();
+
+    if (!mEnvironmentIndex.IsReady() || mEnvironmentIndex.IsCompatible(motherboard, pEnvironment))
+    {
+        return true;
+    }
+
+    const auto recommended = mEnvironmentIndex.EnvironmentsFor(motherboard);
+    mMainWindow.Log(QString("Environment %0 is not recommended for %1. Recommended environments: %2").arg(pEnvironment, motherboard, recommended.join(", ")), "rgb(249, 154, 0)");
+
+    QMessageBox msgBox;
+    msgBox.setText(QString("The environment %0 does not match the motherboard %1.").arg(pEnvironment, motherboard));
+    msgBox.setInformativeText(QString("Marlin recommends %0 for this motherboard. Continue anyway?").arg(recommended.join(", ")));
+    msgBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No);
+    msgBox.setDefaultButton(QMessageBox::No);
+    msgBox.setIcon(QMessageBox::Warning);
+
+    return msgBox.exec() == QMessageBox::Yes;
+}
+
+void Application::LoadImpactIndex()
+{
+    const auto code = GenerateCode();
+    if (!mFolderInfo.has_value() || !code.has_value() || nullptr != mImpactIndexThread)
     {
-        mMainWindow.Log("Could not start upload: No Marlin workspace opened.", "red");
         return;
     }
 
+    const auto workspacePath = mFolderInfo.value().filePath();
+    const auto macroNames = ImpactIndex::ExtractMacroNames(code.value());
+    auto index = std::make_shared<ImpactIndex>();
+
+    mMainWindow.Log("Indexing Marlin sources...");
+
+    QElapsedTimer timer;
+    timer.start();
+
+    mImpactIndexThread = QThread::create([index, workspacePath, macroNames](){
+        index->Load(workspacePath, macroNames);
+    });
+
+    QObject::connect(mImpactIndexThread, &QThread::finished, this, [this, index, workspacePath, timer](){
+        mImpactIndexThread->deleteLater();
+        mImpactIndexThread = nullptr;
+
+        if (!index->IsReady())
+        {
+            mMainWindow.Log("Could not index the Marlin sources.", "red");
+            return;
+        }
+
+        mMainWindow.Log(QString("Indexed %0 Marlin source files in %1 ms.").arg(index->TranslationUnitCount()).arg(timer.elapsed()));
+
+        if (mFolderInfo.has_value() && mFolderInfo.value().filePath() == workspacePath)
+        {
+            mImpactIndex = index;
+            OnUpdateRebuildScope();
+        }
+        else
+        {
+            LoadImpactIndex(); // The workspace changed while indexing
+        }
+    });
+
+    mImpactIndexThread->start();
+}
+
+bool Application::RunPlatformIoCompile(const QString& pArguments)
+{
+    if (!mMainWindow.IsCompilerCacheEnabled())
+    {
+        return RunPlatformIo(pArguments);
+    }
+
+    const auto environment = mCompilerCache.PrepareEnvironment(QProcessEnvironment::systemEnvironment());
+    if (!environment.has_value())
+    {
+        mMainWindow.Log("Could not prepare the compiler cache, building without it.", "red");
+        return RunPlatformIo(pArguments);
+    }
+
+    const auto before = mCompilerCache.ReadStatistics();
+
+    RunPlatformIo(pArguments, environment.value());
+
+    const auto after = mCompilerCache.ReadStatistics();
+
+    if (before.has_value() && after.has_value())
+    {
+        const auto hits = after->hits - before->hits;
+        const auto misses = after->misses - before->misses;
+        const auto total = hits + misses;
+
+        mMainWindow.CompilerLog(std::nullopt, QString("Compiler cache: %0 hits, %1 misses (%2% hit rate)").arg(hits).arg(misses).arg(total > 0 ? (100 * hits) / total : 0), "rgb(249, 154, 0)");
+    }
+    else if (!CompilerCache::FindExecutable().has_value())
+    {
+        mMainWindow.CompilerLog(std::nullopt, "Compiler cache: ccache not found, PlatformIO's build cache was used instead.", "rgb(249, 154, 0)");
+    }
+
+    return mBuildSuccess;
+}
+
+bool Application::RunPreflight()
+{
+    if (!HostPreprocessor::FindCompiler().has_value())
+    {
+        mMainWindow.Log("No host compiler found, skipping configuration preflight.");
+        return true;
+    }
+
+    mMainWindow.Log("Checking configuration...");
+
+    const HostPreprocessor preprocessor(mFolderInfo.value().filePath());
+
+    std::optional<HostPreprocessor::PreflightReport> report;
+    if (!RunInBackground(BackgroundJob::Preflight, [&preprocessor, &report](){ report = preprocessor.RunPreflight(); }))
+    {
+        mMainWindow.Log("Could not check the configuration: Another preflight is running.", "red");
+        return false;
+    }
+
+    if (!report.has_value() || !report->conclusive)
+    {
+        mMainWindow.Log("Configuration preflight was inconclusive, starting the build anyway.", "rgb(249, 154, 0)");
+        return true;
+    }
+
+    for (const auto& conflict : report->conflicts)
+    {
+        mMainWindow.CompilerLog(QString("%0:%1").arg(conflict.file).arg(conflict.line), conflict.message.toHtmlEscaped(), "rgb(249, 154, 0)");
+    }
+
+    for (const auto& error : report->errors)
+    {
+        mMainWindow.CompilerLog(QString("%0:%1").arg(error.file).arg(error.line), error.message.toHtmlEscaped(), "red");
+    }
+
+    if (report->errors.isEmpty())
+    {
+        mMainWindow.Log(QString("Configuration preflight passed in %0 ms (%1 conflicting defines).").arg(report->elapsedMs).arg(report->conflicts.size()), "rgb(249, 154, 0)");
+        return true;
+    }
+
+    mMainWindow.Log(QString("Configuration preflight found %0 errors. See compiler outputs for more details.").arg(report->errors.size()), "red");
+
+    QMessageBox msgBox;
+    msgBox.setText("The configuration does not pass Marlin's sanity checks.");
+    msgBox.setInformativeText("The build will most likely fail. Start it anyway?");
+    msgBox.setStandardButtons(QMessageBox::Yes | QMessageBox::No);
+    msgBox.setDefaultButton(QMessageBox::No);
+    msgBox.setIcon(QMessageBox::Warning);
+
+    return msgBox.exec() == QMessageBox::Yes;
+}
+
+QString Application::ComputeArtifactKey(const QString& pEnvironment)
+{
+    const TraceSpan span("Application::ComputeArtifactKey", pEnvironment);
+
+    // Hashing the inputs stats every file of Marlin/src, which takes too long for the GUI thread
+    const auto workspacePath = mFolderInfo.value().filePath();
+    QString key;
+    if (!RunInBackground(BackgroundJob::ArtifactKey, [&workspacePath, &pEnvironment, &key](){ key = ArtifactCache::ComputeKey(workspacePath, pEnvironment); }))
+    {
+        mMainWindow.Log("Could not check the firmware cache: Another check is running.", "rgb(249, 154, 0)");
+    }
+    return key;
+}
+
+bool Application::RunInBackground(BackgroundJob pJob, const std::function<void(void)>& pFunction)
+{
+    if (IsRunningInBackground(pJob))
+    {
+        return false;
+    }
+    // Different jobs still nest in each other's event processing, so the user cannot start workspace actions in between
+    if (mBackgroundJobs.empty())
+    {
+        mMainWindow.SetWorkspaceActionsAvailable(false);
+    }
+    mBackgroundJobs.insert(pJob);
+
+    // Keep the GUI responsive while the function runs
+    auto future = std::async(std::launch::async, pFunction);
+    while (future.wait_for(std::chrono::milliseconds(20)) != std::future_status::ready)
+    {
+        QApplication::processEvents();
+    }
+    future.get();
+
+    mBackgroundJobs.erase(pJob);
+    if (mBackgroundJobs.empty())
+    {
+        mMainWindow.SetWorkspaceActionsAvailable(true);
+    }
+    return true;
+}
+
+bool Application::IsRunningInBackground(BackgroundJob pJob) const
+{
+    return mBackgroundJobs.count(pJob) > 0;
+}
+
+bool Application::RunPlatformIo(const QString& pArguments, const QProcessEnvironment& pEnvironment)
+{
+    const TraceSpan span("Application::RunPlatformIo", pArguments);
+
     mBuildSuccess = false;
 
+    QElapsedTimer buildTimer;
+    buildTimer.start();
+    mMainWindow.SetBuildJobState(QString("Running platformio %0").arg(pArguments));
+
     QProcess process;
+    process.setProcessEnvironment(pEnvironment);
     process.start("C:\\Windows\\system32\\cmd.exe");
 
     if (false == process.waitForStarted())
     {
-        return;
+        mMainWindow.SetBuildJobState("Idle (PlatformIO could not be started)");
+        return false;
     }
 
-    if (mFolderInfo.has_value())
-    {
-        process.write(QString("cd %0\n").arg(mFolderInfo.value().filePath()).toLocal8Bit());
-    }
+    process.write(QString("cd %0\n").arg(mFolderInfo.value().filePath()).toLocal8Bit());
 
     QObject::connect(&process, &QProcess::readyReadStandardOutput, this, [&](){
         auto stream = QTextStream(process.readAllStandardOutput());
@@ -600,9 +2216,7 @@ void Application::OnUpload(const QString& pEnvironment)
         }
     });
 
-    mMainWindow.Log(QString("Starting upload for environment %0...").arg(pEnvironment));
-
-    process.write(QString("platformio run --target upload -e %0\n").arg(pEnvironment).toLocal8Bit());
+    process.write(QString("platformio %0\n").arg(pArguments).toLocal8Bit());
 
     process.write("exit\n");
 
@@ -619,24 +2233,17 @@ void Application::OnUpload(const QString& pEnvironment)
     process.close();
 
     mMainWindow.CompilerLog(std::nullopt, "");
-    if (mBuildSuccess)
-    {
-        mMainWindow.Log("Upload successful.", "rgb(249, 154, 0)");
-    }
-    else if (mMainWindow.IsBuildCanceled())
-    {
-        mMainWindow.Log("Upload canceled.", "red");
-    }
-    else
-    {
-        mMainWindow.Log("Upload failed. See compiler outputs for more details.", "red");
-    }
 
-    mMainWindow.DeactivateCancelButton();
+    mMainWindow.SetBuildJobState(QString("Idle (platformio %0 %1 after %2 s)").arg(pArguments, mBuildSuccess ? "succeeded" : "failed")
+                                                                              .arg(buildTimer.elapsed() / 1000.0, 0, 'f', 1));
+
+    return mBuildSuccess;
 }
 
 std::optional<QString> Application::GetPlatformIoVersion(void) const
 {
+    const TraceSpan span("Application::GetPlatformIoVersion");
+
     std::optional<QString> result = std::nullopt;
 
     QProcess process;
@@ -27,8 +27,41 @@
 #define APPLICATION_H
 
 #include "MainWindow.h"
+#include "ArtifactCache.h"
+#include "AutomationServer.h"
+#include "BinaryConfiguration.h"
+#include "ChangeTracker.h"
+#include "CompilerCache.h"
+#include "ConfigurationComparison.h"
+#include "ConfigurationImporter.h"
+#include "ConfigurationRenderer.h"
+#include "ConfigurationJournal.h"
+#include "EffectiveDefines.h"
+#include "EnvironmentIndex.h"
+#include "FleetCatalog.h"
+#include "HardwareCatalog.h"
+#include "ImpactIndex.h"
+#include "PinConflicts.h"
+#include "PinDatabase.h"
+#include "ProfileResolver.h"
+#include "StallWatchdog.h"
+#include "TemplateCompatibility.h"
+#include "TemplatePack.h"
+#include "UndoHistory.h"
+#include "HostPreprocessor.h"
 
 #include <QFileInfo>
+#include <QHash>
+#include <QSet>
+#include <QThread>
+#include <QTimer>
+
+#include <array>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 
 ///
 /// \brief The Application class represents the application
@@ -47,7 +80,9 @@ public:
 
 protected slots:
     /// \brief Exports the current configuration
-    void OnGenerate(void);
+    ///
+    /// \return \b true, if Configuration.h was written
+    bool OnGenerate(void);
 
     /// \brief Saves the project either in the open location or asks for the file path
     void OnSaveProject(void);
@@ -63,20 +98,341 @@ protected slots:
 
     void OnUpload(const QString& pEnvironment);
 
+    /// \brief Removes all cached firmware images
+    void OnClearFirmwareCache(void);
+
+    /// \brief Converts all Marlin Configuration.h files below a folder into configuration.json files
+    void OnImportConfigurations(void);
+
+    /// \brief Refreshes the fleet catalog, queries it and opens a matching workspace
+    void OnQueryFleet(void);
+
+    /// \brief Adds a folder to the fleet folders
+    void OnAddFleetFolder(void);
+
+    /// \brief Compares the open configuration and the configuration.json files below a folder
+    void OnCompareConfigurations(void);
+
+    /// \brief Writes the last comparison to a file
+    ///
+    /// \param pPath: The export file, a .json file or a .csv file
+    void OnExportComparison(const QString& pPath);
+
+    /// \brief Saves the recorded trace as a Chrome trace event file
+    void OnExportTrace(void);
+
+    /// \brief Starts or stops the automation server
+    ///
+    /// \param pEnabled: \b true, if the server should run
+    void OnToggleAutomationServer(bool pEnabled);
+
+    /// \brief Evaluates the macros Marlin derives from the displayed configuration, if they are shown
+    void OnEvaluateEffectiveDefines(void);
+
+    /// \brief Estimates how many translation units the changes since the last generation will recompile
+    void OnUpdateRebuildScope(void);
+
+    /// \brief Updates the pin claims of the configured features and reports new and resolved pin conflicts
+    void OnUpdatePinConflicts(void);
+
+    /// \brief Records the fields changed since the last call in the undo history and the autosave journal
+    void OnRecordChanges(void);
+
+    /// \brief Shows the fields changed since the last generation and the last build
+    void OnUpdateDirtyFields(void);
+
+    /// \brief Reverts the last configuration change
+    void OnUndo(void);
+
+    /// \brief Repeats the last undone configuration change
+    void OnRedo(void);
+
 protected:
     /// \brief Generates the Configuration.h file from the template
     ///
     /// \return The Configuration.h content as a QStringList, if successful
     std::optional<QStringList> GenerateCode(void);
 
+    /// \brief Registers the render, validate, fingerprint and build operations of the automation server
+    void RegisterAutomationHandlers(void);
+
+    /// \brief Generates Configuration.h for a configuration without changing the displayed one
+    ///
+    /// The hidden pages of the renderer are filled with the hardware catalogs of the workspace.
+    ///
+    /// \param pTemplate: The configuration template
+    /// \param pConfiguration: The configuration
+    /// \param pWorkspacePath: Path to the Marlin base folder, empty for the built-in catalogs
+    /// \return The Configuration.h content or the fields that could not be set
+    ConfigurationRenderer::Result RenderConfiguration(const QStringList& pTemplate, const Configuration& pConfiguration, const QString& pWorkspacePath);
+
+    /// \brief Generates Configuration.h into a workspace and builds it, called on a worker thread
+    ///
+    /// The template pack is selected and checked for the workspace. A workspace without configuration.json is
+    /// only written with "overwrite" set, and the open workspace is refused while a GUI job runs in it.
+    ///
+    /// \param pRequest: The request with "workspace", "environment", "configuration" and optionally "overwrite"
+    /// \return The result fields
+    QJsonObject RunAutomationBuild(const QJsonObject& pRequest);
+
+    /// \brief Writes Configuration.h into a workspace and runs PlatformIO, called on a worker thread
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pEnvironment: The PlatformIO environment to build
+    /// \param pCode: The Configuration.h content
+    /// \return The result fields
+    QJsonObject BuildInWorkspace(const QString& pWorkspacePath, const QString& pEnvironment, const QStringList& pCode);
+
+    /// \brief Reads the template pack matching a workspace's Marlin version and checks it against the workspace
+    ///
+    /// Unlike SelectTemplatePack, nothing is asked or logged, so it can be called on a worker thread. The result
+    /// is reused until the version headers or Configuration.h of the workspace change.
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pError: Receives the reason if no compatible template was found
+    /// \return The configuration template, if it matches the workspace
+    std::optional<QStringList> ReadWorkspaceTemplate(const QString& pWorkspacePath, QString& pError);
+
+    /// \brief Reads the template pack matching a workspace's Marlin version and checks it against the workspace, without the cache
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pError: Receives the reason if no compatible template was found
+    /// \return The configuration template, if it matches the workspace
+    static std::optional<QStringList> CheckWorkspaceTemplate(const QString& pWorkspacePath, QString& pError);
+
+    /// \brief Takes over the stamp of a Configuration.h generated from the cached template, so it is not checked again
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    void UpdateWorkspaceTemplateStamps(const QString& pWorkspacePath);
+
+    /// \brief Computes the size and modification time of workspace files
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pFiles: The files, relative to the workspace
+    /// \return The stamps, equal as long as none of the files changed
+    static QString FileStamps(const QString& pWorkspacePath, const QStringList& pFiles);
+
+    /// \brief Returns whether a path is the open workspace
+    ///
+    /// \param pWorkspacePath: Path to a Marlin base folder
+    /// \return \b true, if the workspace is open in the GUI
+    bool IsOpenWorkspace(const QString& pWorkspacePath) const;
+
+    /// \brief Logs an error if an automation build is running in the open workspace
+    ///
+    /// \param pJob: The job about to start, e.g. "build"
+    /// \return \b true, if the job may start
+    bool CheckWorkspaceAvailable(const QString& pJob);
+
+    /// \brief Opens a Marlin workspace and loads its configuration
+    ///
+    /// \param pFolderName: Path to the Marlin base folder
+    void OpenWorkspace(const QString& pFolderName);
+
     void OpenConfigurationJson(const QFileInfo& pFilePath);
 
+    /// \brief Loads the binary workspace configuration if it is at least as recent as configuration.json
+    ///
+    /// \param pWorkspacePath: Path of the Marlin workspace
+    /// \return \b true, if the configuration was loaded from the binary file
+    bool OpenConfigurationBinary(const QString& pWorkspacePath);
+
     std::optional<QString> GetPlatformIoVersion(void) const;
 
+    /// \brief Runs a PlatformIO command in the open workspace and forwards its outputs to the compiler log
+    ///
+    /// \param pArguments: The arguments passed to the platformio command
+    /// \param pEnvironment: The environment of the PlatformIO process
+    /// \return \b true, if PlatformIO reported success
+    bool RunPlatformIo(const QString& pArguments, const QProcessEnvironment& pEnvironment = QProcessEnvironment::systemEnvironment());
+
+    /// \brief Runs a compiling PlatformIO command, using the compiler cache if enabled
+    ///
+    /// \param pArguments: The arguments passed to the platformio command
+    /// \return \b true, if PlatformIO reported success
+    bool RunPlatformIoCompile(const QString& pArguments);
+
+    /// \brief Preprocesses the generated configuration on the host to find sanity check errors early
+    ///
+    /// \return \b true, if the build shall be started
+    bool RunPreflight(void);
+
+    /// \brief Computes the firmware cache key of the opened workspace on a worker thread
+    ///
+    /// \param pEnvironment: The PlatformIO environment to build
+    /// \return The key or an empty string if the build inputs could not be read
+    QString ComputeArtifactKey(const QString& pEnvironment);
+
+    /// \brief The jobs run by RunInBackground, each runs at most once at a time
+    enum class BackgroundJob
+    {
+        EffectiveDefines,
+        ImportConfigurations,
+        FleetRefresh,
+        Preflight,
+        ArtifactKey
+    };
+
+    /// \brief Runs a function on a worker thread while the GUI keeps processing events
+    ///
+    /// Events processed while waiting may trigger the same job again, which is refused instead of
+    /// running the function twice on the same data.
+    ///
+    /// \param pJob: The job the function belongs to
+    /// \param pFunction: The function, which must not access widgets
+    /// \return \b false, if the function was not run because the job is already running
+    bool RunInBackground(BackgroundJob pJob, const std::function<void(void)>& pFunction);
+
+    /// \brief Returns whether a job of RunInBackground is running
+    ///
+    /// \param pJob: The job
+    /// \return \b true, if the job is running
+    bool IsRunningInBackground(BackgroundJob pJob) const;
+
+    /// \brief Selects the template pack matching the workspace's Marlin version and checks its compatibility
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \return \b true, if the workspace shall be opened
+    bool SelectTemplatePack(const QString& pWorkspacePath);
+
+    /// \brief Compares the workspace configuration with the template and reports mismatches
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pTemplate: The configuration template
+    /// \param pMarlinVersion: The Marlin version the template was made for
+    /// \return \b true, if the workspace shall be opened
+    bool CheckTemplateCompatibility(const QString& pWorkspacePath, const QStringList& pTemplate, const QString& pMarlinVersion);
+
+    /// \brief Loads or builds the impact index of the open workspace in a background thread
+    void LoadImpactIndex(void);
+
+    /// \brief Reads the motherboards, thermistor and driver types of a workspace as dropdown items
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pUnreadable: Receives the headers that could not be read, their built-in lists apply
+    /// \param pParsedHeaders: Increased for each header that was parsed instead of taken from the index
+    /// \return The motherboards, thermistor and driver types
+    std::array<QStringList, 3> ReadHardwareCatalogs(const QString& pWorkspacePath, QStringList& pUnreadable, int32_t& pParsedHeaders);
+
+    /// \brief Adds the motherboards, thermistor and driver types of the workspace to the dropdown menus
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    void LoadHardwareCatalogs(const QString& pWorkspacePath);
+
+    /// \brief Offers to take over the settings of the workspace's existing Configuration.h
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \return \b true, if the configuration was imported
+    bool ImportConfigurationHeader(const QString& pWorkspacePath);
+
+    /// \brief Offers to restore the changes a previous session did not save, then starts a new autosave journal
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    void RecoverJournal(const QString& pWorkspacePath);
+
+    /// \brief Loads the environments of the workspace and the environments recommended per motherboard
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    void LoadEnvironmentIndex(const QString& pWorkspacePath);
+
+    /// \brief Asks the user whether to continue if the environment does not match the selected motherboard
+    ///
+    /// \param pEnvironment: The environment to build
+    /// \return \b true, if the job shall be started
+    bool ConfirmEnvironment(const QString& pEnvironment);
+
+    /// \brief Regenerates Configuration.h before a build if the configuration changed since the last generation
+    ///
+    /// Asks the user only if Configuration.h was not generated by iMC or modified since.
+    ///
+    /// \param pJob: The job about to start, e.g. "building"
+    /// \return \b true, if the job shall be started, \b false if it was cancelled or the generation failed
+    bool RegenerateIfChanged(const QString& pJob);
+
+    /// \brief Records a successful build of the generated configuration
+    ///
+    /// \param pEnvironment: The PlatformIO environment that was built
+    void RecordBuild(const QString& pEnvironment);
+
+    /// \brief The template pack checked for a workspace
+    struct WorkspaceTemplate
+    {
+        QString stamps; ///< FileStamps of the version headers and Configuration.h at the check
+        std::optional<QStringList> configurationTemplate; ///< The template, if it matches the workspace
+        QString error; ///< The reason if it does not
+    };
+
+    /// \brief The hardware catalog items of a workspace
+    struct WorkspaceCatalogs
+    {
+        QString stamps; ///< FileStamps of the catalog headers when the items were read
+        std::array<QStringList, 3> items; ///< The motherboards, thermistor and driver types
+    };
+
+    /// \brief Counts a GUI job on the open workspace as running while in scope
+    ///
+    /// The jobs process events while they wait, so an automation build could otherwise change the
+    /// files they read, see RunAutomationBuild.
+    struct WorkspaceJob
+    {
+        explicit WorkspaceJob(int32_t& pJobs) : mJobs(pJobs)
+        {
+            ++mJobs;
+        }
+
+        ~WorkspaceJob(void)
+        {
+            --mJobs;
+        }
+
+        int32_t& mJobs;
+    };
+
 protected:
     MainWindow mMainWindow;
 
+    ArtifactCache mArtifactCache;
+    CompilerCache mCompilerCache;
+    EffectiveDefines mEffectiveDefines;
+    HardwareCatalog mHardwareCatalog;
+    EnvironmentIndex mEnvironmentIndex;
+    PinDatabase mPinDatabase;
+    PinConflicts mPinConflicts;
+    QTimer mPinConflictTimer;
+    ConfigurationJournal mJournal;
+    UndoHistory mUndoHistory;
+    ChangeTracker mChangeTracker;
+    ProfileResolver mProfileResolver;
+    FleetCatalog mFleetCatalog;
+    std::optional<ConfigurationComparison> mComparison;
+    AutomationServer mAutomationServer;
+    StallWatchdog mStallWatchdog;
+    /// \brief Guards the map of build mutexes, one per workspace, and the checked templates
+    std::mutex mAutomationBuildMutex;
+    std::map<QString, std::shared_ptr<std::mutex>> mWorkspaceBuildMutexes;
+    QHash<QString, WorkspaceTemplate> mWorkspaceTemplates;
+
+    /// \brief The renderer and the catalogs it was filled with, used on the GUI thread
+    std::unique_ptr<ConfigurationRenderer> mRenderer;
+    std::optional<QString> mRendererCatalogs;
+    QHash<QString, WorkspaceCatalogs> mWorkspaceCatalogs;
+
+    /// \brief GUI jobs running in the open workspace and the workspaces of running automation builds, both used on the GUI thread
+    int32_t mWorkspaceJobs{0};
+    QSet<QString> mAutomationWorkspaces;
+    std::optional<QString> mProfileParent;
+    QTimer mRecordChangesTimer;
+
+    QTimer mEffectiveDefinesTimer;
+    std::optional<EffectiveDefines::Macros> mLastEffectiveDefines;
+    std::set<BackgroundJob> mBackgroundJobs;
+
+    std::shared_ptr<ImpactIndex> mImpactIndex;
+    QThread *mImpactIndexThread{nullptr};
+    QTimer mRebuildScopeTimer;
+
     std::optional<QStringList> mTemplate;
+    QString mTemplateVersion{MARLIN_VERSION};
     std::optional<QFileInfo> mOpenFileInfo;
     std::optional<QFileInfo> mFolderInfo;
 
@@ -26,36 +26,57 @@
 #ifndef CONFIGURATION_H
 #define CONFIGURATION_H
 
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QDataStream>
 #include <QJsonObject>
+#include <QMap>
+#include <QStringList>
+#include <algorithm>
+#include <array>
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 static constexpr auto SW_VERSION{"0.2.0"};
 static constexpr auto MARLIN_VERSION{"2.1.2"};
 
-static constexpr auto TEMPLATE_PATH{":/configuration_template.txt"};
-static constexpr auto FIRMWARE_TEMPLATE_PATH{":/firmware_template.txt"};
-static constexpr auto HARDWARE_TEMPLATE_PATH{":/hardware_template.txt"};
-static constexpr auto EXTRUDER_TEMPLATE_PATH{":/extruder_template.txt"};
-static constexpr auto POWERSUPPLY_TEMPLATE_PATH{":/powersupply_template.txt"};
-static constexpr auto THERMALSETTINGS_TEMPLATE_PATH{":/thermalsettings_template.txt"};
-static constexpr auto KINEMATICS_TEMPLATE_PATH{":/kinematics_template.txt"};
-static constexpr auto ENDSTOPS_TEMPLATE_PATH{":/endstops_template.txt"};
-static constexpr auto MOVEMENT_TEMPLATE_PATH{":/movement_template.txt"};
-static constexpr auto Z_PROBE_OPTIONS_TEMPLATE_PATH{":/z_probe_options_template.txt"};
-static constexpr auto STEPPER_DRIVERS_TEMPLATE_PATH{":/stepper_drivers_template.txt"};
-static constexpr auto HOMING_AND_BOUNDS_TEMPLATE_PATH{":/homing_and_bounds_template.txt"};
-static constexpr auto FILAMENT_RUNOUT_SENSOR_TEMPLATE_PATH{":/filament_runout_sensor_template.txt"};
-static constexpr auto BED_LEVELING_TEMPLATE_PATH{":/bed_leveling_template.txt"};
-static constexpr auto HOMING_OPTIONS_TEMPLATE_PATH{":/homing_options_template.txt"};
-static constexpr auto ADDITIONAL_FEATURES_TEMPLATE_PATH{":/additional_features_template.txt"};
-static constexpr auto USER_INTERFACE_LANGUAGE_TEMPLATE_PATH{":/user_interface_language_template.txt"};
-static constexpr auto SD_CARD_TEMPLATE_PATH{":/sd_card_template.txt"};
-static constexpr auto LCD_MENU_ITEMS_TEMPLATE_PATH{":/lcd_menu_items_template.txt"};
-static constexpr auto ENCODER_TEMPLATE_PATH{":/encoder_template.txt"};
-static constexpr auto SPEAKER_TEMPLATE_PATH{":/speaker_template.txt"};
-static constexpr auto LCD_CONTROLLER_TEMPLATE_PATH{":/lcd_controller_template.txt"};
-static constexpr auto EXTRA_FEATURES_TEMPLATE_PATH{":/extra_features_template.txt"};
+// Sparse configuration.json files only store the fields that differ from the defaults,
+// marked by the sparse key and the version of the layout they were written with
+static constexpr auto CONFIGURATION_SCHEMA_VERSION{1};
+static constexpr auto CONFIGURATION_SCHEMA_VERSION_KEY{"schemaVersion"};
+static constexpr auto CONFIGURATION_SPARSE_KEY{"sparse"};
+
+// Template packs are compiled in per Marlin version as :/templates/<version>/,
+// the template paths below are relative to the pack selected for the workspace
+static constexpr auto TEMPLATE_PACKS_ROOT{":/templates"};
+
+static constexpr auto TEMPLATE_PATH{"configuration_template.txt"};
+static constexpr auto FIRMWARE_TEMPLATE_PATH{"firmware_template.txt"};
+static constexpr auto HARDWARE_TEMPLATE_PATH{"hardware_template.txt"};
+static constexpr auto EXTRUDER_TEMPLATE_PATH{"extruder_template.txt"};
+static constexpr auto POWERSUPPLY_TEMPLATE_PATH{"powersupply_template.txt"};
+static constexpr auto THERMALSETTINGS_TEMPLATE_PATH{"thermalsettings_template.txt"};
+static constexpr auto KINEMATICS_TEMPLATE_PATH{"kinematics_template.txt"};
+static constexpr auto ENDSTOPS_TEMPLATE_PATH{"endstops_template.txt"};
+static constexpr auto MOVEMENT_TEMPLATE_PATH{"movement_template.txt"};
+static constexpr auto Z_PROBE_OPTIONS_TEMPLATE_PATH{"z_probe_options_template.txt"};
+static constexpr auto STEPPER_DRIVERS_TEMPLATE_PATH{"stepper_drivers_template.txt"};
+static constexpr auto HOMING_AND_BOUNDS_TEMPLATE_PATH{"homing_and_bounds_template.txt"};
+static constexpr auto FILAMENT_RUNOUT_SENSOR_TEMPLATE_PATH{"filament_runout_sensor_template.txt"};
+static constexpr auto BED_LEVELING_TEMPLATE_PATH{"bed_leveling_template.txt"};
+static constexpr auto HOMING_OPTIONS_TEMPLATE_PATH{"homing_options_template.txt"};
+static constexpr auto ADDITIONAL_FEATURES_TEMPLATE_PATH{"additional_features_template.txt"};
+static constexpr auto USER_INTERFACE_LANGUAGE_TEMPLATE_PATH{"user_interface_language_template.txt"};
+static constexpr auto SD_CARD_TEMPLATE_PATH{"sd_card_template.txt"};
+static constexpr auto LCD_MENU_ITEMS_TEMPLATE_PATH{"lcd_menu_items_template.txt"};
+static constexpr auto ENCODER_TEMPLATE_PATH{"encoder_template.txt"};
+static constexpr auto SPEAKER_TEMPLATE_PATH{"speaker_template.txt"};
+static constexpr auto LCD_CONTROLLER_TEMPLATE_PATH{"lcd_controller_template.txt"};
+static constexpr auto EXTRA_FEATURES_TEMPLATE_PATH{"extra_features_template.txt"};
 
 // Contains default values of all configuration parameters
 namespace defaults
@@ -895,12 +916,113 @@ static constexpr auto ENABLE_LCD_FEEDBACK_FREQUENCY_HZ{false};
 struct PageConfiguration
 {
     virtual QJsonObject ToJson(void) const = 0;
+
+    /// \brief Encodes the page in a canonical binary form
+    ///
+    /// Fields are ordered by name and every value is tagged with its type, so the encoding only
+    /// depends on the field values and not on key order or JSON formatting.
+    ///
+    /// \param pJson: The page as returned by ToJson
+    /// \return the canonical encoding
+    static QByteArray ToCanonicalBytes(const QJsonObject& pJson)
+    {
+        QByteArray bytes;
+        QDataStream stream(&bytes, QIODevice::WriteOnly);
+        stream.setVersion(QDataStream::Qt_5_12);
+        stream.setByteOrder(QDataStream::BigEndian);
+        stream.setFloatingPointPrecision(QDataStream::DoublePrecision);
+
+        auto keys = pJson.keys();
+        std::sort(keys.begin(), keys.end());
+
+        for (const auto& key : keys)
+        {
+            const auto value = pJson.value(key);
+            stream << key.toUtf8();
+
+            if (value.isBool())
+            {
+                stream << quint8('b') << quint8(value.toBool() ? 1 : 0);
+            }
+            else if (value.isDouble())
+            {
+                stream << quint8('n') << (value.toDouble() + 0.0); // + 0.0 folds -0.0 into 0.0
+            }
+            else if (value.isString())
+            {
+                stream << quint8('s') << value.toString().toUtf8();
+            }
+            else
+            {
+                stream << quint8('z');
+            }
+        }
+
+        return bytes;
+    }
+
+    /// \brief Computes the 128-bit digest of a page
+    ///
+    /// \param pJson: The page as returned by ToJson
+    /// \return the MD5 digest of the canonical encoding
+    static QByteArray Digest(const QJsonObject& pJson)
+    {
+        return QCryptographicHash::hash(ToCanonicalBytes(pJson), QCryptographicHash::Md5);
+    }
+
+    /// \brief Computes the 128-bit digest of the page
+    ///
+    /// \return the MD5 digest of the canonical encoding
+    QByteArray Digest(void) const
+    {
+        return Digest(ToJson());
+    }
+};
+
+///
+/// \brief The PageFields struct derives the field access and the JSON conversion of a page from its VisitFields list
+///
+/// VisitFields is the only list of a page's fields, so the JSON, binary and page loaders cannot disagree.
+///
+template <typename T>
+struct PageFields : public PageConfiguration
+{
+    /// \brief Calls a function with the name and a reference of each field, in VisitFields order
+    ///
+    /// \param pFunction: Called with the field name and the field
+    template <typename F>
+    void ForEachField(F&& pFunction)
+    {
+        T::VisitFields(static_cast<T&>(*this), pFunction);
+    }
+
+    /// \brief Calls a function with the name and a const reference of each field, in VisitFields order
+    ///
+    /// \param pFunction: Called with the field name and the field
+    template <typename F>
+    void ForEachField(F&& pFunction) const
+    {
+        T::VisitFields(static_cast<const T&>(*this), pFunction);
+    }
+
+    /// \brief Converts the configuration into a JSON object
+    ///
+    /// \return a JSON object containing the configuration data
+    QJsonObject ToJson(void) const override
+    {
+        QJsonObject json;
+        ForEachField([&json](const char *pField, const auto& pValue)
+        {
+            json[pField] = pValue;
+        });
+        return json;
+    }
 };
 
 ///
 /// \brief The FirmwareConfiguration struct contains firmware configurations
 ///
-struct FirmwareConfiguration : public PageConfiguration
+struct FirmwareConfiguration : public PageFields<FirmwareConfiguration>
 {
     QString STRING_CONFIG_H_AUTHOR{defaults::STRING_CONFIG_H_AUTHOR};
     QString CUSTOM_VERSION_FILE{defaults::CUSTOM_VERSION_FILE};
@@ -911,29 +1033,27 @@ struct FirmwareConfiguration : public PageConfiguration
     bool ENABLE_CUSTOM_VERSION_FILE{defaults::ENABLE_CUSTOM_VERSION_FILE};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["STRING_CONFIG_H_AUTHOR"] = STRING_CONFIG_H_AUTHOR;
-        json["CUSTOM_VERSION_FILE"] = CUSTOM_VERSION_FILE;
-        json["SHOW_BOOTSCREEN"] = SHOW_BOOTSCREEN;
-        json["SHOW_CUSTOM_BOOTSCREEN"] = SHOW_CUSTOM_BOOTSCREEN;
-        json["CUSTOM_STATUS_SCREEN_IMAGE"] = CUSTOM_STATUS_SCREEN_IMAGE;
-        json["ENABLE_STRING_CONFIG_H_AUTHOR"] = ENABLE_STRING_CONFIG_H_AUTHOR;
-        json["ENABLE_CUSTOM_VERSION_FILE"] = ENABLE_CUSTOM_VERSION_FILE;
-
-        return json;
+        pFunction("STRING_CONFIG_H_AUTHOR", pSelf.STRING_CONFIG_H_AUTHOR);
+        pFunction("CUSTOM_VERSION_FILE", pSelf.CUSTOM_VERSION_FILE);
+        pFunction("SHOW_BOOTSCREEN", pSelf.SHOW_BOOTSCREEN);
+        pFunction("SHOW_CUSTOM_BOOTSCREEN", pSelf.SHOW_CUSTOM_BOOTSCREEN);
+        pFunction("CUSTOM_STATUS_SCREEN_IMAGE", pSelf.CUSTOM_STATUS_SCREEN_IMAGE);
+        pFunction("ENABLE_STRING_CONFIG_H_AUTHOR", pSelf.ENABLE_STRING_CONFIG_H_AUTHOR);
+        pFunction("ENABLE_CUSTOM_VERSION_FILE", pSelf.ENABLE_CUSTOM_VERSION_FILE);
     }
 };
 
 ///
 /// \brief The HardwareConfiguration struct contains hardware configurations
 ///
-struct HardwareConfiguration : public PageConfiguration
+struct HardwareConfiguration : public PageFields<HardwareConfiguration>
 {
     QString ENVIRONMENT{defaults::ENVIRONMENT};
     QString MOTHERBOARD{defaults::MOTHERBOARD};
@@ -955,40 +1075,38 @@ struct HardwareConfiguration : public PageConfiguration
     bool ENABLE_MACHINE_UUID{defaults::ENABLE_MACHINE_UUID};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["ENVIRONMENT"] = ENVIRONMENT;
-        json["MOTHERBOARD"] = MOTHERBOARD;
-        json["SERIAL_PORT"] = SERIAL_PORT;
-        json["BAUDRATE"] = BAUDRATE;
-        json["BAUD_RATE_GCODE"] = BAUD_RATE_GCODE;
-        json["SERIAL_PORT_2"] = SERIAL_PORT_2;
-        json["BAUDRATE_2"] = BAUDRATE_2;
-        json["SERIAL_PORT_3"] = SERIAL_PORT_3;
-        json["BAUDRATE_3"] = BAUDRATE_3;
-        json["BLUETOOTH"] = BLUETOOTH;
-        json["CUSTOM_MACHINE_NAME"] = CUSTOM_MACHINE_NAME;
-        json["MACHINE_UUID"] = MACHINE_UUID;
-        json["ENABLE_SERIAL_PORT_2"] = ENABLE_SERIAL_PORT_2;
-        json["ENABLE_BAUDRATE_2"] = ENABLE_BAUDRATE_2;
-        json["ENABLE_SERIAL_PORT_3"] = ENABLE_SERIAL_PORT_3;
-        json["ENABLE_BAUDRATE_3"] = ENABLE_BAUDRATE_3;
-        json["ENABLE_CUSTOM_MACHINE_NAME"] = ENABLE_CUSTOM_MACHINE_NAME;
-        json["ENABLE_MACHINE_UUID"] = ENABLE_MACHINE_UUID;
-
-        return json;
+        pFunction("ENVIRONMENT", pSelf.ENVIRONMENT);
+        pFunction("MOTHERBOARD", pSelf.MOTHERBOARD);
+        pFunction("SERIAL_PORT", pSelf.SERIAL_PORT);
+        pFunction("BAUDRATE", pSelf.BAUDRATE);
+        pFunction("BAUD_RATE_GCODE", pSelf.BAUD_RATE_GCODE);
+        pFunction("SERIAL_PORT_2", pSelf.SERIAL_PORT_2);
+        pFunction("BAUDRATE_2", pSelf.BAUDRATE_2);
+        pFunction("SERIAL_PORT_3", pSelf.SERIAL_PORT_3);
+        pFunction("BAUDRATE_3", pSelf.BAUDRATE_3);
+        pFunction("BLUETOOTH", pSelf.BLUETOOTH);
+        pFunction("CUSTOM_MACHINE_NAME", pSelf.CUSTOM_MACHINE_NAME);
+        pFunction("MACHINE_UUID", pSelf.MACHINE_UUID);
+        pFunction("ENABLE_SERIAL_PORT_2", pSelf.ENABLE_SERIAL_PORT_2);
+        pFunction("ENABLE_BAUDRATE_2", pSelf.ENABLE_BAUDRATE_2);
+        pFunction("ENABLE_SERIAL_PORT_3", pSelf.ENABLE_SERIAL_PORT_3);
+        pFunction("ENABLE_BAUDRATE_3", pSelf.ENABLE_BAUDRATE_3);
+        pFunction("ENABLE_CUSTOM_MACHINE_NAME", pSelf.ENABLE_CUSTOM_MACHINE_NAME);
+        pFunction("ENABLE_MACHINE_UUID", pSelf.ENABLE_MACHINE_UUID);
     }
 };
 
 ///
 /// \brief The ExtruderConfiguration struct contains extruder configurations
 ///
-struct ExtruderConfiguration : public PageConfiguration
+struct ExtruderConfiguration : public PageFields<ExtruderConfiguration>
 {
     int32_t EXTRUDERS{defaults::EXTRUDERS};
     double DEFAULT_NOMINAL_FILAMENT_DIA{defaults::DEFAULT_NOMINAL_FILAMENT_DIA};
@@ -1061,91 +1179,89 @@ struct ExtruderConfiguration : public PageConfiguration
     bool ENABLE_HOTEND_OFFSET_Z{defaults::ENABLE_HOTEND_OFFSET_Z};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["EXTRUDERS"] = EXTRUDERS;
-        json["DEFAULT_NOMINAL_FILAMENT_DIA"] = DEFAULT_NOMINAL_FILAMENT_DIA;
-        json["SINGLENOZZLE"] = SINGLENOZZLE;
-        json["SINGLENOZZLE_STANDBY_TEMP"] = SINGLENOZZLE_STANDBY_TEMP;
-        json["SINGLENOZZLE_STANDBY_FAN"] = SINGLENOZZLE_STANDBY_FAN;
-        json["MMU_MODEL"] = MMU_MODEL;
-        json["SWITCHING_EXTRUDER"] = SWITCHING_EXTRUDER;
-        json["SWITCHING_EXTRUDER_SERVO_NR"] = SWITCHING_EXTRUDER_SERVO_NR;
-        json["SWITCHING_EXTRUDER_SERVO_ANGLES_E0"] = SWITCHING_EXTRUDER_SERVO_ANGLES_E0;
-        json["SWITCHING_EXTRUDER_SERVO_ANGLES_E1"] = SWITCHING_EXTRUDER_SERVO_ANGLES_E1;
-        json["SWITCHING_EXTRUDER_SERVO_ANGLES_E2"] = SWITCHING_EXTRUDER_SERVO_ANGLES_E2;
-        json["SWITCHING_EXTRUDER_SERVO_ANGLES_E3"] = SWITCHING_EXTRUDER_SERVO_ANGLES_E3;
-        json["SWITCHING_EXTRUDER_E23_SERVO_NR"] = SWITCHING_EXTRUDER_E23_SERVO_NR;
-        json["SWITCHING_NOZZLE"] = SWITCHING_NOZZLE;
-        json["SWITCHING_NOZZLE_SERVO_NR"] = SWITCHING_NOZZLE_SERVO_NR;
-        json["SWITCHING_NOZZLE_E1_SERVO_NR"] = SWITCHING_NOZZLE_E1_SERVO_NR;
-        json["SWITCHING_NOZZLE_SERVO_ANGLES_E0"] = SWITCHING_NOZZLE_SERVO_ANGLES_E0;
-        json["SWITCHING_NOZZLE_SERVO_ANGLES_E1"] = SWITCHING_NOZZLE_SERVO_ANGLES_E1;
-        json["SWITCHING_NOZZLE_SERVO_DWELL"] = SWITCHING_NOZZLE_SERVO_DWELL;
-        json["PARKING_EXTRUDER"] = PARKING_EXTRUDER;
-        json["MAGNETIC_PARKING_EXTRUDER"] = MAGNETIC_PARKING_EXTRUDER;
-        json["PARKING_EXTRUDER_PARKING_X_0"] = PARKING_EXTRUDER_PARKING_X_0;
-        json["PARKING_EXTRUDER_PARKING_X_1"] = PARKING_EXTRUDER_PARKING_X_1;
-        json["PARKING_EXTRUDER_GRAB_DISTANCE"] = PARKING_EXTRUDER_GRAB_DISTANCE;
-        json["PARKING_EXTRUDER_SOLENOIDS_INVERT"] = PARKING_EXTRUDER_SOLENOIDS_INVERT;
-        json["PARKING_EXTRUDER_SOLENOIDS_PINS_ACTIVE"] = PARKING_EXTRUDER_SOLENOIDS_PINS_ACTIVE;
-        json["PARKING_EXTRUDER_SOLENOIDS_DELAY"] = PARKING_EXTRUDER_SOLENOIDS_DELAY;
-        json["MANUAL_SOLENOID_CONTROL"] = MANUAL_SOLENOID_CONTROL;
-        json["MPE_FAST_SPEED"] = MPE_FAST_SPEED;
-        json["MPE_SLOW_SPEED"] = MPE_SLOW_SPEED;
-        json["MPE_TRAVEL_DISTANCE"] = MPE_TRAVEL_DISTANCE;
-        json["MPE_COMPENSATION"] = MPE_COMPENSATION;
-        json["SWITCHING_TOOLHEAD"] = SWITCHING_TOOLHEAD;
-        json["MAGNETIC_SWITCHING_TOOLHEAD"] = MAGNETIC_SWITCHING_TOOLHEAD;
-        json["ELECTROMAGNETIC_SWITCHING_TOOLHEAD"] = ELECTROMAGNETIC_SWITCHING_TOOLHEAD;
-        json["ENABLE_MMU_MODEL"] = ENABLE_MMU_MODEL;
-        json["ENABLE_SWITCHING_EXTRUDER_SERVO_ANGLES_E23"] = ENABLE_SWITCHING_EXTRUDER_SERVO_ANGLES_E23;
-        json["ENABLE_SWITCHING_NOZZLE_E1_SERVO_NR"] = ENABLE_SWITCHING_NOZZLE_E1_SERVO_NR;
-        json["ENABLE_PARKING_EXTRUDER_SOLENOIDS_DELAY"] = ENABLE_PARKING_EXTRUDER_SOLENOIDS_DELAY;
-        json["SWITCHING_TOOLHEAD_Y_POS"] = SWITCHING_TOOLHEAD_Y_POS;
-        json["SWITCHING_TOOLHEAD_Y_SECURITY"] = SWITCHING_TOOLHEAD_Y_SECURITY;
-        json["SWITCHING_TOOLHEAD_Y_CLEAR"] = SWITCHING_TOOLHEAD_Y_CLEAR;
-        json["SWITCHING_TOOLHEAD_X_POS0"] = SWITCHING_TOOLHEAD_X_POS0;
-        json["SWITCHING_TOOLHEAD_X_POS1"] = SWITCHING_TOOLHEAD_X_POS1;
-        json["SWITCHING_TOOLHEAD_SERVO_NR"] = SWITCHING_TOOLHEAD_SERVO_NR;
-        json["SWITCHING_TOOLHEAD_SERVO_ANGLES0"] = SWITCHING_TOOLHEAD_SERVO_ANGLES0;
-        json["SWITCHING_TOOLHEAD_SERVO_ANGLES1"] = SWITCHING_TOOLHEAD_SERVO_ANGLES1;
-        json["SWITCHING_TOOLHEAD_Y_RELEASE"] = SWITCHING_TOOLHEAD_Y_RELEASE;
-        json["SWITCHING_TOOLHEAD_X_SECURITY_T0"] = SWITCHING_TOOLHEAD_X_SECURITY_T0;
-        json["SWITCHING_TOOLHEAD_X_SECURITY_T1"] = SWITCHING_TOOLHEAD_X_SECURITY_T1;
-        json["PRIME_BEFORE_REMOVE"] = PRIME_BEFORE_REMOVE;
-        json["SWITCHING_TOOLHEAD_PRIME_MM"] = SWITCHING_TOOLHEAD_PRIME_MM;
-        json["SWITCHING_TOOLHEAD_RETRACT_MM"] = SWITCHING_TOOLHEAD_RETRACT_MM;
-        json["SWITCHING_TOOLHEAD_PRIME_FEEDRATE"] = SWITCHING_TOOLHEAD_PRIME_FEEDRATE;
-        json["SWITCHING_TOOLHEAD_RETRACT_FEEDRATE"] = SWITCHING_TOOLHEAD_RETRACT_FEEDRATE;
-        json["SWITCHING_TOOLHEAD_Z_HOP"] = SWITCHING_TOOLHEAD_Z_HOP;
-        json["MIXING_EXTRUDER"] = MIXING_EXTRUDER;
-        json["MIXING_STEPPERS"] = MIXING_STEPPERS;
-        json["MIXING_VIRTUAL_TOOLS"] = MIXING_VIRTUAL_TOOLS;
-        json["DIRECT_MIXING_IN_G1"] = DIRECT_MIXING_IN_G1;
-        json["GRADIENT_MIX"] = GRADIENT_MIX;
-        json["MIXING_PRESETS"] = MIXING_PRESETS;
-        json["GRADIENT_VTOOL"] = GRADIENT_VTOOL;
-        json["HOTEND_OFFSET_X"] = HOTEND_OFFSET_X;
-        json["HOTEND_OFFSET_Y"] = HOTEND_OFFSET_Y;
-        json["HOTEND_OFFSET_Z"] = HOTEND_OFFSET_Z;
-        json["ENABLE_HOTEND_OFFSET_X"] = ENABLE_HOTEND_OFFSET_X;
-        json["ENABLE_HOTEND_OFFSET_Y"] = ENABLE_HOTEND_OFFSET_Y;
-        json["ENABLE_HOTEND_OFFSET_Z"] = ENABLE_HOTEND_OFFSET_Z;
-
-        return json;
+        pFunction("EXTRUDERS", pSelf.EXTRUDERS);
+        pFunction("DEFAULT_NOMINAL_FILAMENT_DIA", pSelf.DEFAULT_NOMINAL_FILAMENT_DIA);
+        pFunction("SINGLENOZZLE", pSelf.SINGLENOZZLE);
+        pFunction("SINGLENOZZLE_STANDBY_TEMP", pSelf.SINGLENOZZLE_STANDBY_TEMP);
+        pFunction("SINGLENOZZLE_STANDBY_FAN", pSelf.SINGLENOZZLE_STANDBY_FAN);
+        pFunction("MMU_MODEL", pSelf.MMU_MODEL);
+        pFunction("SWITCHING_EXTRUDER", pSelf.SWITCHING_EXTRUDER);
+        pFunction("SWITCHING_EXTRUDER_SERVO_NR", pSelf.SWITCHING_EXTRUDER_SERVO_NR);
+        pFunction("SWITCHING_EXTRUDER_SERVO_ANGLES_E0", pSelf.SWITCHING_EXTRUDER_SERVO_ANGLES_E0);
+        pFunction("SWITCHING_EXTRUDER_SERVO_ANGLES_E1", pSelf.SWITCHING_EXTRUDER_SERVO_ANGLES_E1);
+        pFunction("SWITCHING_EXTRUDER_SERVO_ANGLES_E2", pSelf.SWITCHING_EXTRUDER_SERVO_ANGLES_E2);
+        pFunction("SWITCHING_EXTRUDER_SERVO_ANGLES_E3", pSelf.SWITCHING_EXTRUDER_SERVO_ANGLES_E3);
+        pFunction("SWITCHING_EXTRUDER_E23_SERVO_NR", pSelf.SWITCHING_EXTRUDER_E23_SERVO_NR);
+        pFunction("SWITCHING_NOZZLE", pSelf.SWITCHING_NOZZLE);
+        pFunction("SWITCHING_NOZZLE_SERVO_NR", pSelf.SWITCHING_NOZZLE_SERVO_NR);
+        pFunction("SWITCHING_NOZZLE_E1_SERVO_NR", pSelf.SWITCHING_NOZZLE_E1_SERVO_NR);
+        pFunction("SWITCHING_NOZZLE_SERVO_ANGLES_E0", pSelf.SWITCHING_NOZZLE_SERVO_ANGLES_E0);
+        pFunction("SWITCHING_NOZZLE_SERVO_ANGLES_E1", pSelf.SWITCHING_NOZZLE_SERVO_ANGLES_E1);
+        pFunction("SWITCHING_NOZZLE_SERVO_DWELL", pSelf.SWITCHING_NOZZLE_SERVO_DWELL);
+        pFunction("PARKING_EXTRUDER", pSelf.PARKING_EXTRUDER);
+        pFunction("MAGNETIC_PARKING_EXTRUDER", pSelf.MAGNETIC_PARKING_EXTRUDER);
+        pFunction("PARKING_EXTRUDER_PARKING_X_0", pSelf.PARKING_EXTRUDER_PARKING_X_0);
+        pFunction("PARKING_EXTRUDER_PARKING_X_1", pSelf.PARKING_EXTRUDER_PARKING_X_1);
+        pFunction("PARKING_EXTRUDER_GRAB_DISTANCE", pSelf.PARKING_EXTRUDER_GRAB_DISTANCE);
+        pFunction("PARKING_EXTRUDER_SOLENOIDS_INVERT", pSelf.PARKING_EXTRUDER_SOLENOIDS_INVERT);
+        pFunction("PARKING_EXTRUDER_SOLENOIDS_PINS_ACTIVE", pSelf.PARKING_EXTRUDER_SOLENOIDS_PINS_ACTIVE);
+        pFunction("PARKING_EXTRUDER_SOLENOIDS_DELAY", pSelf.PARKING_EXTRUDER_SOLENOIDS_DELAY);
+        pFunction("MANUAL_SOLENOID_CONTROL", pSelf.MANUAL_SOLENOID_CONTROL);
+        pFunction("MPE_FAST_SPEED", pSelf.MPE_FAST_SPEED);
+        pFunction("MPE_SLOW_SPEED", pSelf.MPE_SLOW_SPEED);
+        pFunction("MPE_TRAVEL_DISTANCE", pSelf.MPE_TRAVEL_DISTANCE);
+        pFunction("MPE_COMPENSATION", pSelf.MPE_COMPENSATION);
+        pFunction("SWITCHING_TOOLHEAD", pSelf.SWITCHING_TOOLHEAD);
+        pFunction("MAGNETIC_SWITCHING_TOOLHEAD", pSelf.MAGNETIC_SWITCHING_TOOLHEAD);
+        pFunction("ELECTROMAGNETIC_SWITCHING_TOOLHEAD", pSelf.ELECTROMAGNETIC_SWITCHING_TOOLHEAD);
+        pFunction("ENABLE_MMU_MODEL", pSelf.ENABLE_MMU_MODEL);
+        pFunction("ENABLE_SWITCHING_EXTRUDER_SERVO_ANGLES_E23", pSelf.ENABLE_SWITCHING_EXTRUDER_SERVO_ANGLES_E23);
+        pFunction("ENABLE_SWITCHING_NOZZLE_E1_SERVO_NR", pSelf.ENABLE_SWITCHING_NOZZLE_E1_SERVO_NR);
+        pFunction("ENABLE_PARKING_EXTRUDER_SOLENOIDS_DELAY", pSelf.ENABLE_PARKING_EXTRUDER_SOLENOIDS_DELAY);
+        pFunction("SWITCHING_TOOLHEAD_Y_POS", pSelf.SWITCHING_TOOLHEAD_Y_POS);
+        pFunction("SWITCHING_TOOLHEAD_Y_SECURITY", pSelf.SWITCHING_TOOLHEAD_Y_SECURITY);
+        pFunction("SWITCHING_TOOLHEAD_Y_CLEAR", pSelf.SWITCHING_TOOLHEAD_Y_CLEAR);
+        pFunction("SWITCHING_TOOLHEAD_X_POS0", pSelf.SWITCHING_TOOLHEAD_X_POS0);
+        pFunction("SWITCHING_TOOLHEAD_X_POS1", pSelf.SWITCHING_TOOLHEAD_X_POS1);
+        pFunction("SWITCHING_TOOLHEAD_SERVO_NR", pSelf.SWITCHING_TOOLHEAD_SERVO_NR);
+        pFunction("SWITCHING_TOOLHEAD_SERVO_ANGLES0", pSelf.SWITCHING_TOOLHEAD_SERVO_ANGLES0);
+        pFunction("SWITCHING_TOOLHEAD_SERVO_ANGLES1", pSelf.SWITCHING_TOOLHEAD_SERVO_ANGLES1);
+        pFunction("SWITCHING_TOOLHEAD_Y_RELEASE", pSelf.SWITCHING_TOOLHEAD_Y_RELEASE);
+        pFunction("SWITCHING_TOOLHEAD_X_SECURITY_T0", pSelf.SWITCHING_TOOLHEAD_X_SECURITY_T0);
+        pFunction("SWITCHING_TOOLHEAD_X_SECURITY_T1", pSelf.SWITCHING_TOOLHEAD_X_SECURITY_T1);
+        pFunction("PRIME_BEFORE_REMOVE", pSelf.PRIME_BEFORE_REMOVE);
+        pFunction("SWITCHING_TOOLHEAD_PRIME_MM", pSelf.SWITCHING_TOOLHEAD_PRIME_MM);
+        pFunction("SWITCHING_TOOLHEAD_RETRACT_MM", pSelf.SWITCHING_TOOLHEAD_RETRACT_MM);
+        pFunction("SWITCHING_TOOLHEAD_PRIME_FEEDRATE", pSelf.SWITCHING_TOOLHEAD_PRIME_FEEDRATE);
+        pFunction("SWITCHING_TOOLHEAD_RETRACT_FEEDRATE", pSelf.SWITCHING_TOOLHEAD_RETRACT_FEEDRATE);
+        pFunction("SWITCHING_TOOLHEAD_Z_HOP", pSelf.SWITCHING_TOOLHEAD_Z_HOP);
+        pFunction("MIXING_EXTRUDER", pSelf.MIXING_EXTRUDER);
+        pFunction("MIXING_STEPPERS", pSelf.MIXING_STEPPERS);
+        pFunction("MIXING_VIRTUAL_TOOLS", pSelf.MIXING_VIRTUAL_TOOLS);
+        pFunction("DIRECT_MIXING_IN_G1", pSelf.DIRECT_MIXING_IN_G1);
+        pFunction("GRADIENT_MIX", pSelf.GRADIENT_MIX);
+        pFunction("MIXING_PRESETS", pSelf.MIXING_PRESETS);
+        pFunction("GRADIENT_VTOOL", pSelf.GRADIENT_VTOOL);
+        pFunction("HOTEND_OFFSET_X", pSelf.HOTEND_OFFSET_X);
+        pFunction("HOTEND_OFFSET_Y", pSelf.HOTEND_OFFSET_Y);
+        pFunction("HOTEND_OFFSET_Z", pSelf.HOTEND_OFFSET_Z);
+        pFunction("ENABLE_HOTEND_OFFSET_X", pSelf.ENABLE_HOTEND_OFFSET_X);
+        pFunction("ENABLE_HOTEND_OFFSET_Y", pSelf.ENABLE_HOTEND_OFFSET_Y);
+        pFunction("ENABLE_HOTEND_OFFSET_Z", pSelf.ENABLE_HOTEND_OFFSET_Z);
     }
 };
 
 ///
 /// \brief The PowerSupplyConfiguration struct contains power supply configurations
 ///
-struct PowerSupplyConfiguration : public PageConfiguration
+struct PowerSupplyConfiguration : public PageFields<PowerSupplyConfiguration>
 {
     bool PSU_CONTROL{defaults::PSU_CONTROL};
     QString PSU_NAME{defaults::PSU_NAME};
@@ -1183,56 +1299,54 @@ struct PowerSupplyConfiguration : public PageConfiguration
     bool ENABLE_AUTO_POWER_COOLER_TEMP{defaults::ENABLE_AUTO_POWER_COOLER_TEMP};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["PSU_CONTROL"] = PSU_CONTROL;
-        json["PSU_NAME"] = PSU_NAME;
-        json["MKS_PWC"] = MKS_PWC;
-        json["PS_OFF_CONFIRM"] = PS_OFF_CONFIRM;
-        json["PS_OFF_SOUND"] = PS_OFF_SOUND;
-        json["PSU_ACTIVE_STATE"] = PSU_ACTIVE_STATE;
-        json["PSU_DEFAULT_OFF"] = PSU_DEFAULT_OFF;
-        json["PSU_POWERUP_DELAY"] = PSU_POWERUP_DELAY;
-        json["LED_POWEROFF_TIMEOUT"] = LED_POWEROFF_TIMEOUT;
-        json["POWER_OFF_TIMER"] = POWER_OFF_TIMER;
-        json["POWER_OFF_WAIT_FOR_COOLDOWN"] = POWER_OFF_WAIT_FOR_COOLDOWN;
-        json["PSU_POWERUP_GCODE"] = PSU_POWERUP_GCODE;
-        json["PSU_POWEROFF_GCODE"] = PSU_POWEROFF_GCODE;
-        json["AUTO_POWER_CONTROL"] = AUTO_POWER_CONTROL;
-        json["AUTO_POWER_FANS"] = AUTO_POWER_FANS;
-        json["AUTO_POWER_E_FANS"] = AUTO_POWER_E_FANS;
-        json["AUTO_POWER_CONTROLLERFAN"] = AUTO_POWER_CONTROLLERFAN;
-        json["AUTO_POWER_CHAMBER_FAN"] = AUTO_POWER_CHAMBER_FAN;
-        json["AUTO_POWER_COOLER_FAN"] = AUTO_POWER_COOLER_FAN;
-        json["POWER_TIMEOUT"] = POWER_TIMEOUT;
-        json["POWER_OFF_DELAY"] = POWER_OFF_DELAY;
-        json["AUTO_POWER_E_TEMP"] = AUTO_POWER_E_TEMP;
-        json["AUTO_POWER_CHAMBER_TEMP"] = AUTO_POWER_CHAMBER_TEMP;
-        json["AUTO_POWER_COOLER_TEMP"] = AUTO_POWER_COOLER_TEMP;
-        json["ENABLE_PSU_NAME"] = ENABLE_PSU_NAME;
-        json["ENABLE_PSU_POWERUP_DELAY"] = ENABLE_PSU_POWERUP_DELAY;
-        json["ENABLE_LED_POWEROFF_TIMEOUT"] = ENABLE_LED_POWEROFF_TIMEOUT;
-        json["ENABLE_PSU_POWERUP_GCODE"] = ENABLE_PSU_POWERUP_GCODE;
-        json["ENABLE_PSU_POWEROFF_GCODE"] = ENABLE_PSU_POWEROFF_GCODE;
-        json["ENABLE_POWER_TIMEOUT"] = ENABLE_POWER_TIMEOUT;
-        json["ENABLE_POWER_OFF_DELAY"] = ENABLE_POWER_OFF_DELAY;
-        json["ENABLE_AUTO_POWER_E_TEMP"] = ENABLE_AUTO_POWER_E_TEMP;
-        json["ENABLE_AUTO_POWER_CHAMBER_TEMP"] = ENABLE_AUTO_POWER_CHAMBER_TEMP;
-        json["ENABLE_AUTO_POWER_COOLER_TEMP"] = ENABLE_AUTO_POWER_COOLER_TEMP;
-
-        return json;
+        pFunction("PSU_CONTROL", pSelf.PSU_CONTROL);
+        pFunction("PSU_NAME", pSelf.PSU_NAME);
+        pFunction("MKS_PWC", pSelf.MKS_PWC);
+        pFunction("PS_OFF_CONFIRM", pSelf.PS_OFF_CONFIRM);
+        pFunction("PS_OFF_SOUND", pSelf.PS_OFF_SOUND);
+        pFunction("PSU_ACTIVE_STATE", pSelf.PSU_ACTIVE_STATE);
+        pFunction("PSU_DEFAULT_OFF", pSelf.PSU_DEFAULT_OFF);
+        pFunction("PSU_POWERUP_DELAY", pSelf.PSU_POWERUP_DELAY);
+        pFunction("LED_POWEROFF_TIMEOUT", pSelf.LED_POWEROFF_TIMEOUT);
+        pFunction("POWER_OFF_TIMER", pSelf.POWER_OFF_TIMER);
+        pFunction("POWER_OFF_WAIT_FOR_COOLDOWN", pSelf.POWER_OFF_WAIT_FOR_COOLDOWN);
+        pFunction("PSU_POWERUP_GCODE", pSelf.PSU_POWERUP_GCODE);
+        pFunction("PSU_POWEROFF_GCODE", pSelf.PSU_POWEROFF_GCODE);
+        pFunction("AUTO_POWER_CONTROL", pSelf.AUTO_POWER_CONTROL);
+        pFunction("AUTO_POWER_FANS", pSelf.AUTO_POWER_FANS);
+        pFunction("AUTO_POWER_E_FANS", pSelf.AUTO_POWER_E_FANS);
+        pFunction("AUTO_POWER_CONTROLLERFAN", pSelf.AUTO_POWER_CONTROLLERFAN);
+        pFunction("AUTO_POWER_CHAMBER_FAN", pSelf.AUTO_POWER_CHAMBER_FAN);
+        pFunction("AUTO_POWER_COOLER_FAN", pSelf.AUTO_POWER_COOLER_FAN);
+        pFunction("POWER_TIMEOUT", pSelf.POWER_TIMEOUT);
+        pFunction("POWER_OFF_DELAY", pSelf.POWER_OFF_DELAY);
+        pFunction("AUTO_POWER_E_TEMP", pSelf.AUTO_POWER_E_TEMP);
+        pFunction("AUTO_POWER_CHAMBER_TEMP", pSelf.AUTO_POWER_CHAMBER_TEMP);
+        pFunction("AUTO_POWER_COOLER_TEMP", pSelf.AUTO_POWER_COOLER_TEMP);
+        pFunction("ENABLE_PSU_NAME", pSelf.ENABLE_PSU_NAME);
+        pFunction("ENABLE_PSU_POWERUP_DELAY", pSelf.ENABLE_PSU_POWERUP_DELAY);
+        pFunction("ENABLE_LED_POWEROFF_TIMEOUT", pSelf.ENABLE_LED_POWEROFF_TIMEOUT);
+        pFunction("ENABLE_PSU_POWERUP_GCODE", pSelf.ENABLE_PSU_POWERUP_GCODE);
+        pFunction("ENABLE_PSU_POWEROFF_GCODE", pSelf.ENABLE_PSU_POWEROFF_GCODE);
+        pFunction("ENABLE_POWER_TIMEOUT", pSelf.ENABLE_POWER_TIMEOUT);
+        pFunction("ENABLE_POWER_OFF_DELAY", pSelf.ENABLE_POWER_OFF_DELAY);
+        pFunction("ENABLE_AUTO_POWER_E_TEMP", pSelf.ENABLE_AUTO_POWER_E_TEMP);
+        pFunction("ENABLE_AUTO_POWER_CHAMBER_TEMP", pSelf.ENABLE_AUTO_POWER_CHAMBER_TEMP);
+        pFunction("ENABLE_AUTO_POWER_COOLER_TEMP", pSelf.ENABLE_AUTO_POWER_COOLER_TEMP);
     }
 };
 
 ///
 /// \brief The ThermalSettingsConfiguration struct contains thermal settings configurations
 ///
-struct ThermalSettingsConfiguration : public PageConfiguration
+struct ThermalSettingsConfiguration : public PageFields<ThermalSettingsConfiguration>
 {
     QString TEMP_SENSOR_0{defaults::TEMP_SENSOR_0};
     QString TEMP_SENSOR_1{defaults::TEMP_SENSOR_1};
@@ -1354,140 +1468,138 @@ struct ThermalSettingsConfiguration : public PageConfiguration
     bool THERMAL_PROTECTION_COOLER{defaults::THERMAL_PROTECTION_COOLER};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["TEMP_SENSOR_0"] = TEMP_SENSOR_0;
-        json["TEMP_SENSOR_1"] = TEMP_SENSOR_1;
-        json["TEMP_SENSOR_2"] = TEMP_SENSOR_2;
-        json["TEMP_SENSOR_3"] = TEMP_SENSOR_3;
-        json["TEMP_SENSOR_4"] = TEMP_SENSOR_4;
-        json["TEMP_SENSOR_5"] = TEMP_SENSOR_5;
-        json["TEMP_SENSOR_6"] = TEMP_SENSOR_6;
-        json["TEMP_SENSOR_7"] = TEMP_SENSOR_7;
-        json["TEMP_SENSOR_BED"] = TEMP_SENSOR_BED;
-        json["TEMP_SENSOR_PROBE"] = TEMP_SENSOR_PROBE;
-        json["TEMP_SENSOR_CHAMBER"] = TEMP_SENSOR_CHAMBER;
-        json["TEMP_SENSOR_COOLER"] = TEMP_SENSOR_COOLER;
-        json["TEMP_SENSOR_BOARD"] = TEMP_SENSOR_BOARD;
-        json["TEMP_SENSOR_REDUNDANT"] = TEMP_SENSOR_REDUNDANT;
-        json["DUMMY_THERMISTOR_998_VALUE"] = DUMMY_THERMISTOR_998_VALUE;
-        json["DUMMY_THERMISTOR_999_VALUE"] = DUMMY_THERMISTOR_999_VALUE;
-        json["MAX31865_SENSOR_OHMS_0"] = MAX31865_SENSOR_OHMS_0;
-        json["MAX31865_CALIBRATION_OHMS_0"] = MAX31865_CALIBRATION_OHMS_0;
-        json["MAX31865_SENSOR_OHMS_1"] = MAX31865_SENSOR_OHMS_1;
-        json["MAX31865_CALIBRATION_OHMS_1"] = MAX31865_CALIBRATION_OHMS_1;
-        json["MAX31865_SENSOR_OHMS_2"] = MAX31865_SENSOR_OHMS_2;
-        json["MAX31865_CALIBRATION_OHMS_2"] = MAX31865_CALIBRATION_OHMS_2;
-        json["TEMP_RESIDENCY_TIME"] = TEMP_RESIDENCY_TIME;
-        json["TEMP_WINDOW"] = TEMP_WINDOW;
-        json["TEMP_HYSTERESIS"] = TEMP_HYSTERESIS;
-        json["TEMP_BED_RESIDENCY_TIME"] = TEMP_BED_RESIDENCY_TIME;
-        json["TEMP_BED_WINDOW"] = TEMP_BED_WINDOW;
-        json["TEMP_BED_HYSTERESIS"] = TEMP_BED_HYSTERESIS;
-        json["TEMP_CHAMBER_RESIDENCY_TIME"] = TEMP_CHAMBER_RESIDENCY_TIME;
-        json["TEMP_CHAMBER_WINDOW"] = TEMP_CHAMBER_WINDOW;
-        json["TEMP_CHAMBER_HYSTERESIS"] = TEMP_CHAMBER_HYSTERESIS;
-        json["TEMP_SENSOR_REDUNDANT_SOURCE"] = TEMP_SENSOR_REDUNDANT_SOURCE;
-        json["TEMP_SENSOR_REDUNDANT_TARGET"] = TEMP_SENSOR_REDUNDANT_TARGET;
-        json["TEMP_SENSOR_REDUNDANT_MAX_DIFF"] = TEMP_SENSOR_REDUNDANT_MAX_DIFF;
-        json["HEATER_0_MINTEMP"] = HEATER_0_MINTEMP;
-        json["HEATER_1_MINTEMP"] = HEATER_1_MINTEMP;
-        json["HEATER_2_MINTEMP"] = HEATER_2_MINTEMP;
-        json["HEATER_3_MINTEMP"] = HEATER_3_MINTEMP;
-        json["HEATER_4_MINTEMP"] = HEATER_4_MINTEMP;
-        json["HEATER_5_MINTEMP"] = HEATER_5_MINTEMP;
-        json["HEATER_6_MINTEMP"] = HEATER_6_MINTEMP;
-        json["HEATER_7_MINTEMP"] = HEATER_7_MINTEMP;
-        json["BED_MINTEMP"] = BED_MINTEMP;
-        json["CHAMBER_MINTEMP"] = CHAMBER_MINTEMP;
-        json["HEATER_0_MAXTEMP"] = HEATER_0_MAXTEMP;
-        json["HEATER_1_MAXTEMP"] = HEATER_1_MAXTEMP;
-        json["HEATER_2_MAXTEMP"] = HEATER_2_MAXTEMP;
-        json["HEATER_3_MAXTEMP"] = HEATER_3_MAXTEMP;
-        json["HEATER_4_MAXTEMP"] = HEATER_4_MAXTEMP;
-        json["HEATER_5_MAXTEMP"] = HEATER_5_MAXTEMP;
-        json["HEATER_6_MAXTEMP"] = HEATER_6_MAXTEMP;
-        json["HEATER_7_MAXTEMP"] = HEATER_7_MAXTEMP;
-        json["BED_MAXTEMP"] = BED_MAXTEMP;
-        json["CHAMBER_MAXTEMP"] = CHAMBER_MAXTEMP;
-        json["HOTEND_OVERSHOOT"] = HOTEND_OVERSHOOT;
-        json["BED_OVERSHOOT"] = BED_OVERSHOOT;
-        json["COOLER_OVERSHOOT"] = COOLER_OVERSHOOT;
-        json["PIDTEMP"] = PIDTEMP;
-        json["MPCTEMP"] = MPCTEMP;
-        json["BANG_MAX"] = BANG_MAX;
-        json["PID_MAX"] = PID_MAX;
-        json["PID_K1"] = PID_K1;
-        json["PID_DEBUG"] = PID_DEBUG;
-        json["PID_PARAMS_PER_HOTEND"] = PID_PARAMS_PER_HOTEND;
-        json["DEFAULT_Kp_LIST"] = DEFAULT_Kp_LIST;
-        json["DEFAULT_Ki_LIST"] = DEFAULT_Ki_LIST;
-        json["DEFAULT_Kd_LIST"] = DEFAULT_Kd_LIST;
-        json["DEFAULT_Kp"] = DEFAULT_Kp;
-        json["DEFAULT_Ki"] = DEFAULT_Ki;
-        json["DEFAULT_Kd"] = DEFAULT_Kd;
-        json["MPC_EDIT_MENU"] = MPC_EDIT_MENU;
-        json["MPC_AUTOTUNE_MENU"] = MPC_AUTOTUNE_MENU;
-        json["MPC_MAX"] = MPC_MAX;
-        json["MPC_HEATER_POWER"] = MPC_HEATER_POWER;
-        json["MPC_INCLUDE_FAN"] = MPC_INCLUDE_FAN;
-        json["MPC_BLOCK_HEAT_CAPACITY"] = MPC_BLOCK_HEAT_CAPACITY;
-        json["MPC_SENSOR_RESPONSIVENESS"] = MPC_SENSOR_RESPONSIVENESS;
-        json["MPC_AMBIENT_XFER_COEFF"] = MPC_AMBIENT_XFER_COEFF;
-        json["MPC_AMBIENT_XFER_COEFF_FAN255"] = MPC_AMBIENT_XFER_COEFF_FAN255;
-        json["MPC_FAN_0_ALL_HOTENDS"] = MPC_FAN_0_ALL_HOTENDS;
-        json["MPC_FAN_0_ACTIVE_HOTEND"] = MPC_FAN_0_ACTIVE_HOTEND;
-        json["FILAMENT_HEAT_CAPACITY_PERMM"] = FILAMENT_HEAT_CAPACITY_PERMM;
-        json["MPC_SMOOTHING_FACTOR"] = MPC_SMOOTHING_FACTOR;
-        json["MPC_MIN_AMBIENT_CHANGE"] = MPC_MIN_AMBIENT_CHANGE;
-        json["MPC_STEADYSTATE"] = MPC_STEADYSTATE;
-        json["MPC_TUNING_POS"] = MPC_TUNING_POS;
-        json["MPC_TUNING_END_Z"] = MPC_TUNING_END_Z;
-        json["PIDTEMPBED"] = PIDTEMPBED;
-        json["BED_LIMIT_SWITCHING"] = BED_LIMIT_SWITCHING;
-        json["MAX_BED_POWER"] = MAX_BED_POWER;
-        json["MIN_BED_POWER"] = MIN_BED_POWER;
-        json["ENABLE_MIN_BED_POWER"] = ENABLE_MIN_BED_POWER;
-        json["PID_BED_DEBUG"] = PID_BED_DEBUG;
-        json["DEFAULT_bedKp"] = DEFAULT_bedKp;
-        json["DEFAULT_bedKi"] = DEFAULT_bedKi;
-        json["DEFAULT_bedKd"] = DEFAULT_bedKd;
-        json["PIDTEMPCHAMBER"] = PIDTEMPCHAMBER;
-        json["CHAMBER_LIMIT_SWITCHING"] = CHAMBER_LIMIT_SWITCHING;
-        json["MAX_CHAMBER_POWER"] = MAX_CHAMBER_POWER;
-        json["MIN_CHAMBER_POWER"] = MIN_CHAMBER_POWER;
-        json["ENABLE_MIN_CHAMBER_POWER"] = ENABLE_MIN_CHAMBER_POWER;
-        json["PID_CHAMBER_DEBUG"] = PID_CHAMBER_DEBUG;
-        json["DEFAULT_chamberKp"] = DEFAULT_chamberKp;
-        json["DEFAULT_chamberKi"] = DEFAULT_chamberKi;
-        json["DEFAULT_chamberKd"] = DEFAULT_chamberKd;
-        json["PID_OPENLOOP"] = PID_OPENLOOP;
-        json["SLOW_PWM_HEATERS"] = SLOW_PWM_HEATERS;
-        json["PID_FUNCTIONAL_RANGE"] = PID_FUNCTIONAL_RANGE;
-        json["PID_EDIT_MENU"] = PID_EDIT_MENU;
-        json["PID_AUTOTUNE_MENU"] = PID_AUTOTUNE_MENU;
-        json["PREVENT_COLD_EXTRUSION"] = PREVENT_COLD_EXTRUSION;
-        json["EXTRUDE_MINTEMP"] = EXTRUDE_MINTEMP;
-        json["PREVENT_LENGTHY_EXTRUDE"] = PREVENT_LENGTHY_EXTRUDE;
-        json["EXTRUDE_MAXLENGTH"] = EXTRUDE_MAXLENGTH;
-        json["THERMAL_PROTECTION_HOTENDS"] = THERMAL_PROTECTION_HOTENDS;
-        json["THERMAL_PROTECTION_BED"] = THERMAL_PROTECTION_BED;
-        json["THERMAL_PROTECTION_CHAMBER"] = THERMAL_PROTECTION_CHAMBER;
-        json["THERMAL_PROTECTION_COOLER"] = THERMAL_PROTECTION_COOLER;
-
-        return json;
+        pFunction("TEMP_SENSOR_0", pSelf.TEMP_SENSOR_0);
+        pFunction("TEMP_SENSOR_1", pSelf.TEMP_SENSOR_1);
+        pFunction("TEMP_SENSOR_2", pSelf.TEMP_SENSOR_2);
+        pFunction("TEMP_SENSOR_3", pSelf.TEMP_SENSOR_3);
+        pFunction("TEMP_SENSOR_4", pSelf.TEMP_SENSOR_4);
+        pFunction("TEMP_SENSOR_5", pSelf.TEMP_SENSOR_5);
+        pFunction("TEMP_SENSOR_6", pSelf.TEMP_SENSOR_6);
+        pFunction("TEMP_SENSOR_7", pSelf.TEMP_SENSOR_7);
+        pFunction("TEMP_SENSOR_BED", pSelf.TEMP_SENSOR_BED);
+        pFunction("TEMP_SENSOR_PROBE", pSelf.TEMP_SENSOR_PROBE);
+        pFunction("TEMP_SENSOR_CHAMBER", pSelf.TEMP_SENSOR_CHAMBER);
+        pFunction("TEMP_SENSOR_COOLER", pSelf.TEMP_SENSOR_COOLER);
+        pFunction("TEMP_SENSOR_BOARD", pSelf.TEMP_SENSOR_BOARD);
+        pFunction("TEMP_SENSOR_REDUNDANT", pSelf.TEMP_SENSOR_REDUNDANT);
+        pFunction("DUMMY_THERMISTOR_998_VALUE", pSelf.DUMMY_THERMISTOR_998_VALUE);
+        pFunction("DUMMY_THERMISTOR_999_VALUE", pSelf.DUMMY_THERMISTOR_999_VALUE);
+        pFunction("MAX31865_SENSOR_OHMS_0", pSelf.MAX31865_SENSOR_OHMS_0);
+        pFunction("MAX31865_CALIBRATION_OHMS_0", pSelf.MAX31865_CALIBRATION_OHMS_0);
+        pFunction("MAX31865_SENSOR_OHMS_1", pSelf.MAX31865_SENSOR_OHMS_1);
+        pFunction("MAX31865_CALIBRATION_OHMS_1", pSelf.MAX31865_CALIBRATION_OHMS_1);
+        pFunction("MAX31865_SENSOR_OHMS_2", pSelf.MAX31865_SENSOR_OHMS_2);
+        pFunction("MAX31865_CALIBRATION_OHMS_2", pSelf.MAX31865_CALIBRATION_OHMS_2);
+        pFunction("TEMP_RESIDENCY_TIME", pSelf.TEMP_RESIDENCY_TIME);
+        pFunction("TEMP_WINDOW", pSelf.TEMP_WINDOW);
+        pFunction("TEMP_HYSTERESIS", pSelf.TEMP_HYSTERESIS);
+        pFunction("TEMP_BED_RESIDENCY_TIME", pSelf.TEMP_BED_RESIDENCY_TIME);
+        pFunction("TEMP_BED_WINDOW", pSelf.TEMP_BED_WINDOW);
+        pFunction("TEMP_BED_HYSTERESIS", pSelf.TEMP_BED_HYSTERESIS);
+        pFunction("TEMP_CHAMBER_RESIDENCY_TIME", pSelf.TEMP_CHAMBER_RESIDENCY_TIME);
+        pFunction("TEMP_CHAMBER_WINDOW", pSelf.TEMP_CHAMBER_WINDOW);
+        pFunction("TEMP_CHAMBER_HYSTERESIS", pSelf.TEMP_CHAMBER_HYSTERESIS);
+        pFunction("TEMP_SENSOR_REDUNDANT_SOURCE", pSelf.TEMP_SENSOR_REDUNDANT_SOURCE);
+        pFunction("TEMP_SENSOR_REDUNDANT_TARGET", pSelf.TEMP_SENSOR_REDUNDANT_TARGET);
+        pFunction("TEMP_SENSOR_REDUNDANT_MAX_DIFF", pSelf.TEMP_SENSOR_REDUNDANT_MAX_DIFF);
+        pFunction("HEATER_0_MINTEMP", pSelf.HEATER_0_MINTEMP);
+        pFunction("HEATER_1_MINTEMP", pSelf.HEATER_1_MINTEMP);
+        pFunction("HEATER_2_MINTEMP", pSelf.HEATER_2_MINTEMP);
+        pFunction("HEATER_3_MINTEMP", pSelf.HEATER_3_MINTEMP);
+        pFunction("HEATER_4_MINTEMP", pSelf.HEATER_4_MINTEMP);
+        pFunction("HEATER_5_MINTEMP", pSelf.HEATER_5_MINTEMP);
+        pFunction("HEATER_6_MINTEMP", pSelf.HEATER_6_MINTEMP);
+        pFunction("HEATER_7_MINTEMP", pSelf.HEATER_7_MINTEMP);
+        pFunction("BED_MINTEMP", pSelf.BED_MINTEMP);
+        pFunction("CHAMBER_MINTEMP", pSelf.CHAMBER_MINTEMP);
+        pFunction("HEATER_0_MAXTEMP", pSelf.HEATER_0_MAXTEMP);
+        pFunction("HEATER_1_MAXTEMP", pSelf.HEATER_1_MAXTEMP);
+        pFunction("HEATER_2_MAXTEMP", pSelf.HEATER_2_MAXTEMP);
+        pFunction("HEATER_3_MAXTEMP", pSelf.HEATER_3_MAXTEMP);
+        pFunction("HEATER_4_MAXTEMP", pSelf.HEATER_4_MAXTEMP);
+        pFunction("HEATER_5_MAXTEMP", pSelf.HEATER_5_MAXTEMP);
+        pFunction("HEATER_6_MAXTEMP", pSelf.HEATER_6_MAXTEMP);
+        pFunction("HEATER_7_MAXTEMP", pSelf.HEATER_7_MAXTEMP);
+        pFunction("BED_MAXTEMP", pSelf.BED_MAXTEMP);
+        pFunction("CHAMBER_MAXTEMP", pSelf.CHAMBER_MAXTEMP);
+        pFunction("HOTEND_OVERSHOOT", pSelf.HOTEND_OVERSHOOT);
+        pFunction("BED_OVERSHOOT", pSelf.BED_OVERSHOOT);
+        pFunction("COOLER_OVERSHOOT", pSelf.COOLER_OVERSHOOT);
+        pFunction("PIDTEMP", pSelf.PIDTEMP);
+        pFunction("MPCTEMP", pSelf.MPCTEMP);
+        pFunction("BANG_MAX", pSelf.BANG_MAX);
+        pFunction("PID_MAX", pSelf.PID_MAX);
+        pFunction("PID_K1", pSelf.PID_K1);
+        pFunction("PID_DEBUG", pSelf.PID_DEBUG);
+        pFunction("PID_PARAMS_PER_HOTEND", pSelf.PID_PARAMS_PER_HOTEND);
+        pFunction("DEFAULT_Kp_LIST", pSelf.DEFAULT_Kp_LIST);
+        pFunction("DEFAULT_Ki_LIST", pSelf.DEFAULT_Ki_LIST);
+        pFunction("DEFAULT_Kd_LIST", pSelf.DEFAULT_Kd_LIST);
+        pFunction("DEFAULT_Kp", pSelf.DEFAULT_Kp);
+        pFunction("DEFAULT_Ki", pSelf.DEFAULT_Ki);
+        pFunction("DEFAULT_Kd", pSelf.DEFAULT_Kd);
+        pFunction("MPC_EDIT_MENU", pSelf.MPC_EDIT_MENU);
+        pFunction("MPC_AUTOTUNE_MENU", pSelf.MPC_AUTOTUNE_MENU);
+        pFunction("MPC_MAX", pSelf.MPC_MAX);
+        pFunction("MPC_HEATER_POWER", pSelf.MPC_HEATER_POWER);
+        pFunction("MPC_INCLUDE_FAN", pSelf.MPC_INCLUDE_FAN);
+        pFunction("MPC_BLOCK_HEAT_CAPACITY", pSelf.MPC_BLOCK_HEAT_CAPACITY);
+        pFunction("MPC_SENSOR_RESPONSIVENESS", pSelf.MPC_SENSOR_RESPONSIVENESS);
+        pFunction("MPC_AMBIENT_XFER_COEFF", pSelf.MPC_AMBIENT_XFER_COEFF);
+        pFunction("MPC_AMBIENT_XFER_COEFF_FAN255", pSelf.MPC_AMBIENT_XFER_COEFF_FAN255);
+        pFunction("MPC_FAN_0_ALL_HOTENDS", pSelf.MPC_FAN_0_ALL_HOTENDS);
+        pFunction("MPC_FAN_0_ACTIVE_HOTEND", pSelf.MPC_FAN_0_ACTIVE_HOTEND);
+        pFunction("FILAMENT_HEAT_CAPACITY_PERMM", pSelf.FILAMENT_HEAT_CAPACITY_PERMM);
+        pFunction("MPC_SMOOTHING_FACTOR", pSelf.MPC_SMOOTHING_FACTOR);
+        pFunction("MPC_MIN_AMBIENT_CHANGE", pSelf.MPC_MIN_AMBIENT_CHANGE);
+        pFunction("MPC_STEADYSTATE", pSelf.MPC_STEADYSTATE);
+        pFunction("MPC_TUNING_POS", pSelf.MPC_TUNING_POS);
+        pFunction("MPC_TUNING_END_Z", pSelf.MPC_TUNING_END_Z);
+        pFunction("PIDTEMPBED", pSelf.PIDTEMPBED);
+        pFunction("BED_LIMIT_SWITCHING", pSelf.BED_LIMIT_SWITCHING);
+        pFunction("MAX_BED_POWER", pSelf.MAX_BED_POWER);
+        pFunction("MIN_BED_POWER", pSelf.MIN_BED_POWER);
+        pFunction("ENABLE_MIN_BED_POWER", pSelf.ENABLE_MIN_BED_POWER);
+        pFunction("PID_BED_DEBUG", pSelf.PID_BED_DEBUG);
+        pFunction("DEFAULT_bedKp", pSelf.DEFAULT_bedKp);
+        pFunction("DEFAULT_bedKi", pSelf.DEFAULT_bedKi);
+        pFunction("DEFAULT_bedKd", pSelf.DEFAULT_bedKd);
+        pFunction("PIDTEMPCHAMBER", pSelf.PIDTEMPCHAMBER);
+        pFunction("CHAMBER_LIMIT_SWITCHING", pSelf.CHAMBER_LIMIT_SWITCHING);
+        pFunction("MAX_CHAMBER_POWER", pSelf.MAX_CHAMBER_POWER);
+        pFunction("MIN_CHAMBER_POWER", pSelf.MIN_CHAMBER_POWER);
+        pFunction("ENABLE_MIN_CHAMBER_POWER", pSelf.ENABLE_MIN_CHAMBER_POWER);
+        pFunction("PID_CHAMBER_DEBUG", pSelf.PID_CHAMBER_DEBUG);
+        pFunction("DEFAULT_chamberKp", pSelf.DEFAULT_chamberKp);
+        pFunction("DEFAULT_chamberKi", pSelf.DEFAULT_chamberKi);
+        pFunction("DEFAULT_chamberKd", pSelf.DEFAULT_chamberKd);
+        pFunction("PID_OPENLOOP", pSelf.PID_OPENLOOP);
+        pFunction("SLOW_PWM_HEATERS", pSelf.SLOW_PWM_HEATERS);
+        pFunction("PID_FUNCTIONAL_RANGE", pSelf.PID_FUNCTIONAL_RANGE);
+        pFunction("PID_EDIT_MENU", pSelf.PID_EDIT_MENU);
+        pFunction("PID_AUTOTUNE_MENU", pSelf.PID_AUTOTUNE_MENU);
+        pFunction("PREVENT_COLD_EXTRUSION", pSelf.PREVENT_COLD_EXTRUSION);
+        pFunction("EXTRUDE_MINTEMP", pSelf.EXTRUDE_MINTEMP);
+        pFunction("PREVENT_LENGTHY_EXTRUDE", pSelf.PREVENT_LENGTHY_EXTRUDE);
+        pFunction("EXTRUDE_MAXLENGTH", pSelf.EXTRUDE_MAXLENGTH);
+        pFunction("THERMAL_PROTECTION_HOTENDS", pSelf.THERMAL_PROTECTION_HOTENDS);
+        pFunction("THERMAL_PROTECTION_BED", pSelf.THERMAL_PROTECTION_BED);
+        pFunction("THERMAL_PROTECTION_CHAMBER", pSelf.THERMAL_PROTECTION_CHAMBER);
+        pFunction("THERMAL_PROTECTION_COOLER", pSelf.THERMAL_PROTECTION_COOLER);
     }
 };
 
 ///
 /// \brief The KinematicsConfiguration struct contains kinematics configurations
 ///
-struct KinematicsConfiguration : public PageConfiguration
+struct KinematicsConfiguration : public PageFields<KinematicsConfiguration>
 {
     bool COREXY{defaults::COREXY};
     bool COREXZ{defaults::COREXZ};
@@ -1542,66 +1654,64 @@ struct KinematicsConfiguration : public PageConfiguration
     bool FOAMCUTTER_XYUV{defaults::FOAMCUTTER_XYUV};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["COREXY"] = COREXY;
-        json["COREXZ"] = COREXZ;
-        json["COREYZ"] = COREYZ;
-        json["COREYX"] = COREYX;
-        json["COREZX"] = COREZX;
-        json["COREZY"] = COREZY;
-        json["MARKFORGED_XY"] = MARKFORGED_XY;
-        json["MARKFORGED_YX"] = MARKFORGED_YX;
-        json["BELTPRINTER"] = BELTPRINTER;
-        json["POLARGRAPH"] = POLARGRAPH;
-        json["POLARGRAPH_MAX_BELT_LEN"] = POLARGRAPH_MAX_BELT_LEN;
-        json["DEFAULT_SEGMENTS_PER_SECOND"] = DEFAULT_SEGMENTS_PER_SECOND;
-        json["DELTA"] = DELTA;
-        json["DELTA_HOME_TO_SAFE_ZONE"] = DELTA_HOME_TO_SAFE_ZONE;
-        json["DELTA_CALIBRATION_MENU"] = DELTA_CALIBRATION_MENU;
-        json["DELTA_AUTO_CALIBRATION"] = DELTA_AUTO_CALIBRATION;
-        json["DELTA_CALIBRATION_DEFAULT_POINTS"] = DELTA_CALIBRATION_DEFAULT_POINTS;
-        json["PROBE_MANUALLY_STEP"] = PROBE_MANUALLY_STEP;
-        json["DELTA_PRINTABLE_RADIUS"] = DELTA_PRINTABLE_RADIUS;
-        json["DELTA_MAX_RADIUS"] = DELTA_MAX_RADIUS;
-        json["DELTA_DIAGONAL_ROD"] = DELTA_DIAGONAL_ROD;
-        json["DELTA_HEIGHT"] = DELTA_HEIGHT;
-        json["DELTA_ENDSTOP_ADJ"] = DELTA_ENDSTOP_ADJ;
-        json["DELTA_RADIUS"] = DELTA_RADIUS;
-        json["DELTA_TOWER_ANGLE_TRIM"] = DELTA_TOWER_ANGLE_TRIM;
-        json["DELTA_RADIUS_TRIM_TOWER"] = DELTA_RADIUS_TRIM_TOWER;
-        json["DELTA_DIAGONAL_ROD_TRIM_TOWER"] = DELTA_DIAGONAL_ROD_TRIM_TOWER;
-        json["ENABLE_DELTA_RADIUS_TRIM_TOWER"] = ENABLE_DELTA_RADIUS_TRIM_TOWER;
-        json["ENABLE_DELTA_DIAGONAL_ROD_TRIM_TOWER"] = ENABLE_DELTA_DIAGONAL_ROD_TRIM_TOWER;
-        json["MORGAN_SCARA"] = MORGAN_SCARA;
-        json["MP_SCARA"] = MP_SCARA;
-        json["SCARA_LINKAGE_1"] = SCARA_LINKAGE_1;
-        json["SCARA_LINKAGE_2"] = SCARA_LINKAGE_2;
-        json["SCARA_OFFSET_X"] = SCARA_OFFSET_X;
-        json["SCARA_OFFSET_Y"] = SCARA_OFFSET_Y;
-        json["DEBUG_SCARA_KINEMATICS"] = DEBUG_SCARA_KINEMATICS;
-        json["SCARA_FEEDRATE_SCALING"] = SCARA_FEEDRATE_SCALING;
-        json["MIDDLE_DEAD_ZONE_R"] = MIDDLE_DEAD_ZONE_R;
-        json["THETA_HOMING_OFFSET"] = THETA_HOMING_OFFSET;
-        json["PSI_HOMING_OFFSET"] = PSI_HOMING_OFFSET;
-        json["SCARA_OFFSET_THETA1"] = SCARA_OFFSET_THETA1;
-        json["SCARA_OFFSET_THETA2"] = SCARA_OFFSET_THETA2;
-        json["AXEL_TPARA"] = AXEL_TPARA;
-        json["DEBUG_TPARA_KINEMATICS"] = DEBUG_TPARA_KINEMATICS;
-        json["TPARA_LINKAGE_1"] = TPARA_LINKAGE_1;
-        json["TPARA_LINKAGE_2"] = TPARA_LINKAGE_2;
-        json["TPARA_OFFSET_X"] = TPARA_OFFSET_X;
-        json["TPARA_OFFSET_Y"] = TPARA_OFFSET_Y;
-        json["TPARA_OFFSET_Z"] = TPARA_OFFSET_Z;
-        json["ARTICULATED_ROBOT_ARM"] = ARTICULATED_ROBOT_ARM;
-        json["FOAMCUTTER_XYUV"] = FOAMCUTTER_XYUV;
-
-        return json;
+        pFunction("COREXY", pSelf.COREXY);
+        pFunction("COREXZ", pSelf.COREXZ);
+        pFunction("COREYZ", pSelf.COREYZ);
+        pFunction("COREYX", pSelf.COREYX);
+        pFunction("COREZX", pSelf.COREZX);
+        pFunction("COREZY", pSelf.COREZY);
+        pFunction("MARKFORGED_XY", pSelf.MARKFORGED_XY);
+        pFunction("MARKFORGED_YX", pSelf.MARKFORGED_YX);
+        pFunction("BELTPRINTER", pSelf.BELTPRINTER);
+        pFunction("POLARGRAPH", pSelf.POLARGRAPH);
+        pFunction("POLARGRAPH_MAX_BELT_LEN", pSelf.POLARGRAPH_MAX_BELT_LEN);
+        pFunction("DEFAULT_SEGMENTS_PER_SECOND", pSelf.DEFAULT_SEGMENTS_PER_SECOND);
+        pFunction("DELTA", pSelf.DELTA);
+        pFunction("DELTA_HOME_TO_SAFE_ZONE", pSelf.DELTA_HOME_TO_SAFE_ZONE);
+        pFunction("DELTA_CALIBRATION_MENU", pSelf.DELTA_CALIBRATION_MENU);
+        pFunction("DELTA_AUTO_CALIBRATION", pSelf.DELTA_AUTO_CALIBRATION);
+        pFunction("DELTA_CALIBRATION_DEFAULT_POINTS", pSelf.DELTA_CALIBRATION_DEFAULT_POINTS);
+        pFunction("PROBE_MANUALLY_STEP", pSelf.PROBE_MANUALLY_STEP);
+        pFunction("DELTA_PRINTABLE_RADIUS", pSelf.DELTA_PRINTABLE_RADIUS);
+        pFunction("DELTA_MAX_RADIUS", pSelf.DELTA_MAX_RADIUS);
+        pFunction("DELTA_DIAGONAL_ROD", pSelf.DELTA_DIAGONAL_ROD);
+        pFunction("DELTA_HEIGHT", pSelf.DELTA_HEIGHT);
+        pFunction("DELTA_ENDSTOP_ADJ", pSelf.DELTA_ENDSTOP_ADJ);
+        pFunction("DELTA_RADIUS", pSelf.DELTA_RADIUS);
+        pFunction("DELTA_TOWER_ANGLE_TRIM", pSelf.DELTA_TOWER_ANGLE_TRIM);
+        pFunction("DELTA_RADIUS_TRIM_TOWER", pSelf.DELTA_RADIUS_TRIM_TOWER);
+        pFunction("DELTA_DIAGONAL_ROD_TRIM_TOWER", pSelf.DELTA_DIAGONAL_ROD_TRIM_TOWER);
+        pFunction("ENABLE_DELTA_RADIUS_TRIM_TOWER", pSelf.ENABLE_DELTA_RADIUS_TRIM_TOWER);
+        pFunction("ENABLE_DELTA_DIAGONAL_ROD_TRIM_TOWER", pSelf.ENABLE_DELTA_DIAGONAL_ROD_TRIM_TOWER);
+        pFunction("MORGAN_SCARA", pSelf.MORGAN_SCARA);
+        pFunction("MP_SCARA", pSelf.MP_SCARA);
+        pFunction("SCARA_LINKAGE_1", pSelf.SCARA_LINKAGE_1);
+        pFunction("SCARA_LINKAGE_2", pSelf.SCARA_LINKAGE_2);
+        pFunction("SCARA_OFFSET_X", pSelf.SCARA_OFFSET_X);
+        pFunction("SCARA_OFFSET_Y", pSelf.SCARA_OFFSET_Y);
+        pFunction("DEBUG_SCARA_KINEMATICS", pSelf.DEBUG_SCARA_KINEMATICS);
+        pFunction("SCARA_FEEDRATE_SCALING", pSelf.SCARA_FEEDRATE_SCALING);
+        pFunction("MIDDLE_DEAD_ZONE_R", pSelf.MIDDLE_DEAD_ZONE_R);
+        pFunction("THETA_HOMING_OFFSET", pSelf.THETA_HOMING_OFFSET);
+        pFunction("PSI_HOMING_OFFSET", pSelf.PSI_HOMING_OFFSET);
+        pFunction("SCARA_OFFSET_THETA1", pSelf.SCARA_OFFSET_THETA1);
+        pFunction("SCARA_OFFSET_THETA2", pSelf.SCARA_OFFSET_THETA2);
+        pFunction("AXEL_TPARA", pSelf.AXEL_TPARA);
+        pFunction("DEBUG_TPARA_KINEMATICS", pSelf.DEBUG_TPARA_KINEMATICS);
+        pFunction("TPARA_LINKAGE_1", pSelf.TPARA_LINKAGE_1);
+        pFunction("TPARA_LINKAGE_2", pSelf.TPARA_LINKAGE_2);
+        pFunction("TPARA_OFFSET_X", pSelf.TPARA_OFFSET_X);
+        pFunction("TPARA_OFFSET_Y", pSelf.TPARA_OFFSET_Y);
+        pFunction("TPARA_OFFSET_Z", pSelf.TPARA_OFFSET_Z);
+        pFunction("ARTICULATED_ROBOT_ARM", pSelf.ARTICULATED_ROBOT_ARM);
+        pFunction("FOAMCUTTER_XYUV", pSelf.FOAMCUTTER_XYUV);
     }
 };
 
@@ -1609,7 +1719,7 @@ public:
 ///
 /// \brief The EndstopsConfiguration struct contains endstops configurations
 ///
-struct EndstopsConfiguration : public PageConfiguration
+struct EndstopsConfiguration : public PageFields<EndstopsConfiguration>
 {
     bool USE_XMIN_PLUG{defaults::USE_XMIN_PLUG};
     bool USE_YMIN_PLUG{defaults::USE_YMIN_PLUG};
@@ -1694,103 +1804,101 @@ struct EndstopsConfiguration : public PageConfiguration
     bool DETECT_BROKEN_ENDSTOP{defaults::DETECT_BROKEN_ENDSTOP};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["USE_XMIN_PLUG"] = USE_XMIN_PLUG;
-        json["USE_YMIN_PLUG"] = USE_YMIN_PLUG;
-        json["USE_ZMIN_PLUG"] = USE_ZMIN_PLUG;
-        json["USE_IMIN_PLUG"] = USE_IMIN_PLUG;
-        json["USE_JMIN_PLUG"] = USE_JMIN_PLUG;
-        json["USE_KMIN_PLUG"] = USE_KMIN_PLUG;
-        json["USE_UMIN_PLUG"] = USE_UMIN_PLUG;
-        json["USE_VMIN_PLUG"] = USE_VMIN_PLUG;
-        json["USE_WMIN_PLUG"] = USE_WMIN_PLUG;
-        json["USE_XMAX_PLUG"] = USE_XMAX_PLUG;
-        json["USE_YMAX_PLUG"] = USE_YMAX_PLUG;
-        json["USE_ZMAX_PLUG"] = USE_ZMAX_PLUG;
-        json["USE_IMAX_PLUG"] = USE_IMAX_PLUG;
-        json["USE_JMAX_PLUG"] = USE_JMAX_PLUG;
-        json["USE_KMAX_PLUG"] = USE_KMAX_PLUG;
-        json["USE_UMAX_PLUG"] = USE_UMAX_PLUG;
-        json["USE_VMAX_PLUG"] = USE_VMAX_PLUG;
-        json["USE_WMAX_PLUG"] = USE_WMAX_PLUG;
-        json["ENDSTOPPULLUPS"] = ENDSTOPPULLUPS;
-        json["ENDSTOPPULLUP_XMIN"] = ENDSTOPPULLUP_XMIN;
-        json["ENDSTOPPULLUP_YMIN"] = ENDSTOPPULLUP_YMIN;
-        json["ENDSTOPPULLUP_ZMIN"] = ENDSTOPPULLUP_ZMIN;
-        json["ENDSTOPPULLUP_IMIN"] = ENDSTOPPULLUP_IMIN;
-        json["ENDSTOPPULLUP_JMIN"] = ENDSTOPPULLUP_JMIN;
-        json["ENDSTOPPULLUP_KMIN"] = ENDSTOPPULLUP_KMIN;
-        json["ENDSTOPPULLUP_UMIN"] = ENDSTOPPULLUP_UMIN;
-        json["ENDSTOPPULLUP_VMIN"] = ENDSTOPPULLUP_VMIN;
-        json["ENDSTOPPULLUP_WMIN"] = ENDSTOPPULLUP_WMIN;
-        json["ENDSTOPPULLUP_XMAX"] = ENDSTOPPULLUP_XMAX;
-        json["ENDSTOPPULLUP_YMAX"] = ENDSTOPPULLUP_YMAX;
-        json["ENDSTOPPULLUP_ZMAX"] = ENDSTOPPULLUP_ZMAX;
-        json["ENDSTOPPULLUP_IMAX"] = ENDSTOPPULLUP_IMAX;
-        json["ENDSTOPPULLUP_JMAX"] = ENDSTOPPULLUP_JMAX;
-        json["ENDSTOPPULLUP_KMAX"] = ENDSTOPPULLUP_KMAX;
-        json["ENDSTOPPULLUP_UMAX"] = ENDSTOPPULLUP_UMAX;
-        json["ENDSTOPPULLUP_VMAX"] = ENDSTOPPULLUP_VMAX;
-        json["ENDSTOPPULLUP_WMAX"] = ENDSTOPPULLUP_WMAX;
-        json["ENDSTOPPULLUP_ZMIN_PROBE"] = ENDSTOPPULLUP_ZMIN_PROBE;
-        json["ENDSTOPPULLDOWNS"] = ENDSTOPPULLDOWNS;
-        json["ENDSTOPPULLDOWN_XMIN"] = ENDSTOPPULLDOWN_XMIN;
-        json["ENDSTOPPULLDOWN_YMIN"] = ENDSTOPPULLDOWN_YMIN;
-        json["ENDSTOPPULLDOWN_ZMIN"] = ENDSTOPPULLDOWN_ZMIN;
-        json["ENDSTOPPULLDOWN_IMIN"] = ENDSTOPPULLDOWN_IMIN;
-        json["ENDSTOPPULLDOWN_JMIN"] = ENDSTOPPULLDOWN_JMIN;
-        json["ENDSTOPPULLDOWN_KMIN"] = ENDSTOPPULLDOWN_KMIN;
-        json["ENDSTOPPULLDOWN_UMIN"] = ENDSTOPPULLDOWN_UMIN;
-        json["ENDSTOPPULLDOWN_VMIN"] = ENDSTOPPULLDOWN_VMIN;
-        json["ENDSTOPPULLDOWN_WMIN"] = ENDSTOPPULLDOWN_WMIN;
-        json["ENDSTOPPULLDOWN_XMAX"] = ENDSTOPPULLDOWN_XMAX;
-        json["ENDSTOPPULLDOWN_YMAX"] = ENDSTOPPULLDOWN_YMAX;
-        json["ENDSTOPPULLDOWN_ZMAX"] = ENDSTOPPULLDOWN_ZMAX;
-        json["ENDSTOPPULLDOWN_IMAX"] = ENDSTOPPULLDOWN_IMAX;
-        json["ENDSTOPPULLDOWN_JMAX"] = ENDSTOPPULLDOWN_JMAX;
-        json["ENDSTOPPULLDOWN_KMAX"] = ENDSTOPPULLDOWN_KMAX;
-        json["ENDSTOPPULLDOWN_UMAX"] = ENDSTOPPULLDOWN_UMAX;
-        json["ENDSTOPPULLDOWN_VMAX"] = ENDSTOPPULLDOWN_VMAX;
-        json["ENDSTOPPULLDOWN_WMAX"] = ENDSTOPPULLDOWN_WMAX;
-        json["ENDSTOPPULLDOWN_ZMIN_PROBE"] = ENDSTOPPULLDOWN_ZMIN_PROBE;
-        json["X_MIN_ENDSTOP_INVERTING"] = X_MIN_ENDSTOP_INVERTING;
-        json["Y_MIN_ENDSTOP_INVERTING"] = Y_MIN_ENDSTOP_INVERTING;
-        json["Z_MIN_ENDSTOP_INVERTING"] = Z_MIN_ENDSTOP_INVERTING;
-        json["I_MIN_ENDSTOP_INVERTING"] = I_MIN_ENDSTOP_INVERTING;
-        json["J_MIN_ENDSTOP_INVERTING"] = J_MIN_ENDSTOP_INVERTING;
-        json["K_MIN_ENDSTOP_INVERTING"] = K_MIN_ENDSTOP_INVERTING;
-        json["U_MIN_ENDSTOP_INVERTING"] = U_MIN_ENDSTOP_INVERTING;
-        json["V_MIN_ENDSTOP_INVERTING"] = V_MIN_ENDSTOP_INVERTING;
-        json["W_MIN_ENDSTOP_INVERTING"] = W_MIN_ENDSTOP_INVERTING;
-        json["X_MAX_ENDSTOP_INVERTING"] = X_MAX_ENDSTOP_INVERTING;
-        json["Y_MAX_ENDSTOP_INVERTING"] = Y_MAX_ENDSTOP_INVERTING;
-        json["Z_MAX_ENDSTOP_INVERTING"] = Z_MAX_ENDSTOP_INVERTING;
-        json["I_MAX_ENDSTOP_INVERTING"] = I_MAX_ENDSTOP_INVERTING;
-        json["J_MAX_ENDSTOP_INVERTING"] = J_MAX_ENDSTOP_INVERTING;
-        json["K_MAX_ENDSTOP_INVERTING"] = K_MAX_ENDSTOP_INVERTING;
-        json["U_MAX_ENDSTOP_INVERTING"] = U_MAX_ENDSTOP_INVERTING;
-        json["V_MAX_ENDSTOP_INVERTING"] = V_MAX_ENDSTOP_INVERTING;
-        json["W_MAX_ENDSTOP_INVERTING"] = W_MAX_ENDSTOP_INVERTING;
-        json["Z_MIN_PROBE_ENDSTOP_INVERTING"] = Z_MIN_PROBE_ENDSTOP_INVERTING;
-        json["ENDSTOP_INTERRUPTS_FEATURE"] = ENDSTOP_INTERRUPTS_FEATURE;
-        json["ENDSTOP_NOISE_THRESHOLD"] = ENDSTOP_NOISE_THRESHOLD;
-        json["ENABLE_ENDSTOP_NOISE_THRESHOLD"] = ENABLE_ENDSTOP_NOISE_THRESHOLD;
-        json["DETECT_BROKEN_ENDSTOP"] = DETECT_BROKEN_ENDSTOP;
-
-        return json;
+        pFunction("USE_XMIN_PLUG", pSelf.USE_XMIN_PLUG);
+        pFunction("USE_YMIN_PLUG", pSelf.USE_YMIN_PLUG);
+        pFunction("USE_ZMIN_PLUG", pSelf.USE_ZMIN_PLUG);
+        pFunction("USE_IMIN_PLUG", pSelf.USE_IMIN_PLUG);
+        pFunction("USE_JMIN_PLUG", pSelf.USE_JMIN_PLUG);
+        pFunction("USE_KMIN_PLUG", pSelf.USE_KMIN_PLUG);
+        pFunction("USE_UMIN_PLUG", pSelf.USE_UMIN_PLUG);
+        pFunction("USE_VMIN_PLUG", pSelf.USE_VMIN_PLUG);
+        pFunction("USE_WMIN_PLUG", pSelf.USE_WMIN_PLUG);
+        pFunction("USE_XMAX_PLUG", pSelf.USE_XMAX_PLUG);
+        pFunction("USE_YMAX_PLUG", pSelf.USE_YMAX_PLUG);
+        pFunction("USE_ZMAX_PLUG", pSelf.USE_ZMAX_PLUG);
+        pFunction("USE_IMAX_PLUG", pSelf.USE_IMAX_PLUG);
+        pFunction("USE_JMAX_PLUG", pSelf.USE_JMAX_PLUG);
+        pFunction("USE_KMAX_PLUG", pSelf.USE_KMAX_PLUG);
+        pFunction("USE_UMAX_PLUG", pSelf.USE_UMAX_PLUG);
+        pFunction("USE_VMAX_PLUG", pSelf.USE_VMAX_PLUG);
+        pFunction("USE_WMAX_PLUG", pSelf.USE_WMAX_PLUG);
+        pFunction("ENDSTOPPULLUPS", pSelf.ENDSTOPPULLUPS);
+        pFunction("ENDSTOPPULLUP_XMIN", pSelf.ENDSTOPPULLUP_XMIN);
+        pFunction("ENDSTOPPULLUP_YMIN", pSelf.ENDSTOPPULLUP_YMIN);
+        pFunction("ENDSTOPPULLUP_ZMIN", pSelf.ENDSTOPPULLUP_ZMIN);
+        pFunction("ENDSTOPPULLUP_IMIN", pSelf.ENDSTOPPULLUP_IMIN);
+        pFunction("ENDSTOPPULLUP_JMIN", pSelf.ENDSTOPPULLUP_JMIN);
+        pFunction("ENDSTOPPULLUP_KMIN", pSelf.ENDSTOPPULLUP_KMIN);
+        pFunction("ENDSTOPPULLUP_UMIN", pSelf.ENDSTOPPULLUP_UMIN);
+        pFunction("ENDSTOPPULLUP_VMIN", pSelf.ENDSTOPPULLUP_VMIN);
+        pFunction("ENDSTOPPULLUP_WMIN", pSelf.ENDSTOPPULLUP_WMIN);
+        pFunction("ENDSTOPPULLUP_XMAX", pSelf.ENDSTOPPULLUP_XMAX);
+        pFunction("ENDSTOPPULLUP_YMAX", pSelf.ENDSTOPPULLUP_YMAX);
+        pFunction("ENDSTOPPULLUP_ZMAX", pSelf.ENDSTOPPULLUP_ZMAX);
+        pFunction("ENDSTOPPULLUP_IMAX", pSelf.ENDSTOPPULLUP_IMAX);
+        pFunction("ENDSTOPPULLUP_JMAX", pSelf.ENDSTOPPULLUP_JMAX);
+        pFunction("ENDSTOPPULLUP_KMAX", pSelf.ENDSTOPPULLUP_KMAX);
+        pFunction("ENDSTOPPULLUP_UMAX", pSelf.ENDSTOPPULLUP_UMAX);
+        pFunction("ENDSTOPPULLUP_VMAX", pSelf.ENDSTOPPULLUP_VMAX);
+        pFunction("ENDSTOPPULLUP_WMAX", pSelf.ENDSTOPPULLUP_WMAX);
+        pFunction("ENDSTOPPULLUP_ZMIN_PROBE", pSelf.ENDSTOPPULLUP_ZMIN_PROBE);
+        pFunction("ENDSTOPPULLDOWNS", pSelf.ENDSTOPPULLDOWNS);
+        pFunction("ENDSTOPPULLDOWN_XMIN", pSelf.ENDSTOPPULLDOWN_XMIN);
+        pFunction("ENDSTOPPULLDOWN_YMIN", pSelf.ENDSTOPPULLDOWN_YMIN);
+        pFunction("ENDSTOPPULLDOWN_ZMIN", pSelf.ENDSTOPPULLDOWN_ZMIN);
+        pFunction("ENDSTOPPULLDOWN_IMIN", pSelf.ENDSTOPPULLDOWN_IMIN);
+        pFunction("ENDSTOPPULLDOWN_JMIN", pSelf.ENDSTOPPULLDOWN_JMIN);
+        pFunction("ENDSTOPPULLDOWN_KMIN", pSelf.ENDSTOPPULLDOWN_KMIN);
+        pFunction("ENDSTOPPULLDOWN_UMIN", pSelf.ENDSTOPPULLDOWN_UMIN);
+        pFunction("ENDSTOPPULLDOWN_VMIN", pSelf.ENDSTOPPULLDOWN_VMIN);
+        pFunction("ENDSTOPPULLDOWN_WMIN", pSelf.ENDSTOPPULLDOWN_WMIN);
+        pFunction("ENDSTOPPULLDOWN_XMAX", pSelf.ENDSTOPPULLDOWN_XMAX);
+        pFunction("ENDSTOPPULLDOWN_YMAX", pSelf.ENDSTOPPULLDOWN_YMAX);
+        pFunction("ENDSTOPPULLDOWN_ZMAX", pSelf.ENDSTOPPULLDOWN_ZMAX);
+        pFunction("ENDSTOPPULLDOWN_IMAX", pSelf.ENDSTOPPULLDOWN_IMAX);
+        pFunction("ENDSTOPPULLDOWN_JMAX", pSelf.ENDSTOPPULLDOWN_JMAX);
+        pFunction("ENDSTOPPULLDOWN_KMAX", pSelf.ENDSTOPPULLDOWN_KMAX);
+        pFunction("ENDSTOPPULLDOWN_UMAX", pSelf.ENDSTOPPULLDOWN_UMAX);
+        pFunction("ENDSTOPPULLDOWN_VMAX", pSelf.ENDSTOPPULLDOWN_VMAX);
+        pFunction("ENDSTOPPULLDOWN_WMAX", pSelf.ENDSTOPPULLDOWN_WMAX);
+        pFunction("ENDSTOPPULLDOWN_ZMIN_PROBE", pSelf.ENDSTOPPULLDOWN_ZMIN_PROBE);
+        pFunction("X_MIN_ENDSTOP_INVERTING", pSelf.X_MIN_ENDSTOP_INVERTING);
+        pFunction("Y_MIN_ENDSTOP_INVERTING", pSelf.Y_MIN_ENDSTOP_INVERTING);
+        pFunction("Z_MIN_ENDSTOP_INVERTING", pSelf.Z_MIN_ENDSTOP_INVERTING);
+        pFunction("I_MIN_ENDSTOP_INVERTING", pSelf.I_MIN_ENDSTOP_INVERTING);
+        pFunction("J_MIN_ENDSTOP_INVERTING", pSelf.J_MIN_ENDSTOP_INVERTING);
+        pFunction("K_MIN_ENDSTOP_INVERTING", pSelf.K_MIN_ENDSTOP_INVERTING);
+        pFunction("U_MIN_ENDSTOP_INVERTING", pSelf.U_MIN_ENDSTOP_INVERTING);
+        pFunction("V_MIN_ENDSTOP_INVERTING", pSelf.V_MIN_ENDSTOP_INVERTING);
+        pFunction("W_MIN_ENDSTOP_INVERTING", pSelf.W_MIN_ENDSTOP_INVERTING);
+        pFunction("X_MAX_ENDSTOP_INVERTING", pSelf.X_MAX_ENDSTOP_INVERTING);
+        pFunction("Y_MAX_ENDSTOP_INVERTING", pSelf.Y_MAX_ENDSTOP_INVERTING);
+        pFunction("Z_MAX_ENDSTOP_INVERTING", pSelf.Z_MAX_ENDSTOP_INVERTING);
+        pFunction("I_MAX_ENDSTOP_INVERTING", pSelf.I_MAX_ENDSTOP_INVERTING);
+        pFunction("J_MAX_ENDSTOP_INVERTING", pSelf.J_MAX_ENDSTOP_INVERTING);
+        pFunction("K_MAX_ENDSTOP_INVERTING", pSelf.K_MAX_ENDSTOP_INVERTING);
+        pFunction("U_MAX_ENDSTOP_INVERTING", pSelf.U_MAX_ENDSTOP_INVERTING);
+        pFunction("V_MAX_ENDSTOP_INVERTING", pSelf.V_MAX_ENDSTOP_INVERTING);
+        pFunction("W_MAX_ENDSTOP_INVERTING", pSelf.W_MAX_ENDSTOP_INVERTING);
+        pFunction("Z_MIN_PROBE_ENDSTOP_INVERTING", pSelf.Z_MIN_PROBE_ENDSTOP_INVERTING);
+        pFunction("ENDSTOP_INTERRUPTS_FEATURE", pSelf.ENDSTOP_INTERRUPTS_FEATURE);
+        pFunction("ENDSTOP_NOISE_THRESHOLD", pSelf.ENDSTOP_NOISE_THRESHOLD);
+        pFunction("ENABLE_ENDSTOP_NOISE_THRESHOLD", pSelf.ENABLE_ENDSTOP_NOISE_THRESHOLD);
+        pFunction("DETECT_BROKEN_ENDSTOP", pSelf.DETECT_BROKEN_ENDSTOP);
     }
 };
 
 ///
 /// \brief The StepperDriversConfiguration struct contains stepper drivers configurations
 ///
-struct StepperDriversConfiguration : public PageConfiguration
+struct StepperDriversConfiguration : public PageFields<StepperDriversConfiguration>
 {
     QString X_DRIVER_TYPE{defaults::X_DRIVER_TYPE};
     QString Y_DRIVER_TYPE{defaults::Y_DRIVER_TYPE};
@@ -1917,145 +2025,143 @@ struct StepperDriversConfiguration : public PageConfiguration
     bool DISABLE_REDUCED_ACCURACY_WARNING{defaults::DISABLE_REDUCED_ACCURACY_WARNING};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["X_DRIVER_TYPE"] = X_DRIVER_TYPE;
-        json["Y_DRIVER_TYPE"] = Y_DRIVER_TYPE;
-        json["Z_DRIVER_TYPE"] = Z_DRIVER_TYPE;
-        json["X2_DRIVER_TYPE"] = X2_DRIVER_TYPE;
-        json["Y2_DRIVER_TYPE"] = Y2_DRIVER_TYPE;
-        json["Z2_DRIVER_TYPE"] = Z2_DRIVER_TYPE;
-        json["Z3_DRIVER_TYPE"] = Z3_DRIVER_TYPE;
-        json["Z4_DRIVER_TYPE"] = Z4_DRIVER_TYPE;
-        json["ENABLE_X_DRIVER_TYPE"] = ENABLE_X_DRIVER_TYPE;
-        json["ENABLE_Y_DRIVER_TYPE"] = ENABLE_Y_DRIVER_TYPE;
-        json["ENABLE_Z_DRIVER_TYPE"] = ENABLE_Z_DRIVER_TYPE;
-        json["ENABLE_X2_DRIVER_TYPE"] = ENABLE_X2_DRIVER_TYPE;
-        json["ENABLE_Y2_DRIVER_TYPE"] = ENABLE_Y2_DRIVER_TYPE;
-        json["ENABLE_Z2_DRIVER_TYPE"] = ENABLE_Z2_DRIVER_TYPE;
-        json["ENABLE_Z3_DRIVER_TYPE"] = ENABLE_Z3_DRIVER_TYPE;
-        json["ENABLE_Z4_DRIVER_TYPE"] = ENABLE_Z4_DRIVER_TYPE;
-        json["I_DRIVER_TYPE"] = I_DRIVER_TYPE;
-        json["J_DRIVER_TYPE"] = J_DRIVER_TYPE;
-        json["K_DRIVER_TYPE"] = K_DRIVER_TYPE;
-        json["ENABLE_I_DRIVER_TYPE"] = ENABLE_I_DRIVER_TYPE;
-        json["ENABLE_J_DRIVER_TYPE"] = ENABLE_J_DRIVER_TYPE;
-        json["ENABLE_K_DRIVER_TYPE"] = ENABLE_K_DRIVER_TYPE;
-        json["U_DRIVER_TYPE"] = U_DRIVER_TYPE;
-        json["V_DRIVER_TYPE"] = V_DRIVER_TYPE;
-        json["W_DRIVER_TYPE"] = W_DRIVER_TYPE;
-        json["ENABLE_U_DRIVER_TYPE"] = ENABLE_U_DRIVER_TYPE;
-        json["ENABLE_V_DRIVER_TYPE"] = ENABLE_V_DRIVER_TYPE;
-        json["ENABLE_W_DRIVER_TYPE"] = ENABLE_W_DRIVER_TYPE;
-        json["E0_DRIVER_TYPE"] = E0_DRIVER_TYPE;
-        json["E1_DRIVER_TYPE"] = E1_DRIVER_TYPE;
-        json["E2_DRIVER_TYPE"] = E2_DRIVER_TYPE;
-        json["E3_DRIVER_TYPE"] = E3_DRIVER_TYPE;
-        json["E4_DRIVER_TYPE"] = E4_DRIVER_TYPE;
-        json["E5_DRIVER_TYPE"] = E5_DRIVER_TYPE;
-        json["E6_DRIVER_TYPE"] = E6_DRIVER_TYPE;
-        json["E7_DRIVER_TYPE"] = E7_DRIVER_TYPE;
-        json["ENABLE_E0_DRIVER_TYPE"] = ENABLE_E0_DRIVER_TYPE;
-        json["ENABLE_E1_DRIVER_TYPE"] = ENABLE_E1_DRIVER_TYPE;
-        json["ENABLE_E2_DRIVER_TYPE"] = ENABLE_E2_DRIVER_TYPE;
-        json["ENABLE_E3_DRIVER_TYPE"] = ENABLE_E3_DRIVER_TYPE;
-        json["ENABLE_E4_DRIVER_TYPE"] = ENABLE_E4_DRIVER_TYPE;
-        json["ENABLE_E5_DRIVER_TYPE"] = ENABLE_E5_DRIVER_TYPE;
-        json["ENABLE_E6_DRIVER_TYPE"] = ENABLE_E6_DRIVER_TYPE;
-        json["ENABLE_E7_DRIVER_TYPE"] = ENABLE_E7_DRIVER_TYPE;
-        json["AXIS4_NAME"] = AXIS4_NAME;
-        json["AXIS5_NAME"] = AXIS5_NAME;
-        json["AXIS6_NAME"] = AXIS6_NAME;
-        json["AXIS4_ROTATES"] = AXIS4_ROTATES;
-        json["AXIS5_ROTATES"] = AXIS5_ROTATES;
-        json["AXIS6_ROTATES"] = AXIS6_ROTATES;
-        json["AXIS7_NAME"] = AXIS7_NAME;
-        json["AXIS8_NAME"] = AXIS8_NAME;
-        json["AXIS9_NAME"] = AXIS9_NAME;
-        json["AXIS7_ROTATES"] = AXIS7_ROTATES;
-        json["AXIS8_ROTATES"] = AXIS8_ROTATES;
-        json["AXIS9_ROTATES"] = AXIS9_ROTATES;
-        json["X_ENABLE_ON"] = X_ENABLE_ON;
-        json["Y_ENABLE_ON"] = Y_ENABLE_ON;
-        json["Z_ENABLE_ON"] = Z_ENABLE_ON;
-        json["E_ENABLE_ON"] = E_ENABLE_ON;
-        json["I_ENABLE_ON"] = I_ENABLE_ON;
-        json["J_ENABLE_ON"] = J_ENABLE_ON;
-        json["K_ENABLE_ON"] = K_ENABLE_ON;
-        json["U_ENABLE_ON"] = U_ENABLE_ON;
-        json["V_ENABLE_ON"] = V_ENABLE_ON;
-        json["W_ENABLE_ON"] = W_ENABLE_ON;
-        json["ENABLE_X_ENABLE_ON"] = ENABLE_X_ENABLE_ON;
-        json["ENABLE_Y_ENABLE_ON"] = ENABLE_Y_ENABLE_ON;
-        json["ENABLE_Z_ENABLE_ON"] = ENABLE_Z_ENABLE_ON;
-        json["ENABLE_E_ENABLE_ON"] = ENABLE_E_ENABLE_ON;
-        json["ENABLE_I_ENABLE_ON"] = ENABLE_I_ENABLE_ON;
-        json["ENABLE_J_ENABLE_ON"] = ENABLE_J_ENABLE_ON;
-        json["ENABLE_K_ENABLE_ON"] = ENABLE_K_ENABLE_ON;
-        json["ENABLE_U_ENABLE_ON"] = ENABLE_U_ENABLE_ON;
-        json["ENABLE_V_ENABLE_ON"] = ENABLE_V_ENABLE_ON;
-        json["ENABLE_W_ENABLE_ON"] = ENABLE_W_ENABLE_ON;
-        json["DISABLE_X"] = DISABLE_X;
-        json["DISABLE_Y"] = DISABLE_Y;
-        json["DISABLE_Z"] = DISABLE_Z;
-        json["DISABLE_E"] = DISABLE_E;
-        json["DISABLE_I"] = DISABLE_I;
-        json["DISABLE_J"] = DISABLE_J;
-        json["DISABLE_K"] = DISABLE_K;
-        json["DISABLE_U"] = DISABLE_U;
-        json["DISABLE_V"] = DISABLE_V;
-        json["DISABLE_W"] = DISABLE_W;
-        json["ENABLE_DISABLE_X"] = ENABLE_DISABLE_X;
-        json["ENABLE_DISABLE_Y"] = ENABLE_DISABLE_Y;
-        json["ENABLE_DISABLE_Z"] = ENABLE_DISABLE_Z;
-        json["ENABLE_DISABLE_I"] = ENABLE_DISABLE_I;
-        json["ENABLE_DISABLE_J"] = ENABLE_DISABLE_J;
-        json["ENABLE_DISABLE_K"] = ENABLE_DISABLE_K;
-        json["ENABLE_DISABLE_U"] = ENABLE_DISABLE_U;
-        json["ENABLE_DISABLE_V"] = ENABLE_DISABLE_V;
-        json["ENABLE_DISABLE_W"] = ENABLE_DISABLE_W;
-        json["DISABLE_INACTIVE_EXTRUDER"] = DISABLE_INACTIVE_EXTRUDER;
-        json["INVERT_X_DIR"] = INVERT_X_DIR;
-        json["INVERT_Y_DIR"] = INVERT_Y_DIR;
-        json["INVERT_Z_DIR"] = INVERT_Z_DIR;
-        json["INVERT_I_DIR"] = INVERT_I_DIR;
-        json["INVERT_J_DIR"] = INVERT_J_DIR;
-        json["INVERT_K_DIR"] = INVERT_K_DIR;
-        json["INVERT_U_DIR"] = INVERT_U_DIR;
-        json["INVERT_V_DIR"] = INVERT_V_DIR;
-        json["INVERT_W_DIR"] = INVERT_W_DIR;
-        json["ENABLE_INVERT_X_DIR"] = ENABLE_INVERT_X_DIR;
-        json["ENABLE_INVERT_Y_DIR"] = ENABLE_INVERT_Y_DIR;
-        json["ENABLE_INVERT_Z_DIR"] = ENABLE_INVERT_Z_DIR;
-        json["ENABLE_INVERT_I_DIR"] = ENABLE_INVERT_I_DIR;
-        json["ENABLE_INVERT_J_DIR"] = ENABLE_INVERT_J_DIR;
-        json["ENABLE_INVERT_K_DIR"] = ENABLE_INVERT_K_DIR;
-        json["ENABLE_INVERT_U_DIR"] = ENABLE_INVERT_U_DIR;
-        json["ENABLE_INVERT_V_DIR"] = ENABLE_INVERT_V_DIR;
-        json["ENABLE_INVERT_W_DIR"] = ENABLE_INVERT_W_DIR;
-        json["INVERT_E0_DIR"] = INVERT_E0_DIR;
-        json["INVERT_E1_DIR"] = INVERT_E1_DIR;
-        json["INVERT_E2_DIR"] = INVERT_E2_DIR;
-        json["INVERT_E3_DIR"] = INVERT_E3_DIR;
-        json["INVERT_E4_DIR"] = INVERT_E4_DIR;
-        json["INVERT_E5_DIR"] = INVERT_E5_DIR;
-        json["INVERT_E6_DIR"] = INVERT_E6_DIR;
-        json["INVERT_E7_DIR"] = INVERT_E7_DIR;
-        json["DISABLE_REDUCED_ACCURACY_WARNING"] = DISABLE_REDUCED_ACCURACY_WARNING;
-
-        return json;
+        pFunction("X_DRIVER_TYPE", pSelf.X_DRIVER_TYPE);
+        pFunction("Y_DRIVER_TYPE", pSelf.Y_DRIVER_TYPE);
+        pFunction("Z_DRIVER_TYPE", pSelf.Z_DRIVER_TYPE);
+        pFunction("X2_DRIVER_TYPE", pSelf.X2_DRIVER_TYPE);
+        pFunction("Y2_DRIVER_TYPE", pSelf.Y2_DRIVER_TYPE);
+        pFunction("Z2_DRIVER_TYPE", pSelf.Z2_DRIVER_TYPE);
+        pFunction("Z3_DRIVER_TYPE", pSelf.Z3_DRIVER_TYPE);
+        pFunction("Z4_DRIVER_TYPE", pSelf.Z4_DRIVER_TYPE);
+        pFunction("ENABLE_X_DRIVER_TYPE", pSelf.ENABLE_X_DRIVER_TYPE);
+        pFunction("ENABLE_Y_DRIVER_TYPE", pSelf.ENABLE_Y_DRIVER_TYPE);
+        pFunction("ENABLE_Z_DRIVER_TYPE", pSelf.ENABLE_Z_DRIVER_TYPE);
+        pFunction("ENABLE_X2_DRIVER_TYPE", pSelf.ENABLE_X2_DRIVER_TYPE);
+        pFunction("ENABLE_Y2_DRIVER_TYPE", pSelf.ENABLE_Y2_DRIVER_TYPE);
+        pFunction("ENABLE_Z2_DRIVER_TYPE", pSelf.ENABLE_Z2_DRIVER_TYPE);
+        pFunction("ENABLE_Z3_DRIVER_TYPE", pSelf.ENABLE_Z3_DRIVER_TYPE);
+        pFunction("ENABLE_Z4_DRIVER_TYPE", pSelf.ENABLE_Z4_DRIVER_TYPE);
+        pFunction("I_DRIVER_TYPE", pSelf.I_DRIVER_TYPE);
+        pFunction("J_DRIVER_TYPE", pSelf.J_DRIVER_TYPE);
+        pFunction("K_DRIVER_TYPE", pSelf.K_DRIVER_TYPE);
+        pFunction("ENABLE_I_DRIVER_TYPE", pSelf.ENABLE_I_DRIVER_TYPE);
+        pFunction("ENABLE_J_DRIVER_TYPE", pSelf.ENABLE_J_DRIVER_TYPE);
+        pFunction("ENABLE_K_DRIVER_TYPE", pSelf.ENABLE_K_DRIVER_TYPE);
+        pFunction("U_DRIVER_TYPE", pSelf.U_DRIVER_TYPE);
+        pFunction("V_DRIVER_TYPE", pSelf.V_DRIVER_TYPE);
+        pFunction("W_DRIVER_TYPE", pSelf.W_DRIVER_TYPE);
+        pFunction("ENABLE_U_DRIVER_TYPE", pSelf.ENABLE_U_DRIVER_TYPE);
+        pFunction("ENABLE_V_DRIVER_TYPE", pSelf.ENABLE_V_DRIVER_TYPE);
+        pFunction("ENABLE_W_DRIVER_TYPE", pSelf.ENABLE_W_DRIVER_TYPE);
+        pFunction("E0_DRIVER_TYPE", pSelf.E0_DRIVER_TYPE);
+        pFunction("E1_DRIVER_TYPE", pSelf.E1_DRIVER_TYPE);
+        pFunction("E2_DRIVER_TYPE", pSelf.E2_DRIVER_TYPE);
+        pFunction("E3_DRIVER_TYPE", pSelf.E3_DRIVER_TYPE);
+        pFunction("E4_DRIVER_TYPE", pSelf.E4_DRIVER_TYPE);
+        pFunction("E5_DRIVER_TYPE", pSelf.E5_DRIVER_TYPE);
+        pFunction("E6_DRIVER_TYPE", pSelf.E6_DRIVER_TYPE);
+        pFunction("E7_DRIVER_TYPE", pSelf.E7_DRIVER_TYPE);
+        pFunction("ENABLE_E0_DRIVER_TYPE", pSelf.ENABLE_E0_DRIVER_TYPE);
+        pFunction("ENABLE_E1_DRIVER_TYPE", pSelf.ENABLE_E1_DRIVER_TYPE);
+        pFunction("ENABLE_E2_DRIVER_TYPE", pSelf.ENABLE_E2_DRIVER_TYPE);
+        pFunction("ENABLE_E3_DRIVER_TYPE", pSelf.ENABLE_E3_DRIVER_TYPE);
+        pFunction("ENABLE_E4_DRIVER_TYPE", pSelf.ENABLE_E4_DRIVER_TYPE);
+        pFunction("ENABLE_E5_DRIVER_TYPE", pSelf.ENABLE_E5_DRIVER_TYPE);
+        pFunction("ENABLE_E6_DRIVER_TYPE", pSelf.ENABLE_E6_DRIVER_TYPE);
+        pFunction("ENABLE_E7_DRIVER_TYPE", pSelf.ENABLE_E7_DRIVER_TYPE);
+        pFunction("AXIS4_NAME", pSelf.AXIS4_NAME);
+        pFunction("AXIS5_NAME", pSelf.AXIS5_NAME);
+        pFunction("AXIS6_NAME", pSelf.AXIS6_NAME);
+        pFunction("AXIS4_ROTATES", pSelf.AXIS4_ROTATES);
+        pFunction("AXIS5_ROTATES", pSelf.AXIS5_ROTATES);
+        pFunction("AXIS6_ROTATES", pSelf.AXIS6_ROTATES);
+        pFunction("AXIS7_NAME", pSelf.AXIS7_NAME);
+        pFunction("AXIS8_NAME", pSelf.AXIS8_NAME);
+        pFunction("AXIS9_NAME", pSelf.AXIS9_NAME);
+        pFunction("AXIS7_ROTATES", pSelf.AXIS7_ROTATES);
+        pFunction("AXIS8_ROTATES", pSelf.AXIS8_ROTATES);
+        pFunction("AXIS9_ROTATES", pSelf.AXIS9_ROTATES);
+        pFunction("X_ENABLE_ON", pSelf.X_ENABLE_ON);
+        pFunction("Y_ENABLE_ON", pSelf.Y_ENABLE_ON);
+        pFunction("Z_ENABLE_ON", pSelf.Z_ENABLE_ON);
+        pFunction("E_ENABLE_ON", pSelf.E_ENABLE_ON);
+        pFunction("I_ENABLE_ON", pSelf.I_ENABLE_ON);
+        pFunction("J_ENABLE_ON", pSelf.J_ENABLE_ON);
+        pFunction("K_ENABLE_ON", pSelf.K_ENABLE_ON);
+        pFunction("U_ENABLE_ON", pSelf.U_ENABLE_ON);
+        pFunction("V_ENABLE_ON", pSelf.V_ENABLE_ON);
+        pFunction("W_ENABLE_ON", pSelf.W_ENABLE_ON);
+        pFunction("ENABLE_X_ENABLE_ON", pSelf.ENABLE_X_ENABLE_ON);
+        pFunction("ENABLE_Y_ENABLE_ON", pSelf.ENABLE_Y_ENABLE_ON);
+        pFunction("ENABLE_Z_ENABLE_ON", pSelf.ENABLE_Z_ENABLE_ON);
+        pFunction("ENABLE_E_ENABLE_ON", pSelf.ENABLE_E_ENABLE_ON);
+        pFunction("ENABLE_I_ENABLE_ON", pSelf.ENABLE_I_ENABLE_ON);
+        pFunction("ENABLE_J_ENABLE_ON", pSelf.ENABLE_J_ENABLE_ON);
+        pFunction("ENABLE_K_ENABLE_ON", pSelf.ENABLE_K_ENABLE_ON);
+        pFunction("ENABLE_U_ENABLE_ON", pSelf.ENABLE_U_ENABLE_ON);
+        pFunction("ENABLE_V_ENABLE_ON", pSelf.ENABLE_V_ENABLE_ON);
+        pFunction("ENABLE_W_ENABLE_ON", pSelf.ENABLE_W_ENABLE_ON);
+        pFunction("DISABLE_X", pSelf.DISABLE_X);
+        pFunction("DISABLE_Y", pSelf.DISABLE_Y);
+        pFunction("DISABLE_Z", pSelf.DISABLE_Z);
+        pFunction("DISABLE_E", pSelf.DISABLE_E);
+        pFunction("DISABLE_I", pSelf.DISABLE_I);
+        pFunction("DISABLE_J", pSelf.DISABLE_J);
+        pFunction("DISABLE_K", pSelf.DISABLE_K);
+        pFunction("DISABLE_U", pSelf.DISABLE_U);
+        pFunction("DISABLE_V", pSelf.DISABLE_V);
+        pFunction("DISABLE_W", pSelf.DISABLE_W);
+        pFunction("ENABLE_DISABLE_X", pSelf.ENABLE_DISABLE_X);
+        pFunction("ENABLE_DISABLE_Y", pSelf.ENABLE_DISABLE_Y);
+        pFunction("ENABLE_DISABLE_Z", pSelf.ENABLE_DISABLE_Z);
+        pFunction("ENABLE_DISABLE_I", pSelf.ENABLE_DISABLE_I);
+        pFunction("ENABLE_DISABLE_J", pSelf.ENABLE_DISABLE_J);
+        pFunction("ENABLE_DISABLE_K", pSelf.ENABLE_DISABLE_K);
+        pFunction("ENABLE_DISABLE_U", pSelf.ENABLE_DISABLE_U);
+        pFunction("ENABLE_DISABLE_V", pSelf.ENABLE_DISABLE_V);
+        pFunction("ENABLE_DISABLE_W", pSelf.ENABLE_DISABLE_W);
+        pFunction("DISABLE_INACTIVE_EXTRUDER", pSelf.DISABLE_INACTIVE_EXTRUDER);
+        pFunction("INVERT_X_DIR", pSelf.INVERT_X_DIR);
+        pFunction("INVERT_Y_DIR", pSelf.INVERT_Y_DIR);
+        pFunction("INVERT_Z_DIR", pSelf.INVERT_Z_DIR);
+        pFunction("INVERT_I_DIR", pSelf.INVERT_I_DIR);
+        pFunction("INVERT_J_DIR", pSelf.INVERT_J_DIR);
+        pFunction("INVERT_K_DIR", pSelf.INVERT_K_DIR);
+        pFunction("INVERT_U_DIR", pSelf.INVERT_U_DIR);
+        pFunction("INVERT_V_DIR", pSelf.INVERT_V_DIR);
+        pFunction("INVERT_W_DIR", pSelf.INVERT_W_DIR);
+        pFunction("ENABLE_INVERT_X_DIR", pSelf.ENABLE_INVERT_X_DIR);
+        pFunction("ENABLE_INVERT_Y_DIR", pSelf.ENABLE_INVERT_Y_DIR);
+        pFunction("ENABLE_INVERT_Z_DIR", pSelf.ENABLE_INVERT_Z_DIR);
+        pFunction("ENABLE_INVERT_I_DIR", pSelf.ENABLE_INVERT_I_DIR);
+        pFunction("ENABLE_INVERT_J_DIR", pSelf.ENABLE_INVERT_J_DIR);
+        pFunction("ENABLE_INVERT_K_DIR", pSelf.ENABLE_INVERT_K_DIR);
+        pFunction("ENABLE_INVERT_U_DIR", pSelf.ENABLE_INVERT_U_DIR);
+        pFunction("ENABLE_INVERT_V_DIR", pSelf.ENABLE_INVERT_V_DIR);
+        pFunction("ENABLE_INVERT_W_DIR", pSelf.ENABLE_INVERT_W_DIR);
+        pFunction("INVERT_E0_DIR", pSelf.INVERT_E0_DIR);
+        pFunction("INVERT_E1_DIR", pSelf.INVERT_E1_DIR);
+        pFunction("INVERT_E2_DIR", pSelf.INVERT_E2_DIR);
+        pFunction("INVERT_E3_DIR", pSelf.INVERT_E3_DIR);
+        pFunction("INVERT_E4_DIR", pSelf.INVERT_E4_DIR);
+        pFunction("INVERT_E5_DIR", pSelf.INVERT_E5_DIR);
+        pFunction("INVERT_E6_DIR", pSelf.INVERT_E6_DIR);
+        pFunction("INVERT_E7_DIR", pSelf.INVERT_E7_DIR);
+        pFunction("DISABLE_REDUCED_ACCURACY_WARNING", pSelf.DISABLE_REDUCED_ACCURACY_WARNING);
     }
 };
 
 ///
 /// \brief The HomingAndBoundsConfiguration struct contains homing and bounds configurations
 ///
-struct HomingAndBoundsConfiguration : public PageConfiguration
+struct HomingAndBoundsConfiguration : public PageFields<HomingAndBoundsConfiguration>
 {
     bool NO_MOTION_BEFORE_HOMING{defaults::NO_MOTION_BEFORE_HOMING};
     bool HOME_AFTER_DEACTIVATE{defaults::HOME_AFTER_DEACTIVATE};
@@ -2144,107 +2250,105 @@ struct HomingAndBoundsConfiguration : public PageConfiguration
     bool SOFT_ENDSTOPS_MENU_ITEM{defaults::SOFT_ENDSTOPS_MENU_ITEM};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["NO_MOTION_BEFORE_HOMING"] = NO_MOTION_BEFORE_HOMING;
-        json["HOME_AFTER_DEACTIVATE"] = HOME_AFTER_DEACTIVATE;
-        json["Z_IDLE_HEIGHT"] = Z_IDLE_HEIGHT;
-        json["Z_HOMING_HEIGHT"] = Z_HOMING_HEIGHT;
-        json["Z_AFTER_HOMING"] = Z_AFTER_HOMING;
-        json["ENABLE_Z_IDLE_HEIGHT"] = ENABLE_Z_IDLE_HEIGHT;
-        json["ENABLE_Z_HOMING_HEIGHT"] = ENABLE_Z_HOMING_HEIGHT;
-        json["ENABLE_Z_AFTER_HOMING"] = ENABLE_Z_AFTER_HOMING;
-        json["X_HOME_DIR"] = X_HOME_DIR;
-        json["Y_HOME_DIR"] = Y_HOME_DIR;
-        json["Z_HOME_DIR"] = Z_HOME_DIR;
-        json["I_HOME_DIR"] = I_HOME_DIR;
-        json["J_HOME_DIR"] = J_HOME_DIR;
-        json["K_HOME_DIR"] = K_HOME_DIR;
-        json["U_HOME_DIR"] = U_HOME_DIR;
-        json["V_HOME_DIR"] = V_HOME_DIR;
-        json["W_HOME_DIR"] = W_HOME_DIR;
-        json["ENABLE_X_HOME_DIR"] = ENABLE_X_HOME_DIR;
-        json["ENABLE_Y_HOME_DIR"] = ENABLE_Y_HOME_DIR;
-        json["ENABLE_Z_HOME_DIR"] = ENABLE_Z_HOME_DIR;
-        json["ENABLE_I_HOME_DIR"] = ENABLE_I_HOME_DIR;
-        json["ENABLE_J_HOME_DIR"] = ENABLE_J_HOME_DIR;
-        json["ENABLE_K_HOME_DIR"] = ENABLE_K_HOME_DIR;
-        json["ENABLE_U_HOME_DIR"] = ENABLE_U_HOME_DIR;
-        json["ENABLE_V_HOME_DIR"] = ENABLE_V_HOME_DIR;
-        json["ENABLE_W_HOME_DIR"] = ENABLE_W_HOME_DIR;
-        json["X_BED_SIZE"] = X_BED_SIZE;
-        json["Y_BED_SIZE"] = Y_BED_SIZE;
-        json["X_MIN_POS"] = X_MIN_POS;
-        json["Y_MIN_POS"] = Y_MIN_POS;
-        json["Z_MIN_POS"] = Z_MIN_POS;
-        json["X_MAX_POS"] = X_MAX_POS;
-        json["Y_MAX_POS"] = Y_MAX_POS;
-        json["Z_MAX_POS"] = Z_MAX_POS;
-        json["ENABLE_X_MIN_POS"] = ENABLE_X_MIN_POS;
-        json["ENABLE_Y_MIN_POS"] = ENABLE_Y_MIN_POS;
-        json["ENABLE_Z_MIN_POS"] = ENABLE_Z_MIN_POS;
-        json["ENABLE_X_MAX_POS"] = ENABLE_X_MAX_POS;
-        json["ENABLE_Y_MAX_POS"] = ENABLE_Y_MAX_POS;
-        json["ENABLE_Z_MAX_POS"] = ENABLE_Z_MAX_POS;
-        json["I_MIN_POS"] = I_MIN_POS;
-        json["J_MIN_POS"] = J_MIN_POS;
-        json["K_MIN_POS"] = K_MIN_POS;
-        json["I_MAX_POS"] = I_MAX_POS;
-        json["J_MAX_POS"] = J_MAX_POS;
-        json["K_MAX_POS"] = K_MAX_POS;
-        json["ENABLE_I_MIN_POS"] = ENABLE_I_MIN_POS;
-        json["ENABLE_J_MIN_POS"] = ENABLE_J_MIN_POS;
-        json["ENABLE_K_MIN_POS"] = ENABLE_K_MIN_POS;
-        json["ENABLE_I_MAX_POS"] = ENABLE_I_MAX_POS;
-        json["ENABLE_J_MAX_POS"] = ENABLE_J_MAX_POS;
-        json["ENABLE_K_MAX_POS"] = ENABLE_K_MAX_POS;
-        json["U_MIN_POS"] = U_MIN_POS;
-        json["V_MIN_POS"] = V_MIN_POS;
-        json["W_MIN_POS"] = W_MIN_POS;
-        json["U_MAX_POS"] = U_MAX_POS;
-        json["V_MAX_POS"] = V_MAX_POS;
-        json["W_MAX_POS"] = W_MAX_POS;
-        json["ENABLE_U_MIN_POS"] = ENABLE_U_MIN_POS;
-        json["ENABLE_V_MIN_POS"] = ENABLE_V_MIN_POS;
-        json["ENABLE_W_MIN_POS"] = ENABLE_W_MIN_POS;
-        json["ENABLE_U_MAX_POS"] = ENABLE_U_MAX_POS;
-        json["ENABLE_V_MAX_POS"] = ENABLE_V_MAX_POS;
-        json["ENABLE_W_MAX_POS"] = ENABLE_W_MAX_POS;
-        json["MIN_SOFTWARE_ENDSTOPS"] = MIN_SOFTWARE_ENDSTOPS;
-        json["MIN_SOFTWARE_ENDSTOP_X"] = MIN_SOFTWARE_ENDSTOP_X;
-        json["MIN_SOFTWARE_ENDSTOP_Y"] = MIN_SOFTWARE_ENDSTOP_Y;
-        json["MIN_SOFTWARE_ENDSTOP_Z"] = MIN_SOFTWARE_ENDSTOP_Z;
-        json["MIN_SOFTWARE_ENDSTOP_I"] = MIN_SOFTWARE_ENDSTOP_I;
-        json["MIN_SOFTWARE_ENDSTOP_J"] = MIN_SOFTWARE_ENDSTOP_J;
-        json["MIN_SOFTWARE_ENDSTOP_K"] = MIN_SOFTWARE_ENDSTOP_K;
-        json["MIN_SOFTWARE_ENDSTOP_U"] = MIN_SOFTWARE_ENDSTOP_U;
-        json["MIN_SOFTWARE_ENDSTOP_V"] = MIN_SOFTWARE_ENDSTOP_V;
-        json["MIN_SOFTWARE_ENDSTOP_W"] = MIN_SOFTWARE_ENDSTOP_W;
-        json["MAX_SOFTWARE_ENDSTOPS"] = MAX_SOFTWARE_ENDSTOPS;
-        json["MAX_SOFTWARE_ENDSTOP_X"] = MAX_SOFTWARE_ENDSTOP_X;
-        json["MAX_SOFTWARE_ENDSTOP_Y"] = MAX_SOFTWARE_ENDSTOP_Y;
-        json["MAX_SOFTWARE_ENDSTOP_Z"] = MAX_SOFTWARE_ENDSTOP_Z;
-        json["MAX_SOFTWARE_ENDSTOP_I"] = MAX_SOFTWARE_ENDSTOP_I;
-        json["MAX_SOFTWARE_ENDSTOP_J"] = MAX_SOFTWARE_ENDSTOP_J;
-        json["MAX_SOFTWARE_ENDSTOP_K"] = MAX_SOFTWARE_ENDSTOP_K;
-        json["MAX_SOFTWARE_ENDSTOP_U"] = MAX_SOFTWARE_ENDSTOP_U;
-        json["MAX_SOFTWARE_ENDSTOP_V"] = MAX_SOFTWARE_ENDSTOP_V;
-        json["MAX_SOFTWARE_ENDSTOP_W"] = MAX_SOFTWARE_ENDSTOP_W;
-        json["SOFT_ENDSTOPS_MENU_ITEM"] = SOFT_ENDSTOPS_MENU_ITEM;
-
-        return json;
+        pFunction("NO_MOTION_BEFORE_HOMING", pSelf.NO_MOTION_BEFORE_HOMING);
+        pFunction("HOME_AFTER_DEACTIVATE", pSelf.HOME_AFTER_DEACTIVATE);
+        pFunction("Z_IDLE_HEIGHT", pSelf.Z_IDLE_HEIGHT);
+        pFunction("Z_HOMING_HEIGHT", pSelf.Z_HOMING_HEIGHT);
+        pFunction("Z_AFTER_HOMING", pSelf.Z_AFTER_HOMING);
+        pFunction("ENABLE_Z_IDLE_HEIGHT", pSelf.ENABLE_Z_IDLE_HEIGHT);
+        pFunction("ENABLE_Z_HOMING_HEIGHT", pSelf.ENABLE_Z_HOMING_HEIGHT);
+        pFunction("ENABLE_Z_AFTER_HOMING", pSelf.ENABLE_Z_AFTER_HOMING);
+        pFunction("X_HOME_DIR", pSelf.X_HOME_DIR);
+        pFunction("Y_HOME_DIR", pSelf.Y_HOME_DIR);
+        pFunction("Z_HOME_DIR", pSelf.Z_HOME_DIR);
+        pFunction("I_HOME_DIR", pSelf.I_HOME_DIR);
+        pFunction("J_HOME_DIR", pSelf.J_HOME_DIR);
+        pFunction("K_HOME_DIR", pSelf.K_HOME_DIR);
+        pFunction("U_HOME_DIR", pSelf.U_HOME_DIR);
+        pFunction("V_HOME_DIR", pSelf.V_HOME_DIR);
+        pFunction("W_HOME_DIR", pSelf.W_HOME_DIR);
+        pFunction("ENABLE_X_HOME_DIR", pSelf.ENABLE_X_HOME_DIR);
+        pFunction("ENABLE_Y_HOME_DIR", pSelf.ENABLE_Y_HOME_DIR);
+        pFunction("ENABLE_Z_HOME_DIR", pSelf.ENABLE_Z_HOME_DIR);
+        pFunction("ENABLE_I_HOME_DIR", pSelf.ENABLE_I_HOME_DIR);
+        pFunction("ENABLE_J_HOME_DIR", pSelf.ENABLE_J_HOME_DIR);
+        pFunction("ENABLE_K_HOME_DIR", pSelf.ENABLE_K_HOME_DIR);
+        pFunction("ENABLE_U_HOME_DIR", pSelf.ENABLE_U_HOME_DIR);
+        pFunction("ENABLE_V_HOME_DIR", pSelf.ENABLE_V_HOME_DIR);
+        pFunction("ENABLE_W_HOME_DIR", pSelf.ENABLE_W_HOME_DIR);
+        pFunction("X_BED_SIZE", pSelf.X_BED_SIZE);
+        pFunction("Y_BED_SIZE", pSelf.Y_BED_SIZE);
+        pFunction("X_MIN_POS", pSelf.X_MIN_POS);
+        pFunction("Y_MIN_POS", pSelf.Y_MIN_POS);
+        pFunction("Z_MIN_POS", pSelf.Z_MIN_POS);
+        pFunction("X_MAX_POS", pSelf.X_MAX_POS);
+        pFunction("Y_MAX_POS", pSelf.Y_MAX_POS);
+        pFunction("Z_MAX_POS", pSelf.Z_MAX_POS);
+        pFunction("ENABLE_X_MIN_POS", pSelf.ENABLE_X_MIN_POS);
+        pFunction("ENABLE_Y_MIN_POS", pSelf.ENABLE_Y_MIN_POS);
+        pFunction("ENABLE_Z_MIN_POS", pSelf.ENABLE_Z_MIN_POS);
+        pFunction("ENABLE_X_MAX_POS", pSelf.ENABLE_X_MAX_POS);
+        pFunction("ENABLE_Y_MAX_POS", pSelf.ENABLE_Y_MAX_POS);
+        pFunction("ENABLE_Z_MAX_POS", pSelf.ENABLE_Z_MAX_POS);
+        pFunction("I_MIN_POS", pSelf.I_MIN_POS);
+        pFunction("J_MIN_POS", pSelf.J_MIN_POS);
+        pFunction("K_MIN_POS", pSelf.K_MIN_POS);
+        pFunction("I_MAX_POS", pSelf.I_MAX_POS);
+        pFunction("J_MAX_POS", pSelf.J_MAX_POS);
+        pFunction("K_MAX_POS", pSelf.K_MAX_POS);
+        pFunction("ENABLE_I_MIN_POS", pSelf.ENABLE_I_MIN_POS);
+        pFunction("ENABLE_J_MIN_POS", pSelf.ENABLE_J_MIN_POS);
+        pFunction("ENABLE_K_MIN_POS", pSelf.ENABLE_K_MIN_POS);
+        pFunction("ENABLE_I_MAX_POS", pSelf.ENABLE_I_MAX_POS);
+        pFunction("ENABLE_J_MAX_POS", pSelf.ENABLE_J_MAX_POS);
+        pFunction("ENABLE_K_MAX_POS", pSelf.ENABLE_K_MAX_POS);
+        pFunction("U_MIN_POS", pSelf.U_MIN_POS);
+        pFunction("V_MIN_POS", pSelf.V_MIN_POS);
+        pFunction("W_MIN_POS", pSelf.W_MIN_POS);
+        pFunction("U_MAX_POS", pSelf.U_MAX_POS);
+        pFunction("V_MAX_POS", pSelf.V_MAX_POS);
+        pFunction("W_MAX_POS", pSelf.W_MAX_POS);
+        pFunction("ENABLE_U_MIN_POS", pSelf.ENABLE_U_MIN_POS);
+        pFunction("ENABLE_V_MIN_POS", pSelf.ENABLE_V_MIN_POS);
+        pFunction("ENABLE_W_MIN_POS", pSelf.ENABLE_W_MIN_POS);
+        pFunction("ENABLE_U_MAX_POS", pSelf.ENABLE_U_MAX_POS);
+        pFunction("ENABLE_V_MAX_POS", pSelf.ENABLE_V_MAX_POS);
+        pFunction("ENABLE_W_MAX_POS", pSelf.ENABLE_W_MAX_POS);
+        pFunction("MIN_SOFTWARE_ENDSTOPS", pSelf.MIN_SOFTWARE_ENDSTOPS);
+        pFunction("MIN_SOFTWARE_ENDSTOP_X", pSelf.MIN_SOFTWARE_ENDSTOP_X);
+        pFunction("MIN_SOFTWARE_ENDSTOP_Y", pSelf.MIN_SOFTWARE_ENDSTOP_Y);
+        pFunction("MIN_SOFTWARE_ENDSTOP_Z", pSelf.MIN_SOFTWARE_ENDSTOP_Z);
+        pFunction("MIN_SOFTWARE_ENDSTOP_I", pSelf.MIN_SOFTWARE_ENDSTOP_I);
+        pFunction("MIN_SOFTWARE_ENDSTOP_J", pSelf.MIN_SOFTWARE_ENDSTOP_J);
+        pFunction("MIN_SOFTWARE_ENDSTOP_K", pSelf.MIN_SOFTWARE_ENDSTOP_K);
+        pFunction("MIN_SOFTWARE_ENDSTOP_U", pSelf.MIN_SOFTWARE_ENDSTOP_U);
+        pFunction("MIN_SOFTWARE_ENDSTOP_V", pSelf.MIN_SOFTWARE_ENDSTOP_V);
+        pFunction("MIN_SOFTWARE_ENDSTOP_W", pSelf.MIN_SOFTWARE_ENDSTOP_W);
+        pFunction("MAX_SOFTWARE_ENDSTOPS", pSelf.MAX_SOFTWARE_ENDSTOPS);
+        pFunction("MAX_SOFTWARE_ENDSTOP_X", pSelf.MAX_SOFTWARE_ENDSTOP_X);
+        pFunction("MAX_SOFTWARE_ENDSTOP_Y", pSelf.MAX_SOFTWARE_ENDSTOP_Y);
+        pFunction("MAX_SOFTWARE_ENDSTOP_Z", pSelf.MAX_SOFTWARE_ENDSTOP_Z);
+        pFunction("MAX_SOFTWARE_ENDSTOP_I", pSelf.MAX_SOFTWARE_ENDSTOP_I);
+        pFunction("MAX_SOFTWARE_ENDSTOP_J", pSelf.MAX_SOFTWARE_ENDSTOP_J);
+        pFunction("MAX_SOFTWARE_ENDSTOP_K", pSelf.MAX_SOFTWARE_ENDSTOP_K);
+        pFunction("MAX_SOFTWARE_ENDSTOP_U", pSelf.MAX_SOFTWARE_ENDSTOP_U);
+        pFunction("MAX_SOFTWARE_ENDSTOP_V", pSelf.MAX_SOFTWARE_ENDSTOP_V);
+        pFunction("MAX_SOFTWARE_ENDSTOP_W", pSelf.MAX_SOFTWARE_ENDSTOP_W);
+        pFunction("SOFT_ENDSTOPS_MENU_ITEM", pSelf.SOFT_ENDSTOPS_MENU_ITEM);
     }
 };
 
 ///
 /// \brief The MovementConfiguration struct contains movement configurations
 ///
-struct MovementConfiguration : public PageConfiguration
+struct MovementConfiguration : public PageFields<MovementConfiguration>
 {
     bool DISTINCT_E_FACTORS{defaults::DISTINCT_E_FACTORS};
     QString DEFAULT_AXIS_STEPS_PER_UNIT{defaults::DEFAULT_AXIS_STEPS_PER_UNIT};
@@ -2286,60 +2390,58 @@ struct MovementConfiguration : public PageConfiguration
     bool S_CURVE_ACCELERATION{defaults::S_CURVE_ACCELERATION};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["DISTINCT_E_FACTORS"] = DISTINCT_E_FACTORS;
-        json["DEFAULT_AXIS_STEPS_PER_UNIT"] = DEFAULT_AXIS_STEPS_PER_UNIT;
-        json["DEFAULT_MAX_FEEDRATE"] = DEFAULT_MAX_FEEDRATE;
-        json["LIMITED_MAX_FR_EDITING"] = LIMITED_MAX_FR_EDITING;
-        json["MAX_FEEDRATE_EDIT_VALUES"] = MAX_FEEDRATE_EDIT_VALUES;
-        json["DEFAULT_MAX_ACCELERATION"] = DEFAULT_MAX_ACCELERATION;
-        json["LIMITED_MAX_ACCEL_EDITING"] = LIMITED_MAX_ACCEL_EDITING;
-        json["MAX_ACCEL_EDIT_VALUES"] = MAX_ACCEL_EDIT_VALUES;
-        json["DEFAULT_ACCELERATION"] = DEFAULT_ACCELERATION;
-        json["DEFAULT_RETRACT_ACCELERATION"] = DEFAULT_RETRACT_ACCELERATION;
-        json["DEFAULT_TRAVEL_ACCELERATION"] = DEFAULT_TRAVEL_ACCELERATION;
-        json["CLASSIC_JERK"] = CLASSIC_JERK;
-        json["DEFAULT_XJERK"] = DEFAULT_XJERK;
-        json["DEFAULT_YJERK"] = DEFAULT_YJERK;
-        json["DEFAULT_ZJERK"] = DEFAULT_ZJERK;
-        json["DEFAULT_IJERK"] = DEFAULT_IJERK;
-        json["DEFAULT_JJERK"] = DEFAULT_JJERK;
-        json["DEFAULT_KJERK"] = DEFAULT_KJERK;
-        json["DEFAULT_UJERK"] = DEFAULT_UJERK;
-        json["DEFAULT_VJERK"] = DEFAULT_VJERK;
-        json["DEFAULT_WJERK"] = DEFAULT_WJERK;
-        json["ENABLE_DEFAULT_XJERK"] = ENABLE_DEFAULT_XJERK;
-        json["ENABLE_DEFAULT_YJERK"] = ENABLE_DEFAULT_YJERK;
-        json["ENABLE_DEFAULT_ZJERK"] = ENABLE_DEFAULT_ZJERK;
-        json["ENABLE_DEFAULT_IJERK"] = ENABLE_DEFAULT_IJERK;
-        json["ENABLE_DEFAULT_JJERK"] = ENABLE_DEFAULT_JJERK;
-        json["ENABLE_DEFAULT_KJERK"] = ENABLE_DEFAULT_KJERK;
-        json["ENABLE_DEFAULT_UJERK"] = ENABLE_DEFAULT_UJERK;
-        json["ENABLE_DEFAULT_VJERK"] = ENABLE_DEFAULT_VJERK;
-        json["ENABLE_DEFAULT_WJERK"] = ENABLE_DEFAULT_WJERK;
-        json["TRAVEL_EXTRA_XYJERK"] = TRAVEL_EXTRA_XYJERK;
-        json["ENABLE_TRAVEL_EXTRA_XYJERK"] = ENABLE_TRAVEL_EXTRA_XYJERK;
-        json["LIMITED_JERK_EDITING"] = LIMITED_JERK_EDITING;
-        json["MAX_JERK_EDIT_VALUES"] = MAX_JERK_EDIT_VALUES;
-        json["DEFAULT_EJERK"] = DEFAULT_EJERK;
-        json["JUNCTION_DEVIATION_MM"] = JUNCTION_DEVIATION_MM;
-        json["JD_HANDLE_SMALL_SEGMENTS"] = JD_HANDLE_SMALL_SEGMENTS;
-        json["S_CURVE_ACCELERATION"] = S_CURVE_ACCELERATION;
-
-        return json;
+        pFunction("DISTINCT_E_FACTORS", pSelf.DISTINCT_E_FACTORS);
+        pFunction("DEFAULT_AXIS_STEPS_PER_UNIT", pSelf.DEFAULT_AXIS_STEPS_PER_UNIT);
+        pFunction("DEFAULT_MAX_FEEDRATE", pSelf.DEFAULT_MAX_FEEDRATE);
+        pFunction("LIMITED_MAX_FR_EDITING", pSelf.LIMITED_MAX_FR_EDITING);
+        pFunction("MAX_FEEDRATE_EDIT_VALUES", pSelf.MAX_FEEDRATE_EDIT_VALUES);
+        pFunction("DEFAULT_MAX_ACCELERATION", pSelf.DEFAULT_MAX_ACCELERATION);
+        pFunction("LIMITED_MAX_ACCEL_EDITING", pSelf.LIMITED_MAX_ACCEL_EDITING);
+        pFunction("MAX_ACCEL_EDIT_VALUES", pSelf.MAX_ACCEL_EDIT_VALUES);
+        pFunction("DEFAULT_ACCELERATION", pSelf.DEFAULT_ACCELERATION);
+        pFunction("DEFAULT_RETRACT_ACCELERATION", pSelf.DEFAULT_RETRACT_ACCELERATION);
+        pFunction("DEFAULT_TRAVEL_ACCELERATION", pSelf.DEFAULT_TRAVEL_ACCELERATION);
+        pFunction("CLASSIC_JERK", pSelf.CLASSIC_JERK);
+        pFunction("DEFAULT_XJERK", pSelf.DEFAULT_XJERK);
+        pFunction("DEFAULT_YJERK", pSelf.DEFAULT_YJERK);
+        pFunction("DEFAULT_ZJERK", pSelf.DEFAULT_ZJERK);
+        pFunction("DEFAULT_IJERK", pSelf.DEFAULT_IJERK);
+        pFunction("DEFAULT_JJERK", pSelf.DEFAULT_JJERK);
+        pFunction("DEFAULT_KJERK", pSelf.DEFAULT_KJERK);
+        pFunction("DEFAULT_UJERK", pSelf.DEFAULT_UJERK);
+        pFunction("DEFAULT_VJERK", pSelf.DEFAULT_VJERK);
+        pFunction("DEFAULT_WJERK", pSelf.DEFAULT_WJERK);
+        pFunction("ENABLE_DEFAULT_XJERK", pSelf.ENABLE_DEFAULT_XJERK);
+        pFunction("ENABLE_DEFAULT_YJERK", pSelf.ENABLE_DEFAULT_YJERK);
+        pFunction("ENABLE_DEFAULT_ZJERK", pSelf.ENABLE_DEFAULT_ZJERK);
+        pFunction("ENABLE_DEFAULT_IJERK", pSelf.ENABLE_DEFAULT_IJERK);
+        pFunction("ENABLE_DEFAULT_JJERK", pSelf.ENABLE_DEFAULT_JJERK);
+        pFunction("ENABLE_DEFAULT_KJERK", pSelf.ENABLE_DEFAULT_KJERK);
+        pFunction("ENABLE_DEFAULT_UJERK", pSelf.ENABLE_DEFAULT_UJERK);
+        pFunction("ENABLE_DEFAULT_VJERK", pSelf.ENABLE_DEFAULT_VJERK);
+        pFunction("ENABLE_DEFAULT_WJERK", pSelf.ENABLE_DEFAULT_WJERK);
+        pFunction("TRAVEL_EXTRA_XYJERK", pSelf.TRAVEL_EXTRA_XYJERK);
+        pFunction("ENABLE_TRAVEL_EXTRA_XYJERK", pSelf.ENABLE_TRAVEL_EXTRA_XYJERK);
+        pFunction("LIMITED_JERK_EDITING", pSelf.LIMITED_JERK_EDITING);
+        pFunction("MAX_JERK_EDIT_VALUES", pSelf.MAX_JERK_EDIT_VALUES);
+        pFunction("DEFAULT_EJERK", pSelf.DEFAULT_EJERK);
+        pFunction("JUNCTION_DEVIATION_MM", pSelf.JUNCTION_DEVIATION_MM);
+        pFunction("JD_HANDLE_SMALL_SEGMENTS", pSelf.JD_HANDLE_SMALL_SEGMENTS);
+        pFunction("S_CURVE_ACCELERATION", pSelf.S_CURVE_ACCELERATION);
     }
 };
 
 ///
 /// \brief The FilamentRunoutSensorConfiguration struct contains filament runout sensor configurations
 ///
-struct FilamentRunoutSensorConfiguration : public PageConfiguration
+struct FilamentRunoutSensorConfiguration : public PageFields<FilamentRunoutSensorConfiguration>
 {
     bool FILAMENT_RUNOUT_SENSOR{defaults::FILAMENT_RUNOUT_SENSOR};
     QString FIL_RUNOUT_ENABLED_DEFAULT{defaults::FIL_RUNOUT_ENABLED_DEFAULT};
@@ -2386,65 +2488,63 @@ struct FilamentRunoutSensorConfiguration : public PageConfiguration
     bool FILAMENT_MOTION_SENSOR{defaults::FILAMENT_MOTION_SENSOR};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["FILAMENT_RUNOUT_SENSOR"] = FILAMENT_RUNOUT_SENSOR;
-        json["FIL_RUNOUT_ENABLED_DEFAULT"] = FIL_RUNOUT_ENABLED_DEFAULT;
-        json["NUM_RUNOUT_SENSORS"] = NUM_RUNOUT_SENSORS;
-        json["FIL_RUNOUT_STATE"] = FIL_RUNOUT_STATE;
-        json["FIL_RUNOUT_PULLUP"] = FIL_RUNOUT_PULLUP;
-        json["FIL_RUNOUT_PULLDOWN"] = FIL_RUNOUT_PULLDOWN;
-        json["WATCH_ALL_RUNOUT_SENSORS"] = WATCH_ALL_RUNOUT_SENSORS;
-        json["FIL_RUNOUT1_STATE"] = FIL_RUNOUT1_STATE;
-        json["ENABLE_FIL_RUNOUT1_STATE"] = ENABLE_FIL_RUNOUT1_STATE;
-        json["FIL_RUNOUT1_PULLUP"] = FIL_RUNOUT1_PULLUP;
-        json["FIL_RUNOUT1_PULLDOWN"] = FIL_RUNOUT1_PULLDOWN;
-        json["FIL_RUNOUT2_STATE"] = FIL_RUNOUT2_STATE;
-        json["ENABLE_FIL_RUNOUT2_STATE"] = ENABLE_FIL_RUNOUT2_STATE;
-        json["FIL_RUNOUT2_PULLUP"] = FIL_RUNOUT2_PULLUP;
-        json["FIL_RUNOUT2_PULLDOWN"] = FIL_RUNOUT2_PULLDOWN;
-        json["FIL_RUNOUT3_STATE"] = FIL_RUNOUT3_STATE;
-        json["ENABLE_FIL_RUNOUT3_STATE"] = ENABLE_FIL_RUNOUT3_STATE;
-        json["FIL_RUNOUT3_PULLUP"] = FIL_RUNOUT3_PULLUP;
-        json["FIL_RUNOUT3_PULLDOWN"] = FIL_RUNOUT3_PULLDOWN;
-        json["FIL_RUNOUT4_STATE"] = FIL_RUNOUT4_STATE;
-        json["ENABLE_FIL_RUNOUT4_STATE"] = ENABLE_FIL_RUNOUT4_STATE;
-        json["FIL_RUNOUT4_PULLUP"] = FIL_RUNOUT4_PULLUP;
-        json["FIL_RUNOUT4_PULLDOWN"] = FIL_RUNOUT4_PULLDOWN;
-        json["FIL_RUNOUT5_STATE"] = FIL_RUNOUT5_STATE;
-        json["ENABLE_FIL_RUNOUT5_STATE"] = ENABLE_FIL_RUNOUT5_STATE;
-        json["FIL_RUNOUT5_PULLUP"] = FIL_RUNOUT5_PULLUP;
-        json["FIL_RUNOUT5_PULLDOWN"] = FIL_RUNOUT5_PULLDOWN;
-        json["FIL_RUNOUT6_STATE"] = FIL_RUNOUT6_STATE;
-        json["ENABLE_FIL_RUNOUT6_STATE"] = ENABLE_FIL_RUNOUT6_STATE;
-        json["FIL_RUNOUT6_PULLUP"] = FIL_RUNOUT6_PULLUP;
-        json["FIL_RUNOUT6_PULLDOWN"] = FIL_RUNOUT6_PULLDOWN;
-        json["FIL_RUNOUT7_STATE"] = FIL_RUNOUT7_STATE;
-        json["ENABLE_FIL_RUNOUT7_STATE"] = ENABLE_FIL_RUNOUT7_STATE;
-        json["FIL_RUNOUT7_PULLUP"] = FIL_RUNOUT7_PULLUP;
-        json["FIL_RUNOUT7_PULLDOWN"] = FIL_RUNOUT7_PULLDOWN;
-        json["FIL_RUNOUT8_STATE"] = FIL_RUNOUT8_STATE;
-        json["ENABLE_FIL_RUNOUT8_STATE"] = ENABLE_FIL_RUNOUT8_STATE;
-        json["FIL_RUNOUT8_PULLUP"] = FIL_RUNOUT8_PULLUP;
-        json["FIL_RUNOUT8_PULLDOWN"] = FIL_RUNOUT8_PULLDOWN;
-        json["FILAMENT_RUNOUT_SCRIPT"] = FILAMENT_RUNOUT_SCRIPT;
-        json["FILAMENT_RUNOUT_DISTANCE_MM"] = FILAMENT_RUNOUT_DISTANCE_MM;
-        json["ENABLE_FILAMENT_RUNOUT_DISTANCE_MM"] = ENABLE_FILAMENT_RUNOUT_DISTANCE_MM;
-        json["FILAMENT_MOTION_SENSOR"] = FILAMENT_MOTION_SENSOR;
-
-        return json;
+        pFunction("FILAMENT_RUNOUT_SENSOR", pSelf.FILAMENT_RUNOUT_SENSOR);
+        pFunction("FIL_RUNOUT_ENABLED_DEFAULT", pSelf.FIL_RUNOUT_ENABLED_DEFAULT);
+        pFunction("NUM_RUNOUT_SENSORS", pSelf.NUM_RUNOUT_SENSORS);
+        pFunction("FIL_RUNOUT_STATE", pSelf.FIL_RUNOUT_STATE);
+        pFunction("FIL_RUNOUT_PULLUP", pSelf.FIL_RUNOUT_PULLUP);
+        pFunction("FIL_RUNOUT_PULLDOWN", pSelf.FIL_RUNOUT_PULLDOWN);
+        pFunction("WATCH_ALL_RUNOUT_SENSORS", pSelf.WATCH_ALL_RUNOUT_SENSORS);
+        pFunction("FIL_RUNOUT1_STATE", pSelf.FIL_RUNOUT1_STATE);
+        pFunction("ENABLE_FIL_RUNOUT1_STATE", pSelf.ENABLE_FIL_RUNOUT1_STATE);
+        pFunction("FIL_RUNOUT1_PULLUP", pSelf.FIL_RUNOUT1_PULLUP);
+        pFunction("FIL_RUNOUT1_PULLDOWN", pSelf.FIL_RUNOUT1_PULLDOWN);
+        pFunction("FIL_RUNOUT2_STATE", pSelf.FIL_RUNOUT2_STATE);
+        pFunction("ENABLE_FIL_RUNOUT2_STATE", pSelf.ENABLE_FIL_RUNOUT2_STATE);
+        pFunction("FIL_RUNOUT2_PULLUP", pSelf.FIL_RUNOUT2_PULLUP);
+        pFunction("FIL_RUNOUT2_PULLDOWN", pSelf.FIL_RUNOUT2_PULLDOWN);
+        pFunction("FIL_RUNOUT3_STATE", pSelf.FIL_RUNOUT3_STATE);
+        pFunction("ENABLE_FIL_RUNOUT3_STATE", pSelf.ENABLE_FIL_RUNOUT3_STATE);
+        pFunction("FIL_RUNOUT3_PULLUP", pSelf.FIL_RUNOUT3_PULLUP);
+        pFunction("FIL_RUNOUT3_PULLDOWN", pSelf.FIL_RUNOUT3_PULLDOWN);
+        pFunction("FIL_RUNOUT4_STATE", pSelf.FIL_RUNOUT4_STATE);
+        pFunction("ENABLE_FIL_RUNOUT4_STATE", pSelf.ENABLE_FIL_RUNOUT4_STATE);
+        pFunction("FIL_RUNOUT4_PULLUP", pSelf.FIL_RUNOUT4_PULLUP);
+        pFunction("FIL_RUNOUT4_PULLDOWN", pSelf.FIL_RUNOUT4_PULLDOWN);
+        pFunction("FIL_RUNOUT5_STATE", pSelf.FIL_RUNOUT5_STATE);
+        pFunction("ENABLE_FIL_RUNOUT5_STATE", pSelf.ENABLE_FIL_RUNOUT5_STATE);
+        pFunction("FIL_RUNOUT5_PULLUP", pSelf.FIL_RUNOUT5_PULLUP);
+        pFunction("FIL_RUNOUT5_PULLDOWN", pSelf.FIL_RUNOUT5_PULLDOWN);
+        pFunction("FIL_RUNOUT6_STATE", pSelf.FIL_RUNOUT6_STATE);
+        pFunction("ENABLE_FIL_RUNOUT6_STATE", pSelf.ENABLE_FIL_RUNOUT6_STATE);
+        pFunction("FIL_RUNOUT6_PULLUP", pSelf.FIL_RUNOUT6_PULLUP);
+        pFunction("FIL_RUNOUT6_PULLDOWN", pSelf.FIL_RUNOUT6_PULLDOWN);
+        pFunction("FIL_RUNOUT7_STATE", pSelf.FIL_RUNOUT7_STATE);
+        pFunction("ENABLE_FIL_RUNOUT7_STATE", pSelf.ENABLE_FIL_RUNOUT7_STATE);
+        pFunction("FIL_RUNOUT7_PULLUP", pSelf.FIL_RUNOUT7_PULLUP);
+        pFunction("FIL_RUNOUT7_PULLDOWN", pSelf.FIL_RUNOUT7_PULLDOWN);
+        pFunction("FIL_RUNOUT8_STATE", pSelf.FIL_RUNOUT8_STATE);
+        pFunction("ENABLE_FIL_RUNOUT8_STATE", pSelf.ENABLE_FIL_RUNOUT8_STATE);
+        pFunction("FIL_RUNOUT8_PULLUP", pSelf.FIL_RUNOUT8_PULLUP);
+        pFunction("FIL_RUNOUT8_PULLDOWN", pSelf.FIL_RUNOUT8_PULLDOWN);
+        pFunction("FILAMENT_RUNOUT_SCRIPT", pSelf.FILAMENT_RUNOUT_SCRIPT);
+        pFunction("FILAMENT_RUNOUT_DISTANCE_MM", pSelf.FILAMENT_RUNOUT_DISTANCE_MM);
+        pFunction("ENABLE_FILAMENT_RUNOUT_DISTANCE_MM", pSelf.ENABLE_FILAMENT_RUNOUT_DISTANCE_MM);
+        pFunction("FILAMENT_MOTION_SENSOR", pSelf.FILAMENT_MOTION_SENSOR);
     }
 };
 
 ///
 /// \brief The BedLevelingConfiguration struct contains bed leveling configurations
 ///
-struct BedLevelingConfiguration : public PageConfiguration
+struct BedLevelingConfiguration : public PageFields<BedLevelingConfiguration>
 {
     bool AUTO_BED_LEVELING_3POINT{defaults::AUTO_BED_LEVELING_3POINT};
     bool AUTO_BED_LEVELING_LINEAR{defaults::AUTO_BED_LEVELING_LINEAR};
@@ -2510,84 +2610,82 @@ struct BedLevelingConfiguration : public PageConfiguration
     bool ENABLE_Z_PROBE_END_SCRIPT{defaults::ENABLE_Z_PROBE_END_SCRIPT};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["AUTO_BED_LEVELING_3POINT"] = AUTO_BED_LEVELING_3POINT;
-        json["AUTO_BED_LEVELING_LINEAR"] = AUTO_BED_LEVELING_LINEAR;
-        json["AUTO_BED_LEVELING_BILINEAR"] = AUTO_BED_LEVELING_BILINEAR;
-        json["AUTO_BED_LEVELING_UBL"] = AUTO_BED_LEVELING_UBL;
-        json["MESH_BED_LEVELING"] = MESH_BED_LEVELING;
-        json["RESTORE_LEVELING_AFTER_G28"] = RESTORE_LEVELING_AFTER_G28;
-        json["ENABLE_LEVELING_AFTER_G28"] = ENABLE_LEVELING_AFTER_G28;
-        json["LEVELING_NOZZLE_TEMP"] = LEVELING_NOZZLE_TEMP;
-        json["LEVELING_BED_TEMP"] = LEVELING_BED_TEMP;
-        json["BD_SENSOR"] = BD_SENSOR;
-        json["DEBUG_LEVELING_FEATURE"] = DEBUG_LEVELING_FEATURE;
-        json["MANUAL_PROBE_START_Z"] = MANUAL_PROBE_START_Z;
-        json["ENABLE_MANUAL_PROBE_START_Z"] = ENABLE_MANUAL_PROBE_START_Z;
-        json["ENABLE_LEVELING_FADE_HEIGHT"] = ENABLE_LEVELING_FADE_HEIGHT;
-        json["DEFAULT_LEVELING_FADE_HEIGHT"] = DEFAULT_LEVELING_FADE_HEIGHT;
-        json["SEGMENT_LEVELED_MOVES"] = SEGMENT_LEVELED_MOVES;
-        json["LEVELED_SEGMENT_LENGTH"] = LEVELED_SEGMENT_LENGTH;
-        json["G26_MESH_VALIDATION"] = G26_MESH_VALIDATION;
-        json["MESH_TEST_NOZZLE_SIZE"] = MESH_TEST_NOZZLE_SIZE;
-        json["MESH_TEST_LAYER_HEIGHT"] = MESH_TEST_LAYER_HEIGHT;
-        json["MESH_TEST_HOTEND_TEMP"] = MESH_TEST_HOTEND_TEMP;
-        json["MESH_TEST_BED_TEMP"] = MESH_TEST_BED_TEMP;
-        json["G26_XY_FEEDRATE"] = G26_XY_FEEDRATE;
-        json["G26_XY_FEEDRATE_TRAVEL"] = G26_XY_FEEDRATE_TRAVEL;
-        json["G26_RETRACT_MULTIPLIER"] = G26_RETRACT_MULTIPLIER;
-        json["PREHEAT_BEFORE_LEVELING"] = PREHEAT_BEFORE_LEVELING;
-        json["GRID_MAX_POINTS_X"] = GRID_MAX_POINTS_X;
-        json["GRID_MAX_POINTS_Y"] = GRID_MAX_POINTS_Y;
-        json["PROBE_Y_FIRST"] = PROBE_Y_FIRST;
-        json["EXTRAPOLATE_BEYOND_GRID"] = EXTRAPOLATE_BEYOND_GRID;
-        json["ABL_BILINEAR_SUBDIVISION"] = ABL_BILINEAR_SUBDIVISION;
-        json["BILINEAR_SUBDIVISIONS"] = BILINEAR_SUBDIVISIONS;
-        json["MESH_EDIT_GFX_OVERLAY"] = MESH_EDIT_GFX_OVERLAY;
-        json["MESH_INSET"] = MESH_INSET;
-        json["GRID_MAX_POINTS_X_2"] = GRID_MAX_POINTS_X_2;
-        json["GRID_MAX_POINTS_Y_2"] = GRID_MAX_POINTS_Y_2;
-        json["UBL_HILBERT_CURVE"] = UBL_HILBERT_CURVE;
-        json["UBL_MESH_EDIT_MOVES_Z"] = UBL_MESH_EDIT_MOVES_Z;
-        json["UBL_SAVE_ACTIVE_ON_M500"] = UBL_SAVE_ACTIVE_ON_M500;
-        json["UBL_Z_RAISE_WHEN_OFF_MESH"] = UBL_Z_RAISE_WHEN_OFF_MESH;
-        json["ENABLE_UBL_Z_RAISE_WHEN_OFF_MESH"] = ENABLE_UBL_Z_RAISE_WHEN_OFF_MESH;
-        json["UBL_MESH_WIZARD"] = UBL_MESH_WIZARD;
-        json["MESH_INSET_2"] = MESH_INSET_2;
-        json["GRID_MAX_POINTS_X_3"] = GRID_MAX_POINTS_X_3;
-        json["GRID_MAX_POINTS_Y_3"] = GRID_MAX_POINTS_Y_3;
-        json["MESH_G28_REST_ORIGIN"] = MESH_G28_REST_ORIGIN;
-        json["LCD_BED_LEVELING"] = LCD_BED_LEVELING;
-        json["MESH_EDIT_Z_STEP"] = MESH_EDIT_Z_STEP;
-        json["LCD_PROBE_Z_RANGE"] = LCD_PROBE_Z_RANGE;
-        json["MESH_EDIT_MENU"] = MESH_EDIT_MENU;
-        json["LCD_BED_TRAMMING"] = LCD_BED_TRAMMING;
-        json["BED_TRAMMING_INSET_LFRB"] = BED_TRAMMING_INSET_LFRB;
-        json["BED_TRAMMING_HEIGHT"] = BED_TRAMMING_HEIGHT;
-        json["BED_TRAMMING_Z_HOP"] = BED_TRAMMING_Z_HOP;
-        json["BED_TRAMMING_INCLUDE_CENTER"] = BED_TRAMMING_INCLUDE_CENTER;
-        json["BED_TRAMMING_USE_PROBE"] = BED_TRAMMING_USE_PROBE;
-        json["BED_TRAMMING_PROBE_TOLERANCE"] = BED_TRAMMING_PROBE_TOLERANCE;
-        json["BED_TRAMMING_VERIFY_RAISED"] = BED_TRAMMING_VERIFY_RAISED;
-        json["BED_TRAMMING_AUDIO_FEEDBACK"] = BED_TRAMMING_AUDIO_FEEDBACK;
-        json["BED_TRAMMING_LEVELING_ORDER"] = BED_TRAMMING_LEVELING_ORDER;
-        json["Z_PROBE_END_SCRIPT"] = Z_PROBE_END_SCRIPT;
-        json["ENABLE_Z_PROBE_END_SCRIPT"] = ENABLE_Z_PROBE_END_SCRIPT;
-
-        return json;
+        pFunction("AUTO_BED_LEVELING_3POINT", pSelf.AUTO_BED_LEVELING_3POINT);
+        pFunction("AUTO_BED_LEVELING_LINEAR", pSelf.AUTO_BED_LEVELING_LINEAR);
+        pFunction("AUTO_BED_LEVELING_BILINEAR", pSelf.AUTO_BED_LEVELING_BILINEAR);
+        pFunction("AUTO_BED_LEVELING_UBL", pSelf.AUTO_BED_LEVELING_UBL);
+        pFunction("MESH_BED_LEVELING", pSelf.MESH_BED_LEVELING);
+        pFunction("RESTORE_LEVELING_AFTER_G28", pSelf.RESTORE_LEVELING_AFTER_G28);
+        pFunction("ENABLE_LEVELING_AFTER_G28", pSelf.ENABLE_LEVELING_AFTER_G28);
+        pFunction("LEVELING_NOZZLE_TEMP", pSelf.LEVELING_NOZZLE_TEMP);
+        pFunction("LEVELING_BED_TEMP", pSelf.LEVELING_BED_TEMP);
+        pFunction("BD_SENSOR", pSelf.BD_SENSOR);
+        pFunction("DEBUG_LEVELING_FEATURE", pSelf.DEBUG_LEVELING_FEATURE);
+        pFunction("MANUAL_PROBE_START_Z", pSelf.MANUAL_PROBE_START_Z);
+        pFunction("ENABLE_MANUAL_PROBE_START_Z", pSelf.ENABLE_MANUAL_PROBE_START_Z);
+        pFunction("ENABLE_LEVELING_FADE_HEIGHT", pSelf.ENABLE_LEVELING_FADE_HEIGHT);
+        pFunction("DEFAULT_LEVELING_FADE_HEIGHT", pSelf.DEFAULT_LEVELING_FADE_HEIGHT);
+        pFunction("SEGMENT_LEVELED_MOVES", pSelf.SEGMENT_LEVELED_MOVES);
+        pFunction("LEVELED_SEGMENT_LENGTH", pSelf.LEVELED_SEGMENT_LENGTH);
+        pFunction("G26_MESH_VALIDATION", pSelf.G26_MESH_VALIDATION);
+        pFunction("MESH_TEST_NOZZLE_SIZE", pSelf.MESH_TEST_NOZZLE_SIZE);
+        pFunction("MESH_TEST_LAYER_HEIGHT", pSelf.MESH_TEST_LAYER_HEIGHT);
+        pFunction("MESH_TEST_HOTEND_TEMP", pSelf.MESH_TEST_HOTEND_TEMP);
+        pFunction("MESH_TEST_BED_TEMP", pSelf.MESH_TEST_BED_TEMP);
+        pFunction("G26_XY_FEEDRATE", pSelf.G26_XY_FEEDRATE);
+        pFunction("G26_XY_FEEDRATE_TRAVEL", pSelf.G26_XY_FEEDRATE_TRAVEL);
+        pFunction("G26_RETRACT_MULTIPLIER", pSelf.G26_RETRACT_MULTIPLIER);
+        pFunction("PREHEAT_BEFORE_LEVELING", pSelf.PREHEAT_BEFORE_LEVELING);
+        pFunction("GRID_MAX_POINTS_X", pSelf.GRID_MAX_POINTS_X);
+        pFunction("GRID_MAX_POINTS_Y", pSelf.GRID_MAX_POINTS_Y);
+        pFunction("PROBE_Y_FIRST", pSelf.PROBE_Y_FIRST);
+        pFunction("EXTRAPOLATE_BEYOND_GRID", pSelf.EXTRAPOLATE_BEYOND_GRID);
+        pFunction("ABL_BILINEAR_SUBDIVISION", pSelf.ABL_BILINEAR_SUBDIVISION);
+        pFunction("BILINEAR_SUBDIVISIONS", pSelf.BILINEAR_SUBDIVISIONS);
+        pFunction("MESH_EDIT_GFX_OVERLAY", pSelf.MESH_EDIT_GFX_OVERLAY);
+        pFunction("MESH_INSET", pSelf.MESH_INSET);
+        pFunction("GRID_MAX_POINTS_X_2", pSelf.GRID_MAX_POINTS_X_2);
+        pFunction("GRID_MAX_POINTS_Y_2", pSelf.GRID_MAX_POINTS_Y_2);
+        pFunction("UBL_HILBERT_CURVE", pSelf.UBL_HILBERT_CURVE);
+        pFunction("UBL_MESH_EDIT_MOVES_Z", pSelf.UBL_MESH_EDIT_MOVES_Z);
+        pFunction("UBL_SAVE_ACTIVE_ON_M500", pSelf.UBL_SAVE_ACTIVE_ON_M500);
+        pFunction("UBL_Z_RAISE_WHEN_OFF_MESH", pSelf.UBL_Z_RAISE_WHEN_OFF_MESH);
+        pFunction("ENABLE_UBL_Z_RAISE_WHEN_OFF_MESH", pSelf.ENABLE_UBL_Z_RAISE_WHEN_OFF_MESH);
+        pFunction("UBL_MESH_WIZARD", pSelf.UBL_MESH_WIZARD);
+        pFunction("MESH_INSET_2", pSelf.MESH_INSET_2);
+        pFunction("GRID_MAX_POINTS_X_3", pSelf.GRID_MAX_POINTS_X_3);
+        pFunction("GRID_MAX_POINTS_Y_3", pSelf.GRID_MAX_POINTS_Y_3);
+        pFunction("MESH_G28_REST_ORIGIN", pSelf.MESH_G28_REST_ORIGIN);
+        pFunction("LCD_BED_LEVELING", pSelf.LCD_BED_LEVELING);
+        pFunction("MESH_EDIT_Z_STEP", pSelf.MESH_EDIT_Z_STEP);
+        pFunction("LCD_PROBE_Z_RANGE", pSelf.LCD_PROBE_Z_RANGE);
+        pFunction("MESH_EDIT_MENU", pSelf.MESH_EDIT_MENU);
+        pFunction("LCD_BED_TRAMMING", pSelf.LCD_BED_TRAMMING);
+        pFunction("BED_TRAMMING_INSET_LFRB", pSelf.BED_TRAMMING_INSET_LFRB);
+        pFunction("BED_TRAMMING_HEIGHT", pSelf.BED_TRAMMING_HEIGHT);
+        pFunction("BED_TRAMMING_Z_HOP", pSelf.BED_TRAMMING_Z_HOP);
+        pFunction("BED_TRAMMING_INCLUDE_CENTER", pSelf.BED_TRAMMING_INCLUDE_CENTER);
+        pFunction("BED_TRAMMING_USE_PROBE", pSelf.BED_TRAMMING_USE_PROBE);
+        pFunction("BED_TRAMMING_PROBE_TOLERANCE", pSelf.BED_TRAMMING_PROBE_TOLERANCE);
+        pFunction("BED_TRAMMING_VERIFY_RAISED", pSelf.BED_TRAMMING_VERIFY_RAISED);
+        pFunction("BED_TRAMMING_AUDIO_FEEDBACK", pSelf.BED_TRAMMING_AUDIO_FEEDBACK);
+        pFunction("BED_TRAMMING_LEVELING_ORDER", pSelf.BED_TRAMMING_LEVELING_ORDER);
+        pFunction("Z_PROBE_END_SCRIPT", pSelf.Z_PROBE_END_SCRIPT);
+        pFunction("ENABLE_Z_PROBE_END_SCRIPT", pSelf.ENABLE_Z_PROBE_END_SCRIPT);
     }
 };
 
 ///
 /// \brief The HomingOptionsConfiguration struct contains homing options configurations
 ///
-struct HomingOptionsConfiguration : public PageConfiguration
+struct HomingOptionsConfiguration : public PageFields<HomingOptionsConfiguration>
 {
     bool BED_CENTER_AT_0_0{defaults::BED_CENTER_AT_0_0};
     int32_t MANUAL_X_HOME_POS{defaults::MANUAL_X_HOME_POS};
@@ -2634,136 +2732,128 @@ struct HomingOptionsConfiguration : public PageConfiguration
     bool SKEW_CORRECTION_GCODE{defaults::SKEW_CORRECTION_GCODE};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["BED_CENTER_AT_0_0"] = BED_CENTER_AT_0_0;
-        json["MANUAL_X_HOME_POS"] = MANUAL_X_HOME_POS;
-        json["MANUAL_Y_HOME_POS"] = MANUAL_Y_HOME_POS;
-        json["MANUAL_Z_HOME_POS"] = MANUAL_Z_HOME_POS;
-        json["MANUAL_I_HOME_POS"] = MANUAL_I_HOME_POS;
-        json["MANUAL_J_HOME_POS"] = MANUAL_J_HOME_POS;
-        json["MANUAL_K_HOME_POS"] = MANUAL_K_HOME_POS;
-        json["MANUAL_U_HOME_POS"] = MANUAL_U_HOME_POS;
-        json["MANUAL_V_HOME_POS"] = MANUAL_V_HOME_POS;
-        json["MANUAL_W_HOME_POS"] = MANUAL_W_HOME_POS;
-        json["ENABLE_MANUAL_X_HOME_POS"] = ENABLE_MANUAL_X_HOME_POS;
-        json["ENABLE_MANUAL_Y_HOME_POS"] = ENABLE_MANUAL_Y_HOME_POS;
-        json["ENABLE_MANUAL_Z_HOME_POS"] = ENABLE_MANUAL_Z_HOME_POS;
-        json["ENABLE_MANUAL_I_HOME_POS"] = ENABLE_MANUAL_I_HOME_POS;
-        json["ENABLE_MANUAL_J_HOME_POS"] = ENABLE_MANUAL_J_HOME_POS;
-        json["ENABLE_MANUAL_K_HOME_POS"] = ENABLE_MANUAL_K_HOME_POS;
-        json["ENABLE_MANUAL_U_HOME_POS"] = ENABLE_MANUAL_U_HOME_POS;
-        json["ENABLE_MANUAL_V_HOME_POS"] = ENABLE_MANUAL_V_HOME_POS;
-        json["ENABLE_MANUAL_W_HOME_POS"] = ENABLE_MANUAL_W_HOME_POS;
-        json["Z_SAFE_HOMING"] = Z_SAFE_HOMING;
-        json["Z_SAFE_HOMING_X_POINT"] = Z_SAFE_HOMING_X_POINT;
-        json["Z_SAFE_HOMING_Y_POINT"] = Z_SAFE_HOMING_Y_POINT;
-        json["ENABLE_Z_SAFE_HOMING_X_POINT"] = ENABLE_Z_SAFE_HOMING_X_POINT;
-        json["ENABLE_Z_SAFE_HOMING_Y_POINT"] = ENABLE_Z_SAFE_HOMING_Y_POINT;
-        json["HOMING_FEEDRATE_MM_M"] = HOMING_FEEDRATE_MM_M;
-        json["VALIDATE_HOMING_ENDSTOPS"] = VALIDATE_HOMING_ENDSTOPS;
-        json["SKEW_CORRECTION"] = SKEW_CORRECTION;
-        json["XY_DIAG_AC"] = XY_DIAG_AC;
-        json["XY_DIAG_BD"] = XY_DIAG_BD;
-        json["XY_SIDE_AD"] = XY_SIDE_AD;
-        json["XY_SKEW_FACTOR"] = XY_SKEW_FACTOR;
-        json["ENABLE_XY_SKEW_FACTOR"] = ENABLE_XY_SKEW_FACTOR;
-        json["SKEW_CORRECTION_FOR_Z"] = SKEW_CORRECTION_FOR_Z;
-        json["XZ_DIAG_AC"] = XZ_DIAG_AC;
-        json["XZ_DIAG_BD"] = XZ_DIAG_BD;
-        json["YZ_DIAG_AC"] = YZ_DIAG_AC;
-        json["YZ_DIAG_BD"] = YZ_DIAG_BD;
-        json["YZ_SIDE_AD"] = YZ_SIDE_AD;
-        json["XZ_SKEW_FACTOR"] = XZ_SKEW_FACTOR;
-        json["YZ_SKEW_FACTOR"] = YZ_SKEW_FACTOR;
-        json["ENABLE_XZ_SKEW_FACTOR"] = ENABLE_XZ_SKEW_FACTOR;
-        json["ENABLE_YZ_SKEW_FACTOR"] = ENABLE_YZ_SKEW_FACTOR;
-        json["SKEW_CORRECTION_GCODE"] = SKEW_CORRECTION_GCODE;
-
-        return json;
+        pFunction("BED_CENTER_AT_0_0", pSelf.BED_CENTER_AT_0_0);
+        pFunction("MANUAL_X_HOME_POS", pSelf.MANUAL_X_HOME_POS);
+        pFunction("MANUAL_Y_HOME_POS", pSelf.MANUAL_Y_HOME_POS);
+        pFunction("MANUAL_Z_HOME_POS", pSelf.MANUAL_Z_HOME_POS);
+        pFunction("MANUAL_I_HOME_POS", pSelf.MANUAL_I_HOME_POS);
+        pFunction("MANUAL_J_HOME_POS", pSelf.MANUAL_J_HOME_POS);
+        pFunction("MANUAL_K_HOME_POS", pSelf.MANUAL_K_HOME_POS);
+        pFunction("MANUAL_U_HOME_POS", pSelf.MANUAL_U_HOME_POS);
+        pFunction("MANUAL_V_HOME_POS", pSelf.MANUAL_V_HOME_POS);
+        pFunction("MANUAL_W_HOME_POS", pSelf.MANUAL_W_HOME_POS);
+        pFunction("ENABLE_MANUAL_X_HOME_POS", pSelf.ENABLE_MANUAL_X_HOME_POS);
+        pFunction("ENABLE_MANUAL_Y_HOME_POS", pSelf.ENABLE_MANUAL_Y_HOME_POS);
+        pFunction("ENABLE_MANUAL_Z_HOME_POS", pSelf.ENABLE_MANUAL_Z_HOME_POS);
+        pFunction("ENABLE_MANUAL_I_HOME_POS", pSelf.ENABLE_MANUAL_I_HOME_POS);
+        pFunction("ENABLE_MANUAL_J_HOME_POS", pSelf.ENABLE_MANUAL_J_HOME_POS);
+        pFunction("ENABLE_MANUAL_K_HOME_POS", pSelf.ENABLE_MANUAL_K_HOME_POS);
+        pFunction("ENABLE_MANUAL_U_HOME_POS", pSelf.ENABLE_MANUAL_U_HOME_POS);
+        pFunction("ENABLE_MANUAL_V_HOME_POS", pSelf.ENABLE_MANUAL_V_HOME_POS);
+        pFunction("ENABLE_MANUAL_W_HOME_POS", pSelf.ENABLE_MANUAL_W_HOME_POS);
+        pFunction("Z_SAFE_HOMING", pSelf.Z_SAFE_HOMING);
+        pFunction("Z_SAFE_HOMING_X_POINT", pSelf.Z_SAFE_HOMING_X_POINT);
+        pFunction("Z_SAFE_HOMING_Y_POINT", pSelf.Z_SAFE_HOMING_Y_POINT);
+        pFunction("ENABLE_Z_SAFE_HOMING_X_POINT", pSelf.ENABLE_Z_SAFE_HOMING_X_POINT);
+        pFunction("ENABLE_Z_SAFE_HOMING_Y_POINT", pSelf.ENABLE_Z_SAFE_HOMING_Y_POINT);
+        pFunction("HOMING_FEEDRATE_MM_M", pSelf.HOMING_FEEDRATE_MM_M);
+        pFunction("VALIDATE_HOMING_ENDSTOPS", pSelf.VALIDATE_HOMING_ENDSTOPS);
+        pFunction("SKEW_CORRECTION", pSelf.SKEW_CORRECTION);
+        pFunction("XY_DIAG_AC", pSelf.XY_DIAG_AC);
+        pFunction("XY_DIAG_BD", pSelf.XY_DIAG_BD);
+        pFunction("XY_SIDE_AD", pSelf.XY_SIDE_AD);
+        pFunction("XY_SKEW_FACTOR", pSelf.XY_SKEW_FACTOR);
+        pFunction("ENABLE_XY_SKEW_FACTOR", pSelf.ENABLE_XY_SKEW_FACTOR);
+        pFunction("SKEW_CORRECTION_FOR_Z", pSelf.SKEW_CORRECTION_FOR_Z);
+        pFunction("XZ_DIAG_AC", pSelf.XZ_DIAG_AC);
+        pFunction("XZ_DIAG_BD", pSelf.XZ_DIAG_BD);
+        pFunction("YZ_DIAG_AC", pSelf.YZ_DIAG_AC);
+        pFunction("YZ_DIAG_BD", pSelf.YZ_DIAG_BD);
+        pFunction("YZ_SIDE_AD", pSelf.YZ_SIDE_AD);
+        pFunction("XZ_SKEW_FACTOR", pSelf.XZ_SKEW_FACTOR);
+        pFunction("YZ_SKEW_FACTOR", pSelf.YZ_SKEW_FACTOR);
+        pFunction("ENABLE_XZ_SKEW_FACTOR", pSelf.ENABLE_XZ_SKEW_FACTOR);
+        pFunction("ENABLE_YZ_SKEW_FACTOR", pSelf.ENABLE_YZ_SKEW_FACTOR);
+        pFunction("SKEW_CORRECTION_GCODE", pSelf.SKEW_CORRECTION_GCODE);
     }
 };
 
 ///
 /// \brief The UserInterfaceLanguageConfiguration struct contains user interface language configurations
 ///
-struct UserInterfaceLanguageConfiguration : public PageConfiguration
+struct UserInterfaceLanguageConfiguration : public PageFields<UserInterfaceLanguageConfiguration>
 {
     QString LCD_LANGUAGE{defaults::LCD_LANGUAGE};
     QString DISPLAY_CHARSET_HD44780{defaults::DISPLAY_CHARSET_HD44780};
     QString LCD_INFO_SCREEN_STYLE{defaults::LCD_INFO_SCREEN_STYLE};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["LCD_LANGUAGE"] = LCD_LANGUAGE;
-        json["DISPLAY_CHARSET_HD44780"] = DISPLAY_CHARSET_HD44780;
-        json["LCD_INFO_SCREEN_STYLE"] = LCD_INFO_SCREEN_STYLE;
-
-        return json;
+        pFunction("LCD_LANGUAGE", pSelf.LCD_LANGUAGE);
+        pFunction("DISPLAY_CHARSET_HD44780", pSelf.DISPLAY_CHARSET_HD44780);
+        pFunction("LCD_INFO_SCREEN_STYLE", pSelf.LCD_INFO_SCREEN_STYLE);
     }
 };
 
 ///
 /// \brief The SDCardConfiguration struct contains SD card configurations
 ///
-struct SDCardConfiguration : public PageConfiguration
+struct SDCardConfiguration : public PageFields<SDCardConfiguration>
 {
     bool SDSUPPORT{defaults::SDSUPPORT};
     bool SD_CHECK_AND_RETRY{defaults::SD_CHECK_AND_RETRY};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["SDSUPPORT"] = SDSUPPORT;
-        json["SD_CHECK_AND_RETRY"] = SD_CHECK_AND_RETRY;
-
-        return json;
+        pFunction("SDSUPPORT", pSelf.SDSUPPORT);
+        pFunction("SD_CHECK_AND_RETRY", pSelf.SD_CHECK_AND_RETRY);
     }
 };
 
 ///
 /// \brief The LCDMenuItemsConfiguration struct contains LCD menu items configurations
 ///
-struct LCDMenuItemsConfiguration : public PageConfiguration
+struct LCDMenuItemsConfiguration : public PageFields<LCDMenuItemsConfiguration>
 {
     bool NO_LCD_MENUS{defaults::NO_LCD_MENUS};
     bool SLIM_LCD_MENUS{defaults::SLIM_LCD_MENUS};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["NO_LCD_MENUS"] = NO_LCD_MENUS;
-        json["SLIM_LCD_MENUS"] = SLIM_LCD_MENUS;
-
-        return json;
+        pFunction("NO_LCD_MENUS", pSelf.NO_LCD_MENUS);
+        pFunction("SLIM_LCD_MENUS", pSelf.SLIM_LCD_MENUS);
     }
 };
 
 ///
 /// \brief The EncoderConfiguration struct contains encoder configurations
 ///
-struct EncoderConfiguration : public PageConfiguration
+struct EncoderConfiguration : public PageFields<EncoderConfiguration>
 {
     int32_t ENCODER_PULSES_PER_STEP{defaults::ENCODER_PULSES_PER_STEP};
     bool ENABLE_ENCODER_PULSES_PER_STEP{defaults::ENABLE_ENCODER_PULSES_PER_STEP};
@@ -2778,26 +2868,24 @@ struct EncoderConfiguration : public PageConfiguration
     bool INDIVIDUAL_AXIS_HOMING_SUBMENU{defaults::INDIVIDUAL_AXIS_HOMING_SUBMENU};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["ENCODER_PULSES_PER_STEP"] = ENCODER_PULSES_PER_STEP;
-        json["ENABLE_ENCODER_PULSES_PER_STEP"] = ENABLE_ENCODER_PULSES_PER_STEP;
-        json["ENCODER_STEPS_PER_MENU_ITEM"] = ENCODER_STEPS_PER_MENU_ITEM;
-        json["ENABLE_ENCODER_STEPS_PER_MENU_ITEM"] = ENABLE_ENCODER_STEPS_PER_MENU_ITEM;
-        json["REVERSE_ENCODER_DIRECTION"] = REVERSE_ENCODER_DIRECTION;
-        json["REVERSE_MENU_DIRECTION"] = REVERSE_MENU_DIRECTION;
-        json["REVERSE_SELECT_DIRECTION"] = REVERSE_SELECT_DIRECTION;
-        json["ENCODER_NOISE_FILTER"] = ENCODER_NOISE_FILTER;
-        json["ENCODER_SAMPLES"] = ENCODER_SAMPLES;
-        json["INDIVIDUAL_AXIS_HOMING_MENU"] = INDIVIDUAL_AXIS_HOMING_MENU;
-        json["INDIVIDUAL_AXIS_HOMING_SUBMENU"] = INDIVIDUAL_AXIS_HOMING_SUBMENU;
-
-        return json;
+        pFunction("ENCODER_PULSES_PER_STEP", pSelf.ENCODER_PULSES_PER_STEP);
+        pFunction("ENABLE_ENCODER_PULSES_PER_STEP", pSelf.ENABLE_ENCODER_PULSES_PER_STEP);
+        pFunction("ENCODER_STEPS_PER_MENU_ITEM", pSelf.ENCODER_STEPS_PER_MENU_ITEM);
+        pFunction("ENABLE_ENCODER_STEPS_PER_MENU_ITEM", pSelf.ENABLE_ENCODER_STEPS_PER_MENU_ITEM);
+        pFunction("REVERSE_ENCODER_DIRECTION", pSelf.REVERSE_ENCODER_DIRECTION);
+        pFunction("REVERSE_MENU_DIRECTION", pSelf.REVERSE_MENU_DIRECTION);
+        pFunction("REVERSE_SELECT_DIRECTION", pSelf.REVERSE_SELECT_DIRECTION);
+        pFunction("ENCODER_NOISE_FILTER", pSelf.ENCODER_NOISE_FILTER);
+        pFunction("ENCODER_SAMPLES", pSelf.ENCODER_SAMPLES);
+        pFunction("INDIVIDUAL_AXIS_HOMING_MENU", pSelf.INDIVIDUAL_AXIS_HOMING_MENU);
+        pFunction("INDIVIDUAL_AXIS_HOMING_SUBMENU", pSelf.INDIVIDUAL_AXIS_HOMING_SUBMENU);
     }
 };
 
@@ -2805,7 +2893,7 @@ public:
 ///
 /// \brief The SpeakerConfiguration struct contains speaker configurations
 ///
-struct SpeakerConfiguration : public PageConfiguration
+struct SpeakerConfiguration : public PageFields<SpeakerConfiguration>
 {
     bool SPEAKER{defaults::SPEAKER};
     int32_t LCD_FEEDBACK_FREQUENCY_DURATION_MS{defaults::LCD_FEEDBACK_FREQUENCY_DURATION_MS};
@@ -2814,20 +2902,18 @@ struct SpeakerConfiguration : public PageConfiguration
     bool ENABLE_LCD_FEEDBACK_FREQUENCY_HZ{defaults::ENABLE_LCD_FEEDBACK_FREQUENCY_HZ};
 
 public:
-    /// \brief Converts the configuration into a JSON object
+    /// \brief Calls a function with the name and a reference of each field
     ///
-    /// \return a JSON object containing the configuration data
-    QJsonObject ToJson(void) const override
+    /// \param pSelf: The page
+    /// \param pFunction: Called with the field name and the field
+    template <typename Self, typename F>
+    static void VisitFields(Self& pSelf, F&& pFunction)
     {
-        QJsonObject json;
-
-        json["SPEAKER"] = SPEAKER;
-        json["LCD_FEEDBACK_FREQUENCY_DURATION_MS"] = LCD_FEEDBACK_FREQUENCY_DURATION_MS;
-        json["ENABLE_LCD_FEEDBACK_FREQUENCY_DURATION_MS"] = ENABLE_LCD_FEEDBACK_FREQUENCY_DURATION_MS;
-        json["LCD_FEEDBACK_FREQUENCY_HZ"] = LCD_FEEDBACK_FREQUENCY_HZ;
-        json["ENABLE_LCD_FEEDBACK_FREQUENCY_HZ"] = ENABLE_LCD_FEEDBACK_FREQUENCY_HZ;
-
-        return json;
+        pFunction("SPEAKER", pSelf.SPEAKER);
+        pFunction("LCD_FEEDBACK_FREQUENCY_DURATION_MS", pSelf.LCD_FEEDBACK_FREQUENCY_DURATION_MS);
+        pFunction("ENABLE_LCD_FEEDBACK_FREQUENCY_DURATION_MS", pSelf.ENABLE_LCD_FEEDBACK_FREQUENCY_DURATION_MS);
+        pFunction("LCD_FEEDBACK_FREQUENCY_HZ", pSelf.LCD_FEEDBACK_FREQUENCY_HZ);
+        pFunction("ENABLE_LCD_FEEDBACK_FREQUENCY_HZ", pSelf.ENABLE_LCD_FEEDBACK_FREQUENCY_HZ);
     }
 };
 
@@ -2856,34 +2942,312 @@ struct Configuration
     SpeakerConfiguration speaker;
 
 public:
+    /// \brief Number of configuration pages
+    static constexpr size_t PAGE_COUNT{18};
+
+    /// \brief The page keys as used in configuration.json, in page order
+    static constexpr std::array<const char*, PAGE_COUNT> PAGE_KEYS{
+        "firmware", "hardware", "extruder", "powerSupply", "thermalSettings", "kinematics",
+        "endstops", "movement", "stepperDrivers", "homingAndBounds", "filamentRunoutSensor", "bedLeveling",
+        "homingOptions", "userInterfaceLanguage", "sdCard", "lcdMenuItems", "encoder", "speaker"
+    };
+
+    /// \brief The members holding the pages, in page order
+    static constexpr auto PAGE_MEMBERS = std::make_tuple(
+        &Configuration::firmware, &Configuration::hardware, &Configuration::extruder, &Configuration::powerSupply,
+        &Configuration::thermalSettings, &Configuration::kinematics, &Configuration::endstops, &Configuration::movement,
+        &Configuration::stepperDrivers, &Configuration::homingAndBounds, &Configuration::filamentRunoutSensor,
+        &Configuration::bedLeveling, &Configuration::homingOptions, &Configuration::userInterfaceLanguage,
+        &Configuration::sdCard, &Configuration::lcdMenuItems, &Configuration::encoder, &Configuration::speaker);
+
+    static_assert(std::tuple_size_v<decltype(PAGE_MEMBERS)> == PAGE_COUNT);
+
     /// \brief Converts the configuration into a JSON object
     ///
     /// \return a JSON object containing the configuration data
     QJsonObject ToJson(void) const
     {
         QJsonObject json;
+        ForEachPage([&json](const char *pPage, const auto& pFields)
+        {
+            json[pPage] = pFields.ToJson();
+        });
+        return json;
+    }
+
+    /// \brief Calls a function with the key and a reference of each page, in page order
+    ///
+    /// \param pFunction: Called with the page key and the page
+    template <typename F>
+    void ForEachPage(F&& pFunction)
+    {
+        VisitPages(*this, pFunction, std::make_index_sequence<PAGE_COUNT>());
+    }
+
+    /// \brief Calls a function with the key and a const reference of each page, in page order
+    ///
+    /// \param pFunction: Called with the page key and the page
+    template <typename F>
+    void ForEachPage(F&& pFunction) const
+    {
+        VisitPages(*this, pFunction, std::make_index_sequence<PAGE_COUNT>());
+    }
 
-        json["firmware"] = firmware.ToJson();
-        json["hardware"] = hardware.ToJson();
-        json["extruder"] = extruder.ToJson();
-        json["powerSupply"] = powerSupply.ToJson();
-        json["thermalSettings"] = thermalSettings.ToJson();
-        json["kinematics"] = kinematics.ToJson();
-        json["endstops"] = endstops.ToJson();
-        json["movement"] = movement.ToJson();
-        json["stepperDrivers"] = stepperDrivers.ToJson();
-        json["homingAndBounds"] = homingAndBounds.ToJson();
-        json["filamentRunoutSensor"] = filamentRunoutSensor.ToJson();
-        json["bedLeveling"] = bedLeveling.ToJson();
-        json["homingOptions"] = homingOptions.ToJson();
-        json["userInterfaceLanguage"] = userInterfaceLanguage.ToJson();
-        json["sdCard"] = sdCard.ToJson();
-        json["lcdMenuItems"] = lcdMenuItems.ToJson();
-        json["encoder"] = encoder.ToJson();
-        json["speaker"] = speaker.ToJson();
+    /// \brief Computes the 128-bit fingerprint of the configuration
+    ///
+    /// Equal configurations have equal fingerprints, independent of how they were loaded or stored.
+    ///
+    /// \return the fingerprint, combined from the page digests
+    QByteArray Fingerprint(void) const
+    {
+        return Fingerprint(ToJson());
+    }
+
+    /// \brief Computes the fingerprint of a configuration stored as JSON
+    ///
+    /// \param pJson: A complete configuration as returned by ToJson
+    /// \return the fingerprint, combined from the page digests
+    static QByteArray Fingerprint(const QJsonObject& pJson)
+    {
+        return Fingerprint(PageDigests(pJson));
+    }
+
+    /// \brief Computes the digest of each page of a configuration stored as JSON
+    ///
+    /// \param pJson: A complete configuration as returned by ToJson
+    /// \return Maps the page keys to their digests
+    static QMap<QString, QByteArray> PageDigests(const QJsonObject& pJson)
+    {
+        QMap<QString, QByteArray> digests;
+        for (auto page = pJson.constBegin(); page != pJson.constEnd(); ++page)
+        {
+            digests.insert(page.key(), PageConfiguration::Digest(page.value().toObject()));
+        }
+
+        return digests;
+    }
+
+    /// \brief Combines page digests into a configuration fingerprint
+    ///
+    /// Callers holding the digests of unchanged pages only need to hash the changed pages.
+    ///
+    /// \param pPageDigests: Maps the keys of all pages to their digests
+    /// \return the fingerprint
+    static QByteArray Fingerprint(const QMap<QString, QByteArray>& pPageDigests)
+    {
+        QCryptographicHash hash(QCryptographicHash::Md5);
+        hash.addData(QByteArray("iMC configuration ") + QByteArray::number(CONFIGURATION_SCHEMA_VERSION));
+
+        for (auto digest = pPageDigests.constBegin(); digest != pPageDigests.constEnd(); ++digest)
+        {
+            hash.addData(digest.key().toUtf8() + '\0');
+            hash.addData(digest.value());
+        }
+
+        return hash.result();
+    }
+
+    /// \brief Returns the default configuration as JSON, built once and shared by all callers
+    ///
+    /// \return a complete JSON object as returned by ToJson
+    static const QJsonObject& DefaultJson(void)
+    {
+        static const QJsonObject defaults = Configuration().ToJson();
+        return defaults;
+    }
+
+    /// \brief Converts the configuration into a JSON object containing only the fields that differ from the defaults
+    ///
+    /// \return a sparse JSON object with schema version
+    QJsonObject ToSparseJson(void) const
+    {
+        return ToSparseJson(ToJson());
+    }
+
+    /// \brief Removes the fields that equal the defaults from a complete configuration
+    ///
+    /// \param pJson: A complete configuration as returned by ToJson
+    /// \return a sparse JSON object with schema version
+    static QJsonObject ToSparseJson(const QJsonObject& pJson)
+    {
+        const auto& defaults = DefaultJson();
+
+        QJsonObject json;
+        json[CONFIGURATION_SCHEMA_VERSION_KEY] = CONFIGURATION_SCHEMA_VERSION;
+        json[CONFIGURATION_SPARSE_KEY] = true;
+
+        for (auto page = pJson.constBegin(); page != pJson.constEnd(); ++page)
+        {
+            const auto fields = page.value().toObject();
+            const auto defaultFields = defaults[page.key()].toObject();
+
+            QJsonObject changedFields;
+            for (auto field = fields.constBegin(); field != fields.constEnd(); ++field)
+            {
+                if (defaultFields.value(field.key()) != field.value())
+                {
+                    changedFields[field.key()] = field.value();
+                }
+            }
+
+            if (!changedFields.isEmpty())
+            {
+                json[page.key()] = changedFields;
+            }
+        }
+
+        return json;
+    }
+
+    /// \brief Checks whether a JSON object is a sparse configuration
+    ///
+    /// \param pJson: The configuration
+    /// \return \b true, if fields missing in the JSON object take their default values
+    static bool IsSparseJson(const QJsonObject& pJson)
+    {
+        return pJson.value(CONFIGURATION_SPARSE_KEY).toBool();
+    }
+
+    /// \brief Completes a sparse configuration with the defaults of all missing fields
+    ///
+    /// \param pJson: The sparse configuration
+    /// \return a complete JSON object as returned by ToJson
+    static QJsonObject ExpandSparseJson(const QJsonObject& pJson)
+    {
+        const auto& defaults = DefaultJson();
+
+        QJsonObject json;
+        for (auto page = defaults.constBegin(); page != defaults.constEnd(); ++page)
+        {
+            auto fields = page.value().toObject();
+            const auto changedFields = pJson.value(page.key()).toObject();
+
+            for (auto field = changedFields.constBegin(); field != changedFields.constEnd(); ++field)
+            {
+                fields[field.key()] = field.value();
+            }
+
+            json[page.key()] = fields;
+        }
 
         return json;
     }
+
+    /// \brief Converts a complete or sparse configuration, fields missing in the JSON keep their defaults
+    ///
+    /// \param pJson: The configuration
+    /// \return the configuration or std::nullopt if a value has the wrong type
+    static std::optional<Configuration> FromJson(const QJsonObject& pJson)
+    {
+        Configuration configuration;
+        bool matches = true;
+
+        configuration.ForEachPage([&pJson, &matches](const char *pPage, auto& pFields)
+        {
+            const auto fields = pJson.value(pPage).toObject();
+            pFields.ForEachField([&fields, &matches](const char *pField, auto& pValue)
+            {
+                const auto value = fields.value(pField);
+                if (!value.isUndefined())
+                {
+                    matches &= AssignJsonValue(pValue, value);
+                }
+            });
+        });
+
+        if (!matches)
+        {
+            return std::nullopt;
+        }
+        return configuration;
+    }
+
+    /// \brief Assigns a JSON value to a field
+    ///
+    /// \param pField: The field
+    /// \param pValue: The value
+    /// \return \b true, if the value has the type of the field
+    template <typename T>
+    static bool AssignJsonValue(T& pField, const QJsonValue& pValue)
+    {
+        if constexpr (std::is_same_v<T, QString>)
+        {
+            pField = pValue.toString();
+            return pValue.isString();
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            pField = pValue.toBool();
+            return pValue.isBool();
+        }
+        else if constexpr (std::is_same_v<T, int32_t>)
+        {
+            pField = pValue.toInt();
+            return pValue.isDouble();
+        }
+        else
+        {
+            static_assert(std::is_same_v<T, double>);
+            pField = pValue.toDouble();
+            return pValue.isDouble();
+        }
+    }
+
+    /// \brief Checks a complete or partial configuration against the known pages and fields
+    ///
+    /// Values that are not objects on the top level, e.g. the schema version, are not checked.
+    ///
+    /// \param pJson: The configuration
+    /// \return a description of each unknown page, unknown field and value of the wrong type
+    static QStringList Validate(const QJsonObject& pJson)
+    {
+        QStringList problems;
+
+        const auto version = pJson.value(CONFIGURATION_SCHEMA_VERSION_KEY).toInt();
+        if (version > CONFIGURATION_SCHEMA_VERSION)
+        {
+            problems.append(QString("Schema version %0 is newer than %1").arg(version).arg(CONFIGURATION_SCHEMA_VERSION));
+        }
+
+        const auto& defaults = DefaultJson();
+        for (auto page = pJson.constBegin(); page != pJson.constEnd(); ++page)
+        {
+            if (!page.value().isObject())
+            {
+                continue;
+            }
+
+            if (!defaults.value(page.key()).isObject())
+            {
+                problems.append(QString("Unknown page %0").arg(page.key()));
+                continue;
+            }
+
+            const auto defaultFields = defaults.value(page.key()).toObject();
+            const auto fields = page.value().toObject();
+            for (auto field = fields.constBegin(); field != fields.constEnd(); ++field)
+            {
+                const auto defaultValue = defaultFields.value(field.key());
+                if (defaultValue.isUndefined())
+                {
+                    problems.append(QString("Unknown field %0/%1").arg(page.key(), field.key()));
+                }
+                else if (defaultValue.type() != field.value().type())
+                {
+                    problems.append(QString("Field %0/%1 has the wrong type").arg(page.key(), field.key()));
+                }
+            }
+        }
+
+        return problems;
+    }
+
+protected:
+    template <typename Self, typename F, size_t... I>
+    static void VisitPages(Self& pSelf, F& pFunction, std::index_sequence<I...>)
+    {
+        (pFunction(PAGE_KEYS.at(I), pSelf.*std::get<I>(PAGE_MEMBERS)), ...);
+    }
 };
 
 #endif // CONFIGURATION_H
@@ -0,0 +1,267 @@
+/*!
+ * \file ConfigurationSnapshot.h
+ * \brief The ConfigurationSnapshot class is an immutable configuration with pages shared between snapshots
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CONFIGURATIONSNAPSHOT_H
+#define CONFIGURATIONSNAPSHOT_H
+
+#include "Configuration.h"
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QMap>
+#include <QString>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+///
+/// \brief The ConfigurationSnapshot class is an immutable configuration with pages shared between snapshots
+///
+/// Each page is held as a shared, immutable node together with its JSON representation and
+/// digest. Copying a snapshot only copies pointers, and deriving a snapshot with one changed page
+/// allocates and hashes only that page, all others stay shared. Snapshots can be passed to other
+/// threads without locking. Whether two snapshots share a page tells that the page is unchanged
+/// without comparing its fields.
+///
+class ConfigurationSnapshot
+{
+public:
+    /// \brief Number of configuration pages
+    static constexpr size_t PAGE_COUNT{Configuration::PAGE_COUNT};
+
+    /// \brief The page keys as used in configuration.json, in page order
+    static constexpr std::array<const char*, PAGE_COUNT> PAGE_KEYS{Configuration::PAGE_KEYS};
+
+    /// \brief Creates a snapshot of the default configuration; all default snapshots share their pages
+    ConfigurationSnapshot(void)
+        : mPages(Defaults())
+    {
+    }
+
+    /// \brief Creates a snapshot of a configuration
+    ///
+    /// \param pConfiguration: The configuration to copy
+    explicit ConfigurationSnapshot(const Configuration& pConfiguration)
+        : mPages(MakePages(pConfiguration, std::make_index_sequence<PAGE_COUNT>()))
+    {
+    }
+
+    /// \brief Returns the index of a page
+    ///
+    /// \param pKey: The page key, e.g. "hardware"
+    /// \return The page index or std::nullopt if the key is unknown
+    static std::optional<size_t> PageIndex(const QString& pKey)
+    {
+        for (size_t i = 0; i < PAGE_COUNT; ++i)
+        {
+            if (pKey == PAGE_KEYS.at(i))
+            {
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// \brief Returns a page configuration
+    ///
+    /// \return The page, e.g. Page<HardwareConfiguration>()
+    template <typename T>
+    const T& Page(void) const
+    {
+        return std::get<NodePointer<T>>(mPages)->configuration;
+    }
+
+    /// \brief Returns the JSON representation of a page
+    ///
+    /// \param pIndex: The page index
+    /// \return The page as in configuration.json
+    QJsonObject PageJson(size_t pIndex) const
+    {
+        QJsonObject json;
+        ForPage(pIndex, [&](auto pPage)
+        {
+            json = std::get<decltype(pPage)::value>(mPages)->json;
+        });
+        return json;
+    }
+
+    /// \brief Returns the digest of a page, computed once when the page was taken
+    ///
+    /// \param pIndex: The page index
+    /// \return The 128-bit page digest
+    QByteArray PageDigest(size_t pIndex) const
+    {
+        QByteArray digest;
+        ForPage(pIndex, [&](auto pPage)
+        {
+            digest = std::get<decltype(pPage)::value>(mPages)->digest;
+        });
+        return digest;
+    }
+
+    /// \brief Computes the fingerprint of the snapshot from the page digests
+    ///
+    /// \return The 128-bit fingerprint, equal to Configuration::Fingerprint
+    QByteArray Fingerprint(void) const
+    {
+        QMap<QString, QByteArray> digests;
+        for (size_t i = 0; i < PAGE_COUNT; ++i)
+        {
+            digests.insert(PAGE_KEYS.at(i), PageDigest(i));
+        }
+        return Configuration::Fingerprint(digests);
+    }
+
+    /// \brief Returns whether a page is shared with another snapshot and therefore unchanged
+    ///
+    /// \param pIndex: The page index
+    /// \param pOther: The other snapshot
+    /// \return \b true, if both snapshots hold the same page node
+    bool SharesPage(size_t pIndex, const ConfigurationSnapshot& pOther) const
+    {
+        bool shared = false;
+        ForPage(pIndex, [&](auto pPage)
+        {
+            shared = (std::get<decltype(pPage)::value>(mPages) == std::get<decltype(pPage)::value>(pOther.mPages));
+        });
+        return shared;
+    }
+
+    /// \brief Derives a snapshot with one page taken from a configuration
+    ///
+    /// \param pIndex: The page index
+    /// \param pSource: The configuration to copy the page from
+    /// \return The new snapshot, sharing all other pages with this one
+    ConfigurationSnapshot WithPage(size_t pIndex, const Configuration& pSource) const
+    {
+        ConfigurationSnapshot snapshot(*this);
+        ForPage(pIndex, [&](auto pPage)
+        {
+            std::get<decltype(pPage)::value>(snapshot.mPages) = MakeNode(pSource.*std::get<decltype(pPage)::value>(MEMBERS));
+        });
+        return snapshot;
+    }
+
+    /// \brief Copies the snapshot into a mutable configuration
+    ///
+    /// \return The configuration
+    Configuration ToConfiguration(void) const
+    {
+        Configuration configuration;
+        CopyPages(configuration, std::make_index_sequence<PAGE_COUNT>());
+        return configuration;
+    }
+
+    /// \brief Converts the snapshot into a JSON object without converting any page
+    ///
+    /// \return a JSON object as returned by Configuration::ToJson
+    QJsonObject ToJson(void) const
+    {
+        QJsonObject json;
+        for (size_t i = 0; i < PAGE_COUNT; ++i)
+        {
+            json[PAGE_KEYS.at(i)] = PageJson(i);
+        }
+        return json;
+    }
+
+protected:
+    /// \brief An immutable page with its JSON representation and digest
+    template <typename T>
+    struct PageNode
+    {
+        T configuration;
+        QJsonObject json;
+        QByteArray digest;
+    };
+
+    template <typename T>
+    using NodePointer = std::shared_ptr<const PageNode<T>>;
+
+    /// \brief The members of Configuration, in page order
+    static constexpr auto MEMBERS = Configuration::PAGE_MEMBERS;
+
+    template <typename Members>
+    struct NodesOf;
+
+    template <typename... T>
+    struct NodesOf<std::tuple<T Configuration::*...>>
+    {
+        using Type = std::tuple<NodePointer<T>...>;
+    };
+
+    using Pages = NodesOf<std::remove_const_t<decltype(MEMBERS)>>::Type;
+
+    static_assert(std::tuple_size_v<Pages> == PAGE_COUNT && std::tuple_size_v<decltype(MEMBERS)> == PAGE_COUNT);
+
+    template <typename T>
+    static NodePointer<T> MakeNode(const T& pPage)
+    {
+        const auto json = pPage.ToJson();
+        return std::make_shared<const PageNode<T>>(PageNode<T>{pPage, json, PageConfiguration::Digest(json)});
+    }
+
+    template <size_t... I>
+    static Pages MakePages(const Configuration& pConfiguration, std::index_sequence<I...>)
+    {
+        return Pages(MakeNode(pConfiguration.*std::get<I>(MEMBERS))...);
+    }
+
+    template <size_t... I>
+    void CopyPages(Configuration& pConfiguration, std::index_sequence<I...>) const
+    {
+        ((pConfiguration.*std::get<I>(MEMBERS) = std::get<I>(mPages)->configuration), ...);
+    }
+
+    static const Pages& Defaults(void)
+    {
+        static const Pages defaults = MakePages(Configuration(), std::make_index_sequence<PAGE_COUNT>());
+        return defaults;
+    }
+
+    /// \brief Calls a function with the page index as compile-time constant
+    ///
+    /// \param pIndex: The page index
+    /// \param pFunction: Called with std::integral_constant<size_t, pIndex>
+    template <typename F>
+    static void ForPage(size_t pIndex, F&& pFunction)
+    {
+        ForPage(pIndex, pFunction, std::make_index_sequence<PAGE_COUNT>());
+    }
+
+    template <typename F, size_t... I>
+    static void ForPage(size_t pIndex, F& pFunction, std::index_sequence<I...>)
+    {
+        ((I == pIndex ? pFunction(std::integral_constant<size_t, I>()) : void()), ...);
+    }
+
+    Pages mPages;
+};
+
+#endif // CONFIGURATIONSNAPSHOT_H
@@ -89,114 +89,108 @@ inline std::optional<QStringList> ReadTemplateFromFile(const QFileInfo& pFileInf
     return stringList;
 }
 
-/// \brief Sets the given line edit to the text given in the JSON object
+/// \brief Estimates the memory held by the characters of a text
 ///
-/// \param pWidget: Pointer to the line edit
-/// \param pJson: Reference to the JSON object containing the attribute
-/// \param pAttribute: The name of the JSON attribute
-/// \return \b true, if the JSON contains the parameter of type string
-inline bool LoadConfig(QLineEdit* pWidget, const QJsonObject &pJson, const QString& pAttribute)
+/// \param pLines: The lines of the text
+/// \return The size of the characters in bytes
+inline qint64 TextBytes(const QStringList& pLines)
 {
-    if (pJson.contains(pAttribute) && pJson[pAttribute].isString())
+    qint64 bytes = 0;
+    for (const auto& line : pLines)
     {
-        pWidget->setText(pJson[pAttribute].toString());
-        return true;
+        bytes += line.size() * static_cast<qint64>(sizeof(QChar));
     }
-    return false;
+    return bytes;
+}
+
+/// \brief Sets the given line edit to the given text
+///
+/// \param pWidget: Pointer to the line edit
+/// \param pValue: The text
+/// \return \b true
+inline bool LoadConfig(QLineEdit* pWidget, const QString& pValue)
+{
+    pWidget->setText(pValue);
+    return true;
 }
 
 /// \brief Sets the given dropdown menu to the item that contains the given parameter
 ///
 /// \param pWidget: Pointer to the dropdown menu
-/// \param pJson: Reference to the JSON object containing the attribute
-/// \param pAttribute: The name of the JSON attribute
+/// \param pValue: The parameter
 /// \param pMatchItemInBrackets: If true, the widget is set to the item that contains the parameter in square brackets
-/// \return \b true, if the JSON contains the parameter of type string and the widget contains a valid item
-inline bool LoadConfig(Dropdown* pWidget, const QJsonObject &pJson, const QString& pAttribute, bool pMatchItemInBrackets = false)
+/// \return \b true, if the widget contains a valid item
+inline bool LoadConfig(Dropdown* pWidget, const QString& pValue, bool pMatchItemInBrackets = false)
 {
-    if (pJson.contains(pAttribute) && pJson[pAttribute].isString())
+    if (pMatchItemInBrackets)
     {
-        if (pMatchItemInBrackets)
+        const auto&& index = pWidget->findText(QString("[%0]").arg(pValue), Qt::MatchContains);
+        if (index >= 0)
         {
-            const auto&& index = pWidget->findText(QString("[%0]").arg(pJson[pAttribute].toString()), Qt::MatchContains);
-            if (index >= 0)
-            {
-                pWidget->setCurrentIndex(index);
-                return true;
-            }
+            pWidget->setCurrentIndex(index);
+            return true;
         }
-        else
+        return false;
+    }
+
+    // Imported configurations only know the flag name, e.g. "[BOARD_RAMPS_14_EFB]"
+    if (pValue.startsWith('[') && pWidget->findText(pValue) < 0)
+    {
+        const auto index = pWidget->findText(pValue, Qt::MatchContains);
+        if (index >= 0)
         {
-            pWidget->setCurrentText(pJson[pAttribute].toString());
+            pWidget->setCurrentIndex(index);
             return true;
         }
     }
-    return false;
+
+    pWidget->setCurrentText(pValue);
+    return true;
 }
 
-/// \brief Sets the given widget (e.g. QSpinBox) to the value given in the JSON object
+/// \brief Sets the given widget (e.g. QSpinBox) to the given value
 ///
 /// \param pWidget: Reference to the widget
-/// \param pJson: Reference to the JSON object containing the attribute
-/// \param pAttribute: The name of the JSON attribute
-/// \return \b true, if the JSON contains the parameter of type double
+/// \param pValue: The value
+/// \return \b true
 template <typename T>
-inline bool LoadConfig(T& pWidget, const QJsonObject &pJson, const QString& pAttribute)
+inline bool LoadConfig(T& pWidget, int32_t pValue)
 {
-    if (pJson.contains(pAttribute) && pJson[pAttribute].isDouble())
-    {
-        pWidget->setValue(pJson[pAttribute].toInt());
-        return true;
-    }
-    return false;
+    pWidget->setValue(pValue);
+    return true;
 }
 
-/// \brief Sets the given QDoubleSpinBox to the value given in the JSON object
+/// \brief Sets the given QDoubleSpinBox to the given value
 ///
 /// \param pWidget: Reference to the QDoubleSpinBox widget
-/// \param pJson: Reference to the JSON object containing the attribute
-/// \param pAttribute: The name of the JSON attribute
-/// \return \b true, if the JSON contains the parameter of type double
-inline bool LoadConfig(QDoubleSpinBox* pWidget, const QJsonObject &pJson, const QString& pAttribute)
+/// \param pValue: The value
+/// \return \b true
+inline bool LoadConfig(QDoubleSpinBox* pWidget, double pValue)
 {
-    if (pJson.contains(pAttribute) && pJson[pAttribute].isDouble())
-    {
-        pWidget->setValue(pJson[pAttribute].toDouble());
-        return true;
-    }
-    return false;
+    pWidget->setValue(pValue);
+    return true;
 }
 
-/// \brief Sets the given checkbox to the value given in the JSON object
+/// \brief Sets the given checkbox to the given value
 ///
 /// \param pWidget: Pointer to the widget
-/// \param pJson: Reference to the JSON object containing the attribute
-/// \param pAttribute: The name of the JSON attribute
-/// \return \b true, if the JSON contains the parameter of type bool
-inline bool LoadConfig(QCheckBox* pWidget, const QJsonObject &pJson, const QString& pAttribute)
+/// \param pValue: The check state
+/// \return \b true
+inline bool LoadConfig(QCheckBox* pWidget, bool pValue)
 {
-    if (pJson.contains(pAttribute) && pJson[pAttribute].isBool())
-    {
-        pWidget->setChecked(pJson[pAttribute].toBool());
-        return true;
-    }
-    return false;
+    pWidget->setChecked(pValue);
+    return true;
 }
 
-/// \brief Sets the given group box to the check value given in the JSON object
+/// \brief Sets the given group box to the given check value
 ///
 /// \param pWidget: Pointer to the widget
-/// \param pJson: Reference to the JSON object containing the attribute
-/// \param pAttribute: The name of the JSON attribute
-/// \return \b true, if the JSON contains the parameter of type bool
-inline bool LoadConfig(QGroupBox* pWidget, const QJsonObject &pJson, const QString& pAttribute)
+/// \param pValue: The check state
+/// \return \b true
+inline bool LoadConfig(QGroupBox* pWidget, bool pValue)
 {
-    if (pJson.contains(pAttribute) && pJson[pAttribute].isBool())
-    {
-        pWidget->setChecked(pJson[pAttribute].toBool());
-        return true;
-    }
-    return false;
+    pWidget->setChecked(pValue);
+    return true;
 }
 
 /// \brief Sets the given string to the line edit's text
@@ -0,0 +1,407 @@
+/*!
+ * \file Trace.h
+ * \brief The Trace class records timed spans of the session
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QString>
+#include <QStringList>
+#include <QThread>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+///
+/// \brief The Trace class records timed spans of the session
+///
+/// Spans are recorded by TraceSpan objects into a buffer per thread, so recording threads do not
+/// contend. While tracing is disabled, a span costs one relaxed atomic load. The recorded spans
+/// are exported in the Chrome trace event format, which chrome://tracing and Perfetto open.
+///
+/// Independent of recording, the spans currently open on each thread can be tracked, so another
+/// thread can tell what a blocked thread is doing.
+///
+class Trace
+{
+public:
+    /// \brief Flag set while spans are recorded
+    static constexpr uint32_t RECORD{1};
+
+    /// \brief Flag set while the open spans of each thread are tracked
+    static constexpr uint32_t TRACK{2};
+
+    /// \brief Returns whether spans are recorded
+    ///
+    /// \return \b true, if tracing is enabled
+    static bool IsEnabled(void)
+    {
+        return (Flags() & RECORD) != 0;
+    }
+
+    /// \brief Starts or stops recording, recorded spans are kept
+    ///
+    /// \param pEnabled: \b true, if spans should be recorded
+    static void SetEnabled(bool pEnabled)
+    {
+        SetFlag(RECORD, pEnabled);
+    }
+
+    /// \brief Starts or stops tracking the open spans of each thread
+    ///
+    /// Spans opened while tracking was disabled are not reported.
+    ///
+    /// \param pTracked: \b true, if the open spans should be tracked
+    static void SetActiveSpansTracked(bool pTracked)
+    {
+        SetFlag(TRACK, pTracked);
+    }
+
+    /// \brief Returns the RECORD and TRACK flags
+    ///
+    /// \return The currently set flags
+    static uint32_t Flags(void)
+    {
+        return State().load(std::memory_order_relaxed);
+    }
+
+    /// \brief Marks a span as opened on the calling thread
+    ///
+    /// \param pName: The name of the span, must be a string literal
+    static void Enter(const char *pName)
+    {
+        auto& buffer = LocalBuffer();
+
+        const auto depth = buffer.depth.load(std::memory_order_relaxed);
+        if (depth < static_cast<int32_t>(MAX_ACTIVE_DEPTH))
+        {
+            buffer.active.at(static_cast<size_t>(depth)).store(pName, std::memory_order_release);
+        }
+        buffer.depth.store(depth + 1, std::memory_order_release);
+    }
+
+    /// \brief Marks the innermost span of the calling thread as closed
+    static void Leave(void)
+    {
+        auto& buffer = LocalBuffer();
+        buffer.depth.store(buffer.depth.load(std::memory_order_relaxed) - 1, std::memory_order_release);
+    }
+
+    /// \brief Returns the spans currently open on the GUI thread
+    ///
+    /// May be called from any thread. The result is a snapshot and may be outdated once returned.
+    ///
+    /// \return The names of the open spans, outermost first
+    static QStringList ActiveGuiSpans(void)
+    {
+        QStringList spans;
+
+        std::lock_guard<std::mutex> lock(BuffersMutex());
+        for (const auto& buffer : Buffers())
+        {
+            if (buffer->threadName != "GUI")
+            {
+                continue;
+            }
+
+            const auto depth = std::min(buffer->depth.load(std::memory_order_acquire), static_cast<int32_t>(MAX_ACTIVE_DEPTH));
+            for (int32_t i = 0; i < depth; ++i)
+            {
+                spans.append(buffer->active.at(static_cast<size_t>(i)).load(std::memory_order_acquire));
+            }
+        }
+
+        return spans;
+    }
+
+    /// \brief Returns the current time on the trace clock
+    ///
+    /// \return Nanoseconds since the start of the session
+    static int64_t Now(void)
+    {
+        static const auto epoch = std::chrono::steady_clock::now();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+    }
+
+    /// \brief Records a finished span on the calling thread
+    ///
+    /// \param pName: The name of the span, must be a string literal
+    /// \param pDetail: Additional information shown with the span, may be empty
+    /// \param pStart: Start time on the trace clock
+    /// \param pEnd: End time on the trace clock
+    static void Record(const char *pName, const QString& pDetail, int64_t pStart, int64_t pEnd)
+    {
+        auto& buffer = LocalBuffer();
+
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        if (buffer.events.size() >= MAX_EVENTS_PER_THREAD)
+        {
+            ++buffer.dropped;
+            return;
+        }
+        buffer.events.push_back(Event{pName, pDetail, pStart, pEnd - pStart});
+    }
+
+    /// \brief Discards all recorded spans
+    static void Clear(void)
+    {
+        std::lock_guard<std::mutex> lock(BuffersMutex());
+        for (const auto& buffer : Buffers())
+        {
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            buffer->events.clear();
+            buffer->dropped = 0;
+        }
+    }
+
+    /// \brief Returns the number of recorded spans
+    ///
+    /// \return The number of spans of all threads
+    static size_t EventCount(void)
+    {
+        size_t count = 0;
+
+        std::lock_guard<std::mutex> lock(BuffersMutex());
+        for (const auto& buffer : Buffers())
+        {
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            count += buffer->events.size();
+        }
+
+        return count;
+    }
+
+    /// \brief Writes the recorded spans as a Chrome trace event file
+    ///
+    /// \param pPath: Path of the JSON file
+    /// \return \b true, if the file was written
+    static bool Export(const QString& pPath)
+    {
+        QFile file(pPath);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            return false;
+        }
+
+        // Events are written one by one, a long session does not build one huge JSON document
+        file.write("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+        bool first = true;
+        const auto writeEvent = [&file, &first](const QJsonObject& pEvent)
+        {
+            file.write(first ? "" : ",\n");
+            file.write(QJsonDocument(pEvent).toJson(QJsonDocument::Compact));
+            first = false;
+        };
+
+        const auto pid = static_cast<qint64>(QCoreApplication::applicationPid());
+
+        std::lock_guard<std::mutex> lock(BuffersMutex());
+        for (const auto& buffer : Buffers())
+        {
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+
+            writeEvent(QJsonObject{{"name", "thread_name"}, {"ph", "M"}, {"pid", pid}, {"tid", buffer->threadId},
+                                   {"args", QJsonObject{{"name", buffer->threadName}}}});
+
+            for (const auto& event : buffer->events)
+            {
+                QJsonObject json{{"name", event.name}, {"cat", "imc"}, {"ph", "X"}, {"pid", pid}, {"tid", buffer->threadId},
+                                 {"ts", static_cast<double>(event.start) / 1000.0}, {"dur", static_cast<double>(event.duration) / 1000.0}};
+                if (!event.detail.isEmpty())
+                {
+                    json["args"] = QJsonObject{{"detail", event.detail}};
+                }
+                writeEvent(json);
+            }
+
+            if (buffer->dropped > 0)
+            {
+                writeEvent(QJsonObject{{"name", QString("%0 spans dropped").arg(buffer->dropped)}, {"ph", "i"}, {"s", "t"},
+                                       {"pid", pid}, {"tid", buffer->threadId}, {"ts", static_cast<double>(Now()) / 1000.0}});
+            }
+        }
+
+        file.write("\n]}\n");
+        return file.error() == QFileDevice::NoError;
+    }
+
+protected:
+    /// \brief Limits the memory of a thread that records spans in a tight loop
+    static constexpr size_t MAX_EVENTS_PER_THREAD{500000};
+
+    /// \brief Number of nested open spans tracked per thread, deeper spans are counted only
+    static constexpr size_t MAX_ACTIVE_DEPTH{32};
+
+    /// \brief A finished span
+    struct Event
+    {
+        const char *name;
+        QString detail;
+        int64_t start;
+        int64_t duration;
+    };
+
+    /// \brief The spans recorded by one thread
+    struct ThreadBuffer
+    {
+        qint64 threadId;
+        QString threadName;
+        std::mutex mutex;
+        std::vector<Event> events;
+        qint64 dropped{0};
+
+        /// \brief The names of the open spans, read by other threads without locking
+        std::array<std::atomic<const char*>, MAX_ACTIVE_DEPTH> active{};
+        std::atomic<int32_t> depth{0};
+    };
+
+    static std::atomic<uint32_t>& State(void)
+    {
+        static std::atomic<uint32_t> state{0};
+        return state;
+    }
+
+    static void SetFlag(uint32_t pFlag, bool pSet)
+    {
+        if (pSet)
+        {
+            State().fetch_or(pFlag, std::memory_order_relaxed);
+        }
+        else
+        {
+            State().fetch_and(~pFlag, std::memory_order_relaxed);
+        }
+    }
+
+    static std::mutex& BuffersMutex(void)
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    /// \brief The buffers of all threads that recorded spans, kept after a thread ends
+    static std::vector<std::shared_ptr<ThreadBuffer>>& Buffers(void)
+    {
+        static std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        return buffers;
+    }
+
+    static ThreadBuffer& LocalBuffer(void)
+    {
+        thread_local const auto buffer = []()
+        {
+            auto newBuffer = std::make_shared<ThreadBuffer>();
+
+            std::lock_guard<std::mutex> lock(BuffersMutex());
+            newBuffer->threadId = static_cast<qint64>(Buffers().size()) + 1;
+
+            const auto* thread = QThread::currentThread();
+            if (nullptr != QCoreApplication::instance() && thread == QCoreApplication::instance()->thread())
+            {
+                newBuffer->threadName = "GUI";
+            }
+            else
+            {
+                newBuffer->threadName = thread->objectName().isEmpty() ? QString("Worker %0").arg(newBuffer->threadId) : thread->objectName();
+            }
+
+            Buffers().push_back(newBuffer);
+            return newBuffer;
+        }();
+
+        return *buffer;
+    }
+};
+
+///
+/// \brief The TraceSpan class records the lifetime of a scope as a span
+///
+/// Usage: const TraceSpan span("Application::OnGenerate");
+///
+class TraceSpan
+{
+public:
+    /// \brief Starts a span if tracing is enabled
+    ///
+    /// \param pName: The name of the span, must be a string literal
+    explicit TraceSpan(const char *pName) :
+        mFlags(Trace::Flags()),
+        mName(pName),
+        mStart((mFlags & Trace::RECORD) ? Trace::Now() : 0)
+    {
+        if (mFlags & Trace::TRACK)
+        {
+            Trace::Enter(mName);
+        }
+    }
+
+    /// \brief Starts a span with additional information if tracing is enabled
+    ///
+    /// \param pName: The name of the span, must be a string literal
+    /// \param pDetail: Additional information, e.g. a file or page name
+    TraceSpan(const char *pName, const QString& pDetail) :
+        TraceSpan(pName)
+    {
+        if (mFlags & Trace::RECORD)
+        {
+            mDetail = pDetail;
+        }
+    }
+
+    /// \brief Ends and records the span
+    ~TraceSpan(void)
+    {
+        if (mFlags & Trace::TRACK)
+        {
+            Trace::Leave();
+        }
+
+        if (mFlags & Trace::RECORD)
+        {
+            Trace::Record(mName, mDetail, mStart, Trace::Now());
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+private:
+    const uint32_t mFlags;
+    const char *mName;
+    int64_t mStart;
+    QString mDetail;
+};
+
+#endif // TRACE_H
@@ -0,0 +1,261 @@
+/*!
+ * \file ArtifactCache.cpp
+ * \brief The ArtifactCache class stores built firmware images by configuration fingerprint
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ArtifactCache.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QStandardPaths>
+
+#include <algorithm>
+
+namespace
+{
+static constexpr auto LAST_USED_FILE_NAME{"last_used"};
+static const QStringList FIRMWARE_NAME_FILTERS{"firmware*.*"};
+
+/// \brief Reads the commit hash the Marlin workspace is checked out at
+///
+/// \param pWorkspacePath: Path to the Marlin base folder
+/// \return The commit hash or an empty array if the workspace is not a git repository
+QByteArray ReadGitRevision(const QString& pWorkspacePath)
+{
+    QFile headFile(pWorkspacePath + "/.git/HEAD");
+    if (!headFile.open(QIODevice::ReadOnly))
+    {
+        return QByteArray();
+    }
+
+    const auto head = headFile.readAll().trimmed();
+    if (!head.startsWith("ref: "))
+    {
+        return head; // Detached HEAD contains the hash itself
+    }
+
+    const auto ref = head.mid(5);
+
+    QFile refFile(pWorkspacePath + "/.git/" + QString::fromUtf8(ref));
+    if (refFile.open(QIODevice::ReadOnly))
+    {
+        return refFile.readAll().trimmed();
+    }
+
+    QFile packedRefsFile(pWorkspacePath + "/.git/packed-refs");
+    if (packedRefsFile.open(QIODevice::ReadOnly))
+    {
+        while (!packedRefsFile.atEnd())
+        {
+            const auto line = packedRefsFile.readLine().trimmed();
+            if (line.endsWith(" " + ref))
+            {
+                return line.left(line.indexOf(' '));
+            }
+        }
+    }
+
+    return head;
+}
+
+/// \brief Marks a cache entry as recently used
+///
+/// \param pEntryPath: Path to the cache entry folder
+void TouchEntry(const QString& pEntryPath)
+{
+    QFile file(pEntryPath + "/" + LAST_USED_FILE_NAME);
+    if (file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        file.write(QByteArray::number(QDateTime::currentMSecsSinceEpoch()));
+    }
+}
+}
+
+ArtifactCache::ArtifactCache(const QString& pCacheDirectory) :
+    mCacheDirectory(pCacheDirectory)
+{
+    if (mCacheDirectory.isEmpty())
+    {
+        mCacheDirectory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/artifacts";
+    }
+}
+
+QString ArtifactCache::ComputeKey(const QString& pWorkspacePath, const QString& pEnvironment)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(QByteArrayLiteral("imc-artifact-v1"));
+    hash.addData(pEnvironment.toUtf8());
+
+    // Generated configuration and build definitions
+    QStringList inputFiles{"Marlin/Configuration.h", "Marlin/Configuration_adv.h", "Marlin/_Bootscreen.h", "Marlin/_Statusscreen.h", "platformio.ini"};
+    for (const auto& iniFile : QDir(pWorkspacePath + "/ini").entryList(QStringList{"*.ini"}, QDir::Files, QDir::Name))
+    {
+        inputFiles.append("ini/" + iniFile);
+    }
+
+    for (const auto& relativePath : inputFiles)
+    {
+        hash.addData(relativePath.toUtf8());
+
+        QFile file(pWorkspacePath + "/" + relativePath);
+        if (!file.exists())
+        {
+            hash.addData(QByteArrayLiteral("-"));
+            continue;
+        }
+
+        if (!file.open(QIODevice::ReadOnly) || !hash.addData(&file))
+        {
+            return QString();
+        }
+    }
+
+    // Marlin source tree: checked out revision plus size and modification time of
+    // every source file, so that local changes invalidate cached firmware as well
+    hash.addData(ReadGitRevision(pWorkspacePath));
+
+    const QDir sourceDir(pWorkspacePath + "/Marlin/src");
+    if (!sourceDir.exists())
+    {
+        return QString();
+    }
+
+    QStringList sourceEntries;
+    QDirIterator iterator(sourceDir.path(), QDir::Files, QDirIterator::Subdirectories);
+    while (iterator.hasNext())
+    {
+        iterator.next();
+        const auto& info = iterator.fileInfo();
+        sourceEntries.append(QString("%0:%1:%2").arg(sourceDir.relativeFilePath(info.filePath()))
+                                                .arg(info.size())
+                                                .arg(info.lastModified().toMSecsSinceEpoch()));
+    }
+    sourceEntries.sort();
+
+    hash.addData(sourceEntries.join('\n').toUtf8());
+
+    return QString::fromLatin1(hash.result().toHex());
+}
+
+bool ArtifactCache::Contains(const QString& pKey) const
+{
+    return !pKey.isEmpty() && !QDir(mCacheDirectory + "/" + pKey).entryList(FIRMWARE_NAME_FILTERS, QDir::Files).isEmpty();
+}
+
+bool ArtifactCache::Store(const QString& pKey, const QString& pWorkspacePath, const QString& pEnvironment)
+{
+    if (pKey.isEmpty())
+    {
+        return false;
+    }
+
+    const auto files = QDir(BuildDirectory(pWorkspacePath, pEnvironment)).entryInfoList(FIRMWARE_NAME_FILTERS, QDir::Files);
+    if (files.isEmpty())
+    {
+        return false;
+    }
+
+    const auto entryPath = mCacheDirectory + "/" + pKey;
+    QDir(entryPath).removeRecursively();
+
+    if (!QDir().mkpath(entryPath))
+    {
+        return false;
+    }
+
+    for (const auto& file : files)
+    {
+        if (!QFile::copy(file.filePath(), entryPath + "/" + file.fileName()))
+        {
+            QDir(entryPath).removeRecursively();
+            return false;
+        }
+    }
+
+    TouchEntry(entryPath);
+    Prune();
+
+    return true;
+}
+
+bool ArtifactCache::Restore(const QString& pKey, const QString& pWorkspacePath, const QString& pEnvironment)
+{
+    if (!Contains(pKey))
+    {
+        return false;
+    }
+
+    const auto entryPath = mCacheDirectory + "/" + pKey;
+    const auto buildPath = BuildDirectory(pWorkspacePath, pEnvironment);
+
+    if (!QDir().mkpath(buildPath))
+    {
+        return false;
+    }
+
+    for (const auto& file : QDir(entryPath).entryInfoList(FIRMWARE_NAME_FILTERS, QDir::Files))
+    {
+        const auto target = buildPath + "/" + file.fileName();
+        QFile::remove(target);
+        if (!QFile::copy(file.filePath(), target))
+        {
+            return false;
+        }
+    }
+
+    TouchEntry(entryPath);
+
+    return true;
+}
+
+void ArtifactCache::Clear()
+{
+    QDir(mCacheDirectory).removeRecursively();
+}
+
+void ArtifactCache::Prune()
+{
+    auto entries = QDir(mCacheDirectory).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot);
+    if (entries.size() <= mMaxEntries)
+    {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const QFileInfo& pA, const QFileInfo& pB)
+    {
+        return QFileInfo(pA.filePath() + "/" + LAST_USED_FILE_NAME).lastModified() > QFileInfo(pB.filePath() + "/" + LAST_USED_FILE_NAME).lastModified();
+    });
+
+    for (auto i = mMaxEntries; i < entries.size(); i++)
+    {
+        QDir(entries.at(i).filePath()).removeRecursively();
+    }
+}
+
+QString ArtifactCache::BuildDirectory(const QString& pWorkspacePath, const QString& pEnvironment)
+{
+    return QString("%0/.pio/build/%1").arg(pWorkspacePath, pEnvironment);
+}
@@ -0,0 +1,98 @@
+/*!
+ * \file ArtifactCache.h
+ * \brief The ArtifactCache class stores built firmware images by configuration fingerprint
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ARTIFACTCACHE_H
+#define ARTIFACTCACHE_H
+
+#include <QString>
+#include <QByteArray>
+
+#include <cstdint>
+
+///
+/// \brief The ArtifactCache class stores built firmware images by configuration fingerprint
+///
+/// Each cache entry is a folder named after the fingerprint of the build inputs
+/// (generated configuration headers, PlatformIO environment and Marlin source tree),
+/// containing the firmware files PlatformIO placed in .pio/build/<environment>.
+///
+class ArtifactCache
+{
+public:
+    /// \brief Constructor for ArtifactCache
+    ///
+    /// \param pCacheDirectory: Root folder of the cache, the user cache location is used if empty
+    explicit ArtifactCache(const QString& pCacheDirectory = QString());
+
+    /// \brief Computes the fingerprint of all inputs that determine the firmware image
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pEnvironment: The PlatformIO environment to build
+    /// \return The fingerprint as a hex string or an empty string if the inputs could not be read
+    static QString ComputeKey(const QString& pWorkspacePath, const QString& pEnvironment);
+
+    /// \brief Checks if firmware files for the given key are cached
+    ///
+    /// \param pKey: The input fingerprint
+    /// \return \b true, if an entry for the key exists
+    bool Contains(const QString& pKey) const;
+
+    /// \brief Copies the firmware files of a finished build into the cache
+    ///
+    /// \param pKey: The input fingerprint the build was started with
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pEnvironment: The PlatformIO environment that was built
+    /// \return \b true, if at least one firmware file was stored
+    bool Store(const QString& pKey, const QString& pWorkspacePath, const QString& pEnvironment);
+
+    /// \brief Copies cached firmware files back into the PlatformIO build folder
+    ///
+    /// \param pKey: The input fingerprint
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pEnvironment: The PlatformIO environment to restore
+    /// \return \b true, if the firmware files were restored
+    bool Restore(const QString& pKey, const QString& pWorkspacePath, const QString& pEnvironment);
+
+    /// \brief Removes all cache entries
+    void Clear(void);
+
+protected:
+    /// \brief Removes the least recently used entries until at most mMaxEntries remain
+    void Prune(void);
+
+    /// \brief Returns the PlatformIO build folder of the given environment
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pEnvironment: The PlatformIO environment
+    /// \return The build folder path
+    static QString BuildDirectory(const QString& pWorkspacePath, const QString& pEnvironment);
+
+protected:
+    QString mCacheDirectory;
+
+    int32_t mMaxEntries{32};
+};
+
+#endif // ARTIFACTCACHE_H
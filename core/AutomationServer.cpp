@@ -0,0 +1,284 @@
+/*!
+ * \file AutomationServer.cpp
+ * \brief The AutomationServer class serves configuration operations over a local socket
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "AutomationServer.h"
+#include "Trace.h"
+
+#include <QCoreApplication>
+#include <QJsonDocument>
+#include <QLocalSocket>
+#include <QThread>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace
+{
+static constexpr auto MIN_WORKERS{2u};
+static constexpr auto MAX_WORKERS{8u};
+static constexpr auto MAX_REQUEST_SIZE{16 * 1024 * 1024};
+}
+
+AutomationServer::AutomationServer(QObject *pParent) :
+    QObject(pParent)
+{
+    mServer.setSocketOptions(QLocalServer::UserAccessOption);
+
+    QObject::connect(&mServer, &QLocalServer::newConnection, this, &AutomationServer::OnNewConnection);
+}
+
+AutomationServer::~AutomationServer()
+{
+    Close();
+}
+
+void AutomationServer::SetHandler(const QString& pOperation, const Handler& pHandler)
+{
+    mHandlers.insert(pOperation, pHandler);
+}
+
+bool AutomationServer::Listen(const QString& pName)
+{
+    if (mServer.isListening())
+    {
+        return true;
+    }
+
+    // A socket left behind by a crashed instance would block the name on Unix
+    QLocalServer::removeServer(pName);
+    if (!mServer.listen(pName))
+    {
+        return false;
+    }
+
+    mStopping = false;
+
+    const auto workers = std::clamp(std::thread::hardware_concurrency(), MIN_WORKERS, MAX_WORKERS);
+    for (auto i = 0u; i < workers; ++i)
+    {
+        ++mRunningWorkers;
+        mWorkers.emplace_back([this](){ RunWorker(); });
+    }
+
+    return true;
+}
+
+void AutomationServer::Close()
+{
+    mServer.close();
+
+    for (auto* socket : std::as_const(mConnections))
+    {
+        socket->disconnect(this);
+        socket->abort();
+        socket->deleteLater();
+    }
+    mConnections.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+        mJobs.clear();
+    }
+    mCondition.notify_all();
+
+    // Workers may wait for RunOnMainThread, which needs the event loop of this thread
+    while (mRunningWorkers > 0)
+    {
+        QCoreApplication::processEvents();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    for (auto& worker : mWorkers)
+    {
+        worker.join();
+    }
+    mWorkers.clear();
+}
+
+bool AutomationServer::IsListening() const
+{
+    return mServer.isListening();
+}
+
+QString AutomationServer::FullServerName() const
+{
+    return mServer.fullServerName();
+}
+
+QString AutomationServer::ErrorString() const
+{
+    return mServer.errorString();
+}
+
+bool AutomationServer::RunOnMainThread(const std::function<void(void)>& pFunction)
+{
+    if (QThread::currentThread() == thread())
+    {
+        pFunction();
+        return true;
+    }
+
+    if (mStopping)
+    {
+        return false;
+    }
+
+    bool run = false;
+    QMetaObject::invokeMethod(this, [this, &pFunction, &run](){
+        if (!mStopping)
+        {
+            pFunction();
+            run = true;
+        }
+    }, Qt::BlockingQueuedConnection);
+
+    return run;
+}
+
+bool AutomationServer::IsStopping() const
+{
+    return mStopping;
+}
+
+QJsonObject AutomationServer::Error(const QString& pMessage)
+{
+    return QJsonObject{{"ok", false}, {"error", pMessage}};
+}
+
+void AutomationServer::OnNewConnection()
+{
+    while (mServer.hasPendingConnections())
+    {
+        auto* socket = mServer.nextPendingConnection();
+        const auto connection = mNextConnection++;
+        mConnections.insert(connection, socket);
+
+        QObject::connect(socket, &QLocalSocket::disconnected, this, [this, socket, connection](){
+            mConnections.remove(connection);
+            socket->deleteLater();
+        });
+
+        QObject::connect(socket, &QLocalSocket::readyRead, this, [this, socket, connection](){
+            while (socket->canReadLine())
+            {
+                const auto line = socket->readLine().trimmed();
+                if (line.isEmpty())
+                {
+                    continue;
+                }
+
+                QJsonParseError jsonError;
+                const auto document = QJsonDocument::fromJson(line, &jsonError);
+                if (jsonError.error != QJsonParseError::NoError || !document.isObject())
+                {
+                    WriteResponse(connection, Error(QString("Invalid request: %0").arg(jsonError.errorString())));
+                    continue;
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(mMutex);
+                    mJobs.push_back(Job{connection, document.object()});
+                }
+                mCondition.notify_one();
+            }
+
+            // A client that never ends its line is not buffered forever
+            if (socket->bytesAvailable() > MAX_REQUEST_SIZE)
+            {
+                WriteResponse(connection, Error("Request too large"));
+                socket->abort();
+            }
+        });
+    }
+}
+
+void AutomationServer::RunWorker()
+{
+    while (true)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCondition.wait(lock, [this](){ return mStopping || !mJobs.empty(); });
+            if (mStopping)
+            {
+                break;
+            }
+
+            job = std::move(mJobs.front());
+            mJobs.pop_front();
+        }
+
+        const auto response = Dispatch(job.request);
+        const auto connection = job.connection;
+
+        QMetaObject::invokeMethod(this, [this, connection, response](){ WriteResponse(connection, response); }, Qt::QueuedConnection);
+    }
+
+    --mRunningWorkers;
+}
+
+QJsonObject AutomationServer::Dispatch(const QJsonObject& pRequest) const
+{
+    const auto operation = pRequest.value("op").toString();
+    const TraceSpan span("AutomationServer::Dispatch", operation);
+
+    QJsonObject response;
+    if (!mHandlers.contains(operation))
+    {
+        QStringList operations = mHandlers.keys();
+        operations.sort();
+        response = Error(QString("Unknown operation \"%0\", expected one of %1").arg(operation, operations.join(", ")));
+    }
+    else
+    {
+        response = mHandlers.value(operation)(pRequest);
+    }
+
+    if (!response.contains("ok"))
+    {
+        response["ok"] = true;
+    }
+
+    if (pRequest.contains("id"))
+    {
+        response["id"] = pRequest.value("id");
+    }
+
+    return response;
+}
+
+void AutomationServer::WriteResponse(quint64 pConnection, const QJsonObject& pResponse)
+{
+    auto* socket = mConnections.value(pConnection, nullptr);
+    if (nullptr == socket)
+    {
+        return;
+    }
+
+    socket->write(QJsonDocument(pResponse).toJson(QJsonDocument::Compact) + '\n');
+}
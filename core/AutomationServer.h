@@ -0,0 +1,157 @@
+/*!
+ * \file AutomationServer.h
+ * \brief The AutomationServer class serves configuration operations over a local socket
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef AUTOMATIONSERVER_H
+#define AUTOMATIONSERVER_H
+
+#include <QHash>
+#include <QJsonObject>
+#include <QLocalServer>
+#include <QObject>
+#include <QString>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \brief Default name of the local socket
+static constexpr auto AUTOMATION_SERVER_NAME{"imc-automation"};
+
+///
+/// \brief The AutomationServer class serves configuration operations over a local socket
+///
+/// Clients send one JSON object per line, e.g. {"id": 1, "op": "fingerprint", "configuration": {...}},
+/// and receive one JSON object per line with the same "id", "ok" and either the result fields or
+/// "error". Requests are queued and handled by a fixed set of worker threads, so a slow request does
+/// not hold up the others. Handlers that need the GUI use RunOnMainThread.
+///
+class AutomationServer : public QObject
+{
+    Q_OBJECT
+public:
+    /// \brief Handles a request and returns the result fields
+    using Handler = std::function<QJsonObject(const QJsonObject& pRequest)>;
+
+    /// \brief Constructor for AutomationServer
+    ///
+    /// \param pParent: Reference to the parent object
+    explicit AutomationServer(QObject *pParent = nullptr);
+
+    /// \brief Destructor for AutomationServer, stops the workers
+    ~AutomationServer(void) override;
+
+    /// \brief Registers the handler of an operation, only valid before Listen
+    ///
+    /// \param pOperation: The value of "op" the handler serves
+    /// \param pHandler: The handler, called on a worker thread
+    void SetHandler(const QString& pOperation, const Handler& pHandler);
+
+    /// \brief Starts the workers and listens for clients
+    ///
+    /// \param pName: Name of the local socket
+    /// \return \b true, if the server is listening
+    bool Listen(const QString& pName = AUTOMATION_SERVER_NAME);
+
+    /// \brief Disconnects all clients and stops the workers after their current requests
+    void Close(void);
+
+    /// \brief Returns whether the server is listening
+    ///
+    /// \return \b true, if clients can connect
+    bool IsListening(void) const;
+
+    /// \brief Returns the full name of the local socket, e.g. a path on Unix
+    ///
+    /// \return The socket name
+    QString FullServerName(void) const;
+
+    /// \brief Returns the reason Listen failed
+    ///
+    /// \return The error message
+    QString ErrorString(void) const;
+
+    /// \brief Runs a function on the thread of the server and waits for it
+    ///
+    /// \param pFunction: The function
+    /// \return \b false, if the function was not run because the server is stopping
+    bool RunOnMainThread(const std::function<void(void)>& pFunction);
+
+    /// \brief Returns whether the server is stopping, long running handlers should give up
+    ///
+    /// \return \b true, if Close was called
+    bool IsStopping(void) const;
+
+    /// \brief Creates the result of a failed request
+    ///
+    /// \param pMessage: The reason
+    /// \return The result fields
+    static QJsonObject Error(const QString& pMessage);
+
+protected slots:
+    /// \brief Accepts pending clients
+    void OnNewConnection(void);
+
+protected:
+    /// \brief A request waiting for a worker
+    struct Job
+    {
+        quint64 connection;
+        QJsonObject request;
+    };
+
+    /// \brief Takes requests from the queue until the server stops
+    void RunWorker(void);
+
+    /// \brief Handles a request
+    ///
+    /// \param pRequest: The request
+    /// \return The response
+    QJsonObject Dispatch(const QJsonObject& pRequest) const;
+
+    /// \brief Sends a response to a client if it is still connected
+    ///
+    /// \param pConnection: The client
+    /// \param pResponse: The response
+    void WriteResponse(quint64 pConnection, const QJsonObject& pResponse);
+
+    QLocalServer mServer;
+    QHash<quint64, QLocalSocket*> mConnections;
+    quint64 mNextConnection{0};
+
+    QHash<QString, Handler> mHandlers;
+
+    std::vector<std::thread> mWorkers;
+    std::atomic<int32_t> mRunningWorkers{0};
+    std::deque<Job> mJobs;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    std::atomic<bool> mStopping{false};
+};
+
+#endif // AUTOMATIONSERVER_H
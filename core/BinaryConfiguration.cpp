@@ -0,0 +1,448 @@
+/*!
+ * \file BinaryConfiguration.cpp
+ * \brief The BinaryConfiguration class reads and writes the binary workspace configuration
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "BinaryConfiguration.h"
+
+#include <QFile>
+#include <QHash>
+#include <QPair>
+#include <QSaveFile>
+#include <QVector>
+
+#include <cmath>
+#include <functional>
+
+namespace
+{
+static constexpr quint32 FNV_OFFSET_BASIS{2166136261u};
+static constexpr quint32 FNV_PRIME{16777619u};
+static constexpr auto FORMAT_MARKER{"iMC"};
+static constexpr quint64 FORMAT_VERSION{1};
+
+/// \brief Keys of the top-level CBOR map
+enum Key : quint64
+{
+    MARKER = 0,
+    VERSION = 1,
+    SCHEMA_VERSION = 2,
+    FIELDS = 3
+};
+
+/// \brief Returns the page and field name of each field ID, built once from the default configuration
+///
+/// \return Maps the field IDs to page and field name
+const QHash<quint32, QPair<QString, QString>>& FieldsById()
+{
+    static const QHash<quint32, QPair<QString, QString>> fields = []()
+    {
+        QHash<quint32, QPair<QString, QString>> result;
+
+        const auto& defaults = Configuration::DefaultJson();
+        for (auto page = defaults.constBegin(); page != defaults.constEnd(); ++page)
+        {
+            const auto pageFields = page.value().toObject();
+            for (auto field = pageFields.constBegin(); field != pageFields.constEnd(); ++field)
+            {
+                const auto id = BinaryConfiguration::FieldId(page.key(), field.key());
+                Q_ASSERT(!result.contains(id));
+                result.insert(id, qMakePair(page.key(), field.key()));
+            }
+        }
+        return result;
+    }();
+
+    return fields;
+}
+
+/// \brief Reads a text string, which CBOR may split into chunks
+///
+/// \param pReader: The reader, positioned at a string
+/// \return The string or std::nullopt if the data is invalid
+std::optional<QString> ReadString(QCborStreamReader& pReader)
+{
+    QString text;
+    auto chunk = pReader.readString();
+    while (chunk.status == QCborStreamReader::Ok)
+    {
+        text += chunk.data;
+        chunk = pReader.readString();
+    }
+
+    if (chunk.status != QCborStreamReader::EndOfString)
+    {
+        return std::nullopt;
+    }
+    return text;
+}
+
+/// \brief Returns the position of each field ID in the order of Configuration::ForEachPage and ForEachField
+///
+/// \return Maps the field IDs to their position
+const QHash<quint32, int32_t>& FieldPositions()
+{
+    static const QHash<quint32, int32_t> positions = []()
+    {
+        QHash<quint32, int32_t> result;
+
+        Configuration configuration;
+        configuration.ForEachPage([&result](const char *pPage, auto& pFields)
+        {
+            pFields.ForEachField([&result, pPage](const char *pField, auto&)
+            {
+                result.insert(BinaryConfiguration::FieldId(pPage, pField), static_cast<int32_t>(result.size()));
+            });
+        });
+        return result;
+    }();
+
+    return positions;
+}
+
+/// \brief Walks a binary configuration and passes each field to a function
+///
+/// \param pData: Pointer to the CBOR data
+/// \param pSize: Size of the data in bytes
+/// \param pSchemaVersion: Set to the schema version of the data
+/// \param pField: Called with the ID and value of each field of a supported type
+/// \return \b true, if the data is valid
+bool DecodeFields(const char *pData, qint64 pSize, qint64& pSchemaVersion, const std::function<void(quint32, const QJsonValue&)>& pField)
+{
+    QCborStreamReader reader(pData, pSize);
+    if (!reader.isMap() || !reader.enterContainer())
+    {
+        return false;
+    }
+
+    bool hasMarker = false;
+
+    while (reader.lastError() == QCborError::NoError && reader.hasNext())
+    {
+        if (!reader.isUnsignedInteger())
+        {
+            return false;
+        }
+        const auto key = reader.toUnsignedInteger();
+        reader.next();
+
+        if (key == MARKER && reader.isString())
+        {
+            hasMarker = (ReadString(reader) == QString(FORMAT_MARKER));
+        }
+        else if (key == VERSION && reader.isUnsignedInteger())
+        {
+            if (reader.toUnsignedInteger() > FORMAT_VERSION)
+            {
+                return false;
+            }
+            reader.next();
+        }
+        else if (key == SCHEMA_VERSION && reader.isUnsignedInteger())
+        {
+            pSchemaVersion = static_cast<qint64>(reader.toUnsignedInteger());
+            reader.next();
+        }
+        else if (key == FIELDS && reader.isMap())
+        {
+            reader.enterContainer();
+            while (reader.lastError() == QCborError::NoError && reader.hasNext())
+            {
+                if (!reader.isUnsignedInteger())
+                {
+                    return false;
+                }
+                const auto id = static_cast<quint32>(reader.toUnsignedInteger());
+                reader.next();
+
+                const auto value = BinaryConfiguration::ReadValue(reader);
+                if (!value.has_value())
+                {
+                    return false;
+                }
+
+                if (!value.value().isUndefined())
+                {
+                    pField(id, value.value());
+                }
+            }
+            reader.leaveContainer();
+        }
+        else if (!reader.next())
+        {
+            return false;
+        }
+    }
+
+    return hasMarker && reader.lastError() == QCborError::NoError;
+}
+
+/// \brief Memory-maps a file and decodes it
+///
+/// \param pPath: Path of the file
+/// \param pDecode: The decoder
+/// \return The decoded file or std::nullopt if the file could not be read or decoded
+template <typename T>
+std::optional<T> DecodeFile(const QString& pPath, std::optional<T> (*pDecode)(const char*, qint64))
+{
+    QFile file(pPath);
+    if (!file.open(QIODevice::ReadOnly) || file.size() == 0)
+    {
+        return std::nullopt;
+    }
+
+    const auto data = file.map(0, file.size());
+    if (nullptr == data)
+    {
+        return std::nullopt;
+    }
+
+    const auto decoded = pDecode(reinterpret_cast<const char*>(data), file.size());
+    file.unmap(data);
+
+    return decoded;
+}
+}
+
+quint32 BinaryConfiguration::FieldId(const QString& pPage, const QString& pField)
+{
+    auto hash = FNV_OFFSET_BASIS;
+    for (const auto byte : (pPage + "/" + pField).toUtf8())
+    {
+        hash ^= static_cast<quint8>(byte);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+std::optional<QPair<QString, QString>> BinaryConfiguration::FieldName(quint32 pId)
+{
+    const auto& fieldsById = FieldsById();
+
+    const auto field = fieldsById.constFind(pId);
+    if (field == fieldsById.cend())
+    {
+        return std::nullopt;
+    }
+    return field.value();
+}
+
+void BinaryConfiguration::WriteValue(QCborStreamWriter& pWriter, const QJsonValue& pValue)
+{
+    if (pValue.isBool())
+    {
+        pWriter.append(pValue.toBool());
+    }
+    else if (pValue.isString())
+    {
+        pWriter.append(pValue.toString());
+    }
+    else if (const auto number = pValue.toDouble(); std::floor(number) == number && std::abs(number) < 1e15)
+    {
+        // Integers take one to nine bytes instead of nine for every double
+        pWriter.append(static_cast<qint64>(number));
+    }
+    else
+    {
+        pWriter.append(number);
+    }
+}
+
+std::optional<QJsonValue> BinaryConfiguration::ReadValue(QCborStreamReader& pReader)
+{
+    if (pReader.isBool())
+    {
+        const auto value = pReader.toBool();
+        pReader.next();
+        return QJsonValue(value);
+    }
+    if (pReader.isInteger())
+    {
+        const auto value = static_cast<qint64>(pReader.toInteger());
+        pReader.next();
+        return QJsonValue(value);
+    }
+    if (pReader.isDouble())
+    {
+        const auto value = pReader.toDouble();
+        pReader.next();
+        return QJsonValue(value);
+    }
+    if (pReader.isString())
+    {
+        const auto value = ReadString(pReader);
+        if (!value.has_value())
+        {
+            return std::nullopt;
+        }
+        return QJsonValue(value.value());
+    }
+
+    if (!pReader.next())
+    {
+        return std::nullopt;
+    }
+    return QJsonValue(QJsonValue::Undefined);
+}
+
+QByteArray BinaryConfiguration::Encode(const QJsonObject& pJson)
+{
+    QList<QPair<quint32, QJsonValue>> fields;
+    for (auto page = pJson.constBegin(); page != pJson.constEnd(); ++page)
+    {
+        if (!page.value().isObject())
+        {
+            continue;
+        }
+
+        const auto pageFields = page.value().toObject();
+        for (auto field = pageFields.constBegin(); field != pageFields.constEnd(); ++field)
+        {
+            if (field.value().isBool() || field.value().isDouble() || field.value().isString())
+            {
+                fields.append(qMakePair(FieldId(page.key(), field.key()), field.value()));
+            }
+        }
+    }
+
+    QByteArray data;
+    QCborStreamWriter writer(&data);
+
+    writer.startMap(4);
+    writer.append(static_cast<quint64>(MARKER));
+    writer.append(QLatin1String(FORMAT_MARKER));
+    writer.append(static_cast<quint64>(VERSION));
+    writer.append(FORMAT_VERSION);
+    writer.append(static_cast<quint64>(SCHEMA_VERSION));
+    writer.append(static_cast<quint64>(CONFIGURATION_SCHEMA_VERSION));
+    writer.append(static_cast<quint64>(FIELDS));
+
+    writer.startMap(fields.size());
+    for (const auto& field : fields)
+    {
+        writer.append(static_cast<quint64>(field.first));
+        WriteValue(writer, field.second);
+    }
+    writer.endMap();
+
+    writer.endMap();
+
+    return data;
+}
+
+std::optional<QJsonObject> BinaryConfiguration::Decode(const char *pData, qint64 pSize)
+{
+    qint64 schemaVersion = 0;
+    QHash<QString, QJsonObject> pages;
+
+    const auto valid = DecodeFields(pData, pSize, schemaVersion, [&pages](quint32 pId, const QJsonValue& pValue)
+    {
+        // Fields of newer or older versions without a counterpart are skipped
+        const auto field = FieldName(pId);
+        if (field.has_value())
+        {
+            pages[field.value().first][field.value().second] = pValue;
+        }
+    });
+
+    if (!valid)
+    {
+        return std::nullopt;
+    }
+
+    QJsonObject json;
+    json[CONFIGURATION_SCHEMA_VERSION_KEY] = schemaVersion;
+    json[CONFIGURATION_SPARSE_KEY] = true;
+    for (auto page = pages.cbegin(); page != pages.cend(); ++page)
+    {
+        json[page.key()] = page.value();
+    }
+    return json;
+}
+
+std::optional<Configuration> BinaryConfiguration::DecodeConfiguration(const char *pData, qint64 pSize)
+{
+    const auto& positions = FieldPositions();
+
+    // Values are placed by position, so the configuration is filled in one pass without lookups by name
+    qint64 schemaVersion = 0;
+    QVector<QJsonValue> values(positions.size(), QJsonValue(QJsonValue::Undefined));
+
+    const auto valid = DecodeFields(pData, pSize, schemaVersion, [&positions, &values](quint32 pId, const QJsonValue& pValue)
+    {
+        const auto position = positions.constFind(pId);
+        if (position != positions.cend())
+        {
+            values[position.value()] = pValue;
+        }
+    });
+
+    if (!valid || schemaVersion > CONFIGURATION_SCHEMA_VERSION)
+    {
+        return std::nullopt;
+    }
+
+    Configuration configuration;
+    bool matches = true;
+    int32_t position = 0;
+
+    configuration.ForEachPage([&values, &matches, &position](const char*, auto& pFields)
+    {
+        pFields.ForEachField([&values, &matches, &position](const char*, auto& pField)
+        {
+            const auto& value = values.at(position++);
+            if (!value.isUndefined())
+            {
+                matches &= Configuration::AssignJsonValue(pField, value);
+            }
+        });
+    });
+
+    if (!matches)
+    {
+        return std::nullopt;
+    }
+    return configuration;
+}
+
+bool BinaryConfiguration::WriteFile(const QString& pPath, const QJsonObject& pJson)
+{
+    QSaveFile file(pPath);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    file.write(Encode(pJson));
+    return file.commit();
+}
+
+std::optional<QJsonObject> BinaryConfiguration::ReadFile(const QString& pPath)
+{
+    return DecodeFile(pPath, &BinaryConfiguration::Decode);
+}
+
+std::optional<Configuration> BinaryConfiguration::ReadConfigurationFile(const QString& pPath)
+{
+    return DecodeFile(pPath, &BinaryConfiguration::DecodeConfiguration);
+}
@@ -0,0 +1,120 @@
+/*!
+ * \file BinaryConfiguration.h
+ * \brief The BinaryConfiguration class reads and writes the binary workspace configuration
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef BINARYCONFIGURATION_H
+#define BINARYCONFIGURATION_H
+
+#include "Configuration.h"
+
+#include <QByteArray>
+#include <QCborStreamReader>
+#include <QCborStreamWriter>
+#include <QJsonObject>
+#include <QPair>
+#include <QString>
+
+#include <optional>
+
+/// \brief Name of the binary configuration file in the workspace folder
+static constexpr auto BINARY_CONFIGURATION_FILE{"configuration.imc"};
+
+///
+/// \brief The BinaryConfiguration class reads and writes the binary workspace configuration
+///
+/// The configuration is stored as a CBOR map from integer field IDs to values, next to the
+/// configuration.json that stays the interchange format. A field ID is the 32-bit FNV-1a hash
+/// of "page/FIELD", so IDs are stable across versions without a registry. Reading walks the
+/// memory-mapped file with a CBOR stream reader; no document tree and no string keys are built.
+/// DecodeConfiguration assigns the values by field ID directly to the members of a Configuration.
+///
+class BinaryConfiguration
+{
+public:
+    /// \brief Returns the ID of a configuration field
+    ///
+    /// \param pPage: The page key, e.g. "hardware"
+    /// \param pField: The field name, e.g. "MOTHERBOARD"
+    /// \return The field ID
+    static quint32 FieldId(const QString& pPage, const QString& pField);
+
+    /// \brief Returns the page and field name of a field ID
+    ///
+    /// \param pId: The field ID
+    /// \return Page key and field name or std::nullopt if the ID is unknown to this version
+    static std::optional<QPair<QString, QString>> FieldName(quint32 pId);
+
+    /// \brief Writes a single field value
+    ///
+    /// \param pWriter: The CBOR writer
+    /// \param pValue: The value, a boolean, number or string
+    static void WriteValue(QCborStreamWriter& pWriter, const QJsonValue& pValue);
+
+    /// \brief Reads a single field value
+    ///
+    /// \param pReader: The reader, positioned at the value
+    /// \return The value, undefined for unsupported types, or std::nullopt if the data is invalid
+    static std::optional<QJsonValue> ReadValue(QCborStreamReader& pReader);
+
+    /// \brief Encodes a complete or sparse configuration
+    ///
+    /// \param pJson: The configuration as returned by Configuration::ToJson or ToSparseJson
+    /// \return The CBOR encoded configuration
+    static QByteArray Encode(const QJsonObject& pJson);
+
+    /// \brief Decodes a binary configuration
+    ///
+    /// \param pData: Pointer to the CBOR data
+    /// \param pSize: Size of the data in bytes
+    /// \return The configuration in the sparse JSON format or std::nullopt if the data is invalid
+    static std::optional<QJsonObject> Decode(const char *pData, qint64 pSize);
+
+    /// \brief Decodes a binary configuration into a configuration, fields not in the data keep their defaults
+    ///
+    /// \param pData: Pointer to the CBOR data
+    /// \param pSize: Size of the data in bytes
+    /// \return The configuration or std::nullopt if the data is invalid, of a newer schema or holds a value of the wrong type
+    static std::optional<Configuration> DecodeConfiguration(const char *pData, qint64 pSize);
+
+    /// \brief Writes a configuration to a binary file
+    ///
+    /// \param pPath: Path of the file
+    /// \param pJson: The configuration
+    /// \return \b true, if the file was written
+    static bool WriteFile(const QString& pPath, const QJsonObject& pJson);
+
+    /// \brief Memory-maps and decodes a binary configuration file
+    ///
+    /// \param pPath: Path of the file
+    /// \return The configuration in the sparse JSON format or std::nullopt if the file could not be read
+    static std::optional<QJsonObject> ReadFile(const QString& pPath);
+
+    /// \brief Memory-maps and decodes a binary configuration file into a configuration
+    ///
+    /// \param pPath: Path of the file
+    /// \return The configuration or std::nullopt if the file could not be read
+    static std::optional<Configuration> ReadConfigurationFile(const QString& pPath);
+};
+
+#endif // BINARYCONFIGURATION_H
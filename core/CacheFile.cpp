@@ -0,0 +1,91 @@
+/*!
+ * \file CacheFile.cpp
+ * \brief The CacheFile class reads and writes the binary cache files of iMC
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "CacheFile.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+
+bool CacheFile::Read(const QString& pPath, const Format& pFormat, const QString& pKey, const std::function<void(QDataStream&)>& pReader)
+{
+    QFile file(pPath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    QDataStream stream(&file);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QString key;
+    stream >> magic >> version >> key;
+
+    if (stream.status() != QDataStream::Ok || magic != pFormat.magic || version != pFormat.version || key != pKey)
+    {
+        return false;
+    }
+
+    pReader(stream);
+
+    return stream.status() == QDataStream::Ok;
+}
+
+bool CacheFile::Write(const QString& pPath, const Format& pFormat, const QString& pKey, const std::function<void(QDataStream&)>& pWriter)
+{
+    if (!QDir().mkpath(QFileInfo(pPath).absolutePath()))
+    {
+        return false;
+    }
+
+    QSaveFile file(pPath);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream << pFormat.magic << pFormat.version << pKey;
+    pWriter(stream);
+
+    if (stream.status() != QDataStream::Ok)
+    {
+        file.cancelWriting();
+        return false;
+    }
+
+    return file.commit();
+}
+
+void CacheFile::Prune(const QString& pDirectory, const QString& pNameFilter, int32_t pMaxFiles)
+{
+    const auto entries = QDir(pDirectory).entryInfoList(QStringList{pNameFilter}, QDir::Files, QDir::Time);
+    for (auto i = pMaxFiles; i < entries.size(); ++i)
+    {
+        QFile::remove(entries[i].filePath());
+    }
+}
@@ -0,0 +1,78 @@
+/*!
+ * \file CacheFile.h
+ * \brief The CacheFile class reads and writes the binary cache files of iMC
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CACHEFILE_H
+#define CACHEFILE_H
+
+#include <QDataStream>
+#include <QString>
+
+#include <cstdint>
+#include <functional>
+
+///
+/// \brief The CacheFile class reads and writes the binary cache files of iMC
+///
+/// Every cache file starts with a magic number, a format version and a key, e.g. the hash of the
+/// inputs the cache was built from. A file whose header does not match is treated as missing, so
+/// changing the layout of a cache only requires a new format version.
+///
+class CacheFile
+{
+public:
+    /// \brief Identifies the layout of a cache file
+    struct Format
+    {
+        quint32 magic;
+        quint32 version;
+    };
+
+    /// \brief Reads a cache file if its header matches
+    ///
+    /// \param pPath: Path of the cache file
+    /// \param pFormat: The expected magic number and version
+    /// \param pKey: The expected key
+    /// \param pReader: Reads the content following the header
+    /// \return \b true, if the header matched and the content was read without stream errors
+    static bool Read(const QString& pPath, const Format& pFormat, const QString& pKey, const std::function<void(QDataStream&)>& pReader);
+
+    /// \brief Replaces a cache file, a reader never sees a partially written file
+    ///
+    /// \param pPath: Path of the cache file, missing folders are created
+    /// \param pFormat: The magic number and version to write
+    /// \param pKey: The key to write
+    /// \param pWriter: Writes the content following the header
+    /// \return \b true, if the file was written
+    static bool Write(const QString& pPath, const Format& pFormat, const QString& pKey, const std::function<void(QDataStream&)>& pWriter);
+
+    /// \brief Removes all but the most recently written cache files of a folder
+    ///
+    /// \param pDirectory: The cache folder
+    /// \param pNameFilter: Pattern of the cache files, e.g. "*.idx"
+    /// \param pMaxFiles: The number of files to keep
+    static void Prune(const QString& pDirectory, const QString& pNameFilter, int32_t pMaxFiles);
+};
+
+#endif // CACHEFILE_H
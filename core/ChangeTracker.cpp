@@ -0,0 +1,227 @@
+/*!
+ * \file ChangeTracker.cpp
+ * \brief The ChangeTracker class tracks configuration changes since the last generation and build
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ChangeTracker.h"
+#include "CacheFile.h"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QStandardPaths>
+
+namespace
+{
+static constexpr CacheFile::Format CACHE_FORMAT{0x494D4342, 1}; // "IMCB"
+static constexpr auto MAX_CACHE_FILES{32};
+}
+
+ChangeTracker::ChangeTracker(const QString& pCacheDirectory) :
+    mCacheDirectory(pCacheDirectory)
+{
+    if (mCacheDirectory.isEmpty())
+    {
+        mCacheDirectory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/baselines";
+    }
+}
+
+void ChangeTracker::Load(const QString& pWorkspacePath)
+{
+    Clear();
+
+    mWorkspacePath = QDir::cleanPath(QFileInfo(pWorkspacePath).absoluteFilePath());
+    mCachePath = mCacheDirectory + "/" + QCryptographicHash::hash(mWorkspacePath.toUtf8(), QCryptographicHash::Sha1).toHex() + ".bsl";
+
+    if (!ReadCache())
+    {
+        mGenerated.reset();
+        mBuilt.reset();
+    }
+}
+
+void ChangeTracker::Clear()
+{
+    mWorkspacePath.clear();
+    mCachePath.clear();
+    mGenerated.reset();
+    mBuilt.reset();
+}
+
+void ChangeTracker::SetGenerated(const ConfigurationSnapshot& pSnapshot, const QByteArray& pHeaderHash)
+{
+    mGenerated = MakeRecord(pSnapshot.ToJson());
+    mGenerated->headerHash = pHeaderHash;
+
+    WriteCache();
+}
+
+void ChangeTracker::SetBuilt(const QString& pEnvironment)
+{
+    if (!mGenerated.has_value())
+    {
+        return;
+    }
+
+    mBuilt = mGenerated;
+    mBuilt->environment = pEnvironment;
+
+    WriteCache();
+}
+
+bool ChangeTracker::HasBaseline(Baseline pBaseline) const
+{
+    return Get(pBaseline).has_value();
+}
+
+bool ChangeTracker::IsHeaderGenerated(const QByteArray& pHeaderHash) const
+{
+    return mGenerated.has_value() && !pHeaderHash.isEmpty() && mGenerated->headerHash == pHeaderHash;
+}
+
+QString ChangeTracker::BuiltEnvironment() const
+{
+    return mBuilt.has_value() ? mBuilt->environment : QString();
+}
+
+bool ChangeTracker::IsChanged(Baseline pBaseline, const ConfigurationSnapshot& pSnapshot) const
+{
+    const auto& record = Get(pBaseline);
+    return !record.has_value() || record->fingerprint != pSnapshot.Fingerprint();
+}
+
+QList<ChangeTracker::Change> ChangeTracker::Changes(Baseline pBaseline, const ConfigurationSnapshot& pSnapshot) const
+{
+    QList<Change> changes;
+
+    const auto& record = Get(pBaseline);
+    if (!record.has_value() || record->fingerprint == pSnapshot.Fingerprint())
+    {
+        return changes;
+    }
+
+    for (size_t i = 0; i < ConfigurationSnapshot::PAGE_COUNT; ++i)
+    {
+        // Only pages with differing digests are compared field by field
+        const QString page = ConfigurationSnapshot::PAGE_KEYS.at(i);
+        if (record->pageDigests.value(page) == pSnapshot.PageDigest(i))
+        {
+            continue;
+        }
+
+        const auto fields = pSnapshot.PageJson(i);
+        const auto previousFields = record->configuration.value(page).toObject();
+        for (auto field = fields.constBegin(); field != fields.constEnd(); ++field)
+        {
+            const auto before = previousFields.value(field.key());
+            if (before != field.value())
+            {
+                changes.append(Change{page, field.key(), before, field.value()});
+            }
+        }
+    }
+
+    return changes;
+}
+
+QByteArray ChangeTracker::HashFile(const QString& pPath)
+{
+    QFile file(pPath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return QByteArray();
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(&file);
+    return hash.result();
+}
+
+ChangeTracker::Record ChangeTracker::MakeRecord(const QJsonObject& pConfiguration)
+{
+    Record record;
+    record.configuration = pConfiguration;
+
+    record.pageDigests = Configuration::PageDigests(pConfiguration);
+    record.fingerprint = Configuration::Fingerprint(record.pageDigests);
+
+    return record;
+}
+
+const std::optional<ChangeTracker::Record>& ChangeTracker::Get(Baseline pBaseline) const
+{
+    return (pBaseline == Baseline::Generated) ? mGenerated : mBuilt;
+}
+
+bool ChangeTracker::ReadCache()
+{
+    return CacheFile::Read(mCachePath, CACHE_FORMAT, mWorkspacePath, [this](QDataStream& pStream)
+    {
+        for (auto* record : {&mGenerated, &mBuilt})
+        {
+            bool present = false;
+            pStream >> present;
+            if (!present)
+            {
+                continue;
+            }
+
+            QByteArray json;
+            QByteArray headerHash;
+            QString environment;
+            pStream >> json >> headerHash >> environment;
+
+            *record = MakeRecord(QJsonDocument::fromJson(json).object());
+            (*record)->headerHash = headerHash;
+            (*record)->environment = environment;
+        }
+    });
+}
+
+void ChangeTracker::WriteCache() const
+{
+    if (mCachePath.isEmpty())
+    {
+        return;
+    }
+
+    const auto written = CacheFile::Write(mCachePath, CACHE_FORMAT, mWorkspacePath, [this](QDataStream& pStream)
+    {
+        for (const auto* record : {&mGenerated, &mBuilt})
+        {
+            pStream << record->has_value();
+            if (record->has_value())
+            {
+                pStream << QJsonDocument((*record)->configuration).toJson(QJsonDocument::Compact) << (*record)->headerHash << (*record)->environment;
+            }
+        }
+    });
+
+    // Keep the baselines of the most recently used workspaces only
+    if (written)
+    {
+        CacheFile::Prune(mCacheDirectory, "*.bsl", MAX_CACHE_FILES);
+    }
+}
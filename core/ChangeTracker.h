@@ -0,0 +1,169 @@
+/*!
+ * \file ChangeTracker.h
+ * \brief The ChangeTracker class tracks configuration changes since the last generation and build
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CHANGETRACKER_H
+#define CHANGETRACKER_H
+
+#include "ConfigurationSnapshot.h"
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QList>
+#include <QMap>
+#include <QString>
+
+#include <optional>
+
+///
+/// \brief The ChangeTracker class tracks configuration changes since the last generation and build
+///
+/// The configuration written to Configuration.h and the one of the last successful build are kept
+/// as baselines per workspace, together with the hash of the generated header. Comparing the
+/// fingerprint of a snapshot tells in constant time whether anything changed; only then pages with
+/// differing digests are compared field by field. The baselines are stored in the user cache, so
+/// they survive restarts.
+///
+class ChangeTracker
+{
+public:
+    /// \brief The configurations changes are tracked against
+    enum class Baseline
+    {
+        Generated,
+        Built
+    };
+
+    /// \brief A field that differs from a baseline
+    struct Change
+    {
+        QString page;
+        QString field;
+        QJsonValue before;
+        QJsonValue after;
+    };
+
+    /// \brief Constructor for ChangeTracker
+    ///
+    /// \param pCacheDirectory: Root folder of the cache, the user cache location is used if empty
+    explicit ChangeTracker(const QString& pCacheDirectory = QString());
+
+    /// \brief Loads the baselines recorded for a workspace
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    void Load(const QString& pWorkspacePath);
+
+    /// \brief Forgets the baselines of the current workspace, the stored ones are kept
+    void Clear(void);
+
+    /// \brief Records the configuration that was written to Configuration.h
+    ///
+    /// \param pSnapshot: The generated configuration
+    /// \param pHeaderHash: Hash of the generated file, see HashFile
+    void SetGenerated(const ConfigurationSnapshot& pSnapshot, const QByteArray& pHeaderHash);
+
+    /// \brief Records that the generated configuration was built successfully
+    ///
+    /// \param pEnvironment: The PlatformIO environment that was built
+    void SetBuilt(const QString& pEnvironment);
+
+    /// \brief Returns whether a baseline was recorded
+    ///
+    /// \param pBaseline: The baseline
+    /// \return \b true, if changes can be tracked against the baseline
+    bool HasBaseline(Baseline pBaseline) const;
+
+    /// \brief Checks whether Configuration.h is still the file iMC generated last
+    ///
+    /// \param pHeaderHash: Hash of the current file, see HashFile
+    /// \return \b false, if nothing was generated yet or the file was modified outside iMC
+    bool IsHeaderGenerated(const QByteArray& pHeaderHash) const;
+
+    /// \brief Returns the environment of the last successful build
+    ///
+    /// \return The environment name or an empty string if nothing was built
+    QString BuiltEnvironment(void) const;
+
+    /// \brief Checks whether the configuration differs from a baseline
+    ///
+    /// \param pBaseline: The baseline
+    /// \param pSnapshot: The current configuration
+    /// \return \b true, if the fingerprints differ or the baseline is missing
+    bool IsChanged(Baseline pBaseline, const ConfigurationSnapshot& pSnapshot) const;
+
+    /// \brief Lists the fields that differ from a baseline
+    ///
+    /// \param pBaseline: The baseline
+    /// \param pSnapshot: The current configuration
+    /// \return The changed fields, ordered by page and field, or an empty list if the baseline is missing
+    QList<Change> Changes(Baseline pBaseline, const ConfigurationSnapshot& pSnapshot) const;
+
+    /// \brief Computes the hash of a file
+    ///
+    /// \param pPath: Path of the file
+    /// \return The SHA-1 hash or an empty array if the file could not be read
+    static QByteArray HashFile(const QString& pPath);
+
+protected:
+    /// \brief A recorded configuration with its page digests
+    struct Record
+    {
+        QJsonObject configuration;
+        QMap<QString, QByteArray> pageDigests;
+        QByteArray fingerprint;
+        QByteArray headerHash;
+        QString environment;
+    };
+
+    /// \brief Creates a record of a configuration
+    ///
+    /// \param pConfiguration: The configuration as returned by Configuration::ToJson
+    /// \return The record with page digests and fingerprint
+    static Record MakeRecord(const QJsonObject& pConfiguration);
+
+    /// \brief Returns the record of a baseline
+    ///
+    /// \param pBaseline: The baseline
+    /// \return The record or std::nullopt if none was recorded
+    const std::optional<Record>& Get(Baseline pBaseline) const;
+
+    /// \brief Reads the baselines from the cache file
+    ///
+    /// \return \b true, if the file was valid
+    bool ReadCache(void);
+
+    /// \brief Writes the baselines to the cache file
+    void WriteCache(void) const;
+
+protected:
+    QString mCacheDirectory;
+    QString mCachePath;
+    QString mWorkspacePath;
+
+    std::optional<Record> mGenerated;
+    std::optional<Record> mBuilt;
+};
+
+#endif // CHANGETRACKER_H
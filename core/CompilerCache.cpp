@@ -0,0 +1,155 @@
+/*!
+ * \file CompilerCache.cpp
+ * \brief The CompilerCache class wires a compiler cache into PlatformIO builds
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "CompilerCache.h"
+
+#include <QDir>
+#include <QFile>
+#include <QProcess>
+#include <QStandardPaths>
+#include <QTextStream>
+
+namespace
+{
+static constexpr auto EXTRA_SCRIPT_NAME{"imc_compiler_cache.py"};
+
+/// \brief Python extra script that prefixes the compilers of the build environment with ccache
+static constexpr auto EXTRA_SCRIPT_TEMPLATE{R"(# Generated by iMC, changes will be overwritten.
+# Routes the compilers of the PlatformIO build through ccache.
+Import("env")
+
+CCACHE = r"%0"
+
+for tool in ("CC", "CXX"):
+    compiler = env.get(tool)
+    if compiler and CCACHE not in str(compiler):
+        env.Replace(**{tool: '"%s" %s' % (CCACHE, compiler)})
+)"};
+}
+
+CompilerCache::CompilerCache(const QString& pCacheDirectory) :
+    mCacheDirectory(pCacheDirectory)
+{
+    if (mCacheDirectory.isEmpty())
+    {
+        mCacheDirectory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/compiler";
+    }
+}
+
+std::optional<QString> CompilerCache::FindExecutable()
+{
+    const auto path = QStandardPaths::findExecutable("ccache");
+    if (path.isEmpty())
+    {
+        return std::nullopt;
+    }
+    return path;
+}
+
+std::optional<QProcessEnvironment> CompilerCache::PrepareEnvironment(const QProcessEnvironment& pBase) const
+{
+    if (!QDir().mkpath(mCacheDirectory))
+    {
+        return std::nullopt;
+    }
+
+    auto environment = pBase;
+
+    const auto executable = FindExecutable();
+    if (!executable.has_value())
+    {
+        // Without ccache, fall back to PlatformIO's object file cache
+        environment.insert("PLATFORMIO_BUILD_CACHE_DIR", QDir::toNativeSeparators(mCacheDirectory + "/platformio"));
+        return environment;
+    }
+
+    const auto scriptPath = mCacheDirectory + "/" + EXTRA_SCRIPT_NAME;
+
+    QFile script(scriptPath);
+    if (!script.open(QFile::WriteOnly | QFile::Truncate | QFile::Text))
+    {
+        return std::nullopt;
+    }
+
+    QTextStream(&script) << QString(EXTRA_SCRIPT_TEMPLATE).arg(QDir::toNativeSeparators(executable.value()));
+    script.close();
+
+    environment.insert("PLATFORMIO_EXTRA_SCRIPTS", QDir::toNativeSeparators(scriptPath));
+    environment.insert("CCACHE_DIR", QDir::toNativeSeparators(mCacheDirectory + "/ccache"));
+    environment.insert("CCACHE_SLOPPINESS", "time_macros,include_file_mtime,include_file_ctime");
+
+    return environment;
+}
+
+std::optional<CompilerCache::Statistics> CompilerCache::ReadStatistics() const
+{
+    const auto executable = FindExecutable();
+    if (!executable.has_value())
+    {
+        return std::nullopt;
+    }
+
+    auto environment = QProcessEnvironment::systemEnvironment();
+    environment.insert("CCACHE_DIR", QDir::toNativeSeparators(mCacheDirectory + "/ccache"));
+
+    QProcess process;
+    process.setProcessEnvironment(environment);
+    process.start(executable.value(), QStringList{"--print-stats"});
+
+    if (!process.waitForFinished(3000) || process.exitCode() != 0)
+    {
+        return std::nullopt;
+    }
+
+    Statistics statistics;
+    bool found = false;
+
+    QTextStream stream(process.readAllStandardOutput());
+    while (!stream.atEnd())
+    {
+        const auto fields = stream.readLine().split('\t');
+        if (fields.size() != 2)
+        {
+            continue;
+        }
+
+        if (fields[0] == "direct_cache_hit" || fields[0] == "preprocessed_cache_hit")
+        {
+            statistics.hits += fields[1].toLongLong();
+            found = true;
+        }
+        else if (fields[0] == "cache_miss")
+        {
+            statistics.misses += fields[1].toLongLong();
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        return std::nullopt;
+    }
+    return statistics;
+}
@@ -0,0 +1,77 @@
+/*!
+ * \file CompilerCache.h
+ * \brief The CompilerCache class wires a compiler cache into PlatformIO builds
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef COMPILERCACHE_H
+#define COMPILERCACHE_H
+
+#include <QProcessEnvironment>
+#include <QString>
+
+#include <optional>
+
+///
+/// \brief The CompilerCache class wires a compiler cache into PlatformIO builds
+///
+/// The user's platformio.ini is left untouched: a generated extra script is passed to
+/// PlatformIO via PLATFORMIO_EXTRA_SCRIPTS, which PlatformIO appends to the extra_scripts
+/// of the built environment. The script prefixes the compilers with ccache. If ccache is
+/// not installed, PlatformIO's own object file cache is enabled instead.
+///
+class CompilerCache
+{
+public:
+    /// \brief Hit and miss counters of the compiler cache
+    struct Statistics
+    {
+        int64_t hits{0};
+        int64_t misses{0};
+    };
+
+    /// \brief Constructor for CompilerCache
+    ///
+    /// \param pCacheDirectory: Folder for the cache data, the user cache location is used if empty
+    explicit CompilerCache(const QString& pCacheDirectory = QString());
+
+    /// \brief Searches the PATH for the ccache executable
+    ///
+    /// \return The path of the executable, if found
+    static std::optional<QString> FindExecutable(void);
+
+    /// \brief Writes the extra script and returns the environment for the PlatformIO process
+    ///
+    /// \param pBase: The environment to extend
+    /// \return The extended environment or std::nullopt if the extra script could not be written
+    std::optional<QProcessEnvironment> PrepareEnvironment(const QProcessEnvironment& pBase) const;
+
+    /// \brief Reads the current counters of the ccache instance used for iMC builds
+    ///
+    /// \return The counters, if ccache is installed and reported them
+    std::optional<Statistics> ReadStatistics(void) const;
+
+protected:
+    QString mCacheDirectory;
+};
+
+#endif // COMPILERCACHE_H
@@ -0,0 +1,204 @@
+/*!
+ * \file ConfigurationComparison.cpp
+ * \brief The ConfigurationComparison class compares many configurations field by field
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ConfigurationComparison.h"
+#include "BinaryConfiguration.h"
+#include "ConfigurationSnapshot.h"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QSet>
+
+#include <algorithm>
+
+namespace
+{
+/// \brief Quotes a CSV cell if needed
+///
+/// \param pText: The cell text
+/// \return The CSV cell
+QString CsvCell(const QString& pText)
+{
+    if (!pText.contains(',') && !pText.contains('"') && !pText.contains('\n'))
+    {
+        return pText;
+    }
+
+    return '"' + QString(pText).replace('"', "\"\"") + '"';
+}
+}
+
+ConfigurationComparison ConfigurationComparison::Compare(const QList<Column>& pColumns)
+{
+    ConfigurationComparison comparison;
+
+    // Pages are compared in the order of the configuration, unknown pages follow
+    QStringList pages;
+    for (const auto* page : ConfigurationSnapshot::PAGE_KEYS)
+    {
+        pages.append(page);
+    }
+
+    for (const auto& column : pColumns)
+    {
+        comparison.mLabels.append(column.label);
+
+        for (const auto& page : column.configuration.keys())
+        {
+            if (column.configuration.value(page).isObject() && !pages.contains(page))
+            {
+                pages.append(page);
+            }
+        }
+    }
+
+    for (const auto& page : pages)
+    {
+        QVector<QJsonObject> fields;
+        QSet<QByteArray> digests;
+        for (const auto& column : pColumns)
+        {
+            fields.append(column.configuration.value(page).toObject());
+            digests.insert(PageConfiguration::Digest(fields.last()));
+        }
+
+        if (digests.size() <= 1)
+        {
+            comparison.mIdenticalPages.append(page);
+            continue;
+        }
+        comparison.mComparedPages.append(page);
+
+        QStringList names;
+        for (const auto& object : fields)
+        {
+            names.append(object.keys());
+        }
+        std::sort(names.begin(), names.end());
+        names.erase(std::unique(names.begin(), names.end()), names.end());
+
+        for (const auto& name : names)
+        {
+            Row row{BinaryConfiguration::FieldId(page, name), page, name, QVector<QJsonValue>()};
+            for (const auto& object : fields)
+            {
+                row.values.append(object.value(name));
+            }
+
+            if (std::any_of(row.values.cbegin(), row.values.cend(), [&row](const QJsonValue& pValue){ return pValue != row.values.first(); }))
+            {
+                comparison.mRows.append(row);
+            }
+        }
+    }
+
+    return comparison;
+}
+
+QStringList ConfigurationComparison::Labels() const
+{
+    return mLabels;
+}
+
+const QList<ConfigurationComparison::Row>& ConfigurationComparison::Rows() const
+{
+    return mRows;
+}
+
+QStringList ConfigurationComparison::IdenticalPages() const
+{
+    return mIdenticalPages;
+}
+
+QStringList ConfigurationComparison::ComparedPages() const
+{
+    return mComparedPages;
+}
+
+QByteArray ConfigurationComparison::ToCsv() const
+{
+    QStringList lines;
+
+    QStringList header{"id", "page", "field"};
+    for (const auto& label : mLabels)
+    {
+        header.append(CsvCell(label));
+    }
+    lines.append(header.join(','));
+
+    for (const auto& row : mRows)
+    {
+        QStringList cells{QString::number(row.fieldId, 16), row.page, row.field};
+        for (const auto& value : row.values)
+        {
+            cells.append(CsvCell(ToText(value)));
+        }
+        lines.append(cells.join(','));
+    }
+
+    return (lines.join('\n') + '\n').toUtf8();
+}
+
+QByteArray ConfigurationComparison::ToJson() const
+{
+    QJsonArray differences;
+    for (const auto& row : mRows)
+    {
+        QJsonArray values;
+        for (const auto& value : row.values)
+        {
+            values.append(value.isUndefined() ? QJsonValue() : value);
+        }
+
+        differences.append(QJsonObject{
+            {"id", QString::number(row.fieldId, 16)},
+            {"page", row.page},
+            {"field", row.field},
+            {"values", values}
+        });
+    }
+
+    QJsonObject json;
+    json["columns"] = QJsonArray::fromStringList(mLabels);
+    json["identicalPages"] = QJsonArray::fromStringList(mIdenticalPages);
+    json["differences"] = differences;
+
+    return QJsonDocument(json).toJson();
+}
+
+QString ConfigurationComparison::ToText(const QJsonValue& pValue)
+{
+    if (pValue.isBool())
+    {
+        return pValue.toBool() ? "true" : "false";
+    }
+
+    if (pValue.isDouble())
+    {
+        return QString::number(pValue.toDouble());
+    }
+
+    return pValue.toString();
+}
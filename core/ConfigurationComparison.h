@@ -0,0 +1,113 @@
+/*!
+ * \file ConfigurationComparison.h
+ * \brief The ConfigurationComparison class compares many configurations field by field
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CONFIGURATIONCOMPARISON_H
+#define CONFIGURATIONCOMPARISON_H
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QList>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+///
+/// \brief The ConfigurationComparison class compares many configurations field by field
+///
+/// The configurations are aligned by field ID, so each row holds one field of one page with the
+/// values of all configurations. Pages whose digests are equal in all configurations are skipped
+/// without looking at their fields. Only differing fields become rows, which keeps the result
+/// small even for dozens of configurations. The result can be exported as CSV or JSON for scripts.
+///
+class ConfigurationComparison
+{
+public:
+    /// \brief A configuration to compare
+    struct Column
+    {
+        QString label;
+        QJsonObject configuration; ///< The complete configuration as returned by Configuration::ToJson
+    };
+
+    /// \brief A field whose values differ
+    struct Row
+    {
+        quint32 fieldId;
+        QString page;
+        QString field;
+        QVector<QJsonValue> values; ///< One value per column, undefined if the column lacks the field
+    };
+
+    /// \brief Compares configurations
+    ///
+    /// \param pColumns: The configurations
+    /// \return The comparison
+    static ConfigurationComparison Compare(const QList<Column>& pColumns);
+
+    /// \brief Returns the labels of the compared configurations
+    ///
+    /// \return The labels in column order
+    QStringList Labels(void) const;
+
+    /// \brief Returns the differing fields
+    ///
+    /// \return The rows in page order
+    const QList<Row>& Rows(void) const;
+
+    /// \brief Returns the pages that are equal in all configurations
+    ///
+    /// \return The page keys
+    QStringList IdenticalPages(void) const;
+
+    /// \brief Returns the pages whose fields were compared
+    ///
+    /// \return The page keys
+    QStringList ComparedPages(void) const;
+
+    /// \brief Exports the differing fields as CSV, one row per field and one column per configuration
+    ///
+    /// \return The UTF-8 encoded CSV
+    QByteArray ToCsv(void) const;
+
+    /// \brief Exports the comparison as JSON
+    ///
+    /// \return The UTF-8 encoded JSON document
+    QByteArray ToJson(void) const;
+
+    /// \brief Converts a value for display and CSV export
+    ///
+    /// \param pValue: The value
+    /// \return The value as text, empty if it is undefined
+    static QString ToText(const QJsonValue& pValue);
+
+protected:
+    QStringList mLabels;
+    QList<Row> mRows;
+    QStringList mIdenticalPages;
+    QStringList mComparedPages;
+};
+
+#endif // CONFIGURATIONCOMPARISON_H
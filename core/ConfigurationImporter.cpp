@@ -0,0 +1,295 @@
+/*!
+ * \file ConfigurationImporter.cpp
+ * \brief The ConfigurationImporter class converts existing Marlin configurations into iMC configurations
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ConfigurationImporter.h"
+#include "DefineScanner.h"
+#include "Configuration.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QSet>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace
+{
+static constexpr auto ENABLE_PREFIX{"ENABLE_"};
+static constexpr auto WORKSPACE_MARLIN_FOLDER{"Marlin"};
+static const QSet<QString> IGNORED_DEFINES{"CONFIGURATION_H", "CONFIGURATION_H_VERSION"};
+
+/// \brief The default configuration and the page of each field
+struct Schema
+{
+    QJsonObject defaults;
+    QHash<QString, QString> pageByField;
+};
+
+/// \brief Returns the schema, built once from the default configuration
+///
+/// \return The schema
+const Schema& GetSchema()
+{
+    static const Schema schema = []()
+    {
+        Schema result;
+        result.defaults = Configuration::DefaultJson();
+
+        for (auto page = result.defaults.constBegin(); page != result.defaults.constEnd(); ++page)
+        {
+            const auto fields = page.value().toObject();
+            for (auto field = fields.constBegin(); field != fields.constEnd(); ++field)
+            {
+                if (!result.pageByField.contains(field.key()))
+                {
+                    result.pageByField.insert(field.key(), page.key());
+                }
+            }
+        }
+        return result;
+    }();
+
+    return schema;
+}
+
+/// \brief Removes enclosing quotes and resolves escaped line breaks
+///
+/// \param pValue: The define value
+/// \return The unquoted value
+QString Unquote(const QString& pValue)
+{
+    if (pValue.size() >= 2 && ((pValue.startsWith('"') && pValue.endsWith('"')) || (pValue.startsWith('\'') && pValue.endsWith('\''))))
+    {
+        return pValue.mid(1, pValue.size() - 2).replace("\\n", "\n");
+    }
+    return pValue;
+}
+
+/// \brief Parses a numeric define value such as "0.05f" or "(200)"
+///
+/// \param pValue: The define value
+/// \param pNumber: Receives the number
+/// \return \b true, if the value is a plain number
+bool ParseNumber(QString pValue, double& pNumber)
+{
+    pValue = pValue.trimmed();
+    if (pValue.startsWith('(') && pValue.endsWith(')'))
+    {
+        pValue = pValue.mid(1, pValue.size() - 2).trimmed();
+    }
+    if (pValue.endsWith('f') || pValue.endsWith('F'))
+    {
+        pValue.chop(1);
+    }
+
+    bool ok = false;
+    pNumber = pValue.toDouble(&ok);
+    return ok;
+}
+
+/// \brief Maps a define onto a field of its page
+///
+/// \param pPage: The page configuration to write into
+/// \param pField: The field name, equal to the define name
+/// \param pDefine: The define
+/// \param pResult: Receives invalid values
+void Apply(QJsonObject& pPage, const QString& pField, const DefineScanner::Define& pDefine, ConfigurationImporter::Result& pResult)
+{
+    const auto defaultValue = pPage.value(pField);
+    const auto value = QString::fromUtf8(pDefine.value);
+    const auto enableField = ENABLE_PREFIX + pField;
+
+    if (pPage.value(enableField).isBool())
+    {
+        pPage[enableField] = pDefine.enabled;
+    }
+
+    if (defaultValue.isBool())
+    {
+        pPage[pField] = pDefine.enabled;
+        return;
+    }
+
+    // Disabled defines often carry no value, the default is kept then
+    if (value.isEmpty())
+    {
+        return;
+    }
+
+    if (defaultValue.isDouble())
+    {
+        double number = 0.0;
+        if (!ParseNumber(value, number))
+        {
+            if (pDefine.enabled)
+            {
+                pResult.invalid.append(QString("%0 %1").arg(pField, value));
+            }
+            return;
+        }
+
+        if (std::floor(number) == number && std::abs(number) < 1e15)
+        {
+            pPage[pField] = static_cast<qint64>(number);
+        }
+        else
+        {
+            pPage[pField] = number;
+        }
+    }
+    else if (defaultValue.isString())
+    {
+        // Dropdown items with the flag name in square brackets are matched by the flag
+        const auto defaultText = defaultValue.toString();
+        const bool isFlagItem = defaultText.endsWith(']') && defaultText.contains('[');
+
+        pPage[pField] = isFlagItem ? QString("[%0]").arg(value) : Unquote(value);
+    }
+}
+}
+
+ConfigurationImporter::Result ConfigurationImporter::Import(const QByteArray& pContent)
+{
+    const auto& schema = GetSchema();
+
+    Result result;
+
+    QHash<QString, QJsonObject> pages;
+    for (auto page = schema.defaults.constBegin(); page != schema.defaults.constEnd(); ++page)
+    {
+        pages.insert(page.key(), page.value().toObject());
+    }
+
+    // The first active definition wins, a disabled one is only used until an active one follows
+    QHash<QString, bool> applied;
+    QSet<QString> unmapped;
+
+    for (const auto& define : DefineScanner::Scan(pContent))
+    {
+        const auto name = QString::fromLatin1(define.name);
+
+        const auto page = schema.pageByField.constFind(name);
+        if (page == schema.pageByField.cend())
+        {
+            if (define.enabled && !IGNORED_DEFINES.contains(name) && !unmapped.contains(name))
+            {
+                unmapped.insert(name);
+                result.unmapped.append(name);
+            }
+            continue;
+        }
+
+        const auto previous = applied.constFind(name);
+        if (previous != applied.cend() && (previous.value() || !define.enabled))
+        {
+            continue;
+        }
+
+        Apply(pages[page.value()], name, define, result);
+
+        if (previous == applied.cend())
+        {
+            ++result.mapped;
+        }
+        applied.insert(name, define.enabled);
+    }
+
+    for (auto page = pages.cbegin(); page != pages.cend(); ++page)
+    {
+        result.configuration[page.key()] = page.value();
+    }
+
+    result.success = result.mapped > 0;
+    return result;
+}
+
+ConfigurationImporter::Result ConfigurationImporter::ImportFile(const QString& pPath)
+{
+    Result result;
+    result.path = pPath;
+
+    QFile file(pPath);
+    if (!file.open(QIODevice::ReadOnly) || file.size() == 0)
+    {
+        return result;
+    }
+
+    const auto data = file.map(0, file.size());
+    if (nullptr == data)
+    {
+        return result;
+    }
+
+    // The mapped file is only read while importing, so no copy is made
+    result = Import(QByteArray::fromRawData(reinterpret_cast<const char*>(data), file.size()));
+    result.path = pPath;
+
+    file.unmap(data);
+    return result;
+}
+
+QList<ConfigurationImporter::Result> ConfigurationImporter::ImportFiles(const QStringList& pPaths)
+{
+    // Build the schema before the workers share it
+    GetSchema();
+
+    std::vector<Result> results(pPaths.size());
+    std::atomic<int32_t> nextFile{0};
+
+    const auto worker = [&](){
+        for (auto i = nextFile++; i < pPaths.size(); i = nextFile++)
+        {
+            results[i] = ImportFile(pPaths[i]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const auto threadCount = std::min(std::max(1u, std::thread::hardware_concurrency()), static_cast<unsigned>(std::max<qsizetype>(1, pPaths.size())));
+    for (auto i = 0u; i < threadCount; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return QList<Result>(results.begin(), results.end());
+}
+
+QString ConfigurationImporter::ConfigurationJsonPath(const QString& pPath)
+{
+    auto directory = QFileInfo(pPath).absoluteDir();
+    if (directory.dirName() == WORKSPACE_MARLIN_FOLDER)
+    {
+        directory.cdUp();
+    }
+    return directory.filePath("configuration.json");
+}
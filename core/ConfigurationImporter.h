@@ -0,0 +1,83 @@
+/*!
+ * \file ConfigurationImporter.h
+ * \brief The ConfigurationImporter class converts existing Marlin configurations into iMC configurations
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CONFIGURATIONIMPORTER_H
+#define CONFIGURATIONIMPORTER_H
+
+#include <QByteArray>
+#include <QJsonObject>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+///
+/// \brief The ConfigurationImporter class converts existing Marlin configurations into iMC configurations
+///
+/// The #define and //#define lines of a Configuration.h are tokenized with the DefineScanner and
+/// mapped onto the fields of the Configuration structs by name. Boolean fields take the state of
+/// the define, value fields its value, and ENABLE_ fields whether the define is active. Dropdown
+/// values that iMC stores with the flag name in square brackets are imported as "[FLAG]", which
+/// the pages resolve to the matching item. Fields without a define keep their default values.
+///
+class ConfigurationImporter
+{
+public:
+    /// \brief The outcome of importing a configuration header
+    struct Result
+    {
+        QString path;
+        bool success{false};
+        QJsonObject configuration;
+        int32_t mapped{0};
+        QStringList unmapped;
+        QStringList invalid;
+    };
+
+    /// \brief Imports the given configuration header content
+    ///
+    /// \param pContent: Content of a Marlin Configuration.h
+    /// \return The configuration; unmapped contains active defines without a matching field
+    static Result Import(const QByteArray& pContent);
+
+    /// \brief Memory-maps and imports the given configuration header
+    ///
+    /// \param pPath: Path to a Marlin Configuration.h
+    /// \return The configuration, success is false if the file could not be read
+    static Result ImportFile(const QString& pPath);
+
+    /// \brief Imports many configuration headers in parallel
+    ///
+    /// \param pPaths: Paths to Marlin Configuration.h files
+    /// \return The results in the order of the paths
+    static QList<Result> ImportFiles(const QStringList& pPaths);
+
+    /// \brief Returns the path of the configuration.json that belongs to a configuration header
+    ///
+    /// \param pPath: Path to a Configuration.h, usually located in the Marlin folder of a workspace
+    /// \return The path in the workspace folder
+    static QString ConfigurationJsonPath(const QString& pPath);
+};
+
+#endif // CONFIGURATIONIMPORTER_H
@@ -0,0 +1,261 @@
+/*!
+ * \file ConfigurationJournal.cpp
+ * \brief The ConfigurationJournal class records unsaved configuration changes for crash recovery
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ConfigurationJournal.h"
+#include "BinaryConfiguration.h"
+#include "Configuration.h"
+
+#include <QCborStreamReader>
+#include <QCborStreamWriter>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFileInfo>
+#include <QStandardPaths>
+
+#include <chrono>
+
+namespace
+{
+static constexpr auto SNAPSHOT_FILE{"snapshot.imc"};
+static constexpr auto JOURNAL_FILE{"journal.cbor"};
+static constexpr auto COMPACTING_FILE{"journal.compacting.cbor"};
+static constexpr int32_t COMPACT_AFTER_RECORDS{256};
+
+/// \brief Applies the records of a journal file to a sparse configuration
+///
+/// \param pPath: Path of the journal file
+/// \param pRecovery: The configuration to update
+void Replay(const QString& pPath, ConfigurationJournal::Recovery& pRecovery)
+{
+    QFile file(pPath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return;
+    }
+
+    const auto data = file.readAll();
+    pRecovery.lastChange = std::max(pRecovery.lastChange, QFileInfo(file).lastModified());
+
+    // Each record is an array of field ID and value; a torn record ends the replay
+    QCborStreamReader reader(data);
+    while (reader.isArray() && reader.enterContainer())
+    {
+        if (!reader.isUnsignedInteger())
+        {
+            break;
+        }
+        const auto id = static_cast<quint32>(reader.toUnsignedInteger());
+        reader.next();
+
+        const auto value = BinaryConfiguration::ReadValue(reader);
+        if (!value.has_value() || !reader.leaveContainer())
+        {
+            break;
+        }
+
+        const auto field = BinaryConfiguration::FieldName(id);
+        if (field.has_value() && !value.value().isUndefined())
+        {
+            auto page = pRecovery.configuration.value(field.value().first).toObject();
+            page[field.value().second] = value.value();
+            pRecovery.configuration[field.value().first] = page;
+        }
+        ++pRecovery.changes;
+    }
+}
+}
+
+ConfigurationJournal::~ConfigurationJournal()
+{
+    // The files are kept, the next session offers to replay them
+    WaitForCompaction();
+    mJournal.close();
+}
+
+std::optional<ConfigurationJournal::Recovery> ConfigurationJournal::Recover(const QString& pWorkspacePath)
+{
+    const auto directory = JournalDirectory(pWorkspacePath);
+    const QFileInfo snapshotInfo(directory + "/" + SNAPSHOT_FILE);
+
+    const auto snapshot = BinaryConfiguration::ReadFile(snapshotInfo.filePath());
+    if (!snapshot.has_value())
+    {
+        return std::nullopt;
+    }
+
+    Recovery recovery{snapshot.value(), 0, snapshotInfo.lastModified()};
+
+    // A journal rotated by an unfinished compaction precedes the current one
+    Replay(directory + "/" + COMPACTING_FILE, recovery);
+    Replay(directory + "/" + JOURNAL_FILE, recovery);
+
+    return recovery;
+}
+
+bool ConfigurationJournal::Open(const QString& pWorkspacePath, const QJsonObject& pConfiguration)
+{
+    WaitForCompaction();
+    mJournal.close();
+
+    mDirectory = JournalDirectory(pWorkspacePath);
+    mRecorded = pConfiguration;
+    mRecords = 0;
+
+    if (!QDir().mkpath(mDirectory))
+    {
+        return false;
+    }
+
+    QFile::remove(mDirectory + "/" + COMPACTING_FILE);
+    QFile::remove(mDirectory + "/" + JOURNAL_FILE);
+
+    if (!BinaryConfiguration::WriteFile(mDirectory + "/" + SNAPSHOT_FILE, Configuration::ToSparseJson(pConfiguration)))
+    {
+        return false;
+    }
+
+    mJournal.setFileName(mDirectory + "/" + JOURNAL_FILE);
+    return mJournal.open(QIODevice::WriteOnly | QIODevice::Append);
+}
+
+int32_t ConfigurationJournal::Record(const QJsonObject& pConfiguration)
+{
+    if (!mJournal.isOpen())
+    {
+        return 0;
+    }
+
+    QByteArray records;
+    QCborStreamWriter writer(&records);
+    int32_t count = 0;
+
+    for (auto page = pConfiguration.constBegin(); page != pConfiguration.constEnd(); ++page)
+    {
+        const auto previous = mRecorded.value(page.key());
+        if (!page.value().isObject() || previous == page.value())
+        {
+            continue;
+        }
+
+        const auto fields = page.value().toObject();
+        const auto previousFields = previous.toObject();
+        for (auto field = fields.constBegin(); field != fields.constEnd(); ++field)
+        {
+            const auto value = field.value();
+            if (previousFields.value(field.key()) == value || !(value.isBool() || value.isDouble() || value.isString()))
+            {
+                continue;
+            }
+
+            writer.startArray(2);
+            writer.append(static_cast<quint64>(BinaryConfiguration::FieldId(page.key(), field.key())));
+            BinaryConfiguration::WriteValue(writer, value);
+            writer.endArray();
+            ++count;
+        }
+    }
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    mJournal.write(records);
+    mJournal.flush();
+
+    mRecorded = pConfiguration;
+    mRecords += count;
+
+    if (mRecords >= COMPACT_AFTER_RECORDS)
+    {
+        Compact();
+    }
+
+    return count;
+}
+
+void ConfigurationJournal::Discard()
+{
+    WaitForCompaction();
+    mJournal.close();
+
+    if (!mDirectory.isEmpty())
+    {
+        QDir(mDirectory).removeRecursively();
+    }
+
+    mDirectory.clear();
+    mRecorded = QJsonObject();
+    mRecords = 0;
+}
+
+bool ConfigurationJournal::IsOpen() const
+{
+    return mJournal.isOpen();
+}
+
+QString ConfigurationJournal::JournalDirectory(const QString& pWorkspacePath)
+{
+    const auto key = QCryptographicHash::hash(QDir::cleanPath(QFileInfo(pWorkspacePath).absoluteFilePath()).toUtf8(), QCryptographicHash::Sha1).toHex();
+    return QStandardPaths::writableLocation(QStandardPaths::AppLocalDataLocation) + "/journal/" + key;
+}
+
+void ConfigurationJournal::Compact()
+{
+    // Records keep going to the current journal while the previous compaction runs
+    if (mCompaction.valid() && mCompaction.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+    {
+        return;
+    }
+
+    const auto journalPath = mDirectory + "/" + JOURNAL_FILE;
+    const auto compactingPath = mDirectory + "/" + COMPACTING_FILE;
+
+    mJournal.close();
+    const auto rotated = !QFile::exists(compactingPath) && QFile::rename(journalPath, compactingPath);
+    mJournal.open(QIODevice::WriteOnly | QIODevice::Append);
+
+    if (!rotated)
+    {
+        return;
+    }
+    mRecords = 0;
+
+    mCompaction = std::async(std::launch::async, [directory = mDirectory, configuration = mRecorded]()
+    {
+        if (BinaryConfiguration::WriteFile(directory + "/" + SNAPSHOT_FILE, Configuration::ToSparseJson(configuration)))
+        {
+            QFile::remove(directory + "/" + COMPACTING_FILE);
+        }
+    });
+}
+
+void ConfigurationJournal::WaitForCompaction()
+{
+    if (mCompaction.valid())
+    {
+        mCompaction.wait();
+    }
+}
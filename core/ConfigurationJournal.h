@@ -0,0 +1,107 @@
+/*!
+ * \file ConfigurationJournal.h
+ * \brief The ConfigurationJournal class records unsaved configuration changes for crash recovery
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CONFIGURATIONJOURNAL_H
+#define CONFIGURATIONJOURNAL_H
+
+#include <QDateTime>
+#include <QFile>
+#include <QJsonObject>
+#include <QString>
+
+#include <cstdint>
+#include <future>
+#include <optional>
+
+///
+/// \brief The ConfigurationJournal class records unsaved configuration changes for crash recovery
+///
+/// Each changed field is appended to a per-workspace journal as one small CBOR record of field ID
+/// and value, so the cost of a write does not depend on the size of the configuration. The journal
+/// is relative to a binary snapshot. After a number of records, it is rotated and a background
+/// thread folds it into a new snapshot. Snapshot plus journals can be replayed at any time, even if
+/// the application was terminated during a write or a compaction; a torn last record is dropped.
+///
+class ConfigurationJournal
+{
+public:
+    /// \brief The configuration restored from a previous session
+    struct Recovery
+    {
+        QJsonObject configuration; ///< The configuration in the sparse JSON format
+        int32_t changes; ///< Number of replayed changes
+        QDateTime lastChange;
+    };
+
+    ~ConfigurationJournal(void);
+
+    /// \brief Returns the unsaved changes a previous session left for a workspace
+    ///
+    /// \param pWorkspacePath: Path of the Marlin workspace
+    /// \return The recovered configuration or std::nullopt if there is none
+    static std::optional<Recovery> Recover(const QString& pWorkspacePath);
+
+    /// \brief Starts a new journal for a workspace and discards the previous one
+    ///
+    /// \param pWorkspacePath: Path of the Marlin workspace
+    /// \param pConfiguration: The current configuration as returned by Configuration::ToJson
+    /// \return \b true, if the snapshot and the journal could be created
+    bool Open(const QString& pWorkspacePath, const QJsonObject& pConfiguration);
+
+    /// \brief Appends the fields that differ from the last recorded configuration
+    ///
+    /// \param pConfiguration: The current configuration as returned by Configuration::ToJson
+    /// \return The number of recorded fields
+    int32_t Record(const QJsonObject& pConfiguration);
+
+    /// \brief Closes the journal and deletes its files
+    void Discard(void);
+
+    /// \brief Returns whether a journal is open
+    ///
+    /// \return \b true, if changes are recorded
+    bool IsOpen(void) const;
+
+protected:
+    /// \brief Returns the folder holding snapshot and journals of a workspace
+    ///
+    /// \param pWorkspacePath: Path of the Marlin workspace
+    /// \return The folder path
+    static QString JournalDirectory(const QString& pWorkspacePath);
+
+    /// \brief Rotates the journal and writes the recorded configuration as new snapshot in the background
+    void Compact(void);
+
+    /// \brief Waits for a running compaction
+    void WaitForCompaction(void);
+
+    QString mDirectory;
+    QFile mJournal;
+    QJsonObject mRecorded;
+    int32_t mRecords{0};
+    std::future<void> mCompaction;
+};
+
+#endif // CONFIGURATIONJOURNAL_H
@@ -0,0 +1,221 @@
+/*!
+ * \file DefineScanner.cpp
+ * \brief The DefineScanner class extracts macro definitions from configuration headers
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "DefineScanner.h"
+
+#include <QFile>
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+inline bool IsBlank(const char pChar)
+{
+    return pChar == ' ' || pChar == '\t';
+}
+
+inline bool IsIdentifierChar(const char pChar)
+{
+    return (pChar >= 'a' && pChar <= 'z') || (pChar >= 'A' && pChar <= 'Z') || (pChar >= '0' && pChar <= '9') || pChar == '_';
+}
+
+/// \brief Removes a trailing comment outside of string literals and surrounding blanks
+///
+/// \param pBegin: Start of the value
+/// \param pEnd: End of the line
+/// \param pComment: Receives the text of the trailing comment without delimiters
+/// \return The value
+QByteArray ExtractValue(const char *pBegin, const char *pEnd, QByteArray& pComment)
+{
+    bool inString = false;
+    auto end = pBegin;
+
+    for (; end < pEnd; ++end)
+    {
+        if (*end == '"' && (end == pBegin || end[-1] != '\\'))
+        {
+            inString = !inString;
+        }
+        else if (!inString && *end == '/' && end + 1 < pEnd && (end[1] == '/' || end[1] == '*'))
+        {
+            break;
+        }
+    }
+
+    if (end < pEnd)
+    {
+        const auto commentBegin = end + 2;
+        auto commentEnd = pEnd;
+        if (end[1] == '*')
+        {
+            static constexpr char CLOSE[]{'*', '/'};
+            commentEnd = std::search(commentBegin, pEnd, CLOSE, CLOSE + 2);
+        }
+        pComment = QByteArray(commentBegin, commentEnd - commentBegin).trimmed();
+    }
+
+    while (pBegin < end && IsBlank(*pBegin))
+    {
+        ++pBegin;
+    }
+    while (end > pBegin && (IsBlank(end[-1]) || end[-1] == '\r'))
+    {
+        --end;
+    }
+
+    return QByteArray(pBegin, end - pBegin);
+}
+}
+
+QList<DefineScanner::Define> DefineScanner::Scan(const char *pData, qint64 pSize)
+{
+    QList<Define> defines;
+
+    const auto end = pData + pSize;
+    auto position = pData;
+
+    // Line numbers are counted lazily, from the previous directive to the current one
+    auto countedUntil = pData;
+    int32_t line = 1;
+
+    while (position < end)
+    {
+        const auto hash = static_cast<const char*>(std::memchr(position, '#', end - position));
+        if (nullptr == hash)
+        {
+            break;
+        }
+        position = hash + 1;
+
+        // The directive name follows after optional blanks
+        auto directive = position;
+        while (directive < end && IsBlank(*directive))
+        {
+            ++directive;
+        }
+
+        if (end - directive < 7 || std::memcmp(directive, "define", 6) != 0 || !IsBlank(directive[6]))
+        {
+            continue;
+        }
+
+        // Only blanks, optionally preceded by "//", may appear between line start and '#'
+        auto lineStart = hash;
+        while (lineStart > pData && lineStart[-1] != '\n')
+        {
+            --lineStart;
+        }
+
+        auto prefix = lineStart;
+        while (prefix < hash && IsBlank(*prefix))
+        {
+            ++prefix;
+        }
+
+        bool enabled = true;
+        if (prefix + 1 < hash && prefix[0] == '/' && prefix[1] == '/')
+        {
+            enabled = false;
+            prefix += 2;
+            while (prefix < hash && IsBlank(*prefix))
+            {
+                ++prefix;
+            }
+        }
+
+        if (prefix != hash)
+        {
+            continue;
+        }
+
+        auto nameBegin = directive + 6;
+        while (nameBegin < end && IsBlank(*nameBegin))
+        {
+            ++nameBegin;
+        }
+
+        auto nameEnd = nameBegin;
+        while (nameEnd < end && IsIdentifierChar(*nameEnd))
+        {
+            ++nameEnd;
+        }
+
+        if (nameEnd == nameBegin)
+        {
+            continue;
+        }
+
+        auto lineEnd = static_cast<const char*>(std::memchr(nameEnd, '\n', end - nameEnd));
+        if (nullptr == lineEnd)
+        {
+            lineEnd = end;
+        }
+
+        line += static_cast<int32_t>(std::count(countedUntil, lineStart, '\n'));
+        countedUntil = lineStart;
+
+        Define define;
+        define.name = QByteArray(nameBegin, nameEnd - nameBegin);
+        define.value = ExtractValue(nameEnd, lineEnd, define.comment);
+        define.enabled = enabled;
+        define.line = line;
+        defines.append(define);
+
+        position = lineEnd;
+    }
+
+    return defines;
+}
+
+QList<DefineScanner::Define> DefineScanner::Scan(const QByteArray& pContent)
+{
+    return Scan(pContent.constData(), pContent.size());
+}
+
+std::optional<QList<DefineScanner::Define>> DefineScanner::ScanFile(const QString& pPath)
+{
+    QFile file(pPath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return std::nullopt;
+    }
+
+    if (file.size() == 0)
+    {
+        return QList<Define>();
+    }
+
+    const auto data = file.map(0, file.size());
+    if (nullptr == data)
+    {
+        return Scan(file.readAll());
+    }
+
+    const auto defines = Scan(reinterpret_cast<const char*>(data), file.size());
+    file.unmap(data);
+
+    return defines;
+}
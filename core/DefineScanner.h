@@ -0,0 +1,75 @@
+/*!
+ * \file DefineScanner.h
+ * \brief The DefineScanner class extracts macro definitions from configuration headers
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef DEFINESCANNER_H
+#define DEFINESCANNER_H
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+
+#include <optional>
+
+///
+/// \brief The DefineScanner class extracts macro definitions from configuration headers
+///
+/// Enabled (#define) and disabled (//#define) definitions are found by jumping from one
+/// '#' to the next with memchr, which the C library implements with vector instructions,
+/// so only the few bytes around each directive are inspected individually.
+///
+class DefineScanner
+{
+public:
+    /// \brief A macro definition found in a header
+    struct Define
+    {
+        QByteArray name;
+        QByteArray value;
+        QByteArray comment;
+        bool enabled{false};
+        int32_t line{0};
+    };
+
+    /// \brief Scans the given header content
+    ///
+    /// \param pData: Pointer to the content
+    /// \param pSize: Size of the content in bytes
+    /// \return All definitions in order of appearance, values without trailing comments
+    static QList<Define> Scan(const char *pData, qint64 pSize);
+
+    /// \brief Scans the given header content
+    ///
+    /// \param pContent: The content
+    /// \return All definitions in order of appearance, values without trailing comments
+    static QList<Define> Scan(const QByteArray& pContent);
+
+    /// \brief Memory-maps and scans the given header file
+    ///
+    /// \param pPath: Path to the header
+    /// \return All definitions or std::nullopt if the file could not be read
+    static std::optional<QList<Define>> ScanFile(const QString& pPath);
+};
+
+#endif // DEFINESCANNER_H
@@ -0,0 +1,550 @@
+/*!
+ * \file EffectiveDefines.cpp
+ * \brief The EffectiveDefines class evaluates the macros Marlin derives from a configuration
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EffectiveDefines.h"
+#include "DefineScanner.h"
+#include "HostPreprocessor.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QMutexLocker>
+#include <QRegularExpression>
+#include <QStandardPaths>
+
+#include <algorithm>
+
+namespace
+{
+static constexpr auto ENTRY_FILE{"Marlin/src/inc/MarlinConfig.h"};
+static constexpr auto CONFIGURATION_FILE{"Marlin/Configuration.h"};
+static constexpr auto COMPLETE_MARKER_FILE_NAME{"complete"};
+static constexpr auto EMPTY_FILE_NAME{"imc_empty.h"};
+static constexpr auto DEPENDENCY_FILE_NAME{"imc_dependencies.d"};
+static constexpr auto MAX_STORED_RESULTS{256};
+static const QStringList HEADER_NAME_FILTERS{"*.h", "*.hpp"};
+
+/// \brief Lists all headers of the workspace that take part in the configuration include chain
+///
+/// \param pWorkspacePath: Path to the Marlin base folder
+/// \return Paths relative to the workspace, sorted, without Configuration.h
+QStringList ListHeaders(const QString& pWorkspacePath)
+{
+    const QDir workspaceDir(pWorkspacePath);
+    QStringList headers;
+
+    for (const auto& file : QDir(pWorkspacePath + "/Marlin").entryList(HEADER_NAME_FILTERS, QDir::Files))
+    {
+        headers.append("Marlin/" + file);
+    }
+    headers.removeAll(CONFIGURATION_FILE);
+
+    QDirIterator iterator(pWorkspacePath + "/Marlin/src", HEADER_NAME_FILTERS, QDir::Files, QDirIterator::Subdirectories);
+    while (iterator.hasNext())
+    {
+        headers.append(workspaceDir.relativeFilePath(iterator.next()));
+    }
+
+    headers.sort();
+    return headers;
+}
+
+/// \brief Removes all but the most recently modified entries of a folder
+///
+/// \param pPath: The folder to prune
+/// \param pMaxEntries: Number of entries to keep
+/// \param pTimestampFile: Name of the file inside an entry folder whose modification time counts
+void PruneOldest(const QString& pPath, int32_t pMaxEntries, const QString& pTimestampFile = QString())
+{
+    auto entries = QDir(pPath).entryInfoList(QDir::Files | QDir::Dirs | QDir::NoDotAndDotDot);
+    if (entries.size() <= pMaxEntries)
+    {
+        return;
+    }
+
+    const auto timestamp = [&pTimestampFile](const QFileInfo& pInfo){
+        return pTimestampFile.isEmpty() ? pInfo.lastModified() : QFileInfo(pInfo.filePath() + "/" + pTimestampFile).lastModified();
+    };
+
+    std::sort(entries.begin(), entries.end(), [&timestamp](const QFileInfo& pLeft, const QFileInfo& pRight){
+        return timestamp(pLeft) > timestamp(pRight);
+    });
+
+    for (auto i = pMaxEntries; i < entries.size(); ++i)
+    {
+        if (entries[i].isDir())
+        {
+            QDir(entries[i].filePath()).removeRecursively();
+        }
+        else
+        {
+            QFile::remove(entries[i].filePath());
+        }
+    }
+}
+
+/// \brief Collects all identifiers of a text, including those in comments and literals
+///
+/// \param pText: The text
+/// \param pIdentifiers: Receives the identifiers
+void CollectIdentifiers(const QByteArray& pText, QSet<QByteArray>& pIdentifiers)
+{
+    const auto isIdentifierChar = [](const char pChar){
+        return (pChar >= 'a' && pChar <= 'z') || (pChar >= 'A' && pChar <= 'Z') || (pChar >= '0' && pChar <= '9') || pChar == '_';
+    };
+
+    const auto end = pText.constData() + pText.size();
+    auto position = pText.constData();
+
+    while (position < end)
+    {
+        if (!isIdentifierChar(*position))
+        {
+            ++position;
+            continue;
+        }
+
+        const auto start = position;
+        while (position < end && isIdentifierChar(*position))
+        {
+            ++position;
+        }
+
+        if (*start < '0' || *start > '9')
+        {
+            pIdentifiers.insert(QByteArray(start, position - start));
+        }
+    }
+}
+
+/// \brief Reads the files listed in a dependency file written by the compiler with -MD
+///
+/// \param pPath: Path of the dependency file
+/// \return The prerequisites as written by the compiler, without the target
+QStringList ReadDependencies(const QString& pPath)
+{
+    QFile file(pPath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return QStringList();
+    }
+
+    auto content = QString::fromUtf8(file.readAll());
+    content.replace("\\\r\n", " ").replace("\\\n", " ");
+
+    const auto targetEnd = content.indexOf(": ");
+    if (targetEnd < 0)
+    {
+        return QStringList();
+    }
+
+    return content.mid(targetEnd + 2).split(QRegularExpression("\\s+"), Qt::SkipEmptyParts);
+}
+
+/// \brief Serializes macros in the format of a macro dump
+///
+/// \param pMacros: The macros to serialize
+/// \return The serialized macros
+QByteArray SerializeMacros(const EffectiveDefines::Macros& pMacros)
+{
+    QByteArray output;
+    for (auto it = pMacros.cbegin(); it != pMacros.cend(); ++it)
+    {
+        const auto separator = it.value().startsWith('(') ? "" : " ";
+        output.append(QString("#define %0%1%2\n").arg(it.key(), separator, it.value()).toUtf8());
+    }
+    return output;
+}
+}
+
+EffectiveDefines::EffectiveDefines(const QString& pCacheDirectory) :
+    mCacheDirectory(pCacheDirectory)
+{
+    if (mCacheDirectory.isEmpty())
+    {
+        mCacheDirectory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/defines";
+    }
+}
+
+std::optional<EffectiveDefines::Macros> EffectiveDefines::Evaluate(const QString& pWorkspacePath, const QStringList& pConfiguration)
+{
+    QMutexLocker locker(&mMutex);
+
+    const auto compiler = HostPreprocessor::FindCompiler();
+    if (!compiler.has_value())
+    {
+        return std::nullopt;
+    }
+
+    const auto treeKey = ComputeTreeKey(pWorkspacePath);
+    if (treeKey.isEmpty())
+    {
+        return std::nullopt;
+    }
+
+    const auto configuration = pConfiguration.join('\n').toUtf8();
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArrayLiteral("imc-defines-v1"));
+    hash.addData(compiler.value().toUtf8());
+    hash.addData(treeKey.toLatin1());
+    hash.addData(configuration);
+    const auto key = QString::fromLatin1(hash.result().toHex());
+
+    if (mResults.contains(key))
+    {
+        mResultOrder.removeAll(key);
+        mResultOrder.append(key);
+        return mResults.value(key);
+    }
+
+    const auto resultPath = mCacheDirectory + "/results/" + key + ".dM";
+
+    QFile storedResult(resultPath);
+    if (storedResult.open(QIODevice::ReadOnly))
+    {
+        const auto macros = ParseMacros(storedResult.readAll());
+        Remember(key, macros);
+        return macros;
+    }
+
+    const auto incremental = EvaluateIncrementally(treeKey, pConfiguration);
+    if (incremental.has_value())
+    {
+        Remember(key, incremental.value());
+        return incremental;
+    }
+
+    const auto shadowPath = PrepareShadowTree(pWorkspacePath, treeKey);
+    if (!shadowPath.has_value())
+    {
+        return std::nullopt;
+    }
+
+    QFile configurationFile(shadowPath.value() + "/" + CONFIGURATION_FILE);
+    if (!configurationFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return std::nullopt;
+    }
+    configurationFile.write(configuration);
+    configurationFile.close();
+
+    if (!mBuiltinMacros.has_value())
+    {
+        DetectBuiltinMacros(shadowPath.value());
+    }
+
+    const auto dependencyPath = shadowPath.value() + "/" + DEPENDENCY_FILE_NAME;
+    QFile::remove(dependencyPath);
+
+    const auto result = HostPreprocessor(shadowPath.value()).DumpMacros(ENTRY_FILE, QStringList{"-MD", "-MF", DEPENDENCY_FILE_NAME});
+    if (!result.has_value() || result->exitCode < 0)
+    {
+        return std::nullopt;
+    }
+
+    for (const auto& diagnostic : result->diagnostics)
+    {
+        if (diagnostic.isFatal)
+        {
+            return std::nullopt; // The include chain was not evaluated completely
+        }
+    }
+
+    auto macros = ParseMacros(result->output);
+    for (const auto& builtin : mBuiltinMacros.value_or(QSet<QString>()))
+    {
+        macros.remove(builtin);
+    }
+
+    // The headers of the include chain decide which later changes can be applied incrementally
+    const QDir shadowDir(shadowPath.value());
+    const auto configurationPath = QDir::cleanPath(shadowDir.absoluteFilePath(CONFIGURATION_FILE));
+
+    QSet<QByteArray> chainIdentifiers;
+    const auto headers = ReadDependencies(dependencyPath);
+    for (const auto& header : headers)
+    {
+        const auto headerPath = QDir::cleanPath(shadowDir.absoluteFilePath(header));
+        if (headerPath == configurationPath || !headerPath.startsWith(shadowDir.absolutePath() + "/"))
+        {
+            continue; // System headers cannot reference the configuration
+        }
+
+        QFile headerFile(headerPath);
+        if (headerFile.open(QIODevice::ReadOnly))
+        {
+            CollectIdentifiers(headerFile.readAll(), chainIdentifiers);
+        }
+    }
+
+    if (headers.isEmpty())
+    {
+        mBaseline.reset();
+    }
+    else
+    {
+        mBaseline = Baseline{treeKey, pConfiguration, macros, chainIdentifiers};
+    }
+
+    if (QDir().mkpath(mCacheDirectory + "/results"))
+    {
+        QFile file(resultPath);
+        if (file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            file.write(SerializeMacros(macros));
+        }
+        PruneOldest(mCacheDirectory + "/results", MAX_STORED_RESULTS);
+    }
+
+    Remember(key, macros);
+    return macros;
+}
+
+std::optional<EffectiveDefines::Macros> EffectiveDefines::EvaluateIncrementally(const QString& pTreeKey, const QStringList& pConfiguration)
+{
+    if (!mBaseline.has_value() || mBaseline->treeKey != pTreeKey || mBaseline->configuration.size() != pConfiguration.size())
+    {
+        return std::nullopt;
+    }
+
+    QSet<QByteArray> unchangedIdentifiers;
+    QHash<QByteArray, DefineScanner::Define> changes;
+    int32_t depth = 0;
+
+    for (auto i = 0; i < pConfiguration.size(); ++i)
+    {
+        const auto& line = pConfiguration.at(i);
+        const auto& baselineLine = mBaseline->configuration.at(i);
+
+        const auto directive = line.trimmed();
+        if (directive.startsWith("#if"))
+        {
+            ++depth;
+        }
+        else if (directive.startsWith("#endif"))
+        {
+            --depth;
+        }
+
+        if (line == baselineLine)
+        {
+            CollectIdentifiers(line.toUtf8(), unchangedIdentifiers);
+            continue;
+        }
+
+        // Only a changed value or a toggled comment of a single-line define is applied
+        const auto before = DefineScanner::Scan(baselineLine.toUtf8());
+        const auto after = DefineScanner::Scan(line.toUtf8());
+        if (before.size() != 1 || after.size() != 1 || before.first().name != after.first().name
+            || line.endsWith('\\') || baselineLine.endsWith('\\') || changes.contains(after.first().name))
+        {
+            return std::nullopt;
+        }
+
+        // Inside a conditional block, only a define that took effect before shows that the block is active
+        if (depth > 0 && !(before.first().enabled && mBaseline->macros.contains(QString::fromUtf8(before.first().name))))
+        {
+            return std::nullopt;
+        }
+
+        changes.insert(after.first().name, after.first());
+    }
+
+    for (auto change = changes.cbegin(); change != changes.cend(); ++change)
+    {
+        if (mBaseline->chainIdentifiers.contains(change.key()) || unchangedIdentifiers.contains(change.key()))
+        {
+            return std::nullopt; // Other macros may be derived from the changed one
+        }
+    }
+
+    auto macros = mBaseline->macros;
+    for (const auto& change : changes)
+    {
+        if (change.enabled)
+        {
+            macros.insert(QString::fromUtf8(change.name), QString::fromUtf8(change.value).simplified());
+        }
+        else
+        {
+            macros.remove(QString::fromUtf8(change.name));
+        }
+    }
+
+    mBaseline->configuration = pConfiguration;
+    mBaseline->macros = macros;
+
+    return macros;
+}
+
+EffectiveDefines::Macros EffectiveDefines::ParseMacros(const QByteArray& pOutput)
+{
+    Macros macros;
+
+    for (const auto& line : pOutput.split('\n'))
+    {
+        if (!line.startsWith("#define "))
+        {
+            continue;
+        }
+
+        const auto definition = QString::fromUtf8(line.mid(8)).trimmed();
+
+        qsizetype nameEnd = 0;
+        while (nameEnd < definition.size() && definition[nameEnd] != ' ' && definition[nameEnd] != '(')
+        {
+            ++nameEnd;
+        }
+
+        if (nameEnd == 0)
+        {
+            continue;
+        }
+
+        // Function-like macros keep their parameter list as part of the value
+        const auto value = (nameEnd < definition.size() && definition[nameEnd] == '(') ? definition.mid(nameEnd) : definition.mid(nameEnd + 1);
+        macros.insert(definition.left(nameEnd), value);
+    }
+
+    return macros;
+}
+
+QSet<QString> EffectiveDefines::Diff(const Macros& pBefore, const Macros& pAfter)
+{
+    QSet<QString> changed;
+
+    for (auto it = pAfter.cbegin(); it != pAfter.cend(); ++it)
+    {
+        const auto before = pBefore.constFind(it.key());
+        if (before == pBefore.cend() || before.value() != it.value())
+        {
+            changed.insert(it.key());
+        }
+    }
+
+    for (auto it = pBefore.cbegin(); it != pBefore.cend(); ++it)
+    {
+        if (!pAfter.contains(it.key()))
+        {
+            changed.insert(it.key());
+        }
+    }
+
+    return changed;
+}
+
+QString EffectiveDefines::ComputeTreeKey(const QString& pWorkspacePath)
+{
+    if (!QFileInfo::exists(pWorkspacePath + "/" + ENTRY_FILE))
+    {
+        return QString();
+    }
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+
+    for (const auto& header : ListHeaders(pWorkspacePath))
+    {
+        const QFileInfo info(pWorkspacePath + "/" + header);
+        hash.addData(QString("%0:%1:%2\n").arg(header).arg(info.size()).arg(info.lastModified().toMSecsSinceEpoch()).toUtf8());
+    }
+
+    return QString::fromLatin1(hash.result().toHex());
+}
+
+std::optional<QString> EffectiveDefines::PrepareShadowTree(const QString& pWorkspacePath, const QString& pTreeKey)
+{
+    const auto treesPath = mCacheDirectory + "/trees";
+    const auto shadowPath = treesPath + "/" + pTreeKey;
+    const auto markerPath = shadowPath + "/" + COMPLETE_MARKER_FILE_NAME;
+
+    const auto touchMarker = [&markerPath](){
+        QFile marker(markerPath);
+        if (marker.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            marker.write(QByteArray::number(QDateTime::currentMSecsSinceEpoch()));
+            return true;
+        }
+        return false;
+    };
+
+    if (QFileInfo::exists(markerPath))
+    {
+        touchMarker();
+        return shadowPath;
+    }
+
+    QDir(shadowPath).removeRecursively();
+
+    for (const auto& header : ListHeaders(pWorkspacePath))
+    {
+        const auto target = shadowPath + "/" + header;
+        if (!QDir().mkpath(QFileInfo(target).path()) || !QFile::copy(pWorkspacePath + "/" + header, target))
+        {
+            QDir(shadowPath).removeRecursively();
+            return std::nullopt;
+        }
+    }
+
+    if (!touchMarker())
+    {
+        QDir(shadowPath).removeRecursively();
+        return std::nullopt;
+    }
+
+    PruneOldest(treesPath, mMaxTrees, COMPLETE_MARKER_FILE_NAME);
+
+    return shadowPath;
+}
+
+void EffectiveDefines::DetectBuiltinMacros(const QString& pShadowPath)
+{
+    QFile emptyFile(pShadowPath + "/" + EMPTY_FILE_NAME);
+    if (!emptyFile.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return;
+    }
+    emptyFile.close();
+
+    const auto result = HostPreprocessor(pShadowPath).DumpMacros(EMPTY_FILE_NAME);
+    if (result.has_value() && result->exitCode == 0)
+    {
+        const auto builtins = ParseMacros(result->output);
+        mBuiltinMacros = QSet<QString>(builtins.keyBegin(), builtins.keyEnd());
+    }
+}
+
+void EffectiveDefines::Remember(const QString& pKey, const Macros& pMacros)
+{
+    mResults.insert(pKey, pMacros);
+    mResultOrder.append(pKey);
+
+    while (mResultOrder.size() > mMaxResults)
+    {
+        mResults.remove(mResultOrder.takeFirst());
+    }
+}
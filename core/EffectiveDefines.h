@@ -0,0 +1,139 @@
+/*!
+ * \file EffectiveDefines.h
+ * \brief The EffectiveDefines class evaluates the macros Marlin derives from a configuration
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef EFFECTIVEDEFINES_H
+#define EFFECTIVEDEFINES_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+#include <optional>
+
+///
+/// \brief The EffectiveDefines class evaluates the macros Marlin derives from a configuration
+///
+/// The configuration headers of the workspace are copied into a shadow tree once per
+/// revision of the headers. For each evaluation, the given Configuration.h is written into
+/// the shadow tree and the MarlinConfig.h include chain is preprocessed on the host.
+/// Results are cached in memory and on disk, keyed by the hashes of all inputs.
+///
+/// Evaluations are incremental where this is exact: if only define lines changed since the last
+/// preprocessed configuration, and neither the headers of the include chain nor the rest of
+/// Configuration.h reference the changed macros, the changes are applied to the last result
+/// without running the preprocessor. Any other change is preprocessed completely.
+///
+class EffectiveDefines
+{
+public:
+    /// \brief Maps macro names to their definitions
+    using Macros = QHash<QString, QString>;
+
+    /// \brief Constructor for EffectiveDefines
+    ///
+    /// \param pCacheDirectory: Root folder of the cache, the user cache location is used if empty
+    explicit EffectiveDefines(const QString& pCacheDirectory = QString());
+
+    /// \brief Evaluates all macros defined after including MarlinConfig.h
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pConfiguration: The content of the Configuration.h to evaluate
+    /// \return The macros or std::nullopt if the evaluation failed
+    std::optional<Macros> Evaluate(const QString& pWorkspacePath, const QStringList& pConfiguration);
+
+    /// \brief Parses the output of a macro dump
+    ///
+    /// \param pOutput: The preprocessor output of -dM
+    /// \return The macros, function-like macros include their parameter list in the value
+    static Macros ParseMacros(const QByteArray& pOutput);
+
+    /// \brief Compares two evaluations
+    ///
+    /// \param pBefore: The previous macros
+    /// \param pAfter: The current macros
+    /// \return Names of all macros that were added, removed or changed
+    static QSet<QString> Diff(const Macros& pBefore, const Macros& pAfter);
+
+protected:
+    /// \brief Computes the fingerprint of all headers of the workspace except Configuration.h
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \return The fingerprint as a hex string or an empty string if the workspace is invalid
+    static QString ComputeTreeKey(const QString& pWorkspacePath);
+
+    /// \brief Creates the shadow tree for the given workspace headers if it does not exist yet
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pTreeKey: The fingerprint of the headers
+    /// \return The path of the shadow tree or std::nullopt if it could not be created
+    std::optional<QString> PrepareShadowTree(const QString& pWorkspacePath, const QString& pTreeKey);
+
+    /// \brief Evaluates the compiler's builtin macros which are hidden from the results
+    ///
+    /// \param pShadowPath: Path of a shadow tree to run the compiler in
+    void DetectBuiltinMacros(const QString& pShadowPath);
+
+    /// \brief Applies changed defines to the last preprocessed result, if no other macro can depend on them
+    ///
+    /// \param pTreeKey: The fingerprint of the headers
+    /// \param pConfiguration: The content of the Configuration.h to evaluate
+    /// \return The macros or std::nullopt if the configuration has to be preprocessed
+    std::optional<Macros> EvaluateIncrementally(const QString& pTreeKey, const QStringList& pConfiguration);
+
+    /// \brief Adds a result to the memory cache, dropping the oldest entries
+    ///
+    /// \param pKey: The input fingerprint
+    /// \param pMacros: The evaluated macros
+    void Remember(const QString& pKey, const Macros& pMacros);
+
+protected:
+    QString mCacheDirectory;
+
+    QMutex mMutex;
+
+    QHash<QString, Macros> mResults;
+    QList<QString> mResultOrder;
+    int32_t mMaxResults{16};
+    int32_t mMaxTrees{4};
+
+    std::optional<QSet<QString>> mBuiltinMacros;
+
+    /// \brief The last preprocessed configuration, the base of incremental evaluations
+    struct Baseline
+    {
+        QString treeKey;
+        QStringList configuration;
+        Macros macros;
+        QSet<QByteArray> chainIdentifiers; ///< Identifiers of the included headers except Configuration.h
+    };
+
+    std::optional<Baseline> mBaseline;
+};
+
+#endif // EFFECTIVEDEFINES_H
@@ -0,0 +1,275 @@
+/*!
+ * \file EnvironmentIndex.cpp
+ * \brief The EnvironmentIndex class maps motherboards to their PlatformIO environments
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EnvironmentIndex.h"
+#include "CacheFile.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+#include <QStandardPaths>
+#include <QTextStream>
+
+namespace
+{
+static constexpr CacheFile::Format CACHE_FORMAT{0x494D4345, 1}; // "IMCE"
+static constexpr auto MAX_CACHE_FILES{16};
+static constexpr auto PINS_PATH{"Marlin/src/pins/pins.h"};
+static constexpr auto PLATFORMIO_PATH{"platformio.ini"};
+static constexpr auto EXTRA_CONFIGS_FOLDER{"ini"};
+
+/// \brief Reads all lines of a text file
+///
+/// \param pPath: Path to the file
+/// \return The lines or an empty list if the file could not be read
+QStringList ReadLines(const QString& pPath)
+{
+    QFile file(pPath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        return QStringList();
+    }
+
+    QStringList lines;
+    QTextStream stream(&file);
+    while (!stream.atEnd())
+    {
+        lines.append(stream.readLine());
+    }
+    return lines;
+}
+
+/// \brief Computes the fingerprint of the workspace and the size and modification time of the input files
+///
+/// \param pWorkspacePath: Path to the Marlin base folder
+/// \param pFiles: The input files
+/// \return The fingerprint as a hex string
+QString ComputeKey(const QString& pWorkspacePath, const QStringList& pFiles)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArrayLiteral("imc-environments-v1"));
+    hash.addData(QDir(pWorkspacePath).absolutePath().toUtf8());
+
+    for (const auto& path : pFiles)
+    {
+        const QFileInfo info(path);
+        hash.addData(QString("%0:%1:%2\n").arg(info.fileName()).arg(info.size()).arg(info.lastModified().toMSecsSinceEpoch()).toUtf8());
+    }
+
+    return QString::fromLatin1(hash.result().toHex());
+}
+}
+
+EnvironmentIndex::EnvironmentIndex(const QString& pCacheDirectory) :
+    mCacheDirectory(pCacheDirectory)
+{
+    if (mCacheDirectory.isEmpty())
+    {
+        mCacheDirectory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/environments";
+    }
+}
+
+bool EnvironmentIndex::Load(const QString& pWorkspacePath)
+{
+    mIsReady = false;
+    mWasCached = false;
+    mEnvironments.clear();
+    mEnvironmentsByBoard.clear();
+
+    const auto pinsPath = QString("%0/%1").arg(pWorkspacePath, PINS_PATH);
+    QStringList configPaths{QString("%0/%1").arg(pWorkspacePath, PLATFORMIO_PATH)};
+    for (const auto& info : QDir(QString("%0/%1").arg(pWorkspacePath, EXTRA_CONFIGS_FOLDER)).entryInfoList(QStringList{"*.ini"}, QDir::Files, QDir::Name))
+    {
+        configPaths.append(info.filePath());
+    }
+
+    if (!QFileInfo::exists(pinsPath) || !QFileInfo::exists(configPaths.first()))
+    {
+        return false;
+    }
+
+    const auto key = ComputeKey(pWorkspacePath, QStringList{pinsPath} + configPaths);
+    const auto cachePath = mCacheDirectory + "/" + key + ".env";
+
+    if (ReadCache(cachePath, key))
+    {
+        mWasCached = true;
+        mIsReady = true;
+        return true;
+    }
+
+    mEnvironments.clear();
+    mEnvironmentsByBoard.clear();
+
+    for (const auto& path : configPaths)
+    {
+        mEnvironments.append(ParseEnvironments(ReadLines(path)));
+    }
+    mEnvironments.removeDuplicates();
+
+    // Drop hints to environments this workspace does not define
+    const auto hints = ParsePins(ReadLines(pinsPath));
+    for (auto it = hints.cbegin(); it != hints.cend(); ++it)
+    {
+        QStringList environments;
+        for (const auto& environment : it.value())
+        {
+            if (mEnvironments.contains(environment))
+            {
+                environments.append(environment);
+            }
+        }
+
+        if (!environments.isEmpty())
+        {
+            mEnvironmentsByBoard.insert(it.key(), environments);
+        }
+    }
+
+    WriteCache(cachePath, key);
+
+    mIsReady = true;
+    return true;
+}
+
+bool EnvironmentIndex::IsReady() const
+{
+    return mIsReady;
+}
+
+bool EnvironmentIndex::WasCached() const
+{
+    return mWasCached;
+}
+
+QStringList EnvironmentIndex::Environments() const
+{
+    return mEnvironments;
+}
+
+QHash<QString, QStringList> EnvironmentIndex::EnvironmentsByBoard() const
+{
+    return mEnvironmentsByBoard;
+}
+
+QStringList EnvironmentIndex::EnvironmentsFor(const QString& pBoard) const
+{
+    return mEnvironmentsByBoard.value(pBoard);
+}
+
+bool EnvironmentIndex::IsCompatible(const QString& pBoard, const QString& pEnvironment) const
+{
+    const auto environments = EnvironmentsFor(pBoard);
+    return environments.isEmpty() || environments.contains(pEnvironment);
+}
+
+QHash<QString, QStringList> EnvironmentIndex::ParsePins(const QStringList& pLines)
+{
+    static const QRegularExpression BOARD_CONDITION("^\\s*#\\s*(?:el)?if\\s+MB\\(([^)]*)\\)");
+    static const QRegularExpression OTHER_CONDITION("^\\s*#\\s*(?:if|ifdef|ifndef|elif|else|endif)\\b");
+    static const QRegularExpression INCLUDE("^\\s*#\\s*include\\s");
+    static const QRegularExpression ENVIRONMENT_HINT("env:([\\w\\-\\.]+)");
+
+    QHash<QString, QStringList> environmentsByBoard;
+    QStringList boards;
+
+    for (const auto& line : pLines)
+    {
+        if (const auto match = BOARD_CONDITION.match(line); match.hasMatch())
+        {
+            boards.clear();
+            for (const auto& board : match.captured(1).split(',', Qt::SkipEmptyParts))
+            {
+                boards.append("BOARD_" + board.trimmed());
+            }
+        }
+        else if (OTHER_CONDITION.match(line).hasMatch())
+        {
+            boards.clear();
+        }
+        else if (!boards.isEmpty() && INCLUDE.match(line).hasMatch())
+        {
+            QStringList environments;
+            auto hints = ENVIRONMENT_HINT.globalMatch(line);
+            while (hints.hasNext())
+            {
+                environments.append(hints.next().captured(1));
+            }
+
+            if (!environments.isEmpty())
+            {
+                for (const auto& board : boards)
+                {
+                    environmentsByBoard[board].append(environments);
+                }
+            }
+
+            // Only the first include of a branch selects the pins file
+            boards.clear();
+        }
+    }
+
+    return environmentsByBoard;
+}
+
+QStringList EnvironmentIndex::ParseEnvironments(const QStringList& pLines)
+{
+    static const QRegularExpression SECTION("^\\s*\\[env:([^\\]]+)\\]");
+
+    QStringList environments;
+    for (const auto& line : pLines)
+    {
+        if (const auto match = SECTION.match(line); match.hasMatch())
+        {
+            environments.append(match.captured(1).trimmed());
+        }
+    }
+    return environments;
+}
+
+bool EnvironmentIndex::ReadCache(const QString& pPath, const QString& pKey)
+{
+    return CacheFile::Read(pPath, CACHE_FORMAT, pKey, [this](QDataStream& pStream)
+    {
+        pStream >> mEnvironments >> mEnvironmentsByBoard;
+    });
+}
+
+void EnvironmentIndex::WriteCache(const QString& pPath, const QString& pKey) const
+{
+    const auto written = CacheFile::Write(pPath, CACHE_FORMAT, pKey, [this](QDataStream& pStream)
+    {
+        pStream << mEnvironments << mEnvironmentsByBoard;
+    });
+
+    // Keep the indices of the most recently opened workspaces only
+    if (written)
+    {
+        CacheFile::Prune(mCacheDirectory, "*.env", MAX_CACHE_FILES);
+    }
+}
@@ -0,0 +1,125 @@
+/*!
+ * \file EnvironmentIndex.h
+ * \brief The EnvironmentIndex class maps motherboards to their PlatformIO environments
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ENVIRONMENTINDEX_H
+#define ENVIRONMENTINDEX_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+///
+/// \brief The EnvironmentIndex class maps motherboards to their PlatformIO environments
+///
+/// Marlin's src/pins/pins.h selects the pins file of each motherboard with an
+/// "#if MB(...)" / "#elif MB(...)" chain and lists the environments that can build the
+/// board as "env:" hints behind the include. The environments are collected from the
+/// [env:...] sections of platformio.ini and the ini/ folder. The index is cached per
+/// workspace and rebuilt only if one of these files changed.
+///
+class EnvironmentIndex
+{
+public:
+    /// \brief Constructor for EnvironmentIndex
+    ///
+    /// \param pCacheDirectory: Root folder of the cache, the user cache location is used if empty
+    explicit EnvironmentIndex(const QString& pCacheDirectory = QString());
+
+    /// \brief Loads the index for the given workspace from the cache or builds it
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \return \b true, if the index is ready
+    bool Load(const QString& pWorkspacePath);
+
+    /// \brief Returns whether the index was loaded
+    ///
+    /// \return \b true, if the index is ready
+    bool IsReady(void) const;
+
+    /// \brief Returns whether the most recent Load read the index from the cache
+    ///
+    /// \return \b true, if no file was parsed
+    bool WasCached(void) const;
+
+    /// \brief Returns all environments of the workspace
+    ///
+    /// \return The environment names in order of definition
+    QStringList Environments(void) const;
+
+    /// \brief Returns the environments pins.h recommends for each motherboard
+    ///
+    /// \return Maps the motherboard names, e.g. "BOARD_RAMPS_14_EFB", to their environments
+    QHash<QString, QStringList> EnvironmentsByBoard(void) const;
+
+    /// \brief Returns the environments recommended for the given motherboard
+    ///
+    /// \param pBoard: The motherboard name, e.g. "BOARD_RAMPS_14_EFB"
+    /// \return The environments or an empty list if the board has no hints
+    QStringList EnvironmentsFor(const QString& pBoard) const;
+
+    /// \brief Checks whether an environment may build the given motherboard
+    ///
+    /// \param pBoard: The motherboard name
+    /// \param pEnvironment: The environment name
+    /// \return \b false, if pins.h lists environments for the board and the given one is not among them
+    bool IsCompatible(const QString& pBoard, const QString& pEnvironment) const;
+
+    /// \brief Extracts the environment hints from pins.h
+    ///
+    /// \param pLines: The lines of pins.h
+    /// \return Maps the motherboard names to their environments
+    static QHash<QString, QStringList> ParsePins(const QStringList& pLines);
+
+    /// \brief Extracts the environment names from a PlatformIO configuration file
+    ///
+    /// \param pLines: The lines of the configuration file
+    /// \return The environment names in order of definition
+    static QStringList ParseEnvironments(const QStringList& pLines);
+
+protected:
+    /// \brief Reads the index from the cache file
+    ///
+    /// \param pPath: Path of the cache file
+    /// \param pKey: The expected fingerprint of the inputs
+    /// \return \b true, if a valid index was read
+    bool ReadCache(const QString& pPath, const QString& pKey);
+
+    /// \brief Writes the index to the cache file
+    ///
+    /// \param pPath: Path of the cache file
+    /// \param pKey: The fingerprint of the inputs
+    void WriteCache(const QString& pPath, const QString& pKey) const;
+
+protected:
+    QString mCacheDirectory;
+
+    bool mIsReady{false};
+    bool mWasCached{false};
+
+    QStringList mEnvironments;
+    QHash<QString, QStringList> mEnvironmentsByBoard;
+};
+
+#endif // ENVIRONMENTINDEX_H
@@ -0,0 +1,557 @@
+/*!
+ * \file FleetCatalog.cpp
+ * \brief The FleetCatalog class indexes the configurations of many workspaces
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "FleetCatalog.h"
+#include "CacheFile.h"
+#include "Configuration.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRegularExpression>
+#include <QStandardPaths>
+
+#include <algorithm>
+
+namespace
+{
+static constexpr CacheFile::Format CACHE_FORMAT{0x494D4346, 2}; // "IMCF"
+static constexpr auto MAX_SCAN_DEPTH{6};
+
+/// \brief Converts an indexed value for display
+///
+/// \param pValue: The value
+/// \return The value as text
+QString ToText(const QJsonValue& pValue)
+{
+    if (pValue.isBool())
+    {
+        return pValue.toBool() ? "on" : "off";
+    }
+
+    if (pValue.isDouble())
+    {
+        return QString::number(pValue.toDouble());
+    }
+
+    return pValue.toString();
+}
+
+/// \brief Returns the key of a value in the field index
+///
+/// \param pValue: The value
+/// \return A key that differs for values of different type or text
+QString IndexKey(const QJsonValue& pValue)
+{
+    return QString::number(static_cast<int32_t>(pValue.type())) + ':' + ToText(pValue);
+}
+}
+
+FleetCatalog::FleetCatalog(const QString& pCachePath) :
+    mCachePath(pCachePath)
+{
+    if (mCachePath.isEmpty())
+    {
+        mCachePath = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/fleet/catalog.idx";
+    }
+
+    // Field names found on several pages can only be queried with their page
+    const auto& defaults = Configuration::DefaultJson();
+    for (auto page = defaults.constBegin(); page != defaults.constEnd(); ++page)
+    {
+        const auto fields = page.value().toObject();
+        for (auto field = fields.constBegin(); field != fields.constEnd(); ++field)
+        {
+            mFieldKeys.insert(field.key(), mFieldKeys.contains(field.key()) ? QString() : page.key() + "/" + field.key());
+        }
+    }
+}
+
+FleetCatalog::RefreshResult FleetCatalog::Refresh(const QStringList& pRoots)
+{
+    if (!mCacheRead)
+    {
+        mCacheRead = true;
+        if (!ReadCache())
+        {
+            mEntries.clear();
+        }
+
+        for (auto entry = mEntries.constBegin(); entry != mEntries.constEnd(); ++entry)
+        {
+            AddToIndex(entry.key(), entry.value().fields);
+        }
+    }
+
+    RefreshResult result{0, 0, 0, QStringList()};
+
+    QHash<QString, Entry> entries;
+    for (const auto& root : pRoots)
+    {
+        for (const auto& workspacePath : FindWorkspaces(root))
+        {
+            if (entries.contains(workspacePath))
+            {
+                continue;
+            }
+
+            auto entry = mEntries.take(workspacePath);
+            if (!IsCurrent(entry))
+            {
+                const auto fingerprint = entry.fingerprint;
+                const auto fields = entry.fields;
+
+                if (!IndexWorkspace(workspacePath, entry))
+                {
+                    RemoveFromIndex(workspacePath, fields);
+                    result.failed.append(workspacePath);
+                    continue;
+                }
+                ++result.indexed;
+
+                if (entry.fingerprint != fingerprint)
+                {
+                    RemoveFromIndex(workspacePath, fields);
+                    AddToIndex(workspacePath, entry.fields);
+                }
+            }
+
+            entries.insert(workspacePath, std::move(entry));
+        }
+    }
+
+    // Whatever was not taken above is gone
+    result.removed = mEntries.size();
+    for (auto entry = mEntries.constBegin(); entry != mEntries.constEnd(); ++entry)
+    {
+        RemoveFromIndex(entry.key(), entry.value().fields);
+    }
+    result.workspaces = entries.size();
+
+    mEntries = std::move(entries);
+
+    if (result.indexed > 0 || result.removed > 0)
+    {
+        WriteCache();
+    }
+
+    return result;
+}
+
+std::optional<QList<FleetCatalog::Match>> FleetCatalog::Query(const QString& pQuery) const
+{
+    mLastError.clear();
+
+    QList<Condition> conditions;
+    for (const auto& text : pQuery.split(QRegularExpression("\\s+and\\s+", QRegularExpression::CaseInsensitiveOption), Qt::SkipEmptyParts))
+    {
+        const auto condition = ParseCondition(text);
+        if (!condition.has_value())
+        {
+            return std::nullopt;
+        }
+        conditions.append(condition.value());
+    }
+
+    if (conditions.isEmpty())
+    {
+        mLastError = "The query is empty.";
+        return std::nullopt;
+    }
+
+    std::optional<QSet<QString>> workspaces;
+    for (const auto& condition : conditions)
+    {
+        if (workspaces.has_value())
+        {
+            workspaces.value().intersect(MatchingWorkspaces(condition));
+        }
+        else
+        {
+            workspaces = MatchingWorkspaces(condition);
+        }
+
+        if (workspaces.value().isEmpty())
+        {
+            break;
+        }
+    }
+
+    QList<Match> matches;
+    for (const auto& workspacePath : workspaces.value())
+    {
+        const auto fields = mEntries.value(workspacePath).fields;
+
+        Match match{workspacePath, QStringList()};
+        for (const auto& condition : conditions)
+        {
+            match.values.append(QString("%0=%1").arg(condition.field.section('/', 1), ToText(fields.value(condition.field))));
+        }
+        matches.append(match);
+    }
+
+    std::sort(matches.begin(), matches.end(), [](const Match& pLeft, const Match& pRight){ return pLeft.workspacePath < pRight.workspacePath; });
+
+    return matches;
+}
+
+QString FleetCatalog::LastError() const
+{
+    return mLastError;
+}
+
+int32_t FleetCatalog::Size() const
+{
+    return mEntries.size();
+}
+
+QStringList FleetCatalog::FindWorkspaces(const QString& pRoot)
+{
+    QStringList workspaces;
+
+    QList<QPair<QString, int32_t>> folders{{QDir::cleanPath(QFileInfo(pRoot).absoluteFilePath()), 0}};
+    while (!folders.isEmpty())
+    {
+        const auto next = folders.takeLast();
+        const auto& folder = next.first;
+        const auto depth = next.second;
+        const QDir dir(folder);
+
+        // Workspaces are not searched any further, their build folders are large
+        if (dir.exists("platformio.ini"))
+        {
+            if (dir.exists("configuration.json"))
+            {
+                workspaces.append(folder);
+            }
+            continue;
+        }
+
+        if (depth >= MAX_SCAN_DEPTH)
+        {
+            continue;
+        }
+
+        for (const auto& subfolder : dir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot))
+        {
+            folders.append({subfolder.filePath(), depth + 1});
+        }
+    }
+
+    return workspaces;
+}
+
+QSet<QString> FleetCatalog::MatchingWorkspaces(const Condition& pCondition) const
+{
+    QSet<QString> workspaces;
+
+    const auto values = mIndex.constFind(pCondition.field);
+    if (values != mIndex.constEnd())
+    {
+        for (const auto& indexed : values.value())
+        {
+            if (Matches(indexed.value, pCondition))
+            {
+                workspaces.unite(indexed.workspaces);
+            }
+        }
+    }
+
+    // Workspaces without the field only match "!="
+    if (Matches(QJsonValue(QJsonValue::Undefined), pCondition))
+    {
+        for (auto entry = mEntries.constBegin(); entry != mEntries.constEnd(); ++entry)
+        {
+            if (!entry.value().fields.contains(pCondition.field))
+            {
+                workspaces.insert(entry.key());
+            }
+        }
+    }
+
+    return workspaces;
+}
+
+void FleetCatalog::AddToIndex(const QString& pWorkspacePath, const QHash<QString, QJsonValue>& pFields)
+{
+    for (auto field = pFields.constBegin(); field != pFields.constEnd(); ++field)
+    {
+        auto& indexed = mIndex[field.key()][IndexKey(field.value())];
+        indexed.value = field.value();
+        indexed.workspaces.insert(pWorkspacePath);
+    }
+}
+
+void FleetCatalog::RemoveFromIndex(const QString& pWorkspacePath, const QHash<QString, QJsonValue>& pFields)
+{
+    for (auto field = pFields.constBegin(); field != pFields.constEnd(); ++field)
+    {
+        auto values = mIndex.find(field.key());
+        if (values == mIndex.end())
+        {
+            continue;
+        }
+
+        auto indexed = values.value().find(IndexKey(field.value()));
+        if (indexed == values.value().end())
+        {
+            continue;
+        }
+
+        indexed.value().workspaces.remove(pWorkspacePath);
+        if (indexed.value().workspaces.isEmpty())
+        {
+            values.value().erase(indexed);
+        }
+    }
+}
+
+bool FleetCatalog::IsCurrent(const Entry& pEntry)
+{
+    if (pEntry.files.isEmpty())
+    {
+        return false;
+    }
+
+    return std::all_of(pEntry.files.cbegin(), pEntry.files.cend(), [](const Stamp& pStamp){
+        const QFileInfo info(pStamp.path);
+        return info.exists() && info.size() == pStamp.size && info.lastModified() == pStamp.modified;
+    });
+}
+
+bool FleetCatalog::IndexWorkspace(const QString& pWorkspacePath, Entry& pEntry)
+{
+    const auto resolution = mProfileResolver.Resolve(pWorkspacePath + "/configuration.json");
+    if (!resolution.has_value())
+    {
+        return false;
+    }
+
+    pEntry.files.clear();
+    for (const auto& path : resolution.value().chain)
+    {
+        const QFileInfo info(path);
+        pEntry.files.append(Stamp{path, info.lastModified(), info.size()});
+    }
+
+    const auto& configuration = resolution.value().configuration;
+
+    // Touched but unchanged files keep their fields
+    const auto fingerprint = Configuration::Fingerprint(configuration);
+    if (fingerprint == pEntry.fingerprint)
+    {
+        return true;
+    }
+
+    pEntry.fingerprint = fingerprint;
+    pEntry.fields.clear();
+
+    for (auto page = configuration.constBegin(); page != configuration.constEnd(); ++page)
+    {
+        const auto fields = page.value().toObject();
+        for (auto field = fields.constBegin(); field != fields.constEnd(); ++field)
+        {
+            pEntry.fields.insert(page.key() + "/" + field.key(), field.value());
+        }
+    }
+
+    return true;
+}
+
+std::optional<FleetCatalog::Condition> FleetCatalog::ParseCondition(const QString& pText) const
+{
+    static const QRegularExpression expression("^\\s*([\\w/]+)\\s*(==|!=|<=|>=|=|<|>)\\s*(.*?)\\s*$");
+
+    const auto match = expression.match(pText);
+    if (!match.hasMatch() || match.captured(3).isEmpty())
+    {
+        mLastError = QString("Invalid condition \"%0\", expected e.g. \"GRID_MAX_POINTS_X > 7\".").arg(pText.trimmed());
+        return std::nullopt;
+    }
+
+    Condition condition;
+
+    condition.field = match.captured(1);
+    if (!condition.field.contains('/'))
+    {
+        if (!mFieldKeys.contains(condition.field))
+        {
+            mLastError = QString("Unknown field %0.").arg(condition.field);
+            return std::nullopt;
+        }
+
+        if (mFieldKeys.value(condition.field).isEmpty())
+        {
+            mLastError = QString("Field %0 exists on several pages, write page/%0.").arg(condition.field);
+            return std::nullopt;
+        }
+
+        condition.field = mFieldKeys.value(condition.field);
+    }
+
+    condition.op = (match.captured(2) == "=") ? "==" : match.captured(2);
+
+    const auto text = match.captured(3);
+    const auto lower = text.toLower();
+
+    bool isNumber = false;
+    const auto number = text.toDouble(&isNumber);
+
+    if (lower == "on" || lower == "true")
+    {
+        condition.value = true;
+    }
+    else if (lower == "off" || lower == "false")
+    {
+        condition.value = false;
+    }
+    else if (isNumber)
+    {
+        condition.value = number;
+    }
+    else if (text.size() >= 2 && text.startsWith('"') && text.endsWith('"'))
+    {
+        condition.value = text.mid(1, text.size() - 2);
+    }
+    else
+    {
+        condition.value = text;
+    }
+
+    if (condition.value.isBool() && condition.op != "==" && condition.op != "!=")
+    {
+        mLastError = QString("Switches can only be compared with == and !=, see \"%0\".").arg(pText.trimmed());
+        return std::nullopt;
+    }
+
+    return condition;
+}
+
+bool FleetCatalog::Matches(const QJsonValue& pValue, const Condition& pCondition)
+{
+    int32_t order = 0;
+
+    if (pValue.isBool() && pCondition.value.isBool())
+    {
+        order = static_cast<int32_t>(pValue.toBool()) - static_cast<int32_t>(pCondition.value.toBool());
+    }
+    else if (pValue.isDouble() && pCondition.value.isDouble())
+    {
+        order = (pValue.toDouble() < pCondition.value.toDouble()) ? -1 : ((pValue.toDouble() > pCondition.value.toDouble()) ? 1 : 0);
+    }
+    else if (pValue.isString())
+    {
+        order = QString::compare(pValue.toString(), ToText(pCondition.value), Qt::CaseInsensitive);
+    }
+    else
+    {
+        // Missing fields and mismatching types only differ
+        return pCondition.op == "!=";
+    }
+
+    if (pCondition.op == "==")
+    {
+        return order == 0;
+    }
+    else if (pCondition.op == "!=")
+    {
+        return order != 0;
+    }
+    else if (pCondition.op == "<")
+    {
+        return order < 0;
+    }
+    else if (pCondition.op == "<=")
+    {
+        return order <= 0;
+    }
+    else if (pCondition.op == ">")
+    {
+        return order > 0;
+    }
+
+    return order >= 0;
+}
+
+bool FleetCatalog::ReadCache()
+{
+    return CacheFile::Read(mCachePath, CACHE_FORMAT, QString(), [this](QDataStream& pStream)
+    {
+        qint32 count = 0;
+        pStream >> count;
+
+        for (qint32 i = 0; i < count && pStream.status() == QDataStream::Ok; ++i)
+        {
+            QString workspacePath;
+            qint32 fileCount = 0;
+            pStream >> workspacePath >> fileCount;
+
+            Entry entry;
+            for (qint32 j = 0; j < fileCount && pStream.status() == QDataStream::Ok; ++j)
+            {
+                Stamp stamp;
+                pStream >> stamp.path >> stamp.modified >> stamp.size;
+                entry.files.append(stamp);
+            }
+
+            QByteArray json;
+            pStream >> entry.fingerprint >> json;
+
+            const auto fields = QJsonDocument::fromJson(json).object();
+            for (auto field = fields.constBegin(); field != fields.constEnd(); ++field)
+            {
+                entry.fields.insert(field.key(), field.value());
+            }
+
+            mEntries.insert(workspacePath, std::move(entry));
+        }
+    });
+}
+
+void FleetCatalog::WriteCache() const
+{
+    CacheFile::Write(mCachePath, CACHE_FORMAT, QString(), [this](QDataStream& pStream)
+    {
+        pStream << static_cast<qint32>(mEntries.size());
+
+        for (auto entry = mEntries.constBegin(); entry != mEntries.constEnd(); ++entry)
+        {
+            pStream << entry.key() << static_cast<qint32>(entry.value().files.size());
+            for (const auto& stamp : entry.value().files)
+            {
+                pStream << stamp.path << stamp.modified << stamp.size;
+            }
+
+            QJsonObject fields;
+            for (auto field = entry.value().fields.constBegin(); field != entry.value().fields.constEnd(); ++field)
+            {
+                fields.insert(field.key(), field.value());
+            }
+
+            pStream << entry.value().fingerprint << QJsonDocument(fields).toJson(QJsonDocument::Compact);
+        }
+    });
+}
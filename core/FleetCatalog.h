@@ -0,0 +1,199 @@
+/*!
+ * \file FleetCatalog.h
+ * \brief The FleetCatalog class indexes the configurations of many workspaces
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef FLEETCATALOG_H
+#define FLEETCATALOG_H
+
+#include "ProfileResolver.h"
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
+#include <QJsonValue>
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include <optional>
+
+///
+/// \brief The FleetCatalog class indexes the configurations of many workspaces
+///
+/// Every Marlin workspace with a configuration.json below the fleet folders is indexed with all
+/// fields of its resolved configuration, keyed "page/FIELD". Refreshing only stats the files; a
+/// workspace is resolved again if the size or modification time of its file or of one of its
+/// parent profiles changed, and its fields are only replaced if the configuration fingerprint
+/// differs. The index is stored in the user cache, so queries after a restart start from it.
+///
+/// Queries are conditions joined by "and", e.g. "PIDTEMPBED == off and GRID_MAX_POINTS_X > 7".
+/// Fields are given with or without their page, values are on/off, true/false, numbers or strings.
+/// Each field maps its distinct values to the workspaces using them, so a condition is checked once
+/// per distinct value instead of once per workspace, and the results of the conditions are intersected.
+///
+class FleetCatalog
+{
+public:
+    /// \brief Counts of the last refresh
+    struct RefreshResult
+    {
+        int32_t workspaces; ///< Indexed workspaces
+        int32_t indexed; ///< Workspaces read again because their files changed
+        int32_t removed; ///< Workspaces no longer found
+        QStringList failed; ///< Workspaces whose configuration could not be resolved
+    };
+
+    /// \brief A workspace matching a query
+    struct Match
+    {
+        QString workspacePath;
+        QStringList values; ///< The queried fields as "FIELD=value"
+    };
+
+    /// \brief Constructor for FleetCatalog
+    ///
+    /// \param pCachePath: Path of the index file, a file in the user cache location is used if empty
+    explicit FleetCatalog(const QString& pCachePath = QString());
+
+    /// \brief Updates the index from the workspaces below the fleet folders
+    ///
+    /// \param pRoots: The fleet folders
+    /// \return The counts of the refresh
+    RefreshResult Refresh(const QStringList& pRoots);
+
+    /// \brief Finds the workspaces matching a query
+    ///
+    /// \param pQuery: Conditions joined by "and"
+    /// \return The matching workspaces ordered by path or std::nullopt if the query is invalid, see LastError
+    std::optional<QList<Match>> Query(const QString& pQuery) const;
+
+    /// \brief Returns the reason the last query failed
+    ///
+    /// \return The error message
+    QString LastError(void) const;
+
+    /// \brief Returns the number of indexed workspaces
+    ///
+    /// \return The number of workspaces
+    int32_t Size(void) const;
+
+protected:
+    /// \brief Size and modification time of a file a workspace configuration was resolved from
+    struct Stamp
+    {
+        QString path;
+        QDateTime modified;
+        qint64 size{-1};
+    };
+
+    /// \brief An indexed workspace
+    struct Entry
+    {
+        QVector<Stamp> files;
+        QByteArray fingerprint;
+        QHash<QString, QJsonValue> fields;
+    };
+
+    /// \brief A distinct value of a field and the workspaces using it
+    struct IndexedValue
+    {
+        QJsonValue value;
+        QSet<QString> workspaces;
+    };
+
+    /// \brief A parsed query condition
+    struct Condition
+    {
+        QString field;
+        QString op;
+        QJsonValue value;
+    };
+
+    /// \brief Finds the workspaces below a folder, without descending into workspaces
+    ///
+    /// \param pRoot: The folder
+    /// \return The workspace paths
+    static QStringList FindWorkspaces(const QString& pRoot);
+
+    /// \brief Checks whether the files of an entry are unchanged
+    ///
+    /// \param pEntry: The entry
+    /// \return \b true, if all files have their recorded size and modification time
+    static bool IsCurrent(const Entry& pEntry);
+
+    /// \brief Reads the configuration of a workspace into an entry
+    ///
+    /// \param pWorkspacePath: The workspace
+    /// \param pEntry: The entry to update, its fields are kept if the fingerprint is unchanged
+    /// \return \b true, if the configuration could be resolved
+    bool IndexWorkspace(const QString& pWorkspacePath, Entry& pEntry);
+
+    /// \brief Parses a single query condition
+    ///
+    /// \param pText: The condition, e.g. "GRID_MAX_POINTS_X > 7"
+    /// \return The condition or std::nullopt if it is invalid
+    std::optional<Condition> ParseCondition(const QString& pText) const;
+
+    /// \brief Evaluates a condition on an indexed value
+    ///
+    /// \param pValue: The value of the workspace
+    /// \param pCondition: The condition
+    /// \return \b true, if the condition holds
+    static bool Matches(const QJsonValue& pValue, const Condition& pCondition);
+
+    /// \brief Finds the workspaces matching a condition in the field index
+    ///
+    /// \param pCondition: The condition
+    /// \return The matching workspace paths
+    QSet<QString> MatchingWorkspaces(const Condition& pCondition) const;
+
+    /// \brief Adds the fields of a workspace to the field index
+    ///
+    /// \param pWorkspacePath: The workspace
+    /// \param pFields: Its fields
+    void AddToIndex(const QString& pWorkspacePath, const QHash<QString, QJsonValue>& pFields);
+
+    /// \brief Removes the fields of a workspace from the field index
+    ///
+    /// \param pWorkspacePath: The workspace
+    /// \param pFields: The fields it was added with
+    void RemoveFromIndex(const QString& pWorkspacePath, const QHash<QString, QJsonValue>& pFields);
+
+    bool ReadCache(void);
+    void WriteCache(void) const;
+
+    QString mCachePath;
+    bool mCacheRead{false};
+    QHash<QString, Entry> mEntries;
+
+    /// \brief Maps "page/FIELD" to its distinct values, keyed by type and text
+    QHash<QString, QHash<QString, IndexedValue>> mIndex;
+    QHash<QString, QString> mFieldKeys; ///< Maps field names without page to "page/FIELD"
+    ProfileResolver mProfileResolver;
+    mutable QString mLastError;
+};
+
+#endif // FLEETCATALOG_H
@@ -0,0 +1,234 @@
+/*!
+ * \file HardwareCatalog.cpp
+ * \brief The HardwareCatalog class extracts the hardware catalogs of a Marlin workspace
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "HardwareCatalog.h"
+#include "CacheFile.h"
+#include "DefineScanner.h"
+
+#include <QCryptographicHash>
+#include <QFile>
+#include <QRegularExpression>
+#include <QSet>
+#include <QStandardPaths>
+#include <QStringList>
+
+namespace
+{
+static constexpr CacheFile::Format CACHE_FORMAT{0x494D4343, 2}; // "IMCC"
+static constexpr auto MAX_CACHE_FILES{32};
+
+/// \brief Extracts the motherboard identifiers and their trailing comments
+///
+/// \param pContent: Content of boards.h
+/// \return The motherboards
+QList<HardwareCatalog::Entry> ParseMotherboards(const QByteArray& pContent)
+{
+    static const QRegularExpression NUMBER("^\\d+$");
+
+    QList<HardwareCatalog::Entry> entries;
+    for (const auto& define : DefineScanner::Scan(pContent))
+    {
+        if (define.enabled && define.name.startsWith("BOARD_") && NUMBER.match(QString::fromLatin1(define.value)).hasMatch())
+        {
+            const auto description = QString::fromUtf8(define.comment).simplified();
+            entries.append({QString::fromLatin1(define.name), description.isEmpty() ? QString::fromLatin1(define.name) : description});
+        }
+    }
+    return entries;
+}
+
+/// \brief Extracts the stepper driver types, defined as _NAME with a hexadecimal value
+///
+/// \param pContent: Content of drivers.h
+/// \return The driver types
+QList<HardwareCatalog::Entry> ParseDrivers(const QByteArray& pContent)
+{
+    QList<HardwareCatalog::Entry> entries;
+    for (const auto& define : DefineScanner::Scan(pContent))
+    {
+        if (define.enabled && define.name.size() > 1 && define.name.startsWith('_') && define.value.startsWith("0x"))
+        {
+            const auto name = QString::fromLatin1(define.name.mid(1));
+            entries.append({name, name});
+        }
+    }
+    return entries;
+}
+
+/// \brief Extracts the thermistor types from the lookup table includes and their trailing comments
+///
+/// \param pContent: Content of thermistors.h
+/// \return The thermistor types
+QList<HardwareCatalog::Entry> ParseThermistors(const QByteArray& pContent)
+{
+    static const QRegularExpression TABLE_INCLUDE("^\\s*#\\s*(?:el)?if\\s+ANY_THERMISTOR_IS\\((-?\\d+)\\)\\s*(?://\\s*(.*))?$");
+
+    QList<HardwareCatalog::Entry> entries;
+
+    QSet<QString> ids;
+    for (const auto& line : pContent.split('\n'))
+    {
+        const auto match = TABLE_INCLUDE.match(QString::fromUtf8(line));
+        if (match.hasMatch() && !ids.contains(match.captured(1)))
+        {
+            const auto description = match.captured(2).simplified();
+
+            ids.insert(match.captured(1));
+            entries.append({match.captured(1), description.isEmpty() ? QString("Thermistor %0").arg(match.captured(1)) : description});
+        }
+    }
+    return entries;
+}
+}
+
+HardwareCatalog::HardwareCatalog(const QString& pCacheDirectory) :
+    mCacheDirectory(pCacheDirectory)
+{
+    if (mCacheDirectory.isEmpty())
+    {
+        mCacheDirectory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/catalogs";
+    }
+}
+
+std::optional<QList<HardwareCatalog::Entry>> HardwareCatalog::Load(const QString& pWorkspacePath, Kind pKind)
+{
+    mWasCached = false;
+
+    QFile header(pWorkspacePath + "/" + HeaderPath(pKind));
+    if (!header.open(QIODevice::ReadOnly))
+    {
+        return std::nullopt;
+    }
+
+    const auto content = header.readAll();
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArrayLiteral("imc-catalog-v1"));
+    hash.addData(QByteArray::number(static_cast<int>(pKind)));
+    hash.addData(content);
+
+    const auto cachePath = mCacheDirectory + "/" + QString::fromLatin1(hash.result().toHex()) + ".bin";
+
+    if (const auto cached = ReadCache(cachePath); cached.has_value())
+    {
+        mWasCached = true;
+        return cached;
+    }
+
+    const auto entries = Parse(content, pKind);
+    WriteCache(cachePath, entries);
+
+    return entries;
+}
+
+bool HardwareCatalog::WasCached() const
+{
+    return mWasCached;
+}
+
+QString HardwareCatalog::HeaderPath(Kind pKind)
+{
+    switch (pKind)
+    {
+        case Kind::Motherboards:
+        {
+            return "Marlin/src/core/boards.h";
+        }
+        case Kind::Thermistors:
+        {
+            return "Marlin/src/module/thermistor/thermistors.h";
+        }
+        case Kind::Drivers:
+        {
+            return "Marlin/src/core/drivers.h";
+        }
+    }
+    return QString();
+}
+
+QList<HardwareCatalog::Entry> HardwareCatalog::Parse(const QByteArray& pContent, Kind pKind)
+{
+    switch (pKind)
+    {
+        case Kind::Motherboards:
+        {
+            return ParseMotherboards(pContent);
+        }
+        case Kind::Thermistors:
+        {
+            return ParseThermistors(pContent);
+        }
+        case Kind::Drivers:
+        {
+            return ParseDrivers(pContent);
+        }
+    }
+    return {};
+}
+
+std::optional<QList<HardwareCatalog::Entry>> HardwareCatalog::ReadCache(const QString& pPath) const
+{
+    QStringList ids;
+    QStringList descriptions;
+    const auto read = CacheFile::Read(pPath, CACHE_FORMAT, QString(), [&](QDataStream& pStream)
+    {
+        pStream >> ids >> descriptions;
+    });
+
+    if (!read || ids.size() != descriptions.size())
+    {
+        return std::nullopt;
+    }
+
+    QList<Entry> entries;
+    entries.reserve(ids.size());
+    for (qsizetype i = 0; i < ids.size(); ++i)
+    {
+        entries.append({ids[i], descriptions[i]});
+    }
+    return entries;
+}
+
+void HardwareCatalog::WriteCache(const QString& pPath, const QList<Entry>& pEntries) const
+{
+    QStringList ids;
+    QStringList descriptions;
+    for (const auto& entry : pEntries)
+    {
+        ids.append(entry.id);
+        descriptions.append(entry.description);
+    }
+
+    const auto written = CacheFile::Write(pPath, CACHE_FORMAT, QString(), [&](QDataStream& pStream)
+    {
+        pStream << ids << descriptions;
+    });
+
+    // Keep the catalogs of the most recently opened workspaces only
+    if (written)
+    {
+        CacheFile::Prune(mCacheDirectory, "*.bin", MAX_CACHE_FILES);
+    }
+}
@@ -0,0 +1,111 @@
+/*!
+ * \file HardwareCatalog.h
+ * \brief The HardwareCatalog class extracts the hardware catalogs of a Marlin workspace
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef HARDWARECATALOG_H
+#define HARDWARECATALOG_H
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+
+#include <optional>
+
+///
+/// \brief The HardwareCatalog class extracts the hardware catalogs of a Marlin workspace
+///
+/// The motherboards are read from src/core/boards.h, the stepper driver types from
+/// src/core/drivers.h and the thermistor types from the lookup tables included by
+/// src/module/thermistor/thermistors.h. Configuration.h is not used, iMC overwrites it.
+/// Each catalog is stored in a binary index keyed by the hash of its header, so headers
+/// that did not change since the workspace was last opened are not parsed again.
+///
+class HardwareCatalog
+{
+public:
+    /// \brief The catalogs found in a workspace
+    enum class Kind
+    {
+        Motherboards,
+        Thermistors,
+        Drivers
+    };
+
+    /// \brief An item of a catalog
+    struct Entry
+    {
+        QString id;
+        QString description;
+    };
+
+    /// \brief Constructor for HardwareCatalog
+    ///
+    /// \param pCacheDirectory: Root folder of the cache, the user cache location is used if empty
+    explicit HardwareCatalog(const QString& pCacheDirectory = QString());
+
+    /// \brief Loads a catalog of the given workspace from the index or parses its header
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pKind: The catalog to load
+    /// \return The catalog items in order of the header or std::nullopt if the header could not be read
+    std::optional<QList<Entry>> Load(const QString& pWorkspacePath, Kind pKind);
+
+    /// \brief Returns whether the most recently loaded catalog was read from the index
+    ///
+    /// \return \b true, if the header was not parsed
+    bool WasCached(void) const;
+
+    /// \brief Returns the header containing the given catalog
+    ///
+    /// \param pKind: The catalog
+    /// \return The path relative to the Marlin base folder
+    static QString HeaderPath(Kind pKind);
+
+    /// \brief Extracts a catalog from the content of its header
+    ///
+    /// \param pContent: The header content
+    /// \param pKind: The catalog to extract
+    /// \return The catalog items in order of appearance
+    static QList<Entry> Parse(const QByteArray& pContent, Kind pKind);
+
+protected:
+    /// \brief Reads a catalog from the index
+    ///
+    /// \param pPath: Path of the index file
+    /// \return The catalog or std::nullopt if no valid index was found
+    std::optional<QList<Entry>> ReadCache(const QString& pPath) const;
+
+    /// \brief Writes a catalog to the index
+    ///
+    /// \param pPath: Path of the index file
+    /// \param pEntries: The catalog
+    void WriteCache(const QString& pPath, const QList<Entry>& pEntries) const;
+
+protected:
+    QString mCacheDirectory;
+
+    bool mWasCached{false};
+};
+
+#endif // HARDWARECATALOG_H
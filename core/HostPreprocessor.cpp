@@ -0,0 +1,174 @@
+/*!
+ * \file HostPreprocessor.cpp
+ * \brief The HostPreprocessor class runs a host compiler's preprocessor over a Marlin workspace
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "HostPreprocessor.h"
+
+#include <QDir>
+#include <QElapsedTimer>
+#include <QProcess>
+#include <QRegularExpression>
+#include <QStandardPaths>
+
+namespace
+{
+static constexpr auto PREFLIGHT_ENTRY_FILE{"Marlin/src/inc/MarlinConfig.h"};
+
+/// \brief Arguments that make the Marlin headers evaluate on the host
+static const QStringList BASE_ARGUMENTS{"-x", "c++", "-std=gnu++17", "-E", "-dM", "-D__PLAT_NATIVE_SIM__"};
+}
+
+HostPreprocessor::HostPreprocessor(const QString& pWorkspacePath) :
+    mWorkspacePath(pWorkspacePath)
+{
+}
+
+std::optional<QString> HostPreprocessor::FindCompiler()
+{
+    for (const auto& name : {"g++", "clang++", "c++"})
+    {
+        const auto path = QStandardPaths::findExecutable(name);
+        if (!path.isEmpty())
+        {
+            return path;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<HostPreprocessor::Result> HostPreprocessor::DumpMacros(const QString& pEntryFile, const QStringList& pArguments, int32_t pTimeoutMs) const
+{
+    const auto compiler = FindCompiler();
+    if (!compiler.has_value())
+    {
+        return std::nullopt;
+    }
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QProcess process;
+    process.setWorkingDirectory(mWorkspacePath);
+    process.start(compiler.value(), BASE_ARGUMENTS + pArguments + QStringList{pEntryFile});
+
+    if (!process.waitForStarted())
+    {
+        return std::nullopt;
+    }
+
+    Result result;
+
+    if (!process.waitForFinished(pTimeoutMs))
+    {
+        process.kill();
+        process.waitForFinished();
+    }
+    else if (process.exitStatus() == QProcess::NormalExit)
+    {
+        result.exitCode = process.exitCode();
+    }
+
+    result.output = process.readAllStandardOutput();
+    result.diagnostics = ParseDiagnostics(process.readAllStandardError());
+    result.elapsedMs = timer.elapsed();
+
+    return result;
+}
+
+std::optional<HostPreprocessor::PreflightReport> HostPreprocessor::RunPreflight() const
+{
+    const auto result = DumpMacros(PREFLIGHT_ENTRY_FILE);
+    if (!result.has_value())
+    {
+        return std::nullopt;
+    }
+
+    PreflightReport report;
+    report.elapsedMs = result->elapsedMs;
+
+    // A crash, timeout or missing header stops the preprocessor before the sanity checks
+    report.conclusive = result->exitCode >= 0;
+
+    for (const auto& diagnostic : result->diagnostics)
+    {
+        if (diagnostic.isFatal)
+        {
+            report.conclusive = false;
+        }
+
+        if (IsTargetSpecific(diagnostic))
+        {
+            continue;
+        }
+
+        if (diagnostic.isError)
+        {
+            report.errors.append(diagnostic);
+        }
+        else if (diagnostic.message.contains("redefined"))
+        {
+            report.conflicts.append(diagnostic);
+        }
+    }
+
+    if (report.conclusive)
+    {
+        report.macros = result->output;
+    }
+
+    return report;
+}
+
+QList<HostPreprocessor::Diagnostic> HostPreprocessor::ParseDiagnostics(const QByteArray& pOutput)
+{
+    // e.g. Marlin/src/inc/SanityCheck.h:123:4: error: #error "Message"
+    static const QRegularExpression expression(R"(^(.+?):(\d+):(?:\d+:)?\s*(fatal error|error|warning):\s*(.*)$)");
+
+    QList<Diagnostic> diagnostics;
+
+    for (const auto& line : QString::fromUtf8(pOutput).split('\n'))
+    {
+        const auto match = expression.match(line.trimmed());
+        if (!match.hasMatch())
+        {
+            continue;
+        }
+
+        Diagnostic diagnostic;
+        diagnostic.file = QDir::fromNativeSeparators(match.captured(1));
+        diagnostic.line = match.captured(2).toInt();
+        diagnostic.isFatal = match.captured(3) == "fatal error";
+        diagnostic.isError = diagnostic.isFatal || match.captured(3) == "error";
+        diagnostic.message = match.captured(4);
+
+        diagnostics.append(diagnostic);
+    }
+
+    return diagnostics;
+}
+
+bool HostPreprocessor::IsTargetSpecific(const Diagnostic& pDiagnostic)
+{
+    return pDiagnostic.file.contains("src/HAL/") || pDiagnostic.file.contains("src/pins/");
+}
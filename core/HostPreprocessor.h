@@ -0,0 +1,116 @@
+/*!
+ * \file HostPreprocessor.h
+ * \brief The HostPreprocessor class runs a host compiler's preprocessor over a Marlin workspace
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef HOSTPREPROCESSOR_H
+#define HOSTPREPROCESSOR_H
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+#include <optional>
+
+///
+/// \brief The HostPreprocessor class runs a host compiler's preprocessor over a Marlin workspace
+///
+/// Marlin's native simulator HAL is selected, so the configuration headers, conditionals and
+/// sanity checks are evaluated without the cross toolchain of the target board.
+///
+class HostPreprocessor
+{
+public:
+    /// \brief A compiler diagnostic
+    struct Diagnostic
+    {
+        QString file;
+        int32_t line{0};
+        bool isError{false};
+        bool isFatal{false};
+        QString message;
+    };
+
+    /// \brief The outputs of a preprocessor run
+    struct Result
+    {
+        int32_t exitCode{-1};
+        QByteArray output;
+        QList<Diagnostic> diagnostics;
+        qint64 elapsedMs{0};
+    };
+
+    /// \brief Sanity check results relevant for the configuration
+    struct PreflightReport
+    {
+        bool conclusive{true};
+        QList<Diagnostic> errors;
+        QList<Diagnostic> conflicts;
+        QByteArray macros;
+        qint64 elapsedMs{0};
+    };
+
+    /// \brief Constructor for HostPreprocessor
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    explicit HostPreprocessor(const QString& pWorkspacePath);
+
+    /// \brief Searches the PATH for a host C++ compiler
+    ///
+    /// \return The path of the compiler, if found
+    static std::optional<QString> FindCompiler(void);
+
+    /// \brief Preprocesses the given file and dumps all macro definitions
+    ///
+    /// \param pEntryFile: Path of the file to preprocess
+    /// \param pArguments: Additional compiler arguments, e.g. include paths
+    /// \param pTimeoutMs: Time after which the compiler is killed
+    /// \return The result or std::nullopt if no compiler could be started
+    std::optional<Result> DumpMacros(const QString& pEntryFile, const QStringList& pArguments = QStringList(), int32_t pTimeoutMs = 10000) const;
+
+    /// \brief Runs the include chain of MarlinCore with the workspace configuration
+    ///
+    /// \return The report or std::nullopt if no compiler could be started
+    std::optional<PreflightReport> RunPreflight(void) const;
+
+    /// \brief Parses GCC/Clang style diagnostics
+    ///
+    /// \param pOutput: The standard error output of the compiler
+    /// \return The parsed diagnostics
+    static QList<Diagnostic> ParseDiagnostics(const QByteArray& pOutput);
+
+    /// \brief Checks if a diagnostic stems from the HAL or pins headers
+    ///
+    /// These checks verify the selected board against the compiler target and
+    /// always fail on the host, so they are not reported by the preflight.
+    ///
+    /// \param pDiagnostic: The diagnostic to check
+    /// \return \b true, if the diagnostic is specific to the build target
+    static bool IsTargetSpecific(const Diagnostic& pDiagnostic);
+
+protected:
+    QString mWorkspacePath;
+};
+
+#endif // HOSTPREPROCESSOR_H
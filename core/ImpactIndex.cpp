@@ -0,0 +1,774 @@
+/*!
+ * \file ImpactIndex.cpp
+ * \brief The ImpactIndex class maps configuration macros to the Marlin sources referencing them
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ImpactIndex.h"
+#include "CacheFile.h"
+#include "DefineScanner.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QStandardPaths>
+#include <QVector>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+static constexpr CacheFile::Format CACHE_FORMAT{0x494D4349, 1}; // "IMCI"
+static constexpr auto MAX_CACHE_FILES{8};
+static constexpr auto CONFIGURATION_CHAIN_PREFIX{"inc/"};
+static const QStringList SOURCE_NAME_FILTERS{"*.c", "*.cpp", "*.h", "*.hpp"};
+
+/// \brief Macros referenced and files included by a source file
+struct FileScan
+{
+    std::vector<int32_t> macros;
+    QStringList includes;
+};
+
+inline bool IsIdentifierStart(const char pChar)
+{
+    return (pChar >= 'a' && pChar <= 'z') || (pChar >= 'A' && pChar <= 'Z') || pChar == '_';
+}
+
+inline bool IsIdentifierChar(const char pChar)
+{
+    return IsIdentifierStart(pChar) || (pChar >= '0' && pChar <= '9');
+}
+
+/// \brief Returns the position after the next occurence of the given character, bounded by the line end
+///
+/// \param pBegin: Position to start searching at
+/// \param pEnd: End of the data
+/// \param pDelimiter: The character to find
+/// \return Position after the delimiter or of the line end
+const char* SkipLiteral(const char* pBegin, const char* pEnd, const char pDelimiter)
+{
+    for (auto position = pBegin; position < pEnd; ++position)
+    {
+        if (*position == '\\')
+        {
+            ++position;
+        }
+        else if (*position == pDelimiter)
+        {
+            return position + 1;
+        }
+        else if (*position == '\n')
+        {
+            return position;
+        }
+    }
+    return pEnd;
+}
+
+/// \brief Tokenizes a source file and collects the referenced macros and included files
+///
+/// Comments and literals are skipped, so that only code references are found.
+///
+/// \param pData: The file content
+/// \param pSize: The size of the file content
+/// \param pMacroIds: Maps macro names to their indices
+/// \return The scan result
+FileScan ScanSource(const char* pData, const qint64 pSize, const QHash<QByteArray, int32_t>& pMacroIds)
+{
+    FileScan scan;
+    std::vector<bool> found(pMacroIds.size(), false);
+
+    const auto end = pData + pSize;
+    auto position = pData;
+
+    while (position < end)
+    {
+        const auto current = *position;
+        const auto next = (position + 1 < end) ? position[1] : '\0';
+
+        if (current == '/' && next == '/')
+        {
+            const auto lineEnd = static_cast<const char*>(std::memchr(position, '\n', end - position));
+            position = (nullptr != lineEnd) ? lineEnd : end;
+        }
+        else if (current == '/' && next == '*')
+        {
+            position += 2;
+            while (position + 1 < end && !(position[0] == '*' && position[1] == '/'))
+            {
+                ++position;
+            }
+            position += 2;
+        }
+        else if (current == '"' || current == '\'')
+        {
+            position = SkipLiteral(position + 1, end, current);
+        }
+        else if (current == '#')
+        {
+            auto directive = position + 1;
+            while (directive < end && (*directive == ' ' || *directive == '\t'))
+            {
+                ++directive;
+            }
+
+            if (end - directive > 7 && std::memcmp(directive, "include", 7) == 0)
+            {
+                directive += 7;
+                while (directive < end && (*directive == ' ' || *directive == '\t'))
+                {
+                    ++directive;
+                }
+
+                if (directive < end && *directive == '"')
+                {
+                    const auto pathEnd = SkipLiteral(directive + 1, end, '"');
+                    if (pathEnd - directive >= 2 && *(pathEnd - 1) == '"')
+                    {
+                        scan.includes.append(QString::fromUtf8(directive + 1, pathEnd - directive - 2));
+                    }
+                    position = pathEnd;
+                    continue;
+                }
+            }
+            ++position;
+        }
+        else if (IsIdentifierStart(current))
+        {
+            const auto start = position;
+            while (position < end && IsIdentifierChar(*position))
+            {
+                ++position;
+            }
+
+            const auto it = pMacroIds.constFind(QByteArray::fromRawData(start, position - start));
+            if (it != pMacroIds.cend() && !found[it.value()])
+            {
+                found[it.value()] = true;
+                scan.macros.push_back(it.value());
+            }
+        }
+        else if (IsIdentifierChar(current))
+        {
+            // Skip numbers, so that suffixes and hex digits are not taken for identifiers
+            while (position < end && IsIdentifierChar(*position))
+            {
+                ++position;
+            }
+        }
+        else
+        {
+            ++position;
+        }
+    }
+
+    return scan;
+}
+
+/// \brief Removes comments from preprocessor code, keeping literals and line breaks
+///
+/// \param pContent: The file content
+/// \return The content without comments
+QByteArray StripComments(const QByteArray& pContent)
+{
+    QByteArray code;
+    code.reserve(pContent.size());
+
+    const auto end = pContent.constData() + pContent.size();
+    auto position = pContent.constData();
+
+    while (position < end)
+    {
+        const auto current = *position;
+        const auto next = (position + 1 < end) ? position[1] : '\0';
+
+        if (current == '/' && next == '/')
+        {
+            while (position < end && *position != '\n')
+            {
+                ++position;
+            }
+        }
+        else if (current == '/' && next == '*')
+        {
+            position += 2;
+            while (position + 1 < end && !(position[0] == '*' && position[1] == '/'))
+            {
+                if (*position == '\n')
+                {
+                    code.append('\n');
+                }
+                ++position;
+            }
+            position += 2;
+            code.append(' ');
+        }
+        else if (current == '"' || current == '\'')
+        {
+            const auto literalEnd = SkipLiteral(position + 1, end, current);
+            code.append(position, literalEnd - position);
+            position = literalEnd;
+        }
+        else
+        {
+            code.append(current);
+            ++position;
+        }
+    }
+
+    return code;
+}
+
+/// \brief Collects the identifiers of preprocessor code, skipping numbers and literals
+///
+/// \param pCode: The code
+/// \param pIdentifiers: Receives the identifiers
+void CollectIdentifiers(const QByteArray& pCode, QSet<QByteArray>& pIdentifiers)
+{
+    const auto end = pCode.constData() + pCode.size();
+    auto position = pCode.constData();
+
+    while (position < end)
+    {
+        if (*position == '"' || *position == '\'')
+        {
+            position = SkipLiteral(position + 1, end, *position);
+        }
+        else if (IsIdentifierChar(*position))
+        {
+            const auto start = position;
+            while (position < end && IsIdentifierChar(*position))
+            {
+                ++position;
+            }
+
+            if (IsIdentifierStart(*start))
+            {
+                pIdentifiers.insert(QByteArray(start, position - start));
+            }
+        }
+        else
+        {
+            ++position;
+        }
+    }
+}
+
+/// \brief Collects the macros defined in a header of the configuration chain
+///
+/// A defined or undefined macro depends on the identifiers in its definition and in the
+/// conditions of all enclosing #if, #ifdef, #ifndef and preceding #elif directives.
+///
+/// \param pContent: The header content
+/// \param pDerivations: Maps the defined macros to the identifiers they depend on
+void ScanDerivations(const QByteArray& pContent, QHash<QByteArray, QSet<QByteArray>>& pDerivations)
+{
+    QVector<QSet<QByteArray>> conditions;
+    QByteArray directive;
+
+    for (const auto& line : StripComments(pContent).split('\n'))
+    {
+        // Continued lines form one directive
+        directive += line.trimmed();
+        if (directive.endsWith('\\'))
+        {
+            directive.chop(1);
+            directive += ' ';
+            continue;
+        }
+
+        const auto text = directive;
+        directive.clear();
+
+        if (!text.startsWith('#'))
+        {
+            continue;
+        }
+
+        const auto body = text.mid(1).trimmed();
+        auto nameEnd = 0;
+        while (nameEnd < body.size() && IsIdentifierChar(body.at(nameEnd)))
+        {
+            ++nameEnd;
+        }
+        const auto keyword = body.left(nameEnd);
+        const auto arguments = body.mid(nameEnd).trimmed();
+
+        if (keyword == "if" || keyword == "ifdef" || keyword == "ifndef")
+        {
+            conditions.append(QSet<QByteArray>());
+            CollectIdentifiers(arguments, conditions.last());
+        }
+        else if (keyword == "elif" && !conditions.isEmpty())
+        {
+            CollectIdentifiers(arguments, conditions.last());
+        }
+        else if (keyword == "endif" && !conditions.isEmpty())
+        {
+            conditions.removeLast();
+        }
+        else if (keyword == "define" || keyword == "undef")
+        {
+            auto macroEnd = 0;
+            while (macroEnd < arguments.size() && IsIdentifierChar(arguments.at(macroEnd)))
+            {
+                ++macroEnd;
+            }
+            const auto macro = arguments.left(macroEnd);
+            if (macro.isEmpty())
+            {
+                continue;
+            }
+
+            auto& dependencies = pDerivations[macro];
+            CollectIdentifiers(arguments.mid(macroEnd), dependencies);
+            for (const auto& condition : conditions)
+            {
+                dependencies.unite(condition);
+            }
+            dependencies.remove(macro);
+        }
+    }
+}
+
+/// \brief State of the chain macro resolution
+struct DerivationResolution
+{
+    QHash<QByteArray, QSet<int32_t>> resolved; ///< Completely resolved chain macros
+    QHash<QByteArray, int32_t> open; ///< Chain macros being resolved and their depth in the chain
+    QVector<QByteArray> pending; ///< Resolved while a cycle through an open chain macro was not closed yet
+};
+
+/// \brief Resolves the configuration macros a chain macro depends on, following other chain macros
+///
+/// A chain macro reached again while it is open ends the cycle. The macros resolved inside the cycle miss
+/// the dependencies of the open one, so they are only stored once the cycle is closed, with the result of
+/// the macro that closed it: macros on a common cycle depend on the same configuration macros.
+///
+/// \param pName: The chain macro
+/// \param pDerivations: The chain macros and the identifiers they depend on
+/// \param pMacroIds: Maps the configuration macro names to their indices
+/// \param pResolution: The resolution state, shared by all calls
+/// \param pLowestOpen: Lowered to the depth of the outermost open chain macro the result depends on
+/// \return Indices of the configuration macros
+QSet<int32_t> ResolveDerivation(const QByteArray& pName, const QHash<QByteArray, QSet<QByteArray>>& pDerivations,
+                                const QHash<QByteArray, int32_t>& pMacroIds, DerivationResolution& pResolution, int32_t& pLowestOpen)
+{
+    const auto resolved = pResolution.resolved.constFind(pName);
+    if (resolved != pResolution.resolved.cend())
+    {
+        return resolved.value();
+    }
+
+    const auto open = pResolution.open.constFind(pName);
+    if (open != pResolution.open.cend())
+    {
+        pLowestOpen = std::min(pLowestOpen, open.value());
+        return QSet<int32_t>();
+    }
+
+    const auto depth = static_cast<int32_t>(pResolution.open.size());
+    const auto pendingStart = pResolution.pending.size();
+    pResolution.open.insert(pName, depth);
+
+    auto lowestOpen = depth;
+    QSet<int32_t> macros;
+    for (const auto& identifier : pDerivations.value(pName))
+    {
+        const auto macro = pMacroIds.constFind(identifier);
+        if (macro != pMacroIds.cend())
+        {
+            macros.insert(macro.value());
+        }
+
+        if (pDerivations.contains(identifier))
+        {
+            macros.unite(ResolveDerivation(identifier, pDerivations, pMacroIds, pResolution, lowestOpen));
+        }
+    }
+
+    pResolution.open.remove(pName);
+
+    if (lowestOpen < depth)
+    {
+        pResolution.pending.append(pName);
+        pLowestOpen = std::min(pLowestOpen, lowestOpen);
+        return macros;
+    }
+
+    for (auto i = pendingStart; i < pResolution.pending.size(); ++i)
+    {
+        pResolution.resolved.insert(pResolution.pending.at(i), macros);
+    }
+    pResolution.pending.resize(pendingStart);
+    pResolution.resolved.insert(pName, macros);
+    return macros;
+}
+
+/// \brief Lists all source files of the workspace
+///
+/// \param pSourcePath: Path to Marlin/src
+/// \return Paths relative to Marlin/src, sorted
+QStringList ListSources(const QString& pSourcePath)
+{
+    const QDir sourceDir(pSourcePath);
+    QStringList sources;
+
+    QDirIterator iterator(pSourcePath, SOURCE_NAME_FILTERS, QDir::Files, QDirIterator::Subdirectories);
+    while (iterator.hasNext())
+    {
+        sources.append(sourceDir.relativeFilePath(iterator.next()));
+    }
+
+    sources.sort();
+    return sources;
+}
+
+/// \brief Computes the fingerprint of the source tree and the macro set
+///
+/// \param pSourcePath: Path to Marlin/src
+/// \param pSources: The source files relative to pSourcePath
+/// \param pMacroNames: The indexed macros
+/// \return The fingerprint as a hex string
+QString ComputeKey(const QString& pSourcePath, const QStringList& pSources, const QSet<QString>& pMacroNames)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArrayLiteral("imc-impact-v3"));
+
+    auto macroNames = pMacroNames.values();
+    macroNames.sort();
+    hash.addData(macroNames.join('\n').toUtf8());
+
+    for (const auto& source : pSources)
+    {
+        const QFileInfo info(pSourcePath + "/" + source);
+        hash.addData(QString("%0:%1:%2\n").arg(source).arg(info.size()).arg(info.lastModified().toMSecsSinceEpoch()).toUtf8());
+    }
+
+    return QString::fromLatin1(hash.result().toHex());
+}
+
+bool IsTranslationUnit(const QString& pPath)
+{
+    return pPath.endsWith(".cpp") || pPath.endsWith(".c");
+}
+}
+
+ImpactIndex::ImpactIndex(const QString& pCacheDirectory) :
+    mCacheDirectory(pCacheDirectory)
+{
+    if (mCacheDirectory.isEmpty())
+    {
+        mCacheDirectory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/impact";
+    }
+}
+
+bool ImpactIndex::Load(const QString& pWorkspacePath, const QSet<QString>& pMacroNames)
+{
+    mIsReady = false;
+
+    const auto sourcePath = pWorkspacePath + "/Marlin/src";
+    if (!QDir(sourcePath).exists())
+    {
+        return false;
+    }
+
+    const auto key = ComputeKey(sourcePath, ListSources(sourcePath), pMacroNames);
+    const auto cachePath = mCacheDirectory + "/" + key + ".idx";
+
+    if (ReadCache(cachePath, key))
+    {
+        mIsReady = true;
+        return true;
+    }
+
+    if (!Build(pWorkspacePath, pMacroNames))
+    {
+        return false;
+    }
+
+    WriteCache(cachePath, key);
+
+    mIsReady = true;
+    return true;
+}
+
+bool ImpactIndex::IsReady() const
+{
+    return mIsReady;
+}
+
+int32_t ImpactIndex::TranslationUnitCount() const
+{
+    return mTranslationUnits.size();
+}
+
+QStringList ImpactIndex::AffectedTranslationUnits(const QSet<QString>& pMacroNames) const
+{
+    QSet<int32_t> units;
+    for (const auto& name : pMacroNames)
+    {
+        for (const auto unit : mTranslationUnitsByMacro.value(name))
+        {
+            units.insert(unit);
+        }
+    }
+
+    QStringList paths;
+    for (const auto unit : units)
+    {
+        paths.append(mTranslationUnits[unit]);
+    }
+
+    paths.sort();
+    return paths;
+}
+
+QSet<QString> ImpactIndex::ExtractMacroNames(const QStringList& pLines)
+{
+    QSet<QString> names;
+    for (const auto& define : DefineScanner::Scan(pLines.join('\n').toUtf8()))
+    {
+        names.insert(QString::fromUtf8(define.name));
+    }
+    return names;
+}
+
+QHash<QString, QString> ImpactIndex::ExtractDefines(const QStringList& pLines)
+{
+    QHash<QString, QString> defines;
+    for (const auto& define : DefineScanner::Scan(pLines.join('\n').toUtf8()))
+    {
+        if (define.enabled)
+        {
+            defines.insert(QString::fromUtf8(define.name), QString::fromUtf8(define.value).simplified());
+        }
+    }
+    return defines;
+}
+
+bool ImpactIndex::Build(const QString& pWorkspacePath, const QSet<QString>& pMacroNames)
+{
+    const auto sourcePath = pWorkspacePath + "/Marlin/src";
+    const auto sources = ListSources(sourcePath);
+
+    QHash<QByteArray, int32_t> macroIds;
+    QStringList macroNames;
+    for (const auto& name : pMacroNames)
+    {
+        macroIds.insert(name.toLatin1(), macroNames.size());
+        macroNames.append(name);
+    }
+
+    // Macros of the configuration chain are attributed to the configuration macros they derive from
+    QHash<QByteArray, QSet<QByteArray>> derivations;
+    for (const auto& source : sources)
+    {
+        if (!source.startsWith(CONFIGURATION_CHAIN_PREFIX))
+        {
+            continue;
+        }
+
+        QFile file(sourcePath + "/" + source);
+        if (file.open(QIODevice::ReadOnly))
+        {
+            ScanDerivations(file.readAll(), derivations);
+        }
+    }
+
+    const auto configurationMacroIds = macroIds;
+    DerivationResolution resolution;
+    std::vector<std::vector<int32_t>> attribution(macroNames.size());
+
+    for (auto i = 0; i < macroNames.size(); ++i)
+    {
+        attribution[i].push_back(i);
+    }
+
+    for (auto derivation = derivations.cbegin(); derivation != derivations.cend(); ++derivation)
+    {
+        int32_t lowestOpen{0};
+        const auto macros = ResolveDerivation(derivation.key(), derivations, configurationMacroIds, resolution, lowestOpen);
+        if (macros.isEmpty())
+        {
+            continue;
+        }
+
+        auto id = macroIds.constFind(derivation.key());
+        if (id == macroIds.cend())
+        {
+            id = macroIds.insert(derivation.key(), static_cast<int32_t>(attribution.size()));
+            attribution.emplace_back();
+        }
+
+        for (const auto macro : macros)
+        {
+            if (macro != id.value())
+            {
+                attribution[id.value()].push_back(macro);
+            }
+        }
+    }
+
+    // Scan all files in parallel, each worker takes the next unscanned file
+    std::vector<FileScan> scans(sources.size());
+    std::atomic<int32_t> nextFile{0};
+
+    const auto worker = [&](){
+        for (auto i = nextFile++; i < sources.size(); i = nextFile++)
+        {
+            QFile file(sourcePath + "/" + sources[i]);
+            if (!file.open(QIODevice::ReadOnly) || file.size() == 0)
+            {
+                continue;
+            }
+
+            const auto data = file.map(0, file.size());
+            if (nullptr != data)
+            {
+                scans[i] = ScanSource(reinterpret_cast<const char*>(data), file.size(), macroIds);
+                file.unmap(data);
+            }
+            else
+            {
+                const auto content = file.readAll();
+                scans[i] = ScanSource(content.constData(), content.size(), macroIds);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const auto threadCount = std::max(1u, std::thread::hardware_concurrency());
+    for (auto i = 0u; i < threadCount; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Resolve quoted includes relative to the including file, then to Marlin/src
+    QHash<QString, int32_t> fileIds;
+    for (auto i = 0; i < sources.size(); ++i)
+    {
+        fileIds.insert(sources[i], i);
+    }
+
+    std::vector<std::vector<int32_t>> includes(sources.size());
+    for (auto i = 0; i < sources.size(); ++i)
+    {
+        const auto directory = QFileInfo(sources[i]).path();
+        for (const auto& include : scans[i].includes)
+        {
+            auto it = fileIds.constFind(QDir::cleanPath(directory + "/" + include));
+            if (it == fileIds.cend())
+            {
+                it = fileIds.constFind(QDir::cleanPath(include));
+            }
+
+            if (it != fileIds.cend() && !sources[it.value()].startsWith(CONFIGURATION_CHAIN_PREFIX))
+            {
+                includes[i].push_back(it.value());
+            }
+        }
+    }
+
+    // Collect the macros of each translation unit and its transitive includes
+    mTranslationUnits.clear();
+    mTranslationUnitsByMacro.clear();
+
+    std::vector<int32_t> visited(sources.size(), -1);
+    std::vector<int32_t> usedBy(macroNames.size(), -1);
+
+    for (auto i = 0; i < sources.size(); ++i)
+    {
+        if (!IsTranslationUnit(sources[i]))
+        {
+            continue;
+        }
+
+        const auto unit = static_cast<int32_t>(mTranslationUnits.size());
+        mTranslationUnits.append(sources[i]);
+
+        std::vector<int32_t> pending{i};
+        visited[i] = unit;
+
+        while (!pending.empty())
+        {
+            const auto file = pending.back();
+            pending.pop_back();
+
+            for (const auto macro : scans[file].macros)
+            {
+                for (const auto attributed : attribution[macro])
+                {
+                    if (usedBy[attributed] != unit)
+                    {
+                        usedBy[attributed] = unit;
+                        mTranslationUnitsByMacro[macroNames[attributed]].append(unit);
+                    }
+                }
+            }
+
+            for (const auto include : includes[file])
+            {
+                if (visited[include] != unit)
+                {
+                    visited[include] = unit;
+                    pending.push_back(include);
+                }
+            }
+        }
+    }
+
+    return !mTranslationUnits.isEmpty();
+}
+
+bool ImpactIndex::ReadCache(const QString& pPath, const QString& pKey)
+{
+    return CacheFile::Read(pPath, CACHE_FORMAT, pKey, [this](QDataStream& pStream)
+    {
+        pStream >> mTranslationUnits >> mTranslationUnitsByMacro;
+    });
+}
+
+void ImpactIndex::WriteCache(const QString& pPath, const QString& pKey) const
+{
+    const auto written = CacheFile::Write(pPath, CACHE_FORMAT, pKey, [this](QDataStream& pStream)
+    {
+        pStream << mTranslationUnits << mTranslationUnitsByMacro;
+    });
+
+    // Keep the indices of the most recently used source trees only
+    if (written)
+    {
+        CacheFile::Prune(mCacheDirectory, "*.idx", MAX_CACHE_FILES);
+    }
+}
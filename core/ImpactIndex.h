@@ -0,0 +1,120 @@
+/*!
+ * \file ImpactIndex.h
+ * \brief The ImpactIndex class maps configuration macros to the Marlin sources referencing them
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef IMPACTINDEX_H
+#define IMPACTINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+///
+/// \brief The ImpactIndex class maps configuration macros to the Marlin sources referencing them
+///
+/// All files of Marlin/src are scanned in parallel for the given macro names. A translation unit
+/// depends on a macro if the macro is referenced in the unit itself or in one of the headers it
+/// includes, except for the configuration include chain in src/inc that every unit includes.
+/// Macros defined in the chain, e.g. HAS_HEATED_BED in Conditionals_post.h, are expanded instead:
+/// a reference to them counts as a reference to every configuration macro in their definitions
+/// and in the conditions of the #if blocks around them, followed through other derived macros.
+/// This approximates the units whose preprocessed output changes, i.e. the units a compiler cache
+/// has to recompile. The index is cached on disk per source tree and macro set.
+///
+class ImpactIndex
+{
+public:
+    /// \brief Constructor for ImpactIndex
+    ///
+    /// \param pCacheDirectory: Root folder of the cache, the user cache location is used if empty
+    explicit ImpactIndex(const QString& pCacheDirectory = QString());
+
+    /// \brief Loads the index for the given workspace from the cache or builds it
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pMacroNames: The macros to index
+    /// \return \b true, if the index is ready
+    bool Load(const QString& pWorkspacePath, const QSet<QString>& pMacroNames);
+
+    /// \brief Returns whether the index was loaded
+    ///
+    /// \return \b true, if the index is ready
+    bool IsReady(void) const;
+
+    /// \brief Returns the number of translation units in the source tree
+    ///
+    /// \return The number of .c and .cpp files
+    int32_t TranslationUnitCount(void) const;
+
+    /// \brief Collects the translation units depending on any of the given macros
+    ///
+    /// \param pMacroNames: The changed macros
+    /// \return Paths of the translation units relative to Marlin/src
+    QStringList AffectedTranslationUnits(const QSet<QString>& pMacroNames) const;
+
+    /// \brief Extracts the names of all enabled and disabled macro definitions
+    ///
+    /// \param pLines: The lines of a configuration header
+    /// \return The macro names
+    static QSet<QString> ExtractMacroNames(const QStringList& pLines);
+
+    /// \brief Extracts all enabled macro definitions
+    ///
+    /// \param pLines: The lines of a configuration header
+    /// \return Maps the macro names to their values without trailing comments
+    static QHash<QString, QString> ExtractDefines(const QStringList& pLines);
+
+protected:
+    /// \brief Scans the source tree and computes the translation units of each macro
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pMacroNames: The macros to index
+    /// \return \b true, if the source tree could be scanned
+    bool Build(const QString& pWorkspacePath, const QSet<QString>& pMacroNames);
+
+    /// \brief Reads the index from the cache file
+    ///
+    /// \param pPath: Path of the cache file
+    /// \param pKey: The expected fingerprint of the inputs
+    /// \return \b true, if a valid index was read
+    bool ReadCache(const QString& pPath, const QString& pKey);
+
+    /// \brief Writes the index to the cache file
+    ///
+    /// \param pPath: Path of the cache file
+    /// \param pKey: The fingerprint of the inputs
+    void WriteCache(const QString& pPath, const QString& pKey) const;
+
+protected:
+    QString mCacheDirectory;
+
+    bool mIsReady{false};
+
+    QStringList mTranslationUnits;
+    QHash<QString, QList<int32_t>> mTranslationUnitsByMacro;
+};
+
+#endif // IMPACTINDEX_H
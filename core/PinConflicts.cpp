@@ -0,0 +1,144 @@
+/*!
+ * \file PinConflicts.cpp
+ * \brief The PinConflicts class tracks features assigned to the same physical pin
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "PinConflicts.h"
+
+#include <algorithm>
+
+namespace
+{
+/// \brief Formats the user of a pin
+///
+/// \param pFeature: The feature
+/// \param pName: The pin name
+/// \return The user, e.g. "Power supply (PS_ON_PIN)"
+QString User(const QString& pFeature, const QString& pName)
+{
+    return QString("%0 (%1)").arg(pFeature, pName);
+}
+}
+
+void PinConflicts::SetClaims(const QString& pFeature, const QHash<QString, QString>& pPins)
+{
+    const auto previous = mClaimsByFeature.value(pFeature);
+    if (previous == pPins)
+    {
+        return;
+    }
+
+    for (auto it = previous.cbegin(); it != previous.cend(); ++it)
+    {
+        auto& claims = mClaimsByPin[it.value()];
+        claims.remove(User(pFeature, it.key()));
+        if (claims.isEmpty())
+        {
+            mClaimsByPin.remove(it.value());
+        }
+        mTouchedPins.insert(it.value());
+    }
+
+    for (auto it = pPins.cbegin(); it != pPins.cend(); ++it)
+    {
+        mClaimsByPin[it.value()].insert(User(pFeature, it.key()), it.key());
+        mTouchedPins.insert(it.value());
+    }
+
+    if (pPins.isEmpty())
+    {
+        mClaimsByFeature.remove(pFeature);
+    }
+    else
+    {
+        mClaimsByFeature.insert(pFeature, pPins);
+    }
+}
+
+void PinConflicts::Clear()
+{
+    for (auto it = mClaimsByPin.cbegin(); it != mClaimsByPin.cend(); ++it)
+    {
+        mTouchedPins.insert(it.key());
+    }
+
+    mClaimsByFeature.clear();
+    mClaimsByPin.clear();
+}
+
+PinConflicts::Changes PinConflicts::TakeChanges()
+{
+    Changes changes;
+
+    for (const auto& pin : std::as_const(mTouchedPins))
+    {
+        Conflict conflict;
+        if (Evaluate(pin, conflict))
+        {
+            const auto known = mConflicts.constFind(pin);
+            if (known == mConflicts.cend() || known.value().users != conflict.users)
+            {
+                changes.added.append(conflict);
+            }
+            mConflicts.insert(pin, conflict);
+        }
+        else if (mConflicts.remove(pin) > 0)
+        {
+            changes.resolved.append(pin);
+        }
+    }
+    mTouchedPins.clear();
+
+    return changes;
+}
+
+QList<PinConflicts::Conflict> PinConflicts::Conflicts() const
+{
+    auto conflicts = mConflicts.values();
+    std::sort(conflicts.begin(), conflicts.end(), [](const Conflict& pLeft, const Conflict& pRight)
+    {
+        return pLeft.pin < pRight.pin;
+    });
+    return conflicts;
+}
+
+bool PinConflicts::Evaluate(const QString& pPin, Conflict& pConflict) const
+{
+    const auto claims = mClaimsByPin.value(pPin);
+
+    QSet<QString> names;
+    for (const auto& name : claims)
+    {
+        names.insert(name);
+    }
+
+    if (names.size() < 2)
+    {
+        return false;
+    }
+
+    pConflict.pin = pPin;
+    pConflict.users = claims.keys();
+    pConflict.users.sort();
+    return true;
+}
@@ -0,0 +1,99 @@
+/*!
+ * \file PinConflicts.h
+ * \brief The PinConflicts class tracks features assigned to the same physical pin
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PINCONFLICTS_H
+#define PINCONFLICTS_H
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+///
+/// \brief The PinConflicts class tracks features assigned to the same physical pin
+///
+/// Each feature, e.g. the filament runout sensor, claims a set of pin names together with
+/// the physical pins they resolve to. A pin is in conflict if it is claimed under two or more
+/// different names; one name shared by several features (e.g. the Z-Min endstop and the
+/// probe on Z_MIN_PIN) is intended and not reported. Only pins whose claims changed since
+/// the last update are re-evaluated.
+///
+class PinConflicts
+{
+public:
+    /// \brief A physical pin used for several purposes
+    struct Conflict
+    {
+        QString pin;
+        QStringList users;
+    };
+
+    /// \brief The conflicts that appeared or disappeared with an update
+    struct Changes
+    {
+        QList<Conflict> added;
+        QStringList resolved;
+    };
+
+    /// \brief Replaces the claims of a feature
+    ///
+    /// \param pFeature: The name of the feature, e.g. "Filament runout sensor"
+    /// \param pPins: Maps the pin names the feature uses to their physical pins
+    void SetClaims(const QString& pFeature, const QHash<QString, QString>& pPins);
+
+    /// \brief Removes all claims
+    void Clear(void);
+
+    /// \brief Evaluates the pins touched since the last call
+    ///
+    /// \return The conflicts that appeared or disappeared
+    Changes TakeChanges(void);
+
+    /// \brief Returns all current conflicts
+    ///
+    /// \return The conflicts, ordered by pin
+    QList<Conflict> Conflicts(void) const;
+
+protected:
+    /// \brief Evaluates the claims of a physical pin
+    ///
+    /// \param pPin: The physical pin
+    /// \param pConflict: Receives the conflict if there is one
+    /// \return \b true, if the pin is claimed under different names
+    bool Evaluate(const QString& pPin, Conflict& pConflict) const;
+
+protected:
+    /// Pin names claimed by each feature
+    QHash<QString, QHash<QString, QString>> mClaimsByFeature;
+
+    /// Users, formatted as "Feature (PIN_NAME)", and pin names claiming each physical pin
+    QHash<QString, QHash<QString, QString>> mClaimsByPin;
+
+    QSet<QString> mTouchedPins;
+    QHash<QString, Conflict> mConflicts;
+};
+
+#endif // PINCONFLICTS_H
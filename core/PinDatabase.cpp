@@ -0,0 +1,301 @@
+/*!
+ * \file PinDatabase.cpp
+ * \brief The PinDatabase class resolves the pin map of a motherboard
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "PinDatabase.h"
+#include "CacheFile.h"
+#include "DefineScanner.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+#include <QStandardPaths>
+
+namespace
+{
+static constexpr CacheFile::Format CACHE_FORMAT{0x494D4350, 1}; // "IMCP"
+static constexpr auto MAX_CACHE_FILES{32};
+static constexpr auto MAX_ALIAS_DEPTH{8};
+static constexpr auto PINS_FOLDER{"Marlin/src/pins"};
+static constexpr auto UNUSED_PIN{"-1"};
+
+/// \brief Computes the fingerprint of the workspace, the motherboard and the state of all pins files
+///
+/// \param pPinsPath: Path to src/pins
+/// \param pBoard: The motherboard name
+/// \return The fingerprint as a hex string
+QString ComputeKey(const QString& pPinsPath, const QString& pBoard)
+{
+    QStringList files;
+    QDirIterator it(pPinsPath, QStringList{"*.h"}, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext())
+    {
+        const auto path = it.next();
+        const auto info = it.fileInfo();
+        files.append(QString("%0:%1:%2").arg(path).arg(info.size()).arg(info.lastModified().toMSecsSinceEpoch()));
+    }
+    files.sort();
+
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    hash.addData(QByteArrayLiteral("imc-pins-v1"));
+    hash.addData(QDir(pPinsPath).absolutePath().toUtf8());
+    hash.addData(pBoard.toUtf8());
+    hash.addData(files.join('\n').toUtf8());
+
+    return QString::fromLatin1(hash.result().toHex());
+}
+}
+
+PinDatabase::PinDatabase(const QString& pCacheDirectory) :
+    mCacheDirectory(pCacheDirectory)
+{
+    if (mCacheDirectory.isEmpty())
+    {
+        mCacheDirectory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/pins";
+    }
+}
+
+bool PinDatabase::Load(const QString& pWorkspacePath, const QString& pBoard)
+{
+    mIsReady = false;
+    mSource = QString("%0:%1").arg(pWorkspacePath, pBoard);
+    mPinsFile.clear();
+    mPins.clear();
+
+    const auto pinsPath = QString("%0/%1").arg(pWorkspacePath, PINS_FOLDER);
+
+    QFile pinsHeader(pinsPath + "/pins.h");
+    if (!pinsHeader.open(QIODevice::ReadOnly | QIODevice::Text))
+    {
+        return false;
+    }
+
+    const auto key = ComputeKey(pinsPath, pBoard);
+    const auto cachePath = mCacheDirectory + "/" + key + ".pins";
+
+    if (ReadCache(cachePath, key))
+    {
+        mIsReady = true;
+        return true;
+    }
+
+    mPinsFile.clear();
+    mPins.clear();
+
+    const auto pinsFile = FindPinsFile(QString::fromUtf8(pinsHeader.readAll()).split('\n'), pBoard);
+    if (!pinsFile.has_value())
+    {
+        return false;
+    }
+
+    QSet<QString> visited;
+    QHash<QString, QString> definitions;
+    Collect(pinsPath + "/" + pinsFile.value(), pinsPath, visited, definitions);
+
+    mPinsFile = pinsFile.value();
+    mPins = Resolve(definitions);
+
+    WriteCache(cachePath, key);
+
+    mIsReady = true;
+    return true;
+}
+
+bool PinDatabase::IsReady() const
+{
+    return mIsReady;
+}
+
+QString PinDatabase::Source() const
+{
+    return mSource;
+}
+
+QString PinDatabase::PinsFile() const
+{
+    return mPinsFile;
+}
+
+QString PinDatabase::Pin(const QString& pName) const
+{
+    return mPins.value(pName);
+}
+
+QHash<QString, QString> PinDatabase::Pins() const
+{
+    return mPins;
+}
+
+std::optional<QString> PinDatabase::FindPinsFile(const QStringList& pLines, const QString& pBoard)
+{
+    static const QRegularExpression BOARD_CONDITION("^\\s*#\\s*(?:el)?if\\s+MB\\(([^)]*)\\)");
+    static const QRegularExpression INCLUDE("^\\s*#\\s*include\\s+\"([^\"]+)\"");
+
+    bool selected = false;
+    for (const auto& line : pLines)
+    {
+        if (const auto match = BOARD_CONDITION.match(line); match.hasMatch())
+        {
+            selected = false;
+            for (const auto& board : match.captured(1).split(','))
+            {
+                if ("BOARD_" + board.trimmed() == pBoard)
+                {
+                    selected = true;
+                }
+            }
+        }
+        else if (selected)
+        {
+            if (const auto match = INCLUDE.match(line); match.hasMatch())
+            {
+                return match.captured(1);
+            }
+        }
+    }
+
+    return std::nullopt;
+}
+
+QHash<QString, QString> PinDatabase::Resolve(const QHash<QString, QString>& pDefinitions)
+{
+    QHash<QString, QString> pins;
+
+    for (auto it = pDefinitions.cbegin(); it != pDefinitions.cend(); ++it)
+    {
+        if (!it.key().endsWith("_PIN"))
+        {
+            continue;
+        }
+
+        auto value = it.value();
+        for (auto depth = 0; depth < MAX_ALIAS_DEPTH && pDefinitions.contains(value); ++depth)
+        {
+            value = pDefinitions.value(value);
+        }
+
+        if (value != UNUSED_PIN)
+        {
+            pins.insert(it.key(), value);
+        }
+    }
+
+    return pins;
+}
+
+void PinDatabase::Collect(const QString& pPath, const QString& pPinsPath, QSet<QString>& pVisited, QHash<QString, QString>& pDefinitions) const
+{
+    static const QRegularExpression INCLUDE("^\\s*#\\s*include\\s+\"([^\"]+)\"");
+
+    const auto canonicalPath = QFileInfo(pPath).canonicalFilePath();
+    if (canonicalPath.isEmpty() || pVisited.contains(canonicalPath))
+    {
+        return;
+    }
+    pVisited.insert(canonicalPath);
+
+    QFile file(canonicalPath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return;
+    }
+
+    const auto content = file.readAll();
+    const auto defines = DefineScanner::Scan(content);
+
+    const auto addDefinition = [&](const DefineScanner::Define& pDefine)
+    {
+        const auto name = QString::fromLatin1(pDefine.name);
+        if (pDefine.enabled && !pDefine.value.isEmpty() && !pDefinitions.contains(name))
+        {
+            pDefinitions.insert(name, QString::fromLatin1(pDefine.value));
+        }
+    };
+
+    // Definitions and includes are processed in order of appearance, so that guarded defaults
+    // in included files do not override the board's own definitions
+    const auto pinsRoot = QFileInfo(pPinsPath).canonicalFilePath();
+    const auto directory = QFileInfo(canonicalPath).absolutePath();
+
+    qsizetype nextDefine = 0;
+    int32_t line = 0;
+    for (const auto& text : content.split('\n'))
+    {
+        ++line;
+
+        const auto match = INCLUDE.match(QString::fromUtf8(text));
+        if (!match.hasMatch())
+        {
+            continue;
+        }
+
+        while (nextDefine < defines.size() && defines[nextDefine].line < line)
+        {
+            addDefinition(defines[nextDefine++]);
+        }
+
+        auto include = QFileInfo(directory + "/" + match.captured(1));
+        if (!include.exists())
+        {
+            include = QFileInfo(pPinsPath + "/" + match.captured(1));
+        }
+
+        // Only follow includes within the pins folder
+        if (include.exists() && include.canonicalFilePath().startsWith(pinsRoot))
+        {
+            Collect(include.canonicalFilePath(), pPinsPath, pVisited, pDefinitions);
+        }
+    }
+
+    while (nextDefine < defines.size())
+    {
+        addDefinition(defines[nextDefine++]);
+    }
+}
+
+bool PinDatabase::ReadCache(const QString& pPath, const QString& pKey)
+{
+    return CacheFile::Read(pPath, CACHE_FORMAT, pKey, [this](QDataStream& pStream)
+    {
+        pStream >> mPinsFile >> mPins;
+    });
+}
+
+void PinDatabase::WriteCache(const QString& pPath, const QString& pKey) const
+{
+    const auto written = CacheFile::Write(pPath, CACHE_FORMAT, pKey, [this](QDataStream& pStream)
+    {
+        pStream << mPinsFile << mPins;
+    });
+
+    // Keep the pin maps of the most recently used motherboards only
+    if (written)
+    {
+        CacheFile::Prune(mCacheDirectory, "*.pins", MAX_CACHE_FILES);
+    }
+}
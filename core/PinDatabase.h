@@ -0,0 +1,131 @@
+/*!
+ * \file PinDatabase.h
+ * \brief The PinDatabase class resolves the pin map of a motherboard
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PINDATABASE_H
+#define PINDATABASE_H
+
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+#include <optional>
+
+///
+/// \brief The PinDatabase class resolves the pin map of a motherboard
+///
+/// The pins file selected for the motherboard in src/pins/pins.h is read together with the
+/// files it includes, in include order. As Marlin's pins files guard their defaults with
+/// #ifndef, the first definition of a pin wins; other conditional branches are not evaluated.
+/// Aliases such as "#define FIL_RUNOUT_PIN X_MAX_PIN" are resolved to the physical pin.
+/// The resolved map is cached per workspace and motherboard.
+///
+class PinDatabase
+{
+public:
+    /// \brief Constructor for PinDatabase
+    ///
+    /// \param pCacheDirectory: Root folder of the cache, the user cache location is used if empty
+    explicit PinDatabase(const QString& pCacheDirectory = QString());
+
+    /// \brief Loads the pin map of a motherboard from the cache or resolves it
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pBoard: The motherboard name, e.g. "BOARD_RAMPS_14_EFB"
+    /// \return \b true, if the pin map is ready
+    bool Load(const QString& pWorkspacePath, const QString& pBoard);
+
+    /// \brief Returns whether a pin map was loaded
+    ///
+    /// \return \b true, if the pin map is ready
+    bool IsReady(void) const;
+
+    /// \brief Returns the workspace and motherboard of the loaded pin map
+    ///
+    /// \return The workspace path and the motherboard name, separated by a colon
+    QString Source(void) const;
+
+    /// \brief Returns the pins file of the loaded motherboard
+    ///
+    /// \return The path relative to src/pins
+    QString PinsFile(void) const;
+
+    /// \brief Returns the physical pin of the given pin name
+    ///
+    /// \param pName: The pin name, e.g. "X_MIN_PIN"
+    /// \return The pin or an empty string if the pin is not defined for the motherboard
+    QString Pin(const QString& pName) const;
+
+    /// \brief Returns the resolved pin map
+    ///
+    /// \return Maps the pin names to their physical pins
+    QHash<QString, QString> Pins(void) const;
+
+    /// \brief Finds the pins file pins.h includes for the given motherboard
+    ///
+    /// \param pLines: The lines of pins.h
+    /// \param pBoard: The motherboard name
+    /// \return The path relative to src/pins or std::nullopt if the board is not listed
+    static std::optional<QString> FindPinsFile(const QStringList& pLines, const QString& pBoard);
+
+    /// \brief Resolves pin aliases
+    ///
+    /// \param pDefinitions: All definitions of the pins files, mapping names to values
+    /// \return Maps the names ending with _PIN to their physical pins, unused pins (-1) are omitted
+    static QHash<QString, QString> Resolve(const QHash<QString, QString>& pDefinitions);
+
+protected:
+    /// \brief Collects the definitions of a pins file and the files it includes
+    ///
+    /// \param pPath: Path to the pins file
+    /// \param pPinsPath: Path to src/pins, used to resolve includes
+    /// \param pVisited: Files read so far, to avoid include cycles
+    /// \param pDefinitions: Receives the first definition of each name
+    void Collect(const QString& pPath, const QString& pPinsPath, QSet<QString>& pVisited, QHash<QString, QString>& pDefinitions) const;
+
+    /// \brief Reads the pin map from the cache file
+    ///
+    /// \param pPath: Path of the cache file
+    /// \param pKey: The expected fingerprint of the inputs
+    /// \return \b true, if a valid pin map was read
+    bool ReadCache(const QString& pPath, const QString& pKey);
+
+    /// \brief Writes the pin map to the cache file
+    ///
+    /// \param pPath: Path of the cache file
+    /// \param pKey: The fingerprint of the inputs
+    void WriteCache(const QString& pPath, const QString& pKey) const;
+
+protected:
+    QString mCacheDirectory;
+
+    bool mIsReady{false};
+
+    QString mSource;
+    QString mPinsFile;
+    QHash<QString, QString> mPins;
+};
+
+#endif // PINDATABASE_H
@@ -0,0 +1,227 @@
+/*!
+ * \file ProfileResolver.cpp
+ * \brief The ProfileResolver class resolves layered configuration profiles
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ProfileResolver.h"
+#include "Configuration.h"
+
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+
+namespace
+{
+static constexpr auto MAX_DEPTH{16};
+
+/// \brief Returns the key of the defaults, the parent key of every root profile
+///
+/// \return The fingerprint of the default configuration
+const QByteArray& DefaultsKey()
+{
+    static const QByteArray key = Configuration().Fingerprint();
+    return key;
+}
+}
+
+std::optional<ProfileResolver::Resolution> ProfileResolver::Resolve(const QString& pPath)
+{
+    mLastError.clear();
+
+    QSet<QString> visiting;
+    int32_t resolvedLayers = 0;
+
+    const auto* layer = ResolveLayer(QDir::cleanPath(QFileInfo(pPath).absoluteFilePath()), visiting, resolvedLayers);
+    if (nullptr == layer)
+    {
+        return std::nullopt;
+    }
+
+    return Resolution{layer->resolved, layer->chain, resolvedLayers};
+}
+
+QString ProfileResolver::LastError() const
+{
+    return mLastError;
+}
+
+bool ProfileResolver::IsLayered(const QJsonObject& pJson)
+{
+    return pJson.value(PROFILE_PARENT_KEY).isString();
+}
+
+QJsonObject ProfileResolver::MakeLayer(const QJsonObject& pConfiguration, const QJsonObject& pParent, const QString& pParentPath)
+{
+    QJsonObject json;
+    json[PROFILE_PARENT_KEY] = pParentPath;
+    json[CONFIGURATION_SCHEMA_VERSION_KEY] = CONFIGURATION_SCHEMA_VERSION;
+
+    for (auto page = pConfiguration.constBegin(); page != pConfiguration.constEnd(); ++page)
+    {
+        const auto fields = page.value().toObject();
+        const auto parentFields = pParent.value(page.key()).toObject();
+
+        QJsonObject changedFields;
+        for (auto field = fields.constBegin(); field != fields.constEnd(); ++field)
+        {
+            if (parentFields.value(field.key()) != field.value())
+            {
+                changedFields[field.key()] = field.value();
+            }
+        }
+
+        if (!changedFields.isEmpty())
+        {
+            json[page.key()] = changedFields;
+        }
+    }
+
+    return json;
+}
+
+const ProfileResolver::Layer* ProfileResolver::ResolveLayer(const QString& pPath, QSet<QString>& pVisiting, int32_t& pResolvedLayers)
+{
+    if (pVisiting.contains(pPath))
+    {
+        mLastError = QString("Profile %0 is its own parent.").arg(pPath);
+        return nullptr;
+    }
+
+    if (pVisiting.size() >= MAX_DEPTH)
+    {
+        mLastError = QString("Profile %0 has more than %1 parents.").arg(pPath).arg(MAX_DEPTH);
+        return nullptr;
+    }
+
+    auto layer = mLayers.value(pPath);
+    if (!ReadLayer(pPath, layer))
+    {
+        mLayers.remove(pPath);
+        return nullptr;
+    }
+
+    QByteArray parentKey = DefaultsKey();
+    QJsonObject base = Configuration::DefaultJson();
+    QStringList chain;
+
+    if (!layer.parentPath.isEmpty())
+    {
+        pVisiting.insert(pPath);
+        const auto* parent = ResolveLayer(layer.parentPath, pVisiting, pResolvedLayers);
+        pVisiting.remove(pPath);
+
+        if (nullptr == parent)
+        {
+            return nullptr;
+        }
+
+        parentKey = parent->key;
+        base = parent->resolved;
+        chain = parent->chain;
+    }
+
+    // The key changes with the own content and with every change of a parent
+    const auto key = QCryptographicHash::hash(parentKey + layer.contentHash, QCryptographicHash::Sha1);
+    if (key != layer.key)
+    {
+        for (auto page = layer.fields.constBegin(); page != layer.fields.constEnd(); ++page)
+        {
+            auto fields = base.value(page.key()).toObject();
+
+            const auto changedFields = page.value().toObject();
+            for (auto field = changedFields.constBegin(); field != changedFields.constEnd(); ++field)
+            {
+                fields[field.key()] = field.value();
+            }
+            base[page.key()] = fields;
+        }
+
+        chain.append(pPath);
+
+        layer.key = key;
+        layer.resolved = base;
+        layer.chain = chain;
+        ++pResolvedLayers;
+    }
+
+    auto& stored = mLayers[pPath];
+    stored = std::move(layer);
+    return &stored;
+}
+
+bool ProfileResolver::ReadLayer(const QString& pPath, Layer& pLayer)
+{
+    const QFileInfo info(pPath);
+    if (!info.exists())
+    {
+        mLastError = QString("Profile %0 does not exist.").arg(pPath);
+        return false;
+    }
+
+    if (!pLayer.contentHash.isEmpty() && pLayer.size == info.size() && pLayer.modified == info.lastModified())
+    {
+        return true;
+    }
+
+    QFile file(pPath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        mLastError = QString("Could not open profile %0.").arg(pPath);
+        return false;
+    }
+
+    const auto bytes = file.readAll();
+
+    QJsonParseError jsonError;
+    const auto document = QJsonDocument::fromJson(bytes, &jsonError);
+    if (jsonError.error != QJsonParseError::NoError || !document.isObject())
+    {
+        mLastError = QString("Profile %0 is not a valid configuration: %1").arg(pPath, jsonError.errorString());
+        return false;
+    }
+
+    const auto json = document.object();
+
+    pLayer.modified = info.lastModified();
+    pLayer.size = info.size();
+    pLayer.contentHash = QCryptographicHash::hash(bytes, QCryptographicHash::Sha1);
+    pLayer.parentPath.clear();
+    pLayer.fields = QJsonObject();
+
+    if (IsLayered(json))
+    {
+        pLayer.parentPath = QDir::cleanPath(info.dir().absoluteFilePath(json.value(PROFILE_PARENT_KEY).toString()));
+    }
+
+    for (auto page = json.constBegin(); page != json.constEnd(); ++page)
+    {
+        if (page.value().isObject())
+        {
+            pLayer.fields[page.key()] = page.value();
+        }
+    }
+
+    return true;
+}
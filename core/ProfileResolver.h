@@ -0,0 +1,122 @@
+/*!
+ * \file ProfileResolver.h
+ * \brief The ProfileResolver class resolves layered configuration profiles
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PROFILERESOLVER_H
+#define PROFILERESOLVER_H
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
+#include <QJsonObject>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+#include <optional>
+
+/// \brief Key of the parent profile path in a configuration.json, relative to the file
+static constexpr auto PROFILE_PARENT_KEY{"parent"};
+
+///
+/// \brief The ProfileResolver class resolves layered configuration profiles
+///
+/// A profile is a configuration.json that names a parent profile and only stores the fields that
+/// differ from it, e.g. base -> printer model -> single unit. The root of each chain is based on
+/// the defaults. Every resolved layer is cached together with a key built from its own content and
+/// the key of its parent, so a change in a parent invalidates exactly the layers below it, while
+/// the unchanged layers of siblings and the parsed files are reused. Files are only read again if
+/// their size or modification time changed.
+///
+class ProfileResolver
+{
+public:
+    /// \brief A resolved profile
+    struct Resolution
+    {
+        QJsonObject configuration; ///< The complete configuration as returned by Configuration::ToJson
+        QStringList chain; ///< The profile files from the root to the resolved one
+        int32_t resolvedLayers; ///< Layers merged by this call, the others came from the cache
+    };
+
+    /// \brief Resolves a profile and all its parents
+    ///
+    /// \param pPath: Path of the profile
+    /// \return The resolution or std::nullopt if a file is missing, invalid or the chain has a cycle, see LastError
+    std::optional<Resolution> Resolve(const QString& pPath);
+
+    /// \brief Returns the reason the last resolution failed
+    ///
+    /// \return The error message
+    QString LastError(void) const;
+
+    /// \brief Checks whether a configuration.json is a layered profile
+    ///
+    /// \param pJson: The content of the file
+    /// \return \b true, if the file names a parent profile
+    static bool IsLayered(const QJsonObject& pJson);
+
+    /// \brief Creates the layer that turns the parent configuration into the given one
+    ///
+    /// \param pConfiguration: The complete configuration
+    /// \param pParent: The complete configuration of the parent
+    /// \param pParentPath: The parent path as stored in the file, relative to the profile
+    /// \return The profile containing the parent path and the differing fields
+    static QJsonObject MakeLayer(const QJsonObject& pConfiguration, const QJsonObject& pParent, const QString& pParentPath);
+
+protected:
+    /// \brief A parsed profile file with its last resolution
+    struct Layer
+    {
+        QDateTime modified;
+        qint64 size{-1};
+        QByteArray contentHash;
+        QString parentPath;
+        QJsonObject fields;
+
+        QByteArray key;
+        QJsonObject resolved;
+        QStringList chain;
+    };
+
+    /// \brief Resolves a layer after its parents
+    ///
+    /// \param pPath: Absolute path of the profile
+    /// \param pVisiting: The profiles on the current chain, to detect cycles
+    /// \param pResolvedLayers: Incremented for every merged layer
+    /// \return The layer or nullptr on errors
+    const Layer* ResolveLayer(const QString& pPath, QSet<QString>& pVisiting, int32_t& pResolvedLayers);
+
+    /// \brief Reads a profile file if it changed since it was read last
+    ///
+    /// \param pPath: Absolute path of the profile
+    /// \param pLayer: The layer to update
+    /// \return \b true, if the layer is valid
+    bool ReadLayer(const QString& pPath, Layer& pLayer);
+
+    QHash<QString, Layer> mLayers;
+    QString mLastError;
+};
+
+#endif // PROFILERESOLVER_H
@@ -0,0 +1,157 @@
+/*!
+ * \file StallWatchdog.cpp
+ * \brief The StallWatchdog class reports stalls of the GUI event loop
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "StallWatchdog.h"
+#include "Trace.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QTextStream>
+
+#include <algorithm>
+#include <chrono>
+
+StallWatchdog::StallWatchdog(QObject *pParent) :
+    QObject(pParent)
+{
+    QObject::connect(&mHeartbeatTimer, &QTimer::timeout, this, [this](){
+        mHeartbeat.store(Trace::Now(), std::memory_order_relaxed);
+    });
+}
+
+StallWatchdog::~StallWatchdog()
+{
+    Stop();
+}
+
+void StallWatchdog::Start(int32_t pThresholdMs, const QString& pLogPath)
+{
+    Stop();
+
+    // The heartbeat is several times finer than the threshold, so a stall is not missed by one interval
+    constexpr auto minIntervalMs = 10;
+    constexpr auto maxIntervalMs = 100;
+    const auto intervalMs = std::clamp(pThresholdMs / 5, minIntervalMs, maxIntervalMs);
+
+    mThresholdNs = static_cast<int64_t>(pThresholdMs) * 1000 * 1000;
+    mIntervalNs = static_cast<int64_t>(intervalMs) * 1000 * 1000;
+    mLogPath = pLogPath;
+
+    QDir().mkpath(QFileInfo(mLogPath).absolutePath());
+    if (QFileInfo(mLogPath).size() > MAX_LOG_SIZE)
+    {
+        QFile::remove(mLogPath);
+    }
+
+    // Tracked from now on, so the GUI spans are known even if they are not recorded
+    Trace::SetActiveSpansTracked(true);
+
+    mHeartbeat.store(Trace::Now(), std::memory_order_relaxed);
+    mHeartbeatTimer.start(intervalMs);
+
+    mStopping = false;
+    mThread = std::thread([this](){ Run(); });
+}
+
+void StallWatchdog::Stop()
+{
+    mHeartbeatTimer.stop();
+
+    if (!mThread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mCondition.notify_all();
+    mThread.join();
+
+    Trace::SetActiveSpansTracked(false);
+}
+
+QString StallWatchdog::LogPath() const
+{
+    return mLogPath;
+}
+
+void StallWatchdog::Run()
+{
+    bool stalled = false;
+    int64_t stallBeat = 0;
+    QStringList spans;
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (!mCondition.wait_for(lock, std::chrono::nanoseconds(mIntervalNs), [this](){ return mStopping; }))
+    {
+        const auto beat = mHeartbeat.load(std::memory_order_relaxed);
+
+        if (stalled && beat != stallBeat)
+        {
+            // One interval between the heartbeats is normal
+            const auto durationMs = std::max<int64_t>(beat - stallBeat - mIntervalNs, 0) / (1000 * 1000);
+            const auto spanText = spans.isEmpty() ? QString("an untraced code path") : spans.join(" > ");
+
+            WriteStall(durationMs, spanText);
+            emit StallSignal(durationMs, spanText);
+
+            stalled = false;
+            spans.clear();
+        }
+
+        if (Trace::Now() - beat <= mThresholdNs + mIntervalNs)
+        {
+            continue;
+        }
+
+        if (!stalled)
+        {
+            stalled = true;
+            stallBeat = beat;
+        }
+
+        // Sampled until spans are open, the stack at the start of the stall is kept
+        if (spans.isEmpty())
+        {
+            spans = Trace::ActiveGuiSpans();
+        }
+    }
+}
+
+void StallWatchdog::WriteStall(qint64 pDurationMs, const QString& pSpans) const
+{
+    QFile file(mLogPath);
+    if (!file.open(QFile::WriteOnly | QFile::Append | QFile::Text))
+    {
+        return;
+    }
+
+    QTextStream stream(&file);
+    stream << QDateTime::currentDateTime().toString(Qt::ISODateWithMs) << '\t' << pDurationMs << " ms\t" << pSpans << '\n';
+}
@@ -0,0 +1,110 @@
+/*!
+ * \file StallWatchdog.h
+ * \brief The StallWatchdog class reports stalls of the GUI event loop
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef STALLWATCHDOG_H
+#define STALLWATCHDOG_H
+
+#include <QObject>
+#include <QString>
+#include <QTimer>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+/// \brief Default time the event loop may be blocked before a stall is reported
+static constexpr auto DEFAULT_STALL_THRESHOLD_MS{250};
+
+///
+/// \brief The StallWatchdog class reports stalls of the GUI event loop
+///
+/// A timer on the GUI thread sets a heartbeat, which a separate thread checks. When the heartbeat is
+/// older than the threshold, the thread samples the trace spans open on the GUI thread. Once the event
+/// loop runs again, the stall is appended to the log file and reported by StallSignal.
+///
+class StallWatchdog : public QObject
+{
+    Q_OBJECT
+public:
+    /// \brief Constructor for StallWatchdog
+    ///
+    /// \param pParent: Reference to the parent object
+    explicit StallWatchdog(QObject *pParent = nullptr);
+
+    /// \brief Destructor for StallWatchdog, stops the watchdog thread
+    ~StallWatchdog(void) override;
+
+    /// \brief Starts watching the event loop of the calling thread
+    ///
+    /// \param pThresholdMs: Blocked time in milliseconds from which a stall is reported
+    /// \param pLogPath: File the stalls are appended to
+    void Start(int32_t pThresholdMs, const QString& pLogPath);
+
+    /// \brief Stops watching, a stall in progress is not reported
+    void Stop(void);
+
+    /// \brief Returns the file the stalls are appended to
+    ///
+    /// \return The path of the log file
+    QString LogPath(void) const;
+
+signals:
+    /// \brief Emitted from the watchdog thread once a stall ended
+    ///
+    /// \param pDurationMs: The time the event loop was blocked
+    /// \param pSpans: The spans open on the GUI thread during the stall, e.g. "Application::OnGenerate > Application::GenerateCode"
+    void StallSignal(qint64 pDurationMs, const QString& pSpans);
+
+protected:
+    /// \brief Limits the log file, a larger file is started anew
+    static constexpr qint64 MAX_LOG_SIZE{1024 * 1024};
+
+    /// \brief Checks the heartbeat until the watchdog is stopped
+    void Run(void);
+
+    /// \brief Appends a stall to the log file
+    ///
+    /// \param pDurationMs: The time the event loop was blocked
+    /// \param pSpans: The spans open during the stall
+    void WriteStall(qint64 pDurationMs, const QString& pSpans) const;
+
+    QTimer mHeartbeatTimer;
+
+    /// \brief Trace clock time of the last heartbeat
+    std::atomic<int64_t> mHeartbeat{0};
+
+    int64_t mThresholdNs{0};
+    int64_t mIntervalNs{0};
+    QString mLogPath;
+
+    std::thread mThread;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    bool mStopping{false};
+};
+
+#endif // STALLWATCHDOG_H
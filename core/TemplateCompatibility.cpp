@@ -0,0 +1,148 @@
+/*!
+ * \file TemplateCompatibility.cpp
+ * \brief The TemplateCompatibility class compares a workspace's configuration with the template
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TemplateCompatibility.h"
+#include "DefineScanner.h"
+
+#include <QElapsedTimer>
+#include <QRegularExpression>
+#include <QSet>
+
+namespace
+{
+static constexpr auto CONFIGURATION_VERSION_DEFINE{"CONFIGURATION_H_VERSION"};
+static constexpr auto SHORT_BUILD_VERSION_DEFINE{"SHORT_BUILD_VERSION"};
+
+/// \brief Finds the value of an enabled define
+///
+/// \param pDefines: The scanned defines
+/// \param pName: The name of the define
+/// \return The value of the first enabled definition, if any
+std::optional<QString> FindValue(const QList<DefineScanner::Define>& pDefines, const QByteArray& pName)
+{
+    for (const auto& define : pDefines)
+    {
+        if (define.enabled && define.name == pName)
+        {
+            return QString::fromUtf8(define.value);
+        }
+    }
+    return std::nullopt;
+}
+}
+
+bool TemplateCompatibility::Report::IsCompatible(const QString& pExpectedVersion) const
+{
+    return workspaceVersion == pExpectedVersion
+            && workspaceConfigurationVersion == templateConfigurationVersion
+            && unknownTags.isEmpty();
+}
+
+std::optional<TemplateCompatibility::Report> TemplateCompatibility::Check(const QString& pWorkspacePath, const QStringList& pTemplate)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    const auto workspaceDefines = DefineScanner::ScanFile(pWorkspacePath + "/Marlin/Configuration.h");
+    if (!workspaceDefines.has_value())
+    {
+        return std::nullopt;
+    }
+
+    Report report;
+    report.workspaceVersion = ReadMarlinVersion(pWorkspacePath).value_or(QString());
+    report.workspaceConfigurationVersion = FindValue(workspaceDefines.value(), CONFIGURATION_VERSION_DEFINE).value_or(QString());
+
+    // Defines written literally in the template and defines generated from tags
+    const auto templateDefines = DefineScanner::Scan(pTemplate.join('\n').toUtf8());
+    report.templateConfigurationVersion = FindValue(templateDefines, CONFIGURATION_VERSION_DEFINE).value_or(QString());
+
+    static const QRegularExpression tagExpression(R"(#\{(\w+)\})");
+
+    QStringList tags;
+    for (const auto& line : pTemplate)
+    {
+        auto it = tagExpression.globalMatch(line);
+        while (it.hasNext())
+        {
+            tags.append(it.next().captured(1));
+        }
+    }
+
+    QSet<QString> workspaceNames;
+    for (const auto& define : workspaceDefines.value())
+    {
+        workspaceNames.insert(QString::fromUtf8(define.name));
+    }
+
+    QSet<QString> templateNames(tags.cbegin(), tags.cend());
+    for (const auto& define : templateDefines)
+    {
+        templateNames.insert(QString::fromUtf8(define.name));
+    }
+
+    for (const auto& tag : tags)
+    {
+        if (!workspaceNames.contains(tag) && !report.unknownTags.contains(tag))
+        {
+            report.unknownTags.append(tag);
+        }
+    }
+
+    for (const auto& define : workspaceDefines.value())
+    {
+        const auto name = QString::fromUtf8(define.name);
+        if (!templateNames.contains(name) && !report.untemplatedDefines.contains(name))
+        {
+            report.untemplatedDefines.append(name);
+        }
+    }
+
+    report.elapsedMs = timer.elapsed();
+    return report;
+}
+
+std::optional<QString> TemplateCompatibility::ReadMarlinVersion(const QString& pWorkspacePath)
+{
+    // The user may override the version in Marlin/Version.h, the default is in src/inc/Version.h
+    for (const auto& path : {"/Marlin/Version.h", "/Marlin/src/inc/Version.h"})
+    {
+        const auto defines = DefineScanner::ScanFile(pWorkspacePath + path);
+        if (!defines.has_value())
+        {
+            continue;
+        }
+
+        const auto version = FindValue(defines.value(), SHORT_BUILD_VERSION_DEFINE);
+        if (version.has_value())
+        {
+            auto value = version.value();
+            value.remove('"');
+            return value.trimmed();
+        }
+    }
+
+    return std::nullopt;
+}
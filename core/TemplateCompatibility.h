@@ -0,0 +1,80 @@
+/*!
+ * \file TemplateCompatibility.h
+ * \brief The TemplateCompatibility class compares a workspace's configuration with the template
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TEMPLATECOMPATIBILITY_H
+#define TEMPLATECOMPATIBILITY_H
+
+#include <QString>
+#include <QStringList>
+
+#include <optional>
+
+///
+/// \brief The TemplateCompatibility class compares a workspace's configuration with the template
+///
+/// The define set of the workspace's Configuration.h and its Marlin version from Version.h
+/// are compared with the tags and defines of the configuration template, so that opening
+/// a different Marlin release is reported before a header with renamed defines is generated.
+///
+class TemplateCompatibility
+{
+public:
+    /// \brief The result of a compatibility check
+    struct Report
+    {
+        QString workspaceVersion;
+        QString workspaceConfigurationVersion;
+        QString templateConfigurationVersion;
+
+        /// \brief Template tags without a matching define in the workspace
+        QStringList unknownTags;
+
+        /// \brief Workspace defines that the template does not contain
+        QStringList untemplatedDefines;
+
+        qint64 elapsedMs{0};
+
+        /// \brief Checks if the template can safely be generated into the workspace
+        ///
+        /// \param pExpectedVersion: The Marlin version the template was made for
+        /// \return \b true, if the versions and all template tags match
+        bool IsCompatible(const QString& pExpectedVersion) const;
+    };
+
+    /// \brief Compares the workspace configuration with the given template
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \param pTemplate: The configuration template lines
+    /// \return The report or std::nullopt if the workspace has no Configuration.h
+    static std::optional<Report> Check(const QString& pWorkspacePath, const QStringList& pTemplate);
+
+    /// \brief Reads the Marlin version of a workspace
+    ///
+    /// \param pWorkspacePath: Path to the Marlin base folder
+    /// \return The SHORT_BUILD_VERSION without quotes or std::nullopt if not found
+    static std::optional<QString> ReadMarlinVersion(const QString& pWorkspacePath);
+};
+
+#endif // TEMPLATECOMPATIBILITY_H
@@ -0,0 +1,118 @@
+/*!
+ * \file TemplatePack.cpp
+ * \brief The TemplatePack class selects the compiled template pack for a Marlin version
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "TemplatePack.h"
+#include "Configuration.h"
+
+#include <QDir>
+#include <QRegularExpression>
+#include <QVersionNumber>
+
+#include <algorithm>
+
+namespace
+{
+/// \brief Parses the numeric part of a Marlin version string
+///
+/// \param pVersion: The version string, e.g. "2.1.2" or "bugfix-2.1.x"
+/// \return The version number, empty if none was found
+QVersionNumber ParseVersion(const QString& pVersion)
+{
+    static const QRegularExpression expression(R"((\d+)\.(\d+)(?:\.(\d+))?)");
+
+    const auto match = expression.match(pVersion);
+    if (!match.hasMatch())
+    {
+        return QVersionNumber();
+    }
+
+    QVector<int> segments{match.captured(1).toInt(), match.captured(2).toInt()};
+    if (!match.captured(3).isEmpty())
+    {
+        segments.append(match.captured(3).toInt());
+    }
+    return QVersionNumber(segments);
+}
+}
+
+QStringList TemplatePack::AvailableVersions()
+{
+    auto versions = QDir(TEMPLATE_PACKS_ROOT).entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+
+    std::sort(versions.begin(), versions.end(), [](const QString& pLeft, const QString& pRight){
+        return ParseVersion(pLeft) > ParseVersion(pRight);
+    });
+
+    return versions;
+}
+
+std::optional<QString> TemplatePack::SelectVersion(const QString& pMarlinVersion)
+{
+    const auto versions = AvailableVersions();
+    if (versions.isEmpty())
+    {
+        return std::nullopt;
+    }
+
+    if (versions.contains(pMarlinVersion))
+    {
+        return pMarlinVersion;
+    }
+
+    const auto requested = ParseVersion(pMarlinVersion);
+    if (requested.isNull())
+    {
+        return versions.first();
+    }
+
+    // Closest pack of the same minor release, preferring older patch levels over newer ones
+    std::optional<QString> bestVersion;
+    int32_t bestDistance = 0;
+
+    for (const auto& version : versions)
+    {
+        const auto candidate = ParseVersion(version);
+        if (candidate.majorVersion() != requested.majorVersion() || candidate.minorVersion() != requested.minorVersion())
+        {
+            continue;
+        }
+
+        const auto difference = candidate.microVersion() - requested.microVersion();
+        const auto distance = (difference <= 0) ? -2 * difference : 2 * difference + 1;
+
+        if (!bestVersion.has_value() || distance < bestDistance)
+        {
+            bestVersion = version;
+            bestDistance = distance;
+        }
+    }
+
+    return bestVersion.value_or(versions.first());
+}
+
+QString TemplatePack::Directory(const QString& pVersion)
+{
+    return QString("%0/%1").arg(TEMPLATE_PACKS_ROOT, pVersion);
+}
@@ -0,0 +1,65 @@
+/*!
+ * \file TemplatePack.h
+ * \brief The TemplatePack class selects the compiled template pack for a Marlin version
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TEMPLATEPACK_H
+#define TEMPLATEPACK_H
+
+#include <QString>
+#include <QStringList>
+
+#include <optional>
+
+///
+/// \brief The TemplatePack class selects the compiled template pack for a Marlin version
+///
+/// Each supported Marlin release has its own set of templates, compiled into the
+/// executable as a compressed resource folder below TEMPLATE_PACKS_ROOT. Resources are
+/// only decompressed when opened, so only the templates of the selected pack are loaded.
+///
+class TemplatePack
+{
+public:
+    /// \brief Lists the Marlin versions templates are available for
+    ///
+    /// \return The versions, newest first
+    static QStringList AvailableVersions(void);
+
+    /// \brief Selects the pack that fits the given Marlin version best
+    ///
+    /// An exact match is preferred, then the closest release of the same minor version,
+    /// then the newest pack.
+    ///
+    /// \param pMarlinVersion: The Marlin version of the workspace, e.g. "2.1.2" or "bugfix-2.1.x"
+    /// \return The version of the selected pack or std::nullopt if no packs are available
+    static std::optional<QString> SelectVersion(const QString& pMarlinVersion);
+
+    /// \brief Returns the resource folder of a template pack
+    ///
+    /// \param pVersion: The version of the pack
+    /// \return The resource path
+    static QString Directory(const QString& pVersion);
+};
+
+#endif // TEMPLATEPACK_H
@@ -0,0 +1,218 @@
+/*!
+ * \file UndoHistory.cpp
+ * \brief The UndoHistory class stores configuration changes for undo and redo
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "UndoHistory.h"
+#include "BinaryConfiguration.h"
+
+namespace
+{
+static constexpr qint64 MEMORY_BUDGET{4 * 1024 * 1024};
+static constexpr std::chrono::milliseconds COALESCE_INTERVAL{1000};
+
+/// \brief Estimates the memory held by a field value
+///
+/// \param pValue: The value
+/// \return The size in bytes, beyond the value itself
+qint64 ValueSize(const QJsonValue& pValue)
+{
+    return pValue.isString() ? pValue.toString().size() * static_cast<qint64>(sizeof(QChar)) : 0;
+}
+}
+
+void UndoHistory::Reset(const QJsonObject& pConfiguration)
+{
+    mRecorded = pConfiguration;
+    mUndoSteps.clear();
+    mRedoSteps.clear();
+    mMemoryUsage = 0;
+}
+
+bool UndoHistory::Record(const QJsonObject& pConfiguration)
+{
+    Step step{{}, std::chrono::steady_clock::now(), 0};
+
+    for (auto page = pConfiguration.constBegin(); page != pConfiguration.constEnd(); ++page)
+    {
+        const auto previous = mRecorded.value(page.key());
+        if (!page.value().isObject() || previous == page.value())
+        {
+            continue;
+        }
+
+        const auto fields = page.value().toObject();
+        const auto previousFields = previous.toObject();
+        for (auto field = fields.constBegin(); field != fields.constEnd(); ++field)
+        {
+            const auto before = previousFields.value(field.key());
+            if (before != field.value())
+            {
+                step.deltas.append(Delta{BinaryConfiguration::FieldId(page.key(), field.key()), before, field.value()});
+            }
+        }
+    }
+
+    if (step.deltas.isEmpty())
+    {
+        return false;
+    }
+
+    mRecorded = pConfiguration;
+
+    for (const auto& redoStep : mRedoSteps)
+    {
+        mMemoryUsage -= redoStep.size;
+    }
+    mRedoSteps.clear();
+
+    // Repeated changes of the same fields, e.g. spin box ticks, extend the last step
+    if (!mUndoSteps.empty() && step.time - mUndoSteps.back().time < COALESCE_INTERVAL
+        && mUndoSteps.back().deltas.size() == step.deltas.size())
+    {
+        auto& last = mUndoSteps.back();
+
+        bool sameFields = true;
+        for (int32_t i = 0; i < step.deltas.size() && sameFields; ++i)
+        {
+            sameFields = (last.deltas.at(i).field == step.deltas.at(i).field);
+        }
+
+        if (sameFields)
+        {
+            for (int32_t i = 0; i < step.deltas.size(); ++i)
+            {
+                last.deltas[i].after = step.deltas.at(i).after;
+            }
+            last.time = step.time;
+
+            mMemoryUsage -= last.size;
+            last.size = SizeOf(last);
+            mMemoryUsage += last.size;
+            return true;
+        }
+    }
+
+    step.size = SizeOf(step);
+    mMemoryUsage += step.size;
+    mUndoSteps.push_back(std::move(step));
+
+    Trim();
+    return true;
+}
+
+std::optional<QJsonObject> UndoHistory::Undo()
+{
+    if (mUndoSteps.empty())
+    {
+        return std::nullopt;
+    }
+
+    mRedoSteps.push_back(std::move(mUndoSteps.back()));
+    mUndoSteps.pop_back();
+
+    return Apply(mRedoSteps.back(), false);
+}
+
+std::optional<QJsonObject> UndoHistory::Redo()
+{
+    if (mRedoSteps.empty())
+    {
+        return std::nullopt;
+    }
+
+    mUndoSteps.push_back(std::move(mRedoSteps.back()));
+    mRedoSteps.pop_back();
+
+    // A redone step is never extended by the next change
+    mUndoSteps.back().time = std::chrono::steady_clock::time_point();
+
+    return Apply(mUndoSteps.back(), true);
+}
+
+bool UndoHistory::CanUndo() const
+{
+    return !mUndoSteps.empty();
+}
+
+bool UndoHistory::CanRedo() const
+{
+    return !mRedoSteps.empty();
+}
+
+qint64 UndoHistory::MemoryUsage() const
+{
+    return mMemoryUsage;
+}
+
+QJsonObject UndoHistory::Apply(const Step& pStep, bool pForward)
+{
+    QJsonObject changes;
+
+    for (const auto& delta : pStep.deltas)
+    {
+        const auto name = BinaryConfiguration::FieldName(delta.field);
+        if (!name.has_value())
+        {
+            continue;
+        }
+
+        auto page = changes.value(name.value().first).toObject();
+        page[name.value().second] = pForward ? delta.after : delta.before;
+        changes[name.value().first] = page;
+    }
+
+    for (auto page = changes.constBegin(); page != changes.constEnd(); ++page)
+    {
+        auto fields = mRecorded.value(page.key()).toObject();
+
+        const auto changedFields = page.value().toObject();
+        for (auto field = changedFields.constBegin(); field != changedFields.constEnd(); ++field)
+        {
+            fields[field.key()] = field.value();
+        }
+        mRecorded[page.key()] = fields;
+    }
+
+    return changes;
+}
+
+qint64 UndoHistory::SizeOf(const Step& pStep)
+{
+    qint64 size = sizeof(Step) + pStep.deltas.size() * static_cast<qint64>(sizeof(Delta));
+    for (const auto& delta : pStep.deltas)
+    {
+        size += ValueSize(delta.before) + ValueSize(delta.after);
+    }
+    return size;
+}
+
+void UndoHistory::Trim()
+{
+    // The newest step is kept even if it exceeds the budget on its own
+    while (mMemoryUsage > MEMORY_BUDGET && mUndoSteps.size() > 1)
+    {
+        mMemoryUsage -= mUndoSteps.front().size;
+        mUndoSteps.pop_front();
+    }
+}
@@ -0,0 +1,125 @@
+/*!
+ * \file UndoHistory.h
+ * \brief The UndoHistory class stores configuration changes for undo and redo
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef UNDOHISTORY_H
+#define UNDOHISTORY_H
+
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QList>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+///
+/// \brief The UndoHistory class stores configuration changes for undo and redo
+///
+/// A step holds only the fields that changed, each as field ID with the value before and after,
+/// so resetting a page costs one step of a few hundred small deltas instead of a copy of the
+/// configuration. Steps that change the same fields within a short interval, e.g. the ticks of a
+/// held spin box arrow, are merged into one. The oldest steps are dropped once the history
+/// exceeds its memory budget.
+///
+class UndoHistory
+{
+public:
+    /// \brief Clears the history and sets the configuration changes are recorded against
+    ///
+    /// \param pConfiguration: The configuration as returned by Configuration::ToJson
+    void Reset(const QJsonObject& pConfiguration);
+
+    /// \brief Records the fields that differ from the last recorded configuration as one step
+    ///
+    /// \param pConfiguration: The configuration as returned by Configuration::ToJson
+    /// \return \b true, if a step was added or extended
+    bool Record(const QJsonObject& pConfiguration);
+
+    /// \brief Reverts the last step
+    ///
+    /// \return The changed fields with their previous values, grouped by page, or std::nullopt if there is nothing to undo
+    std::optional<QJsonObject> Undo(void);
+
+    /// \brief Repeats the last undone step
+    ///
+    /// \return The changed fields with their new values, grouped by page, or std::nullopt if there is nothing to redo
+    std::optional<QJsonObject> Redo(void);
+
+    /// \brief Returns whether a step can be undone
+    ///
+    /// \return \b true, if the history has a step to undo
+    bool CanUndo(void) const;
+
+    /// \brief Returns whether a step can be redone
+    ///
+    /// \return \b true, if the history has a step to redo
+    bool CanRedo(void) const;
+
+    /// \brief Returns the estimated memory held by the recorded steps
+    ///
+    /// \return The size in bytes
+    qint64 MemoryUsage(void) const;
+
+protected:
+    /// \brief The change of a single field
+    struct Delta
+    {
+        quint32 field;
+        QJsonValue before;
+        QJsonValue after;
+    };
+
+    /// \brief A group of changes undone and redone together
+    struct Step
+    {
+        QList<Delta> deltas;
+        std::chrono::steady_clock::time_point time;
+        qint64 size;
+    };
+
+    /// \brief Applies a step to the recorded configuration
+    ///
+    /// \param pStep: The step to apply
+    /// \param pForward: \b true to apply the new values, \b false to restore the previous ones
+    /// \return The changed fields, grouped by page
+    QJsonObject Apply(const Step& pStep, bool pForward);
+
+    /// \brief Estimates the memory held by a step
+    ///
+    /// \param pStep: The step
+    /// \return The size in bytes
+    static qint64 SizeOf(const Step& pStep);
+
+    /// \brief Drops the oldest steps until the history fits into its memory budget
+    void Trim(void);
+
+    QJsonObject mRecorded;
+    std::deque<Step> mUndoSteps;
+    std::deque<Step> mRedoSteps;
+    qint64 mMemoryUsage{0};
+};
+
+#endif // UNDOHISTORY_H
@@ -25,21 +25,89 @@
 
 #include "AbstractPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
+#include <QElapsedTimer>
 #include <QGroupBox>
 #include <QLineEdit>
 #include <QComboBox>
 #include <QSpinBox>
 #include <QFileInfo>
 
-AbstractPage::AbstractPage(const QString& pTemplatePath, QWidget *pParent) :
-    QWidget(pParent)
+#include <algorithm>
+#include <vector>
+
+AbstractPage::AbstractPage(const QString& pTemplatePath, const QString& pPageKey, QWidget *pParent) :
+    QWidget(pParent),
+    mTemplatePath(pTemplatePath),
+    mPageKey(pPageKey),
+    mTemplateDirectory(QString("%0/%1").arg(TEMPLATE_PACKS_ROOT, MARLIN_VERSION))
+{
+}
+
+void AbstractPage::SetTemplateDirectory(const QString& pDirectory)
+{
+    if (pDirectory != mTemplateDirectory)
+    {
+        mTemplateDirectory = pDirectory;
+        mTemplate = std::nullopt;
+    }
+}
+
+bool AbstractPage::LoadFromJson(const QJsonObject &pJson)
 {
-    mTemplate = ReadTemplateFromFile(QFileInfo(pTemplatePath));
+    Configuration configuration;
+    FetchConfiguration(configuration);
+
+    bool complete = true;
+    configuration.ForEachPage([this, &pJson, &complete](const char *pPage, auto& pFields)
+    {
+        if (mPageKey != pPage)
+        {
+            return;
+        }
+
+        pFields.ForEachField([&pJson, &complete](const char *pField, auto& pValue)
+        {
+            auto value = pValue;
+            if (Configuration::AssignJsonValue(value, pJson.value(pField)))
+            {
+                pValue = value;
+            }
+            else
+            {
+                complete = false;
+            }
+        });
+    });
+
+    return LoadFromConfiguration(configuration) && complete;
+}
+
+AbstractPage::Statistics AbstractPage::GetStatistics() const
+{
+    Statistics statistics;
+    statistics.renders = mRenders;
+    statistics.signalsReceived = mSignalsReceived;
+    statistics.templateBytes = mTemplate.has_value() ? TextBytes(mTemplate.value()) : 0;
+
+    if (mRenders > 0)
+    {
+        statistics.lastRenderNs = mRenderSamples.at(static_cast<size_t>(mRenders - 1) % RENDER_SAMPLES);
+
+        std::vector<qint64> samples(mRenderSamples.cbegin(), mRenderSamples.cbegin() + std::min<size_t>(mRenders, RENDER_SAMPLES));
+        const auto percentile = samples.begin() + static_cast<std::ptrdiff_t>((samples.size() - 1) * 95 / 100);
+        std::nth_element(samples.begin(), percentile, samples.end());
+        statistics.p95RenderNs = *percentile;
+    }
+
+    return statistics;
 }
 
 void AbstractPage::Init()
 {
+    const TraceSpan span("AbstractPage::Init", objectName());
+
     ConnectGuiSignalsAndSlots();
     ResetValues();
 }
@@ -49,26 +117,31 @@ void AbstractPage::ConnectGuiSignalsAndSlots()
     for (auto&& groupBox : findChildren<QGroupBox*>())
     {
         QObject::connect(groupBox, &QGroupBox::toggled, this, &AbstractPage::OnUpdatePreview);
+        QObject::connect(groupBox, &QGroupBox::toggled, this, &AbstractPage::OnConfigurationChanged);
     }
 
     for (auto&& lineEdit : findChildren<QLineEdit*>())
     {
         QObject::connect(lineEdit, &QLineEdit::textChanged, this, &AbstractPage::OnUpdatePreview);
+        QObject::connect(lineEdit, &QLineEdit::textChanged, this, &AbstractPage::OnConfigurationChanged);
     }
 
     for (auto&& comboBox : findChildren<QComboBox*>())
     {
         QObject::connect(comboBox, &QComboBox::currentIndexChanged, this, &AbstractPage::OnUpdatePreview);
+        QObject::connect(comboBox, &QComboBox::currentIndexChanged, this, &AbstractPage::OnConfigurationChanged);
     }
 
     for (auto&& spinBox : findChildren<QSpinBox*>())
     {
         QObject::connect(spinBox, &QSpinBox::valueChanged, this, &AbstractPage::OnUpdatePreview);
+        QObject::connect(spinBox, &QSpinBox::valueChanged, this, &AbstractPage::OnConfigurationChanged);
     }
 
     for (auto&& spinBox : findChildren<QDoubleSpinBox*>())
     {
         QObject::connect(spinBox, &QDoubleSpinBox::valueChanged, this, &AbstractPage::OnUpdatePreview);
+        QObject::connect(spinBox, &QDoubleSpinBox::valueChanged, this, &AbstractPage::OnConfigurationChanged);
     }
 }
 
@@ -79,15 +152,38 @@ void AbstractPage::OnUpdatePreview()
         return;
     }
 
+    const TraceSpan span("AbstractPage::OnUpdatePreview", objectName());
+
+    QElapsedTimer timer;
+    timer.start();
+
+    if (!mTemplate.has_value())
+    {
+        mTemplate = ReadTemplateFromFile(QFileInfo(mTemplateDirectory + "/" + mTemplatePath));
+    }
+
     if (mTemplate.has_value())
     {
         QStringList output = mTemplate.value();
 
         ReplaceTags(output);
         emit UpdatePreviewSignal(output);
+
+        mRenderSamples.at(static_cast<size_t>(mRenders) % RENDER_SAMPLES) = timer.nsecsElapsed();
+        ++mRenders;
     }
     else
     {
         emit UpdatePreviewSignal(QStringList()); // Set to placeholder text
     }
 }
+
+void AbstractPage::OnConfigurationChanged()
+{
+    ++mSignalsReceived;
+
+    if (!mIsLoading)
+    {
+        emit ConfigurationChangedSignal();
+    }
+}
@@ -30,6 +30,8 @@
 
 #include <QWidget>
 
+#include <array>
+
 ///
 /// \brief The AbstractPage class respresents a configuration page
 ///
@@ -39,9 +41,10 @@ class AbstractPage : public QWidget
 public:
     /// \brief Constructor for the page widget
     ///
-    /// \param pTemplatePath: Path to the code preview template
+    /// \param pTemplatePath: Path to the code preview template, relative to the template pack
+    /// \param pPageKey: Key of the page's data in Configuration, empty if the page holds no data
     /// \param pParent: Reference to the parent widget
-    explicit AbstractPage(const QString& pTemplatePath, QWidget *pParent = nullptr);
+    explicit AbstractPage(const QString& pTemplatePath, const QString& pPageKey, QWidget *pParent = nullptr);
 
     /// \brief Initializes the configuration page
     virtual void Init(void);
@@ -51,9 +54,17 @@ public:
 
     /// \brief Loads the page parameters from the given JSON object
     ///
+    /// The fields come from the page's ForEachField, parameters missing in the JSON or of the wrong type keep their values.
+    ///
     /// \param pJson: Reference to the JSON object
-    /// \return \b true, if all expected parameters where found in the JSON
-    virtual bool LoadFromJson(const QJsonObject &pJson) = 0;
+    /// \return \b true, if all expected parameters where found in the JSON and could be set
+    bool LoadFromJson(const QJsonObject &pJson);
+
+    /// \brief Loads the page parameters from the given configuration
+    ///
+    /// \param pConfig: Reference to the configuration
+    /// \return \b true, if all parameters could be set, e.g. every dropdown item exists
+    virtual bool LoadFromConfiguration(const Configuration& pConfig) = 0;
 
     /// \brief Writes the page parameters into the given Configuration object
     ///
@@ -66,11 +77,35 @@ public:
     /// \param pOutput: Reference to the text to replace tags in
     virtual void ReplaceTags(QStringList& pOutput) = 0;
 
+    /// \brief Counters of the code preview, shown in the performance dock
+    struct Statistics
+    {
+        int32_t renders{0}; ///< Code previews rendered
+        int32_t signalsReceived{0}; ///< Parameter changes of the page's widgets
+        qint64 lastRenderNs{0}; ///< Duration of the last render
+        qint64 p95RenderNs{0}; ///< 95th percentile of the last renders
+        qint64 templateBytes{0}; ///< Memory held by the loaded preview template
+    };
+
+    /// \brief Returns the counters of the code preview
+    ///
+    /// \return The counters
+    Statistics GetStatistics(void) const;
+
+    /// \brief Selects the template pack the code preview template is read from
+    ///
+    /// \param pDirectory: Resource folder of the template pack
+    void SetTemplateDirectory(const QString& pDirectory);
+
 public slots:
     /// \brief Generates a code preview based on the template and GUI states and
     /// emits UpdatePreviewSignal with the code preview included
     virtual void OnUpdatePreview(void);
 
+protected slots:
+    /// \brief Emits ConfigurationChangedSignal unless the page is being loaded
+    void OnConfigurationChanged(void);
+
 protected:
     /// \brief Connects this widget's signals and slots
     virtual void ConnectGuiSignalsAndSlots(void);
@@ -80,10 +115,25 @@ signals:
     /// \param pOutput: The code preview text to display
     void UpdatePreviewSignal(const QStringList& pOutput);
 
+    /// \brief Emitted when the user changed a parameter on the page
+    void ConfigurationChangedSignal(void);
+
 protected:
+    QString mTemplatePath;
+    QString mPageKey;
+    QString mTemplateDirectory;
+
+    /// \brief Read on the first preview, so that only templates of shown pages are loaded
     std::optional<QStringList> mTemplate;
 
     bool mIsLoading{false};
+
+    /// \brief Number of render durations the percentile is computed from
+    static constexpr size_t RENDER_SAMPLES{128};
+
+    int32_t mRenders{0};
+    int32_t mSignalsReceived{0};
+    std::array<qint64, RENDER_SAMPLES> mRenderSamples{};
 };
 
 #endif // ABSTRACTPAGE_H
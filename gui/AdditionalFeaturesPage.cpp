@@ -26,11 +26,13 @@
 #include "AdditionalFeaturesPage.h"
 #include "./ui_AdditionalFeaturesPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 AdditionalFeaturesPage::AdditionalFeaturesPage(QWidget *pParent) :
-    AbstractPage(ADDITIONAL_FEATURES_TEMPLATE_PATH, pParent),
+    AbstractPage(ADDITIONAL_FEATURES_TEMPLATE_PATH, QString(), pParent),
     mUi(new Ui::AdditionalFeaturesPage)
 {
+    const TraceSpan span("AdditionalFeaturesPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -56,7 +58,7 @@ void AdditionalFeaturesPage::ResetValues()
     mIsLoading = false;
 }
 
-bool AdditionalFeaturesPage::LoadFromJson(const QJsonObject &pJson)
+bool AdditionalFeaturesPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
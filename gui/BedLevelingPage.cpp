@@ -26,11 +26,13 @@
 #include "BedLevelingPage.h"
 #include "./ui_BedLevelingPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 BedLevelingPage::BedLevelingPage(QWidget *pParent) :
-    AbstractPage(BED_LEVELING_TEMPLATE_PATH, pParent),
+    AbstractPage(BED_LEVELING_TEMPLATE_PATH, "bedLeveling", pParent),
     mUi(new Ui::BedLevelingPage)
 {
+    const TraceSpan span("BedLevelingPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -152,73 +154,73 @@ void BedLevelingPage::ResetValues()
     mIsLoading = false;
 }
 
-bool BedLevelingPage::LoadFromJson(const QJsonObject &pJson)
+bool BedLevelingPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uAutoBedLeveling3pointBox, pJson, "AUTO_BED_LEVELING_3POINT");
-    success &= LoadConfig(mUi->uAutoBedLevelingLinearBox, pJson, "AUTO_BED_LEVELING_LINEAR");
-    success &= LoadConfig(mUi->uAutoBedLevelingBilinearBox, pJson, "AUTO_BED_LEVELING_BILINEAR");
-    success &= LoadConfig(mUi->uAutoBedLevelingUblBox, pJson, "AUTO_BED_LEVELING_UBL");
-    success &= LoadConfig(mUi->uMeshBedLevelingBox, pJson, "MESH_BED_LEVELING");
-    success &= LoadConfig(mUi->uRestoreLevelingAfterG28Box, pJson, "RESTORE_LEVELING_AFTER_G28");
-    success &= LoadConfig(mUi->uEnableLevelingAfterG28Box, pJson, "ENABLE_LEVELING_AFTER_G28");
-    success &= LoadConfig(mUi->uLevelingNozzleTempSpinBox, pJson, "LEVELING_NOZZLE_TEMP");
-    success &= LoadConfig(mUi->uLevelingBedTempSpinBox, pJson, "LEVELING_BED_TEMP");
-    success &= LoadConfig(mUi->uBdSensorBox, pJson, "BD_SENSOR");
-    success &= LoadConfig(mUi->uDebugLevelingFeatureBox, pJson, "DEBUG_LEVELING_FEATURE");
-    success &= LoadConfig(mUi->uManualProbeStartZSpinBox, pJson, "MANUAL_PROBE_START_Z");
-    success &= LoadConfig(mUi->uManualProbeStartZBox, pJson, "ENABLE_MANUAL_PROBE_START_Z");
-    success &= LoadConfig(mUi->uEnableLevelingFadeHeightBox, pJson, "ENABLE_LEVELING_FADE_HEIGHT");
-    success &= LoadConfig(mUi->uDefaultLevelingFadeHeightSpinBox, pJson, "DEFAULT_LEVELING_FADE_HEIGHT");
-    success &= LoadConfig(mUi->uSegmentLeveledMovesBox, pJson, "SEGMENT_LEVELED_MOVES");
-    success &= LoadConfig(mUi->uLeveledSegmentLengthSpinBox, pJson, "LEVELED_SEGMENT_LENGTH");
-    success &= LoadConfig(mUi->uG26MeshValidationBox, pJson, "G26_MESH_VALIDATION");
-    success &= LoadConfig(mUi->uMeshTestNozzleSizeSpinBox, pJson, "MESH_TEST_NOZZLE_SIZE");
-    success &= LoadConfig(mUi->uMeshTestLayerHeightSpinBox, pJson, "MESH_TEST_LAYER_HEIGHT");
-    success &= LoadConfig(mUi->uMeshTestHotendTempSpinBox, pJson, "MESH_TEST_HOTEND_TEMP");
-    success &= LoadConfig(mUi->uMeshTestBedTempSpinBox, pJson, "MESH_TEST_BED_TEMP");
-    success &= LoadConfig(mUi->uG26XyFeedrateSpinBox, pJson, "G26_XY_FEEDRATE");
-    success &= LoadConfig(mUi->uG26XyFeedrateTravelSpinBox, pJson, "G26_XY_FEEDRATE_TRAVEL");
-    success &= LoadConfig(mUi->uG26RetractMultiplierSpinBox, pJson, "G26_RETRACT_MULTIPLIER");
-    success &= LoadConfig(mUi->uPreheatBeforeLevelingBox, pJson, "PREHEAT_BEFORE_LEVELING");
-    success &= LoadConfig(mUi->uGridMaxPointsXSpinBox, pJson, "GRID_MAX_POINTS_X");
-    success &= LoadConfig(mUi->uGridMaxPointsYSpinBox, pJson, "GRID_MAX_POINTS_Y");
-    success &= LoadConfig(mUi->uProbeYFirstBox, pJson, "PROBE_Y_FIRST");
-    success &= LoadConfig(mUi->uExtrapolateBeyondGridBox, pJson, "EXTRAPOLATE_BEYOND_GRID");
-    success &= LoadConfig(mUi->uAblBilinearSubdivisionBox, pJson, "ABL_BILINEAR_SUBDIVISION");
-    success &= LoadConfig(mUi->uBilinearSubdivisionsSpinBox, pJson, "BILINEAR_SUBDIVISIONS");
-    success &= LoadConfig(mUi->uMeshEditGfxOverlayBox, pJson, "MESH_EDIT_GFX_OVERLAY");
-    success &= LoadConfig(mUi->uMeshInsetSpinBox, pJson, "MESH_INSET");
-    success &= LoadConfig(mUi->uGridMaxPointsXSpinBox_2, pJson, "GRID_MAX_POINTS_X_2");
-    success &= LoadConfig(mUi->uGridMaxPointsYSpinBox_2, pJson, "GRID_MAX_POINTS_Y_2");
-    success &= LoadConfig(mUi->uUblHilbertCurveBox, pJson, "UBL_HILBERT_CURVE");
-    success &= LoadConfig(mUi->uUblMeshEditMovesZBox, pJson, "UBL_MESH_EDIT_MOVES_Z");
-    success &= LoadConfig(mUi->uUblSaveActiveOnM500Box, pJson, "UBL_SAVE_ACTIVE_ON_M500");
-    success &= LoadConfig(mUi->uUblZRaiseWhenOffMeshSpinBox, pJson, "UBL_Z_RAISE_WHEN_OFF_MESH");
-    success &= LoadConfig(mUi->uUblZRaiseWhenOffMeshBox, pJson, "ENABLE_UBL_Z_RAISE_WHEN_OFF_MESH");
-    success &= LoadConfig(mUi->uUblMeshWizardBox, pJson, "UBL_MESH_WIZARD");
-    success &= LoadConfig(mUi->uMeshInsetSpinBox_2, pJson, "MESH_INSET_2");
-    success &= LoadConfig(mUi->uGridMaxPointsXSpinBox_3, pJson, "GRID_MAX_POINTS_X_3");
-    success &= LoadConfig(mUi->uGridMaxPointsYSpinBox_3, pJson, "GRID_MAX_POINTS_Y_3");
-    success &= LoadConfig(mUi->uMeshG28RestOriginBox, pJson, "MESH_G28_REST_ORIGIN");
-    success &= LoadConfig(mUi->uLcdBedLevelingBox, pJson, "LCD_BED_LEVELING");
-    success &= LoadConfig(mUi->uMeshEditZStepSpinBox, pJson, "MESH_EDIT_Z_STEP");
-    success &= LoadConfig(mUi->uLcdProbeZRangeSpinBox, pJson, "LCD_PROBE_Z_RANGE");
-    success &= LoadConfig(mUi->uMeshEditMenuBox, pJson, "MESH_EDIT_MENU");
-    success &= LoadConfig(mUi->uLcdBedTrammingBox, pJson, "LCD_BED_TRAMMING");
-    success &= LoadConfig(mUi->uBedTrammingInsetLfrbEdit, pJson, "BED_TRAMMING_INSET_LFRB");
-    success &= LoadConfig(mUi->uBedTrammingHeightSpinBox, pJson, "BED_TRAMMING_HEIGHT");
-    success &= LoadConfig(mUi->uBedTrammingZHopSpinBox, pJson, "BED_TRAMMING_Z_HOP");
-    success &= LoadConfig(mUi->uBedTrammingIncludeCenterBox, pJson, "BED_TRAMMING_INCLUDE_CENTER");
-    success &= LoadConfig(mUi->uBedTrammingUseProbeBox, pJson, "BED_TRAMMING_USE_PROBE");
-    success &= LoadConfig(mUi->uBedTrammingProbeToleranceSpinBox, pJson, "BED_TRAMMING_PROBE_TOLERANCE");
-    success &= LoadConfig(mUi->uBedTrammingVerifyRaisedBox, pJson, "BED_TRAMMING_VERIFY_RAISED");
-    success &= LoadConfig(mUi->uBedTrammingAudioFeedbackBox, pJson, "BED_TRAMMING_AUDIO_FEEDBACK");
-    success &= LoadConfig(mUi->uBedTrammingLevelingOrderEdit, pJson, "BED_TRAMMING_LEVELING_ORDER");
-    success &= LoadConfig(mUi->uZProbeEndScriptEdit, pJson, "Z_PROBE_END_SCRIPT");
-    success &= LoadConfig(mUi->uZProbeEndScriptBox, pJson, "ENABLE_Z_PROBE_END_SCRIPT");
+    success &= LoadConfig(mUi->uAutoBedLeveling3pointBox, pConfig.bedLeveling.AUTO_BED_LEVELING_3POINT);
+    success &= LoadConfig(mUi->uAutoBedLevelingLinearBox, pConfig.bedLeveling.AUTO_BED_LEVELING_LINEAR);
+    success &= LoadConfig(mUi->uAutoBedLevelingBilinearBox, pConfig.bedLeveling.AUTO_BED_LEVELING_BILINEAR);
+    success &= LoadConfig(mUi->uAutoBedLevelingUblBox, pConfig.bedLeveling.AUTO_BED_LEVELING_UBL);
+    success &= LoadConfig(mUi->uMeshBedLevelingBox, pConfig.bedLeveling.MESH_BED_LEVELING);
+    success &= LoadConfig(mUi->uRestoreLevelingAfterG28Box, pConfig.bedLeveling.RESTORE_LEVELING_AFTER_G28);
+    success &= LoadConfig(mUi->uEnableLevelingAfterG28Box, pConfig.bedLeveling.ENABLE_LEVELING_AFTER_G28);
+    success &= LoadConfig(mUi->uLevelingNozzleTempSpinBox, pConfig.bedLeveling.LEVELING_NOZZLE_TEMP);
+    success &= LoadConfig(mUi->uLevelingBedTempSpinBox, pConfig.bedLeveling.LEVELING_BED_TEMP);
+    success &= LoadConfig(mUi->uBdSensorBox, pConfig.bedLeveling.BD_SENSOR);
+    success &= LoadConfig(mUi->uDebugLevelingFeatureBox, pConfig.bedLeveling.DEBUG_LEVELING_FEATURE);
+    success &= LoadConfig(mUi->uManualProbeStartZSpinBox, pConfig.bedLeveling.MANUAL_PROBE_START_Z);
+    success &= LoadConfig(mUi->uManualProbeStartZBox, pConfig.bedLeveling.ENABLE_MANUAL_PROBE_START_Z);
+    success &= LoadConfig(mUi->uEnableLevelingFadeHeightBox, pConfig.bedLeveling.ENABLE_LEVELING_FADE_HEIGHT);
+    success &= LoadConfig(mUi->uDefaultLevelingFadeHeightSpinBox, pConfig.bedLeveling.DEFAULT_LEVELING_FADE_HEIGHT);
+    success &= LoadConfig(mUi->uSegmentLeveledMovesBox, pConfig.bedLeveling.SEGMENT_LEVELED_MOVES);
+    success &= LoadConfig(mUi->uLeveledSegmentLengthSpinBox, pConfig.bedLeveling.LEVELED_SEGMENT_LENGTH);
+    success &= LoadConfig(mUi->uG26MeshValidationBox, pConfig.bedLeveling.G26_MESH_VALIDATION);
+    success &= LoadConfig(mUi->uMeshTestNozzleSizeSpinBox, pConfig.bedLeveling.MESH_TEST_NOZZLE_SIZE);
+    success &= LoadConfig(mUi->uMeshTestLayerHeightSpinBox, pConfig.bedLeveling.MESH_TEST_LAYER_HEIGHT);
+    success &= LoadConfig(mUi->uMeshTestHotendTempSpinBox, pConfig.bedLeveling.MESH_TEST_HOTEND_TEMP);
+    success &= LoadConfig(mUi->uMeshTestBedTempSpinBox, pConfig.bedLeveling.MESH_TEST_BED_TEMP);
+    success &= LoadConfig(mUi->uG26XyFeedrateSpinBox, pConfig.bedLeveling.G26_XY_FEEDRATE);
+    success &= LoadConfig(mUi->uG26XyFeedrateTravelSpinBox, pConfig.bedLeveling.G26_XY_FEEDRATE_TRAVEL);
+    success &= LoadConfig(mUi->uG26RetractMultiplierSpinBox, pConfig.bedLeveling.G26_RETRACT_MULTIPLIER);
+    success &= LoadConfig(mUi->uPreheatBeforeLevelingBox, pConfig.bedLeveling.PREHEAT_BEFORE_LEVELING);
+    success &= LoadConfig(mUi->uGridMaxPointsXSpinBox, pConfig.bedLeveling.GRID_MAX_POINTS_X);
+    success &= LoadConfig(mUi->uGridMaxPointsYSpinBox, pConfig.bedLeveling.GRID_MAX_POINTS_Y);
+    success &= LoadConfig(mUi->uProbeYFirstBox, pConfig.bedLeveling.PROBE_Y_FIRST);
+    success &= LoadConfig(mUi->uExtrapolateBeyondGridBox, pConfig.bedLeveling.EXTRAPOLATE_BEYOND_GRID);
+    success &= LoadConfig(mUi->uAblBilinearSubdivisionBox, pConfig.bedLeveling.ABL_BILINEAR_SUBDIVISION);
+    success &= LoadConfig(mUi->uBilinearSubdivisionsSpinBox, pConfig.bedLeveling.BILINEAR_SUBDIVISIONS);
+    success &= LoadConfig(mUi->uMeshEditGfxOverlayBox, pConfig.bedLeveling.MESH_EDIT_GFX_OVERLAY);
+    success &= LoadConfig(mUi->uMeshInsetSpinBox, pConfig.bedLeveling.MESH_INSET);
+    success &= LoadConfig(mUi->uGridMaxPointsXSpinBox_2, pConfig.bedLeveling.GRID_MAX_POINTS_X_2);
+    success &= LoadConfig(mUi->uGridMaxPointsYSpinBox_2, pConfig.bedLeveling.GRID_MAX_POINTS_Y_2);
+    success &= LoadConfig(mUi->uUblHilbertCurveBox, pConfig.bedLeveling.UBL_HILBERT_CURVE);
+    success &= LoadConfig(mUi->uUblMeshEditMovesZBox, pConfig.bedLeveling.UBL_MESH_EDIT_MOVES_Z);
+    success &= LoadConfig(mUi->uUblSaveActiveOnM500Box, pConfig.bedLeveling.UBL_SAVE_ACTIVE_ON_M500);
+    success &= LoadConfig(mUi->uUblZRaiseWhenOffMeshSpinBox, pConfig.bedLeveling.UBL_Z_RAISE_WHEN_OFF_MESH);
+    success &= LoadConfig(mUi->uUblZRaiseWhenOffMeshBox, pConfig.bedLeveling.ENABLE_UBL_Z_RAISE_WHEN_OFF_MESH);
+    success &= LoadConfig(mUi->uUblMeshWizardBox, pConfig.bedLeveling.UBL_MESH_WIZARD);
+    success &= LoadConfig(mUi->uMeshInsetSpinBox_2, pConfig.bedLeveling.MESH_INSET_2);
+    success &= LoadConfig(mUi->uGridMaxPointsXSpinBox_3, pConfig.bedLeveling.GRID_MAX_POINTS_X_3);
+    success &= LoadConfig(mUi->uGridMaxPointsYSpinBox_3, pConfig.bedLeveling.GRID_MAX_POINTS_Y_3);
+    success &= LoadConfig(mUi->uMeshG28RestOriginBox, pConfig.bedLeveling.MESH_G28_REST_ORIGIN);
+    success &= LoadConfig(mUi->uLcdBedLevelingBox, pConfig.bedLeveling.LCD_BED_LEVELING);
+    success &= LoadConfig(mUi->uMeshEditZStepSpinBox, pConfig.bedLeveling.MESH_EDIT_Z_STEP);
+    success &= LoadConfig(mUi->uLcdProbeZRangeSpinBox, pConfig.bedLeveling.LCD_PROBE_Z_RANGE);
+    success &= LoadConfig(mUi->uMeshEditMenuBox, pConfig.bedLeveling.MESH_EDIT_MENU);
+    success &= LoadConfig(mUi->uLcdBedTrammingBox, pConfig.bedLeveling.LCD_BED_TRAMMING);
+    success &= LoadConfig(mUi->uBedTrammingInsetLfrbEdit, pConfig.bedLeveling.BED_TRAMMING_INSET_LFRB);
+    success &= LoadConfig(mUi->uBedTrammingHeightSpinBox, pConfig.bedLeveling.BED_TRAMMING_HEIGHT);
+    success &= LoadConfig(mUi->uBedTrammingZHopSpinBox, pConfig.bedLeveling.BED_TRAMMING_Z_HOP);
+    success &= LoadConfig(mUi->uBedTrammingIncludeCenterBox, pConfig.bedLeveling.BED_TRAMMING_INCLUDE_CENTER);
+    success &= LoadConfig(mUi->uBedTrammingUseProbeBox, pConfig.bedLeveling.BED_TRAMMING_USE_PROBE);
+    success &= LoadConfig(mUi->uBedTrammingProbeToleranceSpinBox, pConfig.bedLeveling.BED_TRAMMING_PROBE_TOLERANCE);
+    success &= LoadConfig(mUi->uBedTrammingVerifyRaisedBox, pConfig.bedLeveling.BED_TRAMMING_VERIFY_RAISED);
+    success &= LoadConfig(mUi->uBedTrammingAudioFeedbackBox, pConfig.bedLeveling.BED_TRAMMING_AUDIO_FEEDBACK);
+    success &= LoadConfig(mUi->uBedTrammingLevelingOrderEdit, pConfig.bedLeveling.BED_TRAMMING_LEVELING_ORDER);
+    success &= LoadConfig(mUi->uZProbeEndScriptEdit, pConfig.bedLeveling.Z_PROBE_END_SCRIPT);
+    success &= LoadConfig(mUi->uZProbeEndScriptBox, pConfig.bedLeveling.ENABLE_Z_PROBE_END_SCRIPT);
 
     mIsLoading = false;
     return success;
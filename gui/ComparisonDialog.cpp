@@ -0,0 +1,122 @@
+/*!
+ * \file ComparisonDialog.cpp
+ * \brief The ComparisonDialog class shows configurations side by side
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ComparisonDialog.h"
+#include "./ui_ComparisonDialog.h"
+
+#include <QFileDialog>
+#include <QHash>
+
+ComparisonDialog::ComparisonDialog(QWidget *pParent) :
+    QDialog(pParent),
+    mUi(new Ui::ComparisonDialog)
+{
+    mUi->setupUi(this);
+
+    QObject::connect(mUi->uSearchBox, &QLineEdit::textChanged, this, &ComparisonDialog::OnApplyFilter);
+    QObject::connect(mUi->uExportButton, &QPushButton::clicked, this, &ComparisonDialog::OnExport);
+    QObject::connect(mUi->uCloseButton, &QPushButton::clicked, this, &ComparisonDialog::close);
+}
+
+ComparisonDialog::~ComparisonDialog()
+{
+    delete mUi;
+}
+
+void ComparisonDialog::SetComparison(const QStringList& pLabels, const QList<QStringList>& pRows, const QString& pSummary)
+{
+    const QColor differentColor(249, 154, 0);
+
+    mUi->uSummaryLabel->setText(pSummary);
+
+    mUi->uComparisonTable->setUpdatesEnabled(false);
+    mUi->uComparisonTable->clear();
+    mUi->uComparisonTable->setColumnCount(pLabels.size() + 2);
+    mUi->uComparisonTable->setHorizontalHeaderLabels(QStringList{"Page", "Field"} + pLabels);
+    mUi->uComparisonTable->setRowCount(pRows.size());
+
+    for (int32_t row = 0; row < pRows.size(); ++row)
+    {
+        const auto& cells = pRows.at(row);
+
+        // The most common value is taken as the reference of the row
+        QHash<QString, int32_t> counts;
+        for (int32_t column = 2; column < cells.size(); ++column)
+        {
+            ++counts[cells.at(column)];
+        }
+
+        QString reference;
+        int32_t referenceCount = 0;
+        for (auto it = counts.cbegin(); it != counts.cend(); ++it)
+        {
+            if (it.value() > referenceCount)
+            {
+                reference = it.key();
+                referenceCount = it.value();
+            }
+        }
+
+        for (int32_t column = 0; column < cells.size(); ++column)
+        {
+            auto item = new QTableWidgetItem(cells.at(column));
+
+            if (column >= 2 && cells.at(column) != reference)
+            {
+                item->setForeground(differentColor);
+            }
+
+            mUi->uComparisonTable->setItem(row, column, item);
+        }
+    }
+
+    mUi->uComparisonTable->resizeColumnsToContents();
+    mUi->uComparisonTable->setUpdatesEnabled(true);
+
+    OnApplyFilter();
+}
+
+void ComparisonDialog::OnApplyFilter()
+{
+    const auto searchText = mUi->uSearchBox->text().trimmed();
+
+    for (int32_t row = 0; row < mUi->uComparisonTable->rowCount(); ++row)
+    {
+        const auto visible = searchText.isEmpty()
+                || mUi->uComparisonTable->item(row, 0)->text().contains(searchText, Qt::CaseInsensitive)
+                || mUi->uComparisonTable->item(row, 1)->text().contains(searchText, Qt::CaseInsensitive);
+
+        mUi->uComparisonTable->setRowHidden(row, !visible);
+    }
+}
+
+void ComparisonDialog::OnExport()
+{
+    const auto path = QFileDialog::getSaveFileName(this, tr("Export Comparison..."), QDir::homePath() + "/comparison.csv", tr("CSV (*.csv);;JSON (*.json)"));
+    if (!path.isEmpty())
+    {
+        emit ExportSignal(path);
+    }
+}
@@ -0,0 +1,80 @@
+/*!
+ * \file ComparisonDialog.h
+ * \brief The ComparisonDialog class shows configurations side by side
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef COMPARISONDIALOG_H
+#define COMPARISONDIALOG_H
+
+#include <QDialog>
+#include <QList>
+#include <QStringList>
+
+// Forward declarations
+namespace Ui {
+class ComparisonDialog;
+}
+
+///
+/// \brief The ComparisonDialog class shows configurations side by side
+///
+/// Each row is a field that differs between the configurations. Values that differ from the most
+/// common value of their row are highlighted.
+///
+class ComparisonDialog : public QDialog
+{
+    Q_OBJECT
+public:
+    /// \brief Constructor for ComparisonDialog
+    ///
+    /// \param pParent: Reference to the parent widget
+    explicit ComparisonDialog(QWidget *pParent = nullptr);
+
+    /// \brief Default destructor for ComparisonDialog
+    ~ComparisonDialog(void) override;
+
+    /// \brief Displays a comparison
+    ///
+    /// \param pLabels: The names of the compared configurations
+    /// \param pRows: The differing fields as page, field and one value per configuration
+    /// \param pSummary: The text shown above the table
+    void SetComparison(const QStringList& pLabels, const QList<QStringList>& pRows, const QString& pSummary);
+
+signals:
+    /// \brief Emitted when the comparison should be exported
+    ///
+    /// \param pPath: The export file, a .json file or a .csv file
+    void ExportSignal(const QString& pPath);
+
+protected slots:
+    /// \brief Hides all rows whose page and field do not match the search text
+    void OnApplyFilter(void);
+
+    /// \brief Asks for the export file
+    void OnExport(void);
+
+private:
+    Ui::ComparisonDialog *mUi;
+};
+
+#endif // COMPARISONDIALOG_H
@@ -0,0 +1,122 @@
+/*!
+ * \file ConfigurationRenderer.cpp
+ * \brief The ConfigurationRenderer class generates Configuration.h without the displayed pages
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "ConfigurationRenderer.h"
+#include "AdditionalFeaturesPage.h"
+#include "BedLevelingPage.h"
+#include "EncoderPage.h"
+#include "EndstopsPage.h"
+#include "ExtraFeaturesPage.h"
+#include "ExtruderPage.h"
+#include "FilamentRunoutSensorPage.h"
+#include "FirmwarePage.h"
+#include "HardwarePage.h"
+#include "HomingAndBoundsPage.h"
+#include "HomingOptionsPage.h"
+#include "KinematicsPage.h"
+#include "LCDControllerPage.h"
+#include "LCDMenuItemsPage.h"
+#include "MovementPage.h"
+#include "PowerSupplyPage.h"
+#include "SDCardPage.h"
+#include "SpeakerPage.h"
+#include "StepperDriversPage.h"
+#include "ThermalSettingsPage.h"
+#include "Trace.h"
+#include "UserInterfaceLanguagePage.h"
+#include "ZProbeOptionsPage.h"
+
+ConfigurationRenderer::ConfigurationRenderer()
+{
+    mHardwarePage = new HardwarePage(&mRoot);
+    mThermalSettingsPage = new ThermalSettingsPage(&mRoot);
+    mStepperDriversPage = new StepperDriversPage(&mRoot);
+
+    mPages = {
+        new FirmwarePage(&mRoot), mHardwarePage, new ExtruderPage(&mRoot), new PowerSupplyPage(&mRoot),
+        mThermalSettingsPage, new KinematicsPage(&mRoot), new EndstopsPage(&mRoot), new MovementPage(&mRoot),
+        mStepperDriversPage, new HomingAndBoundsPage(&mRoot), new FilamentRunoutSensorPage(&mRoot), new BedLevelingPage(&mRoot),
+        new HomingOptionsPage(&mRoot), new UserInterfaceLanguagePage(&mRoot), new SDCardPage(&mRoot), new LCDMenuItemsPage(&mRoot),
+        new EncoderPage(&mRoot), new SpeakerPage(&mRoot), new LCDControllerPage(&mRoot), new ExtraFeaturesPage(&mRoot),
+        new AdditionalFeaturesPage(&mRoot), new ZProbeOptionsPage(&mRoot)
+    };
+
+    for (auto&& page : mPages)
+    {
+        page->Init();
+    }
+}
+
+void ConfigurationRenderer::SetHardwareCatalogs(const QStringList& pMotherboards, const QStringList& pThermistors, const QStringList& pDriverTypes)
+{
+    mHardwarePage->AddMotherboards(pMotherboards);
+    mThermalSettingsPage->AddThermistors(pThermistors);
+    mStepperDriversPage->AddDriverTypes(pDriverTypes);
+}
+
+ConfigurationRenderer::Result ConfigurationRenderer::Render(const QStringList& pTemplate, const Configuration& pConfiguration)
+{
+    const TraceSpan span("ConfigurationRenderer::Render");
+
+    Configuration loaded;
+    for (auto&& page : mPages)
+    {
+        page->LoadFromConfiguration(pConfiguration);
+        page->FetchConfiguration(loaded);
+    }
+
+    // A page that could not take a value keeps another one, so comparing the values read back finds all of them
+    Result result;
+    const auto requested = pConfiguration.ToJson();
+    const auto actual = loaded.ToJson();
+    for (auto page = requested.constBegin(); page != requested.constEnd(); ++page)
+    {
+        const auto fields = page.value().toObject();
+        const auto actualFields = actual.value(page.key()).toObject();
+        for (auto field = fields.constBegin(); field != fields.constEnd(); ++field)
+        {
+            if (actualFields.value(field.key()) != field.value())
+            {
+                result.unmappedFields.append(QString("%0/%1").arg(page.key(), field.key()));
+            }
+        }
+    }
+
+    // The build environment is not part of Configuration.h and the pages only list the built-in ones
+    result.unmappedFields.removeAll("hardware/ENVIRONMENT");
+
+    if (!result.unmappedFields.isEmpty())
+    {
+        return result;
+    }
+
+    result.code = pTemplate;
+    for (auto&& page : mPages)
+    {
+        page->ReplaceTags(result.code.value());
+    }
+
+    return result;
+}
@@ -0,0 +1,92 @@
+/*!
+ * \file ConfigurationRenderer.h
+ * \brief The ConfigurationRenderer class generates Configuration.h without the displayed pages
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef CONFIGURATIONRENDERER_H
+#define CONFIGURATIONRENDERER_H
+
+#include "Configuration.h"
+
+#include <QStringList>
+#include <QWidget>
+
+#include <optional>
+#include <vector>
+
+// Forward declarations
+class AbstractPage;
+class HardwarePage;
+class ThermalSettingsPage;
+class StepperDriversPage;
+
+///
+/// \brief The ConfigurationRenderer class generates Configuration.h without the displayed pages
+///
+/// The renderer owns a hidden instance of every configuration page. A configuration is loaded into
+/// these pages and their tags are replaced, so the output matches what the displayed pages generate,
+/// including the defines the page logic disables. The displayed configuration, the undo history and
+/// the listeners of the main window are not involved. The pages are widgets, so the renderer is used
+/// on the GUI thread.
+///
+class ConfigurationRenderer
+{
+public:
+    /// \brief The result of Render
+    struct Result
+    {
+        std::optional<QStringList> code; ///< The Configuration.h content, if all values could be set
+        QStringList unmappedFields; ///< The fields the pages could not take, e.g. "hardware/MOTHERBOARD"
+    };
+
+    /// \brief Constructor for ConfigurationRenderer
+    ConfigurationRenderer(void);
+
+    /// \brief Sets the dropdown items found in a workspace, replacing those of the previous workspace
+    ///
+    /// \param pMotherboards: The motherboards, e.g. "RAMPS 1.4 [BOARD_RAMPS_14_EFB]"
+    /// \param pThermistors: The thermistor types
+    /// \param pDriverTypes: The stepper driver types
+    void SetHardwareCatalogs(const QStringList& pMotherboards, const QStringList& pThermistors, const QStringList& pDriverTypes);
+
+    /// \brief Generates Configuration.h for a configuration
+    ///
+    /// A value is unmapped if the page reads back a different one, e.g. a motherboard missing in the
+    /// catalog or a number outside the range of its spin box.
+    ///
+    /// \param pTemplate: The configuration template
+    /// \param pConfiguration: The configuration
+    /// \return The Configuration.h content or the fields that could not be set
+    Result Render(const QStringList& pTemplate, const Configuration& pConfiguration);
+
+protected:
+    /// \brief Parent of the pages, never shown, so only the page logic disables widgets
+    QWidget mRoot;
+
+    std::vector<AbstractPage*> mPages;
+    HardwarePage *mHardwarePage{nullptr};
+    ThermalSettingsPage *mThermalSettingsPage{nullptr};
+    StepperDriversPage *mStepperDriversPage{nullptr};
+};
+
+#endif // CONFIGURATIONRENDERER_H
@@ -0,0 +1,99 @@
+/*!
+ * \file EffectiveDefinesWidget.cpp
+ * \brief The EffectiveDefinesWidget class lists the effective values of Marlin's macros
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "EffectiveDefinesWidget.h"
+#include "./ui_EffectiveDefinesWidget.h"
+
+EffectiveDefinesWidget::EffectiveDefinesWidget(QWidget *pParent) :
+    QWidget(pParent),
+    mUi(new Ui::EffectiveDefinesWidget)
+{
+    mUi->setupUi(this);
+
+    mUi->uDefinesTable->sortByColumn(0, Qt::AscendingOrder);
+
+    QObject::connect(mUi->uSearchBox, &QLineEdit::textChanged, this, &EffectiveDefinesWidget::OnApplyFilter);
+    QObject::connect(mUi->uChangedOnlyBox, &QCheckBox::toggled, this, &EffectiveDefinesWidget::OnApplyFilter);
+}
+
+EffectiveDefinesWidget::~EffectiveDefinesWidget()
+{
+    delete mUi;
+}
+
+void EffectiveDefinesWidget::SetDefines(const QHash<QString, QString>& pDefines, const QSet<QString>& pChanged)
+{
+    mChanged = pChanged;
+
+    const QColor changedColor(249, 154, 0);
+
+    mUi->uDefinesTable->setSortingEnabled(false);
+    mUi->uDefinesTable->setUpdatesEnabled(false);
+    mUi->uDefinesTable->clearContents();
+    mUi->uDefinesTable->setRowCount(pDefines.size());
+
+    int32_t row = 0;
+    for (auto it = pDefines.cbegin(); it != pDefines.cend(); ++it, ++row)
+    {
+        auto nameItem = new QTableWidgetItem(it.key());
+        auto valueItem = new QTableWidgetItem(it.value());
+
+        if (mChanged.contains(it.key()))
+        {
+            nameItem->setForeground(changedColor);
+            valueItem->setForeground(changedColor);
+        }
+
+        mUi->uDefinesTable->setItem(row, 0, nameItem);
+        mUi->uDefinesTable->setItem(row, 1, valueItem);
+    }
+
+    mUi->uDefinesTable->setSortingEnabled(true);
+    mUi->uDefinesTable->resizeColumnToContents(0);
+    mUi->uDefinesTable->setUpdatesEnabled(true);
+
+    OnApplyFilter();
+}
+
+void EffectiveDefinesWidget::SetStatus(const QString& pText)
+{
+    mUi->uStatusLabel->setText(pText);
+}
+
+void EffectiveDefinesWidget::OnApplyFilter()
+{
+    const auto searchText = mUi->uSearchBox->text().trimmed();
+    const auto changedOnly = mUi->uChangedOnlyBox->isChecked();
+
+    for (int32_t row = 0; row < mUi->uDefinesTable->rowCount(); ++row)
+    {
+        const auto name = mUi->uDefinesTable->item(row, 0)->text();
+
+        const auto visible = (!changedOnly || mChanged.contains(name))
+                && (searchText.isEmpty() || name.contains(searchText, Qt::CaseInsensitive));
+
+        mUi->uDefinesTable->setRowHidden(row, !visible);
+    }
+}
@@ -0,0 +1,74 @@
+/*!
+ * \file EffectiveDefinesWidget.h
+ * \brief The EffectiveDefinesWidget class lists the effective values of Marlin's macros
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef EFFECTIVEDEFINESWIDGET_H
+#define EFFECTIVEDEFINESWIDGET_H
+
+#include <QHash>
+#include <QSet>
+#include <QWidget>
+
+// Forward declarations
+namespace Ui {
+class EffectiveDefinesWidget;
+}
+
+///
+/// \brief The EffectiveDefinesWidget class lists the effective values of Marlin's macros
+///
+class EffectiveDefinesWidget : public QWidget
+{
+    Q_OBJECT
+public:
+    /// \brief Constructor for EffectiveDefinesWidget
+    ///
+    /// \param pParent: Reference to the parent widget
+    explicit EffectiveDefinesWidget(QWidget *pParent = nullptr);
+
+    /// \brief Default destructor for EffectiveDefinesWidget
+    ~EffectiveDefinesWidget(void) override;
+
+    /// \brief Displays the given macros
+    ///
+    /// \param pDefines: Maps macro names to their definitions
+    /// \param pChanged: Names of the macros that changed with the last evaluation
+    void SetDefines(const QHash<QString, QString>& pDefines, const QSet<QString>& pChanged);
+
+    /// \brief Sets the status text next to the search box
+    ///
+    /// \param pText: The status text
+    void SetStatus(const QString& pText);
+
+protected slots:
+    /// \brief Hides all rows that do not match the search text or the changed filter
+    void OnApplyFilter(void);
+
+private:
+    Ui::EffectiveDefinesWidget *mUi;
+
+    QSet<QString> mChanged;
+};
+
+#endif // EFFECTIVEDEFINESWIDGET_H
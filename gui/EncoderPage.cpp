@@ -26,11 +26,13 @@
 #include "EncoderPage.h"
 #include "./ui_EncoderPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 EncoderPage::EncoderPage(QWidget *pParent) :
-    AbstractPage(ENCODER_TEMPLATE_PATH, pParent),
+    AbstractPage(ENCODER_TEMPLATE_PATH, "encoder", pParent),
     mUi(new Ui::EncoderPage)
 {
+    const TraceSpan span("EncoderPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -68,22 +70,22 @@ void EncoderPage::ResetValues()
     mIsLoading = false;
 }
 
-bool EncoderPage::LoadFromJson(const QJsonObject &pJson)
+bool EncoderPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uEncoderPulsesPerStepSpinBox, pJson, "ENCODER_PULSES_PER_STEP");
-    success &= LoadConfig(mUi->uEncoderPulsesPerStepBox, pJson, "ENABLE_ENCODER_PULSES_PER_STEP");
-    success &= LoadConfig(mUi->uEncoderStepsPerMenuItemSpinBox, pJson, "ENCODER_STEPS_PER_MENU_ITEM");
-    success &= LoadConfig(mUi->uEncoderStepsPerMenuItemBox, pJson, "ENABLE_ENCODER_STEPS_PER_MENU_ITEM");
-    success &= LoadConfig(mUi->uReverseEncoderDirectionBox, pJson, "REVERSE_ENCODER_DIRECTION");
-    success &= LoadConfig(mUi->uReverseMenuDirectionBox, pJson, "REVERSE_MENU_DIRECTION");
-    success &= LoadConfig(mUi->uReverseSelectDirectionBox, pJson, "REVERSE_SELECT_DIRECTION");
-    success &= LoadConfig(mUi->uEncoderNoiseFilterBox, pJson, "ENCODER_NOISE_FILTER");
-    success &= LoadConfig(mUi->uEncoderSamplesSpinBox, pJson, "ENCODER_SAMPLES");
-    success &= LoadConfig(mUi->uIndividualAxisHomingMenuBox, pJson, "INDIVIDUAL_AXIS_HOMING_MENU");
-    success &= LoadConfig(mUi->uIndividualAxisHomingSubmenuBox, pJson, "INDIVIDUAL_AXIS_HOMING_SUBMENU");
+    success &= LoadConfig(mUi->uEncoderPulsesPerStepSpinBox, pConfig.encoder.ENCODER_PULSES_PER_STEP);
+    success &= LoadConfig(mUi->uEncoderPulsesPerStepBox, pConfig.encoder.ENABLE_ENCODER_PULSES_PER_STEP);
+    success &= LoadConfig(mUi->uEncoderStepsPerMenuItemSpinBox, pConfig.encoder.ENCODER_STEPS_PER_MENU_ITEM);
+    success &= LoadConfig(mUi->uEncoderStepsPerMenuItemBox, pConfig.encoder.ENABLE_ENCODER_STEPS_PER_MENU_ITEM);
+    success &= LoadConfig(mUi->uReverseEncoderDirectionBox, pConfig.encoder.REVERSE_ENCODER_DIRECTION);
+    success &= LoadConfig(mUi->uReverseMenuDirectionBox, pConfig.encoder.REVERSE_MENU_DIRECTION);
+    success &= LoadConfig(mUi->uReverseSelectDirectionBox, pConfig.encoder.REVERSE_SELECT_DIRECTION);
+    success &= LoadConfig(mUi->uEncoderNoiseFilterBox, pConfig.encoder.ENCODER_NOISE_FILTER);
+    success &= LoadConfig(mUi->uEncoderSamplesSpinBox, pConfig.encoder.ENCODER_SAMPLES);
+    success &= LoadConfig(mUi->uIndividualAxisHomingMenuBox, pConfig.encoder.INDIVIDUAL_AXIS_HOMING_MENU);
+    success &= LoadConfig(mUi->uIndividualAxisHomingSubmenuBox, pConfig.encoder.INDIVIDUAL_AXIS_HOMING_SUBMENU);
 
     mIsLoading = false;
     return success;
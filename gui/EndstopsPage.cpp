@@ -26,11 +26,13 @@
 #include "EndstopsPage.h"
 #include "./ui_EndstopsPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 EndstopsPage::EndstopsPage(QWidget *pParent) :
-    AbstractPage(ENDSTOPS_TEMPLATE_PATH, pParent),
+    AbstractPage(ENDSTOPS_TEMPLATE_PATH, "endstops", pParent),
     mUi(new Ui::EndstopsPage)
 {
+    const TraceSpan span("EndstopsPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -154,92 +156,92 @@ void EndstopsPage::ResetValues()
     mIsLoading = false;
 }
 
-bool EndstopsPage::LoadFromJson(const QJsonObject &pJson)
+bool EndstopsPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uUseXminPlugBox, pJson, "USE_XMIN_PLUG");
-    success &= LoadConfig(mUi->uUseYminPlugBox, pJson, "USE_YMIN_PLUG");
-    success &= LoadConfig(mUi->uUseZminPlugBox, pJson, "USE_ZMIN_PLUG");
-    success &= LoadConfig(mUi->uUseIminPlugBox, pJson, "USE_IMIN_PLUG");
-    success &= LoadConfig(mUi->uUseJminPlugBox, pJson, "USE_JMIN_PLUG");
-    success &= LoadConfig(mUi->uUseKminPlugBox, pJson, "USE_KMIN_PLUG");
-    success &= LoadConfig(mUi->uUseUminPlugBox, pJson, "USE_UMIN_PLUG");
-    success &= LoadConfig(mUi->uUseVminPlugBox, pJson, "USE_VMIN_PLUG");
-    success &= LoadConfig(mUi->uUseWminPlugBox, pJson, "USE_WMIN_PLUG");
-    success &= LoadConfig(mUi->uUseXmaxPlugBox, pJson, "USE_XMAX_PLUG");
-    success &= LoadConfig(mUi->uUseYmaxPlugBox, pJson, "USE_YMAX_PLUG");
-    success &= LoadConfig(mUi->uUseZmaxPlugBox, pJson, "USE_ZMAX_PLUG");
-    success &= LoadConfig(mUi->uUseImaxPlugBox, pJson, "USE_IMAX_PLUG");
-    success &= LoadConfig(mUi->uUseJmaxPlugBox, pJson, "USE_JMAX_PLUG");
-    success &= LoadConfig(mUi->uUseKmaxPlugBox, pJson, "USE_KMAX_PLUG");
-    success &= LoadConfig(mUi->uUseUmaxPlugBox, pJson, "USE_UMAX_PLUG");
-    success &= LoadConfig(mUi->uUseVmaxPlugBox, pJson, "USE_VMAX_PLUG");
-    success &= LoadConfig(mUi->uUseWmaxPlugBox, pJson, "USE_WMAX_PLUG");
-    success &= LoadConfig(mUi->uEndstoppullupsBox, pJson, "ENDSTOPPULLUPS");
-    success &= LoadConfig(mUi->uEndstoppullupXminBox, pJson, "ENDSTOPPULLUP_XMIN");
-    success &= LoadConfig(mUi->uEndstoppullupYminBox, pJson, "ENDSTOPPULLUP_YMIN");
-    success &= LoadConfig(mUi->uEndstoppullupZminBox, pJson, "ENDSTOPPULLUP_ZMIN");
-    success &= LoadConfig(mUi->uEndstoppullupIminBox, pJson, "ENDSTOPPULLUP_IMIN");
-    success &= LoadConfig(mUi->uEndstoppullupJminBox, pJson, "ENDSTOPPULLUP_JMIN");
-    success &= LoadConfig(mUi->uEndstoppullupKminBox, pJson, "ENDSTOPPULLUP_KMIN");
-    success &= LoadConfig(mUi->uEndstoppullupUminBox, pJson, "ENDSTOPPULLUP_UMIN");
-    success &= LoadConfig(mUi->uEndstoppullupVminBox, pJson, "ENDSTOPPULLUP_VMIN");
-    success &= LoadConfig(mUi->uEndstoppullupWminBox, pJson, "ENDSTOPPULLUP_WMIN");
-    success &= LoadConfig(mUi->uEndstoppullupXmaxBox, pJson, "ENDSTOPPULLUP_XMAX");
-    success &= LoadConfig(mUi->uEndstoppullupYmaxBox, pJson, "ENDSTOPPULLUP_YMAX");
-    success &= LoadConfig(mUi->uEndstoppullupZmaxBox, pJson, "ENDSTOPPULLUP_ZMAX");
-    success &= LoadConfig(mUi->uEndstoppullupImaxBox, pJson, "ENDSTOPPULLUP_IMAX");
-    success &= LoadConfig(mUi->uEndstoppullupJmaxBox, pJson, "ENDSTOPPULLUP_JMAX");
-    success &= LoadConfig(mUi->uEndstoppullupKmaxBox, pJson, "ENDSTOPPULLUP_KMAX");
-    success &= LoadConfig(mUi->uEndstoppullupUmaxBox, pJson, "ENDSTOPPULLUP_UMAX");
-    success &= LoadConfig(mUi->uEndstoppullupVmaxBox, pJson, "ENDSTOPPULLUP_VMAX");
-    success &= LoadConfig(mUi->uEndstoppullupWmaxBox, pJson, "ENDSTOPPULLUP_WMAX");
-    success &= LoadConfig(mUi->uEndstoppullupZminProbeBox, pJson, "ENDSTOPPULLUP_ZMIN_PROBE");
-    success &= LoadConfig(mUi->uEndstoppulldownsBox, pJson, "ENDSTOPPULLDOWNS");
-    success &= LoadConfig(mUi->uEndstoppulldownXminBox, pJson, "ENDSTOPPULLDOWN_XMIN");
-    success &= LoadConfig(mUi->uEndstoppulldownYminBox, pJson, "ENDSTOPPULLDOWN_YMIN");
-    success &= LoadConfig(mUi->uEndstoppulldownZminBox, pJson, "ENDSTOPPULLDOWN_ZMIN");
-    success &= LoadConfig(mUi->uEndstoppulldownIminBox, pJson, "ENDSTOPPULLDOWN_IMIN");
-    success &= LoadConfig(mUi->uEndstoppulldownJminBox, pJson, "ENDSTOPPULLDOWN_JMIN");
-    success &= LoadConfig(mUi->uEndstoppulldownKminBox, pJson, "ENDSTOPPULLDOWN_KMIN");
-    success &= LoadConfig(mUi->uEndstoppulldownUminBox, pJson, "ENDSTOPPULLDOWN_UMIN");
-    success &= LoadConfig(mUi->uEndstoppulldownVminBox, pJson, "ENDSTOPPULLDOWN_VMIN");
-    success &= LoadConfig(mUi->uEndstoppulldownWminBox, pJson, "ENDSTOPPULLDOWN_WMIN");
-    success &= LoadConfig(mUi->uEndstoppulldownXmaxBox, pJson, "ENDSTOPPULLDOWN_XMAX");
-    success &= LoadConfig(mUi->uEndstoppulldownYmaxBox, pJson, "ENDSTOPPULLDOWN_YMAX");
-    success &= LoadConfig(mUi->uEndstoppulldownZmaxBox, pJson, "ENDSTOPPULLDOWN_ZMAX");
-    success &= LoadConfig(mUi->uEndstoppulldownImaxBox, pJson, "ENDSTOPPULLDOWN_IMAX");
-    success &= LoadConfig(mUi->uEndstoppulldownJmaxBox, pJson, "ENDSTOPPULLDOWN_JMAX");
-    success &= LoadConfig(mUi->uEndstoppulldownKmaxBox, pJson, "ENDSTOPPULLDOWN_KMAX");
-    success &= LoadConfig(mUi->uEndstoppulldownUmaxBox, pJson, "ENDSTOPPULLDOWN_UMAX");
-    success &= LoadConfig(mUi->uEndstoppulldownVmaxBox, pJson, "ENDSTOPPULLDOWN_VMAX");
-    success &= LoadConfig(mUi->uEndstoppulldownWmaxBox, pJson, "ENDSTOPPULLDOWN_WMAX");
-    success &= LoadConfig(mUi->uEndstoppulldownZminProbeBox, pJson, "ENDSTOPPULLDOWN_ZMIN_PROBE");
-    success &= LoadConfig(mUi->uXMinEndstopInvertingDropdown, pJson, "X_MIN_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uYMinEndstopInvertingDropdown, pJson, "Y_MIN_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uZMinEndstopInvertingDropdown, pJson, "Z_MIN_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uIMinEndstopInvertingDropdown, pJson, "I_MIN_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uJMinEndstopInvertingDropdown, pJson, "J_MIN_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uKMinEndstopInvertingDropdown, pJson, "K_MIN_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uUMinEndstopInvertingDropdown, pJson, "U_MIN_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uVMinEndstopInvertingDropdown, pJson, "V_MIN_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uWMinEndstopInvertingDropdown, pJson, "W_MIN_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uXMaxEndstopInvertingDropdown, pJson, "X_MAX_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uYMaxEndstopInvertingDropdown, pJson, "Y_MAX_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uZMaxEndstopInvertingDropdown, pJson, "Z_MAX_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uIMaxEndstopInvertingDropdown, pJson, "I_MAX_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uJMaxEndstopInvertingDropdown, pJson, "J_MAX_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uKMaxEndstopInvertingDropdown, pJson, "K_MAX_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uUMaxEndstopInvertingDropdown, pJson, "U_MAX_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uVMaxEndstopInvertingDropdown, pJson, "V_MAX_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uWMaxEndstopInvertingDropdown, pJson, "W_MAX_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uZMinProbeEndstopInvertingDropdown, pJson, "Z_MIN_PROBE_ENDSTOP_INVERTING");
-    success &= LoadConfig(mUi->uEndstopInterruptsFeatureBox, pJson, "ENDSTOP_INTERRUPTS_FEATURE");
-    success &= LoadConfig(mUi->uEndstopNoiseThresholdDropdown, pJson, "ENDSTOP_NOISE_THRESHOLD");
-    success &= LoadConfig(mUi->uEndstopNoiseThresholdBox, pJson, "ENABLE_ENDSTOP_NOISE_THRESHOLD");
-    success &= LoadConfig(mUi->uDetectBrokenEndstopBox, pJson, "DETECT_BROKEN_ENDSTOP");
+    success &= LoadConfig(mUi->uUseXminPlugBox, pConfig.endstops.USE_XMIN_PLUG);
+    success &= LoadConfig(mUi->uUseYminPlugBox, pConfig.endstops.USE_YMIN_PLUG);
+    success &= LoadConfig(mUi->uUseZminPlugBox, pConfig.endstops.USE_ZMIN_PLUG);
+    success &= LoadConfig(mUi->uUseIminPlugBox, pConfig.endstops.USE_IMIN_PLUG);
+    success &= LoadConfig(mUi->uUseJminPlugBox, pConfig.endstops.USE_JMIN_PLUG);
+    success &= LoadConfig(mUi->uUseKminPlugBox, pConfig.endstops.USE_KMIN_PLUG);
+    success &= LoadConfig(mUi->uUseUminPlugBox, pConfig.endstops.USE_UMIN_PLUG);
+    success &= LoadConfig(mUi->uUseVminPlugBox, pConfig.endstops.USE_VMIN_PLUG);
+    success &= LoadConfig(mUi->uUseWminPlugBox, pConfig.endstops.USE_WMIN_PLUG);
+    success &= LoadConfig(mUi->uUseXmaxPlugBox, pConfig.endstops.USE_XMAX_PLUG);
+    success &= LoadConfig(mUi->uUseYmaxPlugBox, pConfig.endstops.USE_YMAX_PLUG);
+    success &= LoadConfig(mUi->uUseZmaxPlugBox, pConfig.endstops.USE_ZMAX_PLUG);
+    success &= LoadConfig(mUi->uUseImaxPlugBox, pConfig.endstops.USE_IMAX_PLUG);
+    success &= LoadConfig(mUi->uUseJmaxPlugBox, pConfig.endstops.USE_JMAX_PLUG);
+    success &= LoadConfig(mUi->uUseKmaxPlugBox, pConfig.endstops.USE_KMAX_PLUG);
+    success &= LoadConfig(mUi->uUseUmaxPlugBox, pConfig.endstops.USE_UMAX_PLUG);
+    success &= LoadConfig(mUi->uUseVmaxPlugBox, pConfig.endstops.USE_VMAX_PLUG);
+    success &= LoadConfig(mUi->uUseWmaxPlugBox, pConfig.endstops.USE_WMAX_PLUG);
+    success &= LoadConfig(mUi->uEndstoppullupsBox, pConfig.endstops.ENDSTOPPULLUPS);
+    success &= LoadConfig(mUi->uEndstoppullupXminBox, pConfig.endstops.ENDSTOPPULLUP_XMIN);
+    success &= LoadConfig(mUi->uEndstoppullupYminBox, pConfig.endstops.ENDSTOPPULLUP_YMIN);
+    success &= LoadConfig(mUi->uEndstoppullupZminBox, pConfig.endstops.ENDSTOPPULLUP_ZMIN);
+    success &= LoadConfig(mUi->uEndstoppullupIminBox, pConfig.endstops.ENDSTOPPULLUP_IMIN);
+    success &= LoadConfig(mUi->uEndstoppullupJminBox, pConfig.endstops.ENDSTOPPULLUP_JMIN);
+    success &= LoadConfig(mUi->uEndstoppullupKminBox, pConfig.endstops.ENDSTOPPULLUP_KMIN);
+    success &= LoadConfig(mUi->uEndstoppullupUminBox, pConfig.endstops.ENDSTOPPULLUP_UMIN);
+    success &= LoadConfig(mUi->uEndstoppullupVminBox, pConfig.endstops.ENDSTOPPULLUP_VMIN);
+    success &= LoadConfig(mUi->uEndstoppullupWminBox, pConfig.endstops.ENDSTOPPULLUP_WMIN);
+    success &= LoadConfig(mUi->uEndstoppullupXmaxBox, pConfig.endstops.ENDSTOPPULLUP_XMAX);
+    success &= LoadConfig(mUi->uEndstoppullupYmaxBox, pConfig.endstops.ENDSTOPPULLUP_YMAX);
+    success &= LoadConfig(mUi->uEndstoppullupZmaxBox, pConfig.endstops.ENDSTOPPULLUP_ZMAX);
+    success &= LoadConfig(mUi->uEndstoppullupImaxBox, pConfig.endstops.ENDSTOPPULLUP_IMAX);
+    success &= LoadConfig(mUi->uEndstoppullupJmaxBox, pConfig.endstops.ENDSTOPPULLUP_JMAX);
+    success &= LoadConfig(mUi->uEndstoppullupKmaxBox, pConfig.endstops.ENDSTOPPULLUP_KMAX);
+    success &= LoadConfig(mUi->uEndstoppullupUmaxBox, pConfig.endstops.ENDSTOPPULLUP_UMAX);
+    success &= LoadConfig(mUi->uEndstoppullupVmaxBox, pConfig.endstops.ENDSTOPPULLUP_VMAX);
+    success &= LoadConfig(mUi->uEndstoppullupWmaxBox, pConfig.endstops.ENDSTOPPULLUP_WMAX);
+    success &= LoadConfig(mUi->uEndstoppullupZminProbeBox, pConfig.endstops.ENDSTOPPULLUP_ZMIN_PROBE);
+    success &= LoadConfig(mUi->uEndstoppulldownsBox, pConfig.endstops.ENDSTOPPULLDOWNS);
+    success &= LoadConfig(mUi->uEndstoppulldownXminBox, pConfig.endstops.ENDSTOPPULLDOWN_XMIN);
+    success &= LoadConfig(mUi->uEndstoppulldownYminBox, pConfig.endstops.ENDSTOPPULLDOWN_YMIN);
+    success &= LoadConfig(mUi->uEndstoppulldownZminBox, pConfig.endstops.ENDSTOPPULLDOWN_ZMIN);
+    success &= LoadConfig(mUi->uEndstoppulldownIminBox, pConfig.endstops.ENDSTOPPULLDOWN_IMIN);
+    success &= LoadConfig(mUi->uEndstoppulldownJminBox, pConfig.endstops.ENDSTOPPULLDOWN_JMIN);
+    success &= LoadConfig(mUi->uEndstoppulldownKminBox, pConfig.endstops.ENDSTOPPULLDOWN_KMIN);
+    success &= LoadConfig(mUi->uEndstoppulldownUminBox, pConfig.endstops.ENDSTOPPULLDOWN_UMIN);
+    success &= LoadConfig(mUi->uEndstoppulldownVminBox, pConfig.endstops.ENDSTOPPULLDOWN_VMIN);
+    success &= LoadConfig(mUi->uEndstoppulldownWminBox, pConfig.endstops.ENDSTOPPULLDOWN_WMIN);
+    success &= LoadConfig(mUi->uEndstoppulldownXmaxBox, pConfig.endstops.ENDSTOPPULLDOWN_XMAX);
+    success &= LoadConfig(mUi->uEndstoppulldownYmaxBox, pConfig.endstops.ENDSTOPPULLDOWN_YMAX);
+    success &= LoadConfig(mUi->uEndstoppulldownZmaxBox, pConfig.endstops.ENDSTOPPULLDOWN_ZMAX);
+    success &= LoadConfig(mUi->uEndstoppulldownImaxBox, pConfig.endstops.ENDSTOPPULLDOWN_IMAX);
+    success &= LoadConfig(mUi->uEndstoppulldownJmaxBox, pConfig.endstops.ENDSTOPPULLDOWN_JMAX);
+    success &= LoadConfig(mUi->uEndstoppulldownKmaxBox, pConfig.endstops.ENDSTOPPULLDOWN_KMAX);
+    success &= LoadConfig(mUi->uEndstoppulldownUmaxBox, pConfig.endstops.ENDSTOPPULLDOWN_UMAX);
+    success &= LoadConfig(mUi->uEndstoppulldownVmaxBox, pConfig.endstops.ENDSTOPPULLDOWN_VMAX);
+    success &= LoadConfig(mUi->uEndstoppulldownWmaxBox, pConfig.endstops.ENDSTOPPULLDOWN_WMAX);
+    success &= LoadConfig(mUi->uEndstoppulldownZminProbeBox, pConfig.endstops.ENDSTOPPULLDOWN_ZMIN_PROBE);
+    success &= LoadConfig(mUi->uXMinEndstopInvertingDropdown, pConfig.endstops.X_MIN_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uYMinEndstopInvertingDropdown, pConfig.endstops.Y_MIN_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uZMinEndstopInvertingDropdown, pConfig.endstops.Z_MIN_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uIMinEndstopInvertingDropdown, pConfig.endstops.I_MIN_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uJMinEndstopInvertingDropdown, pConfig.endstops.J_MIN_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uKMinEndstopInvertingDropdown, pConfig.endstops.K_MIN_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uUMinEndstopInvertingDropdown, pConfig.endstops.U_MIN_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uVMinEndstopInvertingDropdown, pConfig.endstops.V_MIN_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uWMinEndstopInvertingDropdown, pConfig.endstops.W_MIN_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uXMaxEndstopInvertingDropdown, pConfig.endstops.X_MAX_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uYMaxEndstopInvertingDropdown, pConfig.endstops.Y_MAX_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uZMaxEndstopInvertingDropdown, pConfig.endstops.Z_MAX_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uIMaxEndstopInvertingDropdown, pConfig.endstops.I_MAX_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uJMaxEndstopInvertingDropdown, pConfig.endstops.J_MAX_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uKMaxEndstopInvertingDropdown, pConfig.endstops.K_MAX_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uUMaxEndstopInvertingDropdown, pConfig.endstops.U_MAX_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uVMaxEndstopInvertingDropdown, pConfig.endstops.V_MAX_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uWMaxEndstopInvertingDropdown, pConfig.endstops.W_MAX_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uZMinProbeEndstopInvertingDropdown, pConfig.endstops.Z_MIN_PROBE_ENDSTOP_INVERTING);
+    success &= LoadConfig(mUi->uEndstopInterruptsFeatureBox, pConfig.endstops.ENDSTOP_INTERRUPTS_FEATURE);
+    success &= LoadConfig(mUi->uEndstopNoiseThresholdDropdown, pConfig.endstops.ENDSTOP_NOISE_THRESHOLD);
+    success &= LoadConfig(mUi->uEndstopNoiseThresholdBox, pConfig.endstops.ENABLE_ENDSTOP_NOISE_THRESHOLD);
+    success &= LoadConfig(mUi->uDetectBrokenEndstopBox, pConfig.endstops.DETECT_BROKEN_ENDSTOP);
 
     mIsLoading = false;
     return success;
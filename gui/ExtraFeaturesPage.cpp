@@ -26,11 +26,13 @@
 #include "ExtraFeaturesPage.h"
 #include "./ui_ExtraFeaturesPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 ExtraFeaturesPage::ExtraFeaturesPage(QWidget *pParent) :
-    AbstractPage(EXTRA_FEATURES_TEMPLATE_PATH, pParent),
+    AbstractPage(EXTRA_FEATURES_TEMPLATE_PATH, QString(), pParent),
     mUi(new Ui::ExtraFeaturesPage)
 {
+    const TraceSpan span("ExtraFeaturesPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -56,7 +58,7 @@ void ExtraFeaturesPage::ResetValues()
     mIsLoading = false;
 }
 
-bool ExtraFeaturesPage::LoadFromJson(const QJsonObject &pJson)
+bool ExtraFeaturesPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
@@ -26,11 +26,13 @@
 #include "ExtruderPage.h"
 #include "./ui_ExtruderPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 ExtruderPage::ExtruderPage(QWidget *pParent) :
-    AbstractPage(EXTRUDER_TEMPLATE_PATH, pParent),
+    AbstractPage(EXTRUDER_TEMPLATE_PATH, "extruder", pParent),
     mUi(new Ui::ExtruderPage)
 {
+    const TraceSpan span("ExtruderPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -172,80 +174,80 @@ void ExtruderPage::ResetValues()
     mIsLoading = false;
 }
 
-bool ExtruderPage::LoadFromJson(const QJsonObject &pJson)
+bool ExtruderPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uExtrudersSpinBox, pJson, "EXTRUDERS");
-    success &= LoadConfig(mUi->uDefaultNominalFilamentDiaSpinBox, pJson, "DEFAULT_NOMINAL_FILAMENT_DIA");
-    success &= LoadConfig(mUi->uSinglenozzleBox, pJson, "SINGLENOZZLE");
-    success &= LoadConfig(mUi->uSinglenozzleStandbyTempBox, pJson, "SINGLENOZZLE_STANDBY_TEMP");
-    success &= LoadConfig(mUi->uSinglenozzleStandbyFanBox, pJson, "SINGLENOZZLE_STANDBY_FAN");
-    success &= LoadConfig(mUi->uMmuModelDropdown, pJson, "MMU_MODEL");
-    success &= LoadConfig(mUi->uSwitchingExtruderBox, pJson, "SWITCHING_EXTRUDER");
-    success &= LoadConfig(mUi->uSwitchingExtruderServoNrSpinBox, pJson, "SWITCHING_EXTRUDER_SERVO_NR");
-    success &= LoadConfig(mUi->uSwitchingExtruderServoAnglesE0SpinBox, pJson, "SWITCHING_EXTRUDER_SERVO_ANGLES_E0");
-    success &= LoadConfig(mUi->uSwitchingExtruderServoAnglesE1SpinBox, pJson, "SWITCHING_EXTRUDER_SERVO_ANGLES_E1");
-    success &= LoadConfig(mUi->uSwitchingExtruderServoAnglesE2SpinBox, pJson, "SWITCHING_EXTRUDER_SERVO_ANGLES_E2");
-    success &= LoadConfig(mUi->uSwitchingExtruderServoAnglesE3SpinBox, pJson, "SWITCHING_EXTRUDER_SERVO_ANGLES_E3");
-    success &= LoadConfig(mUi->uSwitchingExtruderE23ServoNrSpinBox, pJson, "SWITCHING_EXTRUDER_E23_SERVO_NR");
-    success &= LoadConfig(mUi->uSwitchingNozzleBox, pJson, "SWITCHING_NOZZLE");
-    success &= LoadConfig(mUi->uSwitchingNozzleServoNrSpinBox, pJson, "SWITCHING_NOZZLE_SERVO_NR");
-    success &= LoadConfig(mUi->uSwitchingNozzleE1ServoNrSpinBox, pJson, "SWITCHING_NOZZLE_E1_SERVO_NR");
-    success &= LoadConfig(mUi->uSwitchingNozzleServoAnglesE0SpinBox, pJson, "SWITCHING_NOZZLE_SERVO_ANGLES_E0");
-    success &= LoadConfig(mUi->uSwitchingNozzleServoAnglesE1SpinBox, pJson, "SWITCHING_NOZZLE_SERVO_ANGLES_E1");
-    success &= LoadConfig(mUi->uSwitchingNozzleServoDwellSpinBox, pJson, "SWITCHING_NOZZLE_SERVO_DWELL");
-    success &= LoadConfig(mUi->uParkingExtruderBox, pJson, "PARKING_EXTRUDER");
-    success &= LoadConfig(mUi->uMagneticParkingExtruderBox, pJson, "MAGNETIC_PARKING_EXTRUDER");
-    success &= LoadConfig(mUi->uParkingExtruderParkingX0SpinBox, pJson, "PARKING_EXTRUDER_PARKING_X_0");
-    success &= LoadConfig(mUi->uParkingExtruderParkingX1SpinBox, pJson, "PARKING_EXTRUDER_PARKING_X_1");
-    success &= LoadConfig(mUi->uParkingExtruderGrabDistanceSpinBox, pJson, "PARKING_EXTRUDER_GRAB_DISTANCE");
-    success &= LoadConfig(mUi->uParkingExtruderSolenoidsInvertBox, pJson, "PARKING_EXTRUDER_SOLENOIDS_INVERT");
-    success &= LoadConfig(mUi->uParkingExtruderSolenoidsPinsActiveDropdown, pJson, "PARKING_EXTRUDER_SOLENOIDS_PINS_ACTIVE");
-    success &= LoadConfig(mUi->uParkingExtruderSolenoidsDelaySpinBox, pJson, "PARKING_EXTRUDER_SOLENOIDS_DELAY");
-    success &= LoadConfig(mUi->uManualSolenoidControlBox, pJson, "MANUAL_SOLENOID_CONTROL");
-    success &= LoadConfig(mUi->uMpeFastSpeedSpinBox, pJson, "MPE_FAST_SPEED");
-    success &= LoadConfig(mUi->uMpeSlowSpeedSpinBox, pJson, "MPE_SLOW_SPEED");
-    success &= LoadConfig(mUi->uMpeTravelDistanceSpinBox, pJson, "MPE_TRAVEL_DISTANCE");
-    success &= LoadConfig(mUi->uMpeCompensationDropdown, pJson, "MPE_COMPENSATION");
-    success &= LoadConfig(mUi->uSwitchingToolheadBox, pJson, "SWITCHING_TOOLHEAD");
-    success &= LoadConfig(mUi->uMagneticSwitchingToolheadBox, pJson, "MAGNETIC_SWITCHING_TOOLHEAD");
-    success &= LoadConfig(mUi->uElectromagneticSwitchingToolheadBox, pJson, "ELECTROMAGNETIC_SWITCHING_TOOLHEAD");
-    success &= LoadConfig(mUi->uMmuModelBox, pJson, "ENABLE_MMU_MODEL");
-    success &= LoadConfig(mUi->uSwitchingExtruderServoAnglesE23Box, pJson, "ENABLE_SWITCHING_EXTRUDER_SERVO_ANGLES_E23");
-    success &= LoadConfig(mUi->uSwitchingNozzleE1ServoNrBox, pJson, "ENABLE_SWITCHING_NOZZLE_E1_SERVO_NR");
-    success &= LoadConfig(mUi->uParkingExtruderSolenoidsDelayBox, pJson, "ENABLE_PARKING_EXTRUDER_SOLENOIDS_DELAY");
-    success &= LoadConfig(mUi->uSwitchingToolheadYPosSpinBox, pJson, "SWITCHING_TOOLHEAD_Y_POS");
-    success &= LoadConfig(mUi->uSwitchingToolheadYSecuritySpinBox, pJson, "SWITCHING_TOOLHEAD_Y_SECURITY");
-    success &= LoadConfig(mUi->uSwitchingToolheadYClearSpinBox, pJson, "SWITCHING_TOOLHEAD_Y_CLEAR");
-    success &= LoadConfig(mUi->uSwitchingToolheadXPos0SpinBox, pJson, "SWITCHING_TOOLHEAD_X_POS0");
-    success &= LoadConfig(mUi->uSwitchingToolheadXPos1SpinBox, pJson, "SWITCHING_TOOLHEAD_X_POS1");
-    success &= LoadConfig(mUi->uSwitchingToolheadServoNrSpinBox, pJson, "SWITCHING_TOOLHEAD_SERVO_NR");
-    success &= LoadConfig(mUi->uSwitchingToolheadServoAngles0SpinBox, pJson, "SWITCHING_TOOLHEAD_SERVO_ANGLES0");
-    success &= LoadConfig(mUi->uSwitchingToolheadServoAngles1SpinBox, pJson, "SWITCHING_TOOLHEAD_SERVO_ANGLES1");
-    success &= LoadConfig(mUi->uSwitchingToolheadYReleaseSpinBox, pJson, "SWITCHING_TOOLHEAD_Y_RELEASE");
-    success &= LoadConfig(mUi->uSwitchingToolheadXSecurityT0SpinBox, pJson, "SWITCHING_TOOLHEAD_X_SECURITY_T0");
-    success &= LoadConfig(mUi->uSwitchingToolheadXSecurityT1SpinBox, pJson, "SWITCHING_TOOLHEAD_X_SECURITY_T1");
-    success &= LoadConfig(mUi->uPrimeBeforeRemoveBox, pJson, "PRIME_BEFORE_REMOVE");
-    success &= LoadConfig(mUi->uSwitchingToolheadPrimeMmSpinBox, pJson, "SWITCHING_TOOLHEAD_PRIME_MM");
-    success &= LoadConfig(mUi->uSwitchingToolheadRetractMmSpinBox, pJson, "SWITCHING_TOOLHEAD_RETRACT_MM");
-    success &= LoadConfig(mUi->uSwitchingToolheadPrimeFeedrateSpinBox, pJson, "SWITCHING_TOOLHEAD_PRIME_FEEDRATE");
-    success &= LoadConfig(mUi->uSwitchingToolheadRetractFeedrateSpinBox, pJson, "SWITCHING_TOOLHEAD_RETRACT_FEEDRATE");
-    success &= LoadConfig(mUi->uSwitchingToolheadZHopSpinBox, pJson, "SWITCHING_TOOLHEAD_Z_HOP");
-    success &= LoadConfig(mUi->uMixingExtruderBox, pJson, "MIXING_EXTRUDER");
-    success &= LoadConfig(mUi->uMixingSteppersSpinBox, pJson, "MIXING_STEPPERS");
-    success &= LoadConfig(mUi->uMixingVirtualToolsSpinBox, pJson, "MIXING_VIRTUAL_TOOLS");
-    success &= LoadConfig(mUi->uDirectMixingInG1Box, pJson, "DIRECT_MIXING_IN_G1");
-    success &= LoadConfig(mUi->uGradientMixBox, pJson, "GRADIENT_MIX");
-    success &= LoadConfig(mUi->uMixingPresetsBox, pJson, "MIXING_PRESETS");
-    success &= LoadConfig(mUi->uGradientVtoolBox, pJson, "GRADIENT_VTOOL");
-    success &= LoadConfig(mUi->uHotendOffsetXEdit, pJson, "HOTEND_OFFSET_X");
-    success &= LoadConfig(mUi->uHotendOffsetYEdit, pJson, "HOTEND_OFFSET_Y");
-    success &= LoadConfig(mUi->uHotendOffsetZEdit, pJson, "HOTEND_OFFSET_Z");
-    success &= LoadConfig(mUi->uHotendOffsetXBox, pJson, "ENABLE_HOTEND_OFFSET_X");
-    success &= LoadConfig(mUi->uHotendOffsetYBox, pJson, "ENABLE_HOTEND_OFFSET_Y");
-    success &= LoadConfig(mUi->uHotendOffsetZBox, pJson, "ENABLE_HOTEND_OFFSET_Z");
+    success &= LoadConfig(mUi->uExtrudersSpinBox, pConfig.extruder.EXTRUDERS);
+    success &= LoadConfig(mUi->uDefaultNominalFilamentDiaSpinBox, pConfig.extruder.DEFAULT_NOMINAL_FILAMENT_DIA);
+    success &= LoadConfig(mUi->uSinglenozzleBox, pConfig.extruder.SINGLENOZZLE);
+    success &= LoadConfig(mUi->uSinglenozzleStandbyTempBox, pConfig.extruder.SINGLENOZZLE_STANDBY_TEMP);
+    success &= LoadConfig(mUi->uSinglenozzleStandbyFanBox, pConfig.extruder.SINGLENOZZLE_STANDBY_FAN);
+    success &= LoadConfig(mUi->uMmuModelDropdown, pConfig.extruder.MMU_MODEL);
+    success &= LoadConfig(mUi->uSwitchingExtruderBox, pConfig.extruder.SWITCHING_EXTRUDER);
+    success &= LoadConfig(mUi->uSwitchingExtruderServoNrSpinBox, pConfig.extruder.SWITCHING_EXTRUDER_SERVO_NR);
+    success &= LoadConfig(mUi->uSwitchingExtruderServoAnglesE0SpinBox, pConfig.extruder.SWITCHING_EXTRUDER_SERVO_ANGLES_E0);
+    success &= LoadConfig(mUi->uSwitchingExtruderServoAnglesE1SpinBox, pConfig.extruder.SWITCHING_EXTRUDER_SERVO_ANGLES_E1);
+    success &= LoadConfig(mUi->uSwitchingExtruderServoAnglesE2SpinBox, pConfig.extruder.SWITCHING_EXTRUDER_SERVO_ANGLES_E2);
+    success &= LoadConfig(mUi->uSwitchingExtruderServoAnglesE3SpinBox, pConfig.extruder.SWITCHING_EXTRUDER_SERVO_ANGLES_E3);
+    success &= LoadConfig(mUi->uSwitchingExtruderE23ServoNrSpinBox, pConfig.extruder.SWITCHING_EXTRUDER_E23_SERVO_NR);
+    success &= LoadConfig(mUi->uSwitchingNozzleBox, pConfig.extruder.SWITCHING_NOZZLE);
+    success &= LoadConfig(mUi->uSwitchingNozzleServoNrSpinBox, pConfig.extruder.SWITCHING_NOZZLE_SERVO_NR);
+    success &= LoadConfig(mUi->uSwitchingNozzleE1ServoNrSpinBox, pConfig.extruder.SWITCHING_NOZZLE_E1_SERVO_NR);
+    success &= LoadConfig(mUi->uSwitchingNozzleServoAnglesE0SpinBox, pConfig.extruder.SWITCHING_NOZZLE_SERVO_ANGLES_E0);
+    success &= LoadConfig(mUi->uSwitchingNozzleServoAnglesE1SpinBox, pConfig.extruder.SWITCHING_NOZZLE_SERVO_ANGLES_E1);
+    success &= LoadConfig(mUi->uSwitchingNozzleServoDwellSpinBox, pConfig.extruder.SWITCHING_NOZZLE_SERVO_DWELL);
+    success &= LoadConfig(mUi->uParkingExtruderBox, pConfig.extruder.PARKING_EXTRUDER);
+    success &= LoadConfig(mUi->uMagneticParkingExtruderBox, pConfig.extruder.MAGNETIC_PARKING_EXTRUDER);
+    success &= LoadConfig(mUi->uParkingExtruderParkingX0SpinBox, pConfig.extruder.PARKING_EXTRUDER_PARKING_X_0);
+    success &= LoadConfig(mUi->uParkingExtruderParkingX1SpinBox, pConfig.extruder.PARKING_EXTRUDER_PARKING_X_1);
+    success &= LoadConfig(mUi->uParkingExtruderGrabDistanceSpinBox, pConfig.extruder.PARKING_EXTRUDER_GRAB_DISTANCE);
+    success &= LoadConfig(mUi->uParkingExtruderSolenoidsInvertBox, pConfig.extruder.PARKING_EXTRUDER_SOLENOIDS_INVERT);
+    success &= LoadConfig(mUi->uParkingExtruderSolenoidsPinsActiveDropdown, pConfig.extruder.PARKING_EXTRUDER_SOLENOIDS_PINS_ACTIVE);
+    success &= LoadConfig(mUi->uParkingExtruderSolenoidsDelaySpinBox, pConfig.extruder.PARKING_EXTRUDER_SOLENOIDS_DELAY);
+    success &= LoadConfig(mUi->uManualSolenoidControlBox, pConfig.extruder.MANUAL_SOLENOID_CONTROL);
+    success &= LoadConfig(mUi->uMpeFastSpeedSpinBox, pConfig.extruder.MPE_FAST_SPEED);
+    success &= LoadConfig(mUi->uMpeSlowSpeedSpinBox, pConfig.extruder.MPE_SLOW_SPEED);
+    success &= LoadConfig(mUi->uMpeTravelDistanceSpinBox, pConfig.extruder.MPE_TRAVEL_DISTANCE);
+    success &= LoadConfig(mUi->uMpeCompensationDropdown, pConfig.extruder.MPE_COMPENSATION);
+    success &= LoadConfig(mUi->uSwitchingToolheadBox, pConfig.extruder.SWITCHING_TOOLHEAD);
+    success &= LoadConfig(mUi->uMagneticSwitchingToolheadBox, pConfig.extruder.MAGNETIC_SWITCHING_TOOLHEAD);
+    success &= LoadConfig(mUi->uElectromagneticSwitchingToolheadBox, pConfig.extruder.ELECTROMAGNETIC_SWITCHING_TOOLHEAD);
+    success &= LoadConfig(mUi->uMmuModelBox, pConfig.extruder.ENABLE_MMU_MODEL);
+    success &= LoadConfig(mUi->uSwitchingExtruderServoAnglesE23Box, pConfig.extruder.ENABLE_SWITCHING_EXTRUDER_SERVO_ANGLES_E23);
+    success &= LoadConfig(mUi->uSwitchingNozzleE1ServoNrBox, pConfig.extruder.ENABLE_SWITCHING_NOZZLE_E1_SERVO_NR);
+    success &= LoadConfig(mUi->uParkingExtruderSolenoidsDelayBox, pConfig.extruder.ENABLE_PARKING_EXTRUDER_SOLENOIDS_DELAY);
+    success &= LoadConfig(mUi->uSwitchingToolheadYPosSpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_Y_POS);
+    success &= LoadConfig(mUi->uSwitchingToolheadYSecuritySpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_Y_SECURITY);
+    success &= LoadConfig(mUi->uSwitchingToolheadYClearSpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_Y_CLEAR);
+    success &= LoadConfig(mUi->uSwitchingToolheadXPos0SpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_X_POS0);
+    success &= LoadConfig(mUi->uSwitchingToolheadXPos1SpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_X_POS1);
+    success &= LoadConfig(mUi->uSwitchingToolheadServoNrSpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_SERVO_NR);
+    success &= LoadConfig(mUi->uSwitchingToolheadServoAngles0SpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_SERVO_ANGLES0);
+    success &= LoadConfig(mUi->uSwitchingToolheadServoAngles1SpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_SERVO_ANGLES1);
+    success &= LoadConfig(mUi->uSwitchingToolheadYReleaseSpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_Y_RELEASE);
+    success &= LoadConfig(mUi->uSwitchingToolheadXSecurityT0SpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_X_SECURITY_T0);
+    success &= LoadConfig(mUi->uSwitchingToolheadXSecurityT1SpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_X_SECURITY_T1);
+    success &= LoadConfig(mUi->uPrimeBeforeRemoveBox, pConfig.extruder.PRIME_BEFORE_REMOVE);
+    success &= LoadConfig(mUi->uSwitchingToolheadPrimeMmSpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_PRIME_MM);
+    success &= LoadConfig(mUi->uSwitchingToolheadRetractMmSpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_RETRACT_MM);
+    success &= LoadConfig(mUi->uSwitchingToolheadPrimeFeedrateSpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_PRIME_FEEDRATE);
+    success &= LoadConfig(mUi->uSwitchingToolheadRetractFeedrateSpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_RETRACT_FEEDRATE);
+    success &= LoadConfig(mUi->uSwitchingToolheadZHopSpinBox, pConfig.extruder.SWITCHING_TOOLHEAD_Z_HOP);
+    success &= LoadConfig(mUi->uMixingExtruderBox, pConfig.extruder.MIXING_EXTRUDER);
+    success &= LoadConfig(mUi->uMixingSteppersSpinBox, pConfig.extruder.MIXING_STEPPERS);
+    success &= LoadConfig(mUi->uMixingVirtualToolsSpinBox, pConfig.extruder.MIXING_VIRTUAL_TOOLS);
+    success &= LoadConfig(mUi->uDirectMixingInG1Box, pConfig.extruder.DIRECT_MIXING_IN_G1);
+    success &= LoadConfig(mUi->uGradientMixBox, pConfig.extruder.GRADIENT_MIX);
+    success &= LoadConfig(mUi->uMixingPresetsBox, pConfig.extruder.MIXING_PRESETS);
+    success &= LoadConfig(mUi->uGradientVtoolBox, pConfig.extruder.GRADIENT_VTOOL);
+    success &= LoadConfig(mUi->uHotendOffsetXEdit, pConfig.extruder.HOTEND_OFFSET_X);
+    success &= LoadConfig(mUi->uHotendOffsetYEdit, pConfig.extruder.HOTEND_OFFSET_Y);
+    success &= LoadConfig(mUi->uHotendOffsetZEdit, pConfig.extruder.HOTEND_OFFSET_Z);
+    success &= LoadConfig(mUi->uHotendOffsetXBox, pConfig.extruder.ENABLE_HOTEND_OFFSET_X);
+    success &= LoadConfig(mUi->uHotendOffsetYBox, pConfig.extruder.ENABLE_HOTEND_OFFSET_Y);
+    success &= LoadConfig(mUi->uHotendOffsetZBox, pConfig.extruder.ENABLE_HOTEND_OFFSET_Z);
 
     mIsLoading = false;
     return success;
@@ -26,11 +26,13 @@
 #include "FilamentRunoutSensorPage.h"
 #include "./ui_FilamentRunoutSensorPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 FilamentRunoutSensorPage::FilamentRunoutSensorPage(QWidget *pParent) :
-    AbstractPage(FILAMENT_RUNOUT_SENSOR_TEMPLATE_PATH, pParent),
+    AbstractPage(FILAMENT_RUNOUT_SENSOR_TEMPLATE_PATH, "filamentRunoutSensor", pParent),
     mUi(new Ui::FilamentRunoutSensorPage)
 {
+    const TraceSpan span("FilamentRunoutSensorPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -102,54 +104,54 @@ void FilamentRunoutSensorPage::ResetValues()
     mIsLoading = false;
 }
 
-bool FilamentRunoutSensorPage::LoadFromJson(const QJsonObject &pJson)
+bool FilamentRunoutSensorPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uFilamentRunoutSensorBox, pJson, "FILAMENT_RUNOUT_SENSOR");
-    success &= LoadConfig(mUi->uFilRunoutEnabledDefaultDropdown, pJson, "FIL_RUNOUT_ENABLED_DEFAULT");
-    success &= LoadConfig(mUi->uNumRunoutSensorsDropdown, pJson, "NUM_RUNOUT_SENSORS");
-    success &= LoadConfig(mUi->uFilRunoutStateDropdown, pJson, "FIL_RUNOUT_STATE");
-    success &= LoadConfig(mUi->uFilRunoutPullupBox, pJson, "FIL_RUNOUT_PULLUP");
-    success &= LoadConfig(mUi->uFilRunoutPulldownBox, pJson, "FIL_RUNOUT_PULLDOWN");
-    success &= LoadConfig(mUi->uWatchAllRunoutSensorsBox, pJson, "WATCH_ALL_RUNOUT_SENSORS");
-    success &= LoadConfig(mUi->uFilRunout1StateDropdown, pJson, "FIL_RUNOUT1_STATE");
-    success &= LoadConfig(mUi->uFilRunout1StateBox, pJson, "ENABLE_FIL_RUNOUT1_STATE");
-    success &= LoadConfig(mUi->uFilRunout1PullupBox, pJson, "FIL_RUNOUT1_PULLUP");
-    success &= LoadConfig(mUi->uFilRunout1PulldownBox, pJson, "FIL_RUNOUT1_PULLDOWN");
-    success &= LoadConfig(mUi->uFilRunout2StateDropdown, pJson, "FIL_RUNOUT2_STATE");
-    success &= LoadConfig(mUi->uFilRunout2StateBox, pJson, "ENABLE_FIL_RUNOUT2_STATE");
-    success &= LoadConfig(mUi->uFilRunout2PullupBox, pJson, "FIL_RUNOUT2_PULLUP");
-    success &= LoadConfig(mUi->uFilRunout2PulldownBox, pJson, "FIL_RUNOUT2_PULLDOWN");
-    success &= LoadConfig(mUi->uFilRunout3StateDropdown, pJson, "FIL_RUNOUT3_STATE");
-    success &= LoadConfig(mUi->uFilRunout3StateBox, pJson, "ENABLE_FIL_RUNOUT3_STATE");
-    success &= LoadConfig(mUi->uFilRunout3PullupBox, pJson, "FIL_RUNOUT3_PULLUP");
-    success &= LoadConfig(mUi->uFilRunout3PulldownBox, pJson, "FIL_RUNOUT3_PULLDOWN");
-    success &= LoadConfig(mUi->uFilRunout4StateDropdown, pJson, "FIL_RUNOUT4_STATE");
-    success &= LoadConfig(mUi->uFilRunout4StateBox, pJson, "ENABLE_FIL_RUNOUT4_STATE");
-    success &= LoadConfig(mUi->uFilRunout4PullupBox, pJson, "FIL_RUNOUT4_PULLUP");
-    success &= LoadConfig(mUi->uFilRunout4PulldownBox, pJson, "FIL_RUNOUT4_PULLDOWN");
-    success &= LoadConfig(mUi->uFilRunout5StateDropdown, pJson, "FIL_RUNOUT5_STATE");
-    success &= LoadConfig(mUi->uFilRunout5StateBox, pJson, "ENABLE_FIL_RUNOUT5_STATE");
-    success &= LoadConfig(mUi->uFilRunout5PullupBox, pJson, "FIL_RUNOUT5_PULLUP");
-    success &= LoadConfig(mUi->uFilRunout5PulldownBox, pJson, "FIL_RUNOUT5_PULLDOWN");
-    success &= LoadConfig(mUi->uFilRunout6StateDropdown, pJson, "FIL_RUNOUT6_STATE");
-    success &= LoadConfig(mUi->uFilRunout6StateBox, pJson, "ENABLE_FIL_RUNOUT6_STATE");
-    success &= LoadConfig(mUi->uFilRunout6PullupBox, pJson, "FIL_RUNOUT6_PULLUP");
-    success &= LoadConfig(mUi->uFilRunout6PulldownBox, pJson, "FIL_RUNOUT6_PULLDOWN");
-    success &= LoadConfig(mUi->uFilRunout7StateDropdown, pJson, "FIL_RUNOUT7_STATE");
-    success &= LoadConfig(mUi->uFilRunout7StateBox, pJson, "ENABLE_FIL_RUNOUT7_STATE");
-    success &= LoadConfig(mUi->uFilRunout7PullupBox, pJson, "FIL_RUNOUT7_PULLUP");
-    success &= LoadConfig(mUi->uFilRunout7PulldownBox, pJson, "FIL_RUNOUT7_PULLDOWN");
-    success &= LoadConfig(mUi->uFilRunout8StateDropdown, pJson, "FIL_RUNOUT8_STATE");
-    success &= LoadConfig(mUi->uFilRunout8StateBox, pJson, "ENABLE_FIL_RUNOUT8_STATE");
-    success &= LoadConfig(mUi->uFilRunout8PullupBox, pJson, "FIL_RUNOUT8_PULLUP");
-    success &= LoadConfig(mUi->uFilRunout8PulldownBox, pJson, "FIL_RUNOUT8_PULLDOWN");
-    success &= LoadConfig(mUi->uFilamentRunoutScriptEdit, pJson, "FILAMENT_RUNOUT_SCRIPT");
-    success &= LoadConfig(mUi->uFilamentRunoutDistanceMmSpinBox, pJson, "FILAMENT_RUNOUT_DISTANCE_MM");
-    success &= LoadConfig(mUi->uFilamentRunoutDistanceMmBox, pJson, "ENABLE_FILAMENT_RUNOUT_DISTANCE_MM");
-    success &= LoadConfig(mUi->uFilamentMotionSensorBox, pJson, "FILAMENT_MOTION_SENSOR");
+    success &= LoadConfig(mUi->uFilamentRunoutSensorBox, pConfig.filamentRunoutSensor.FILAMENT_RUNOUT_SENSOR);
+    success &= LoadConfig(mUi->uFilRunoutEnabledDefaultDropdown, pConfig.filamentRunoutSensor.FIL_RUNOUT_ENABLED_DEFAULT);
+    success &= LoadConfig(mUi->uNumRunoutSensorsDropdown, pConfig.filamentRunoutSensor.NUM_RUNOUT_SENSORS);
+    success &= LoadConfig(mUi->uFilRunoutStateDropdown, pConfig.filamentRunoutSensor.FIL_RUNOUT_STATE);
+    success &= LoadConfig(mUi->uFilRunoutPullupBox, pConfig.filamentRunoutSensor.FIL_RUNOUT_PULLUP);
+    success &= LoadConfig(mUi->uFilRunoutPulldownBox, pConfig.filamentRunoutSensor.FIL_RUNOUT_PULLDOWN);
+    success &= LoadConfig(mUi->uWatchAllRunoutSensorsBox, pConfig.filamentRunoutSensor.WATCH_ALL_RUNOUT_SENSORS);
+    success &= LoadConfig(mUi->uFilRunout1StateDropdown, pConfig.filamentRunoutSensor.FIL_RUNOUT1_STATE);
+    success &= LoadConfig(mUi->uFilRunout1StateBox, pConfig.filamentRunoutSensor.ENABLE_FIL_RUNOUT1_STATE);
+    success &= LoadConfig(mUi->uFilRunout1PullupBox, pConfig.filamentRunoutSensor.FIL_RUNOUT1_PULLUP);
+    success &= LoadConfig(mUi->uFilRunout1PulldownBox, pConfig.filamentRunoutSensor.FIL_RUNOUT1_PULLDOWN);
+    success &= LoadConfig(mUi->uFilRunout2StateDropdown, pConfig.filamentRunoutSensor.FIL_RUNOUT2_STATE);
+    success &= LoadConfig(mUi->uFilRunout2StateBox, pConfig.filamentRunoutSensor.ENABLE_FIL_RUNOUT2_STATE);
+    success &= LoadConfig(mUi->uFilRunout2PullupBox, pConfig.filamentRunoutSensor.FIL_RUNOUT2_PULLUP);
+    success &= LoadConfig(mUi->uFilRunout2PulldownBox, pConfig.filamentRunoutSensor.FIL_RUNOUT2_PULLDOWN);
+    success &= LoadConfig(mUi->uFilRunout3StateDropdown, pConfig.filamentRunoutSensor.FIL_RUNOUT3_STATE);
+    success &= LoadConfig(mUi->uFilRunout3StateBox, pConfig.filamentRunoutSensor.ENABLE_FIL_RUNOUT3_STATE);
+    success &= LoadConfig(mUi->uFilRunout3PullupBox, pConfig.filamentRunoutSensor.FIL_RUNOUT3_PULLUP);
+    success &= LoadConfig(mUi->uFilRunout3PulldownBox, pConfig.filamentRunoutSensor.FIL_RUNOUT3_PULLDOWN);
+    success &= LoadConfig(mUi->uFilRunout4StateDropdown, pConfig.filamentRunoutSensor.FIL_RUNOUT4_STATE);
+    success &= LoadConfig(mUi->uFilRunout4StateBox, pConfig.filamentRunoutSensor.ENABLE_FIL_RUNOUT4_STATE);
+    success &= LoadConfig(mUi->uFilRunout4PullupBox, pConfig.filamentRunoutSensor.FIL_RUNOUT4_PULLUP);
+    success &= LoadConfig(mUi->uFilRunout4PulldownBox, pConfig.filamentRunoutSensor.FIL_RUNOUT4_PULLDOWN);
+    success &= LoadConfig(mUi->uFilRunout5StateDropdown, pConfig.filamentRunoutSensor.FIL_RUNOUT5_STATE);
+    success &= LoadConfig(mUi->uFilRunout5StateBox, pConfig.filamentRunoutSensor.ENABLE_FIL_RUNOUT5_STATE);
+    success &= LoadConfig(mUi->uFilRunout5PullupBox, pConfig.filamentRunoutSensor.FIL_RUNOUT5_PULLUP);
+    success &= LoadConfig(mUi->uFilRunout5PulldownBox, pConfig.filamentRunoutSensor.FIL_RUNOUT5_PULLDOWN);
+    success &= LoadConfig(mUi->uFilRunout6StateDropdown, pConfig.filamentRunoutSensor.FIL_RUNOUT6_STATE);
+    success &= LoadConfig(mUi->uFilRunout6StateBox, pConfig.filamentRunoutSensor.ENABLE_FIL_RUNOUT6_STATE);
+    success &= LoadConfig(mUi->uFilRunout6PullupBox, pConfig.filamentRunoutSensor.FIL_RUNOUT6_PULLUP);
+    success &= LoadConfig(mUi->uFilRunout6PulldownBox, pConfig.filamentRunoutSensor.FIL_RUNOUT6_PULLDOWN);
+    success &= LoadConfig(mUi->uFilRunout7StateDropdown, pConfig.filamentRunoutSensor.FIL_RUNOUT7_STATE);
+    success &= LoadConfig(mUi->uFilRunout7StateBox, pConfig.filamentRunoutSensor.ENABLE_FIL_RUNOUT7_STATE);
+    success &= LoadConfig(mUi->uFilRunout7PullupBox, pConfig.filamentRunoutSensor.FIL_RUNOUT7_PULLUP);
+    success &= LoadConfig(mUi->uFilRunout7PulldownBox, pConfig.filamentRunoutSensor.FIL_RUNOUT7_PULLDOWN);
+    success &= LoadConfig(mUi->uFilRunout8StateDropdown, pConfig.filamentRunoutSensor.FIL_RUNOUT8_STATE);
+    success &= LoadConfig(mUi->uFilRunout8StateBox, pConfig.filamentRunoutSensor.ENABLE_FIL_RUNOUT8_STATE);
+    success &= LoadConfig(mUi->uFilRunout8PullupBox, pConfig.filamentRunoutSensor.FIL_RUNOUT8_PULLUP);
+    success &= LoadConfig(mUi->uFilRunout8PulldownBox, pConfig.filamentRunoutSensor.FIL_RUNOUT8_PULLDOWN);
+    success &= LoadConfig(mUi->uFilamentRunoutScriptEdit, pConfig.filamentRunoutSensor.FILAMENT_RUNOUT_SCRIPT);
+    success &= LoadConfig(mUi->uFilamentRunoutDistanceMmSpinBox, pConfig.filamentRunoutSensor.FILAMENT_RUNOUT_DISTANCE_MM);
+    success &= LoadConfig(mUi->uFilamentRunoutDistanceMmBox, pConfig.filamentRunoutSensor.ENABLE_FILAMENT_RUNOUT_DISTANCE_MM);
+    success &= LoadConfig(mUi->uFilamentMotionSensorBox, pConfig.filamentRunoutSensor.FILAMENT_MOTION_SENSOR);
 
     mIsLoading = false;
     return success;
@@ -26,11 +26,13 @@
 #include "FirmwarePage.h"
 #include "./ui_FirmwarePage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 FirmwarePage::FirmwarePage(QWidget *pParent) :
-    AbstractPage(FIRMWARE_TEMPLATE_PATH, pParent),
+    AbstractPage(FIRMWARE_TEMPLATE_PATH, "firmware", pParent),
     mUi(new Ui::FirmwarePage)
 {
+    const TraceSpan span("FirmwarePage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -64,18 +66,18 @@ void FirmwarePage::ResetValues()
     mIsLoading = false;
 }
 
-bool FirmwarePage::LoadFromJson(const QJsonObject &pJson)
+bool FirmwarePage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uStringConfigHAuthorEdit, pJson, "STRING_CONFIG_H_AUTHOR");
-    success &= LoadConfig(mUi->uCustomVersionFileEdit, pJson, "CUSTOM_VERSION_FILE");
-    success &= LoadConfig(mUi->uShowBootscreenBox, pJson, "SHOW_BOOTSCREEN");
-    success &= LoadConfig(mUi->uShowCustomBootscreenBox, pJson, "SHOW_CUSTOM_BOOTSCREEN");
-    success &= LoadConfig(mUi->uCustomStatusScreenImageBox, pJson, "CUSTOM_STATUS_SCREEN_IMAGE");
-    success &= LoadConfig(mUi->uStringConfigHAuthorBox, pJson, "ENABLE_STRING_CONFIG_H_AUTHOR");
-    success &= LoadConfig(mUi->uCustomVersionFileBox, pJson, "ENABLE_CUSTOM_VERSION_FILE");
+    success &= LoadConfig(mUi->uStringConfigHAuthorEdit, pConfig.firmware.STRING_CONFIG_H_AUTHOR);
+    success &= LoadConfig(mUi->uCustomVersionFileEdit, pConfig.firmware.CUSTOM_VERSION_FILE);
+    success &= LoadConfig(mUi->uShowBootscreenBox, pConfig.firmware.SHOW_BOOTSCREEN);
+    success &= LoadConfig(mUi->uShowCustomBootscreenBox, pConfig.firmware.SHOW_CUSTOM_BOOTSCREEN);
+    success &= LoadConfig(mUi->uCustomStatusScreenImageBox, pConfig.firmware.CUSTOM_STATUS_SCREEN_IMAGE);
+    success &= LoadConfig(mUi->uStringConfigHAuthorBox, pConfig.firmware.ENABLE_STRING_CONFIG_H_AUTHOR);
+    success &= LoadConfig(mUi->uCustomVersionFileBox, pConfig.firmware.ENABLE_CUSTOM_VERSION_FILE);
 
     mIsLoading = false;
     return success;
@@ -26,18 +26,26 @@
 #include "HardwarePage.h"
 #include "./ui_HardwarePage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
+#include <QSignalBlocker>
 #include <QToolButton>
 
 HardwarePage::HardwarePage(QWidget *pParent) :
-    AbstractPage(HARDWARE_TEMPLATE_PATH, pParent),
+    AbstractPage(HARDWARE_TEMPLATE_PATH, "hardware", pParent),
     mUi(new Ui::HardwarePage)
 {
+    const TraceSpan span("HardwarePage::setupUi");
     mUi->setupUi(this);
 
     // Set the clear button icons of the search boxes
     mUi->uMotherBoardSearchBox->findChild<QToolButton*>()->setIcon(QIcon(":/close_FILL0_wght100_GRAD0_opsz20_white.svg"));
     mUi->uEnvironmentSearchBox->findChild<QToolButton*>()->setIcon(QIcon(":/close_FILL0_wght100_GRAD0_opsz20_white.svg"));
+
+    for (int32_t i = 0; i < mUi->uEnvironmentDropdown->count(); ++i)
+    {
+        mEnvironments.append(mUi->uEnvironmentDropdown->itemText(i));
+    }
 }
 
 HardwarePage::~HardwarePage()
@@ -61,6 +69,11 @@ void HardwarePage::ConnectGuiSignalsAndSlots()
         }
     });
 
+    QObject::connect(mUi->uMotherboardDropdown, &Dropdown::currentIndexChanged, this, [&]()
+    {
+        RankEnvironments(!mIsLoading);
+    });
+
     QObject::connect(mUi->uEnvironmentSearchBox, &QLineEdit::textChanged, this, [&](const QString& pText)
     {
         const auto& index = mUi->uEnvironmentDropdown->findText(pText, Qt::MatchFlag::MatchContains);
@@ -107,29 +120,29 @@ void HardwarePage::ResetValues()
     mIsLoading = false;
 }
 
-bool HardwarePage::LoadFromJson(const QJsonObject &pJson)
+bool HardwarePage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uEnvironmentDropdown, pJson, "ENVIRONMENT");
-    success &= LoadConfig(mUi->uMotherboardDropdown, pJson, "MOTHERBOARD");
-    success &= LoadConfig(mUi->uSerialPortDropdown, pJson, "SERIAL_PORT");
-    success &= LoadConfig(mUi->uBaudrateDropdown, pJson, "BAUDRATE");
-    success &= LoadConfig(mUi->uBaudRateGcodeBox, pJson, "BAUD_RATE_GCODE");
-    success &= LoadConfig(mUi->uSerialPort2Dropdown, pJson, "SERIAL_PORT_2");
-    success &= LoadConfig(mUi->uBaudrate2Dropdown, pJson, "BAUDRATE_2");
-    success &= LoadConfig(mUi->uSerialPort3Dropdown, pJson, "SERIAL_PORT_3");
-    success &= LoadConfig(mUi->uBaudrate3Dropdown, pJson, "BAUDRATE_3");
-    success &= LoadConfig(mUi->uBluetoothBox, pJson, "BLUETOOTH");
-    success &= LoadConfig(mUi->uCustomMachineNameEdit, pJson, "CUSTOM_MACHINE_NAME");
-    success &= LoadConfig(mUi->uMachineUuidEdit, pJson, "MACHINE_UUID");
-    success &= LoadConfig(mUi->uSerialPort2Box, pJson, "ENABLE_SERIAL_PORT_2");
-    success &= LoadConfig(mUi->uBaudrate2Box, pJson, "ENABLE_BAUDRATE_2");
-    success &= LoadConfig(mUi->uSerialPort3Box, pJson, "ENABLE_SERIAL_PORT_3");
-    success &= LoadConfig(mUi->uBaudrate3Box, pJson, "ENABLE_BAUDRATE_3");
-    success &= LoadConfig(mUi->uCustomMachineNameBox, pJson, "ENABLE_CUSTOM_MACHINE_NAME");
-    success &= LoadConfig(mUi->uMachineUuidBox, pJson, "ENABLE_MACHINE_UUID");
+    success &= LoadConfig(mUi->uEnvironmentDropdown, pConfig.hardware.ENVIRONMENT);
+    success &= LoadConfig(mUi->uMotherboardDropdown, pConfig.hardware.MOTHERBOARD);
+    success &= LoadConfig(mUi->uSerialPortDropdown, pConfig.hardware.SERIAL_PORT);
+    success &= LoadConfig(mUi->uBaudrateDropdown, pConfig.hardware.BAUDRATE);
+    success &= LoadConfig(mUi->uBaudRateGcodeBox, pConfig.hardware.BAUD_RATE_GCODE);
+    success &= LoadConfig(mUi->uSerialPort2Dropdown, pConfig.hardware.SERIAL_PORT_2);
+    success &= LoadConfig(mUi->uBaudrate2Dropdown, pConfig.hardware.BAUDRATE_2);
+    success &= LoadConfig(mUi->uSerialPort3Dropdown, pConfig.hardware.SERIAL_PORT_3);
+    success &= LoadConfig(mUi->uBaudrate3Dropdown, pConfig.hardware.BAUDRATE_3);
+    success &= LoadConfig(mUi->uBluetoothBox, pConfig.hardware.BLUETOOTH);
+    success &= LoadConfig(mUi->uCustomMachineNameEdit, pConfig.hardware.CUSTOM_MACHINE_NAME);
+    success &= LoadConfig(mUi->uMachineUuidEdit, pConfig.hardware.MACHINE_UUID);
+    success &= LoadConfig(mUi->uSerialPort2Box, pConfig.hardware.ENABLE_SERIAL_PORT_2);
+    success &= LoadConfig(mUi->uBaudrate2Box, pConfig.hardware.ENABLE_BAUDRATE_2);
+    success &= LoadConfig(mUi->uSerialPort3Box, pConfig.hardware.ENABLE_SERIAL_PORT_3);
+    success &= LoadConfig(mUi->uBaudrate3Box, pConfig.hardware.ENABLE_BAUDRATE_3);
+    success &= LoadConfig(mUi->uCustomMachineNameBox, pConfig.hardware.ENABLE_CUSTOM_MACHINE_NAME);
+    success &= LoadConfig(mUi->uMachineUuidBox, pConfig.hardware.ENABLE_MACHINE_UUID);
 
     mIsLoading = false;
     return success;
@@ -176,3 +189,75 @@ QString HardwarePage::GetEnvironment(void) const
 {
     return mUi->uEnvironmentDropdown->currentText();
 }
+
+int32_t HardwarePage::AddMotherboards(const QStringList& pMotherboards)
+{
+    return mUi->uMotherboardDropdown->SetAddedItems(pMotherboards, true);
+}
+
+QString HardwarePage::GetMotherboard(void) const
+{
+    const auto text = mUi->uMotherboardDropdown->currentText();
+    return text.contains('[') ? ExtractFlagNameInSquareBrackets(text) : QString();
+}
+
+void HardwarePage::SetBoardEnvironments(const QStringList& pEnvironments, const QHash<QString, QStringList>& pEnvironmentsByBoard)
+{
+    if (!pEnvironments.isEmpty())
+    {
+        mEnvironments = pEnvironments;
+    }
+    mEnvironmentsByBoard = pEnvironmentsByBoard;
+
+    RankEnvironments(false);
+}
+
+void HardwarePage::RankEnvironments(bool pSelectRecommended)
+{
+    const auto current = mUi->uEnvironmentDropdown->currentText();
+    const auto recommended = mEnvironmentsByBoard.value(GetMotherboard());
+
+    {
+        const QSignalBlocker blocker(mUi->uEnvironmentDropdown);
+
+        mUi->uEnvironmentDropdown->clear();
+        for (const auto& environment : recommended)
+        {
+            mUi->uEnvironmentDropdown->addItem(environment);
+            mUi->uEnvironmentDropdown->setItemData(mUi->uEnvironmentDropdown->count() - 1, tr("Recommended for the selected motherboard"), Qt::ToolTipRole);
+        }
+
+        if (!recommended.isEmpty())
+        {
+            mUi->uEnvironmentDropdown->insertSeparator(mUi->uEnvironmentDropdown->count());
+        }
+
+        for (const auto& environment : mEnvironments)
+        {
+            if (!recommended.contains(environment))
+            {
+                mUi->uEnvironmentDropdown->addItem(environment);
+            }
+        }
+
+        if (pSelectRecommended && !recommended.isEmpty() && !recommended.contains(current))
+        {
+            mUi->uEnvironmentDropdown->setCurrentIndex(0);
+        }
+        else if (const auto index = mUi->uEnvironmentDropdown->findText(current); index >= 0)
+        {
+            mUi->uEnvironmentDropdown->setCurrentIndex(index);
+        }
+        else if (!current.isEmpty())
+        {
+            // Keep environments defined outside of the known lists selectable
+            mUi->uEnvironmentDropdown->addItem(current);
+            mUi->uEnvironmentDropdown->setCurrentIndex(mUi->uEnvironmentDropdown->count() - 1);
+        }
+    }
+
+    if (mUi->uEnvironmentDropdown->currentText() != current)
+    {
+        OnConfigurationChanged();
+    }
+}
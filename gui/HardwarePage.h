@@ -29,6 +29,9 @@
 #include "Configuration.h"
 #include "AbstractPage.h"
 
+#include <QHash>
+#include <QStringList>
+
 // Forward declarations
 namespace Ui {
 class HardwarePage;
@@ -52,11 +55,11 @@ public:
     /// \brief Resets all parameters on the page to their defaults
     void ResetValues(void) override;
 
-    /// \brief Loads the page parameters from the given JSON object
+    /// \brief Loads the page parameters from the given configuration
     ///
-    /// \param pJson: Reference to the JSON object
-    /// \return \b true, if all expected parameters where found in the JSON
-    bool LoadFromJson(const QJsonObject &pJson) override;
+    /// \param pConfig: Reference to the configuration
+    /// \return \b true, if all parameters could be set, e.g. every dropdown item exists
+    bool LoadFromConfiguration(const Configuration& pConfig) override;
 
     /// \brief Writes the page parameters into the given Configuration object
     ///
@@ -71,12 +74,37 @@ public:
 
     QString GetEnvironment(void) const;
 
+    /// \brief Replaces the motherboards added for the previous workspace with those of the opened workspace
+    ///
+    /// \param pMotherboards: The motherboards in the format "Description [BOARD_NAME]"
+    /// \return The number of added motherboards
+    int32_t AddMotherboards(const QStringList& pMotherboards);
+
+    /// \brief Returns the name of the selected motherboard
+    ///
+    /// \return The name in square brackets, e.g. "BOARD_RAMPS_14_EFB"
+    QString GetMotherboard(void) const;
+
+    /// \brief Sets the environments of the opened workspace and the environments recommended per motherboard
+    ///
+    /// \param pEnvironments: All environments, the built-in list is kept if empty
+    /// \param pEnvironmentsByBoard: Maps the motherboard names to their recommended environments
+    void SetBoardEnvironments(const QStringList& pEnvironments, const QHash<QString, QStringList>& pEnvironmentsByBoard);
+
 protected:
     /// \brief Connects this widget's signals and slots
     void ConnectGuiSignalsAndSlots(void) override;
 
+    /// \brief Lists the environments recommended for the selected motherboard first
+    ///
+    /// \param pSelectRecommended: If true, the first recommended environment is selected if the current one is not recommended
+    void RankEnvironments(bool pSelectRecommended);
+
 protected:
     Ui::HardwarePage *mUi;
+
+    QStringList mEnvironments;
+    QHash<QString, QStringList> mEnvironmentsByBoard;
 };
 
 #endif // HARDWAREPAGE_H
@@ -26,11 +26,13 @@
 #include "HomingAndBoundsPage.h"
 #include "./ui_HomingAndBoundsPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 HomingAndBoundsPage::HomingAndBoundsPage(QWidget *pParent) :
-    AbstractPage(HOMING_AND_BOUNDS_TEMPLATE_PATH, pParent),
+    AbstractPage(HOMING_AND_BOUNDS_TEMPLATE_PATH, "homingAndBounds", pParent),
     mUi(new Ui::HomingAndBoundsPage)
 {
+    const TraceSpan span("HomingAndBoundsPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -155,96 +157,96 @@ void HomingAndBoundsPage::ResetValues()
     mIsLoading = false;
 }
 
-bool HomingAndBoundsPage::LoadFromJson(const QJsonObject &pJson)
+bool HomingAndBoundsPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uNoMotionBeforeHomingBox, pJson, "NO_MOTION_BEFORE_HOMING");
-    success &= LoadConfig(mUi->uHomeAfterDeactivateBox, pJson, "HOME_AFTER_DEACTIVATE");
-    success &= LoadConfig(mUi->uZIdleHeightSpinBox, pJson, "Z_IDLE_HEIGHT");
-    success &= LoadConfig(mUi->uZHomingHeightSpinBox, pJson, "Z_HOMING_HEIGHT");
-    success &= LoadConfig(mUi->uZAfterHomingSpinBox, pJson, "Z_AFTER_HOMING");
-    success &= LoadConfig(mUi->uZIdleHeightBox, pJson, "ENABLE_Z_IDLE_HEIGHT");
-    success &= LoadConfig(mUi->uZHomingHeightBox, pJson, "ENABLE_Z_HOMING_HEIGHT");
-    success &= LoadConfig(mUi->uZAfterHomingBox, pJson, "ENABLE_Z_AFTER_HOMING");
-    success &= LoadConfig(mUi->uXHomeDirDropdown, pJson, "X_HOME_DIR");
-    success &= LoadConfig(mUi->uYHomeDirDropdown, pJson, "Y_HOME_DIR");
-    success &= LoadConfig(mUi->uZHomeDirDropdown, pJson, "Z_HOME_DIR");
-    success &= LoadConfig(mUi->uIHomeDirDropdown, pJson, "I_HOME_DIR");
-    success &= LoadConfig(mUi->uJHomeDirDropdown, pJson, "J_HOME_DIR");
-    success &= LoadConfig(mUi->uKHomeDirDropdown, pJson, "K_HOME_DIR");
-    success &= LoadConfig(mUi->uUHomeDirDropdown, pJson, "U_HOME_DIR");
-    success &= LoadConfig(mUi->uVHomeDirDropdown, pJson, "V_HOME_DIR");
-    success &= LoadConfig(mUi->uWHomeDirDropdown, pJson, "W_HOME_DIR");
-    success &= LoadConfig(mUi->uXHomeDirBox, pJson, "ENABLE_X_HOME_DIR");
-    success &= LoadConfig(mUi->uYHomeDirBox, pJson, "ENABLE_Y_HOME_DIR");
-    success &= LoadConfig(mUi->uZHomeDirBox, pJson, "ENABLE_Z_HOME_DIR");
-    success &= LoadConfig(mUi->uIHomeDirBox, pJson, "ENABLE_I_HOME_DIR");
-    success &= LoadConfig(mUi->uJHomeDirBox, pJson, "ENABLE_J_HOME_DIR");
-    success &= LoadConfig(mUi->uKHomeDirBox, pJson, "ENABLE_K_HOME_DIR");
-    success &= LoadConfig(mUi->uUHomeDirBox, pJson, "ENABLE_U_HOME_DIR");
-    success &= LoadConfig(mUi->uVHomeDirBox, pJson, "ENABLE_V_HOME_DIR");
-    success &= LoadConfig(mUi->uWHomeDirBox, pJson, "ENABLE_W_HOME_DIR");
-    success &= LoadConfig(mUi->uXBedSizeSpinBox, pJson, "X_BED_SIZE");
-    success &= LoadConfig(mUi->uYBedSizeSpinBox, pJson, "Y_BED_SIZE");
-    success &= LoadConfig(mUi->uXMinPosSpinBox, pJson, "X_MIN_POS");
-    success &= LoadConfig(mUi->uYMinPosSpinBox, pJson, "Y_MIN_POS");
-    success &= LoadConfig(mUi->uZMinPosSpinBox, pJson, "Z_MIN_POS");
-    success &= LoadConfig(mUi->uXMaxPosSpinBox, pJson, "X_MAX_POS");
-    success &= LoadConfig(mUi->uYMaxPosSpinBox, pJson, "Y_MAX_POS");
-    success &= LoadConfig(mUi->uZMaxPosSpinBox, pJson, "Z_MAX_POS");
-    success &= LoadConfig(mUi->uXMinPosBox, pJson, "ENABLE_X_MIN_POS");
-    success &= LoadConfig(mUi->uYMinPosBox, pJson, "ENABLE_Y_MIN_POS");
-    success &= LoadConfig(mUi->uZMinPosBox, pJson, "ENABLE_Z_MIN_POS");
-    success &= LoadConfig(mUi->uXMaxPosBox, pJson, "ENABLE_X_MAX_POS");
-    success &= LoadConfig(mUi->uYMaxPosBox, pJson, "ENABLE_Y_MAX_POS");
-    success &= LoadConfig(mUi->uZMaxPosBox, pJson, "ENABLE_Z_MAX_POS");
-    success &= LoadConfig(mUi->uIMinPosSpinBox, pJson, "I_MIN_POS");
-    success &= LoadConfig(mUi->uJMinPosSpinBox, pJson, "J_MIN_POS");
-    success &= LoadConfig(mUi->uKMinPosSpinBox, pJson, "K_MIN_POS");
-    success &= LoadConfig(mUi->uIMaxPosSpinBox, pJson, "I_MAX_POS");
-    success &= LoadConfig(mUi->uJMaxPosSpinBox, pJson, "J_MAX_POS");
-    success &= LoadConfig(mUi->uKMaxPosSpinBox, pJson, "K_MAX_POS");
-    success &= LoadConfig(mUi->uIMinPosBox, pJson, "ENABLE_I_MIN_POS");
-    success &= LoadConfig(mUi->uJMinPosBox, pJson, "ENABLE_J_MIN_POS");
-    success &= LoadConfig(mUi->uKMinPosBox, pJson, "ENABLE_K_MIN_POS");
-    success &= LoadConfig(mUi->uIMaxPosBox, pJson, "ENABLE_I_MAX_POS");
-    success &= LoadConfig(mUi->uJMaxPosBox, pJson, "ENABLE_J_MAX_POS");
-    success &= LoadConfig(mUi->uKMaxPosBox, pJson, "ENABLE_K_MAX_POS");
-    success &= LoadConfig(mUi->uUMinPosSpinBox, pJson, "U_MIN_POS");
-    success &= LoadConfig(mUi->uVMinPosSpinBox, pJson, "V_MIN_POS");
-    success &= LoadConfig(mUi->uWMinPosSpinBox, pJson, "W_MIN_POS");
-    success &= LoadConfig(mUi->uUMaxPosSpinBox, pJson, "U_MAX_POS");
-    success &= LoadConfig(mUi->uVMaxPosSpinBox, pJson, "V_MAX_POS");
-    success &= LoadConfig(mUi->uWMaxPosSpinBox, pJson, "W_MAX_POS");
-    success &= LoadConfig(mUi->uUMinPosBox, pJson, "ENABLE_U_MIN_POS");
-    success &= LoadConfig(mUi->uVMinPosBox, pJson, "ENABLE_V_MIN_POS");
-    success &= LoadConfig(mUi->uWMinPosBox, pJson, "ENABLE_W_MIN_POS");
-    success &= LoadConfig(mUi->uUMaxPosBox, pJson, "ENABLE_U_MAX_POS");
-    success &= LoadConfig(mUi->uVMaxPosBox, pJson, "ENABLE_V_MAX_POS");
-    success &= LoadConfig(mUi->uWMaxPosBox, pJson, "ENABLE_W_MAX_POS");
-    success &= LoadConfig(mUi->uMinSoftwareEndstopsBox, pJson, "MIN_SOFTWARE_ENDSTOPS");
-    success &= LoadConfig(mUi->uMinSoftwareEndstopXBox, pJson, "MIN_SOFTWARE_ENDSTOP_X");
-    success &= LoadConfig(mUi->uMinSoftwareEndstopYBox, pJson, "MIN_SOFTWARE_ENDSTOP_Y");
-    success &= LoadConfig(mUi->uMinSoftwareEndstopZBox, pJson, "MIN_SOFTWARE_ENDSTOP_Z");
-    success &= LoadConfig(mUi->uMinSoftwareEndstopIBox, pJson, "MIN_SOFTWARE_ENDSTOP_I");
-    success &= LoadConfig(mUi->uMinSoftwareEndstopJBox, pJson, "MIN_SOFTWARE_ENDSTOP_J");
-    success &= LoadConfig(mUi->uMinSoftwareEndstopKBox, pJson, "MIN_SOFTWARE_ENDSTOP_K");
-    success &= LoadConfig(mUi->uMinSoftwareEndstopUBox, pJson, "MIN_SOFTWARE_ENDSTOP_U");
-    success &= LoadConfig(mUi->uMinSoftwareEndstopVBox, pJson, "MIN_SOFTWARE_ENDSTOP_V");
-    success &= LoadConfig(mUi->uMinSoftwareEndstopWBox, pJson, "MIN_SOFTWARE_ENDSTOP_W");
-    success &= LoadConfig(mUi->uMaxSoftwareEndstopsBox, pJson, "MAX_SOFTWARE_ENDSTOPS");
-    success &= LoadConfig(mUi->uMaxSoftwareEndstopXBox, pJson, "MAX_SOFTWARE_ENDSTOP_X");
-    success &= LoadConfig(mUi->uMaxSoftwareEndstopYBox, pJson, "MAX_SOFTWARE_ENDSTOP_Y");
-    success &= LoadConfig(mUi->uMaxSoftwareEndstopZBox, pJson, "MAX_SOFTWARE_ENDSTOP_Z");
-    success &= LoadConfig(mUi->uMaxSoftwareEndstopIBox, pJson, "MAX_SOFTWARE_ENDSTOP_I");
-    success &= LoadConfig(mUi->uMaxSoftwareEndstopJBox, pJson, "MAX_SOFTWARE_ENDSTOP_J");
-    success &= LoadConfig(mUi->uMaxSoftwareEndstopKBox, pJson, "MAX_SOFTWARE_ENDSTOP_K");
-    success &= LoadConfig(mUi->uMaxSoftwareEndstopUBox, pJson, "MAX_SOFTWARE_ENDSTOP_U");
-    success &= LoadConfig(mUi->uMaxSoftwareEndstopVBox, pJson, "MAX_SOFTWARE_ENDSTOP_V");
-    success &= LoadConfig(mUi->uMaxSoftwareEndstopWBox, pJson, "MAX_SOFTWARE_ENDSTOP_W");
-    success &= LoadConfig(mUi->uSoftEndstopsMenuItemBox, pJson, "SOFT_ENDSTOPS_MENU_ITEM");
+    success &= LoadConfig(mUi->uNoMotionBeforeHomingBox, pConfig.homingAndBounds.NO_MOTION_BEFORE_HOMING);
+    success &= LoadConfig(mUi->uHomeAfterDeactivateBox, pConfig.homingAndBounds.HOME_AFTER_DEACTIVATE);
+    success &= LoadConfig(mUi->uZIdleHeightSpinBox, pConfig.homingAndBounds.Z_IDLE_HEIGHT);
+    success &= LoadConfig(mUi->uZHomingHeightSpinBox, pConfig.homingAndBounds.Z_HOMING_HEIGHT);
+    success &= LoadConfig(mUi->uZAfterHomingSpinBox, pConfig.homingAndBounds.Z_AFTER_HOMING);
+    success &= LoadConfig(mUi->uZIdleHeightBox, pConfig.homingAndBounds.ENABLE_Z_IDLE_HEIGHT);
+    success &= LoadConfig(mUi->uZHomingHeightBox, pConfig.homingAndBounds.ENABLE_Z_HOMING_HEIGHT);
+    success &= LoadConfig(mUi->uZAfterHomingBox, pConfig.homingAndBounds.ENABLE_Z_AFTER_HOMING);
+    success &= LoadConfig(mUi->uXHomeDirDropdown, pConfig.homingAndBounds.X_HOME_DIR);
+    success &= LoadConfig(mUi->uYHomeDirDropdown, pConfig.homingAndBounds.Y_HOME_DIR);
+    success &= LoadConfig(mUi->uZHomeDirDropdown, pConfig.homingAndBounds.Z_HOME_DIR);
+    success &= LoadConfig(mUi->uIHomeDirDropdown, pConfig.homingAndBounds.I_HOME_DIR);
+    success &= LoadConfig(mUi->uJHomeDirDropdown, pConfig.homingAndBounds.J_HOME_DIR);
+    success &= LoadConfig(mUi->uKHomeDirDropdown, pConfig.homingAndBounds.K_HOME_DIR);
+    success &= LoadConfig(mUi->uUHomeDirDropdown, pConfig.homingAndBounds.U_HOME_DIR);
+    success &= LoadConfig(mUi->uVHomeDirDropdown, pConfig.homingAndBounds.V_HOME_DIR);
+    success &= LoadConfig(mUi->uWHomeDirDropdown, pConfig.homingAndBounds.W_HOME_DIR);
+    success &= LoadConfig(mUi->uXHomeDirBox, pConfig.homingAndBounds.ENABLE_X_HOME_DIR);
+    success &= LoadConfig(mUi->uYHomeDirBox, pConfig.homingAndBounds.ENABLE_Y_HOME_DIR);
+    success &= LoadConfig(mUi->uZHomeDirBox, pConfig.homingAndBounds.ENABLE_Z_HOME_DIR);
+    success &= LoadConfig(mUi->uIHomeDirBox, pConfig.homingAndBounds.ENABLE_I_HOME_DIR);
+    success &= LoadConfig(mUi->uJHomeDirBox, pConfig.homingAndBounds.ENABLE_J_HOME_DIR);
+    success &= LoadConfig(mUi->uKHomeDirBox, pConfig.homingAndBounds.ENABLE_K_HOME_DIR);
+    success &= LoadConfig(mUi->uUHomeDirBox, pConfig.homingAndBounds.ENABLE_U_HOME_DIR);
+    success &= LoadConfig(mUi->uVHomeDirBox, pConfig.homingAndBounds.ENABLE_V_HOME_DIR);
+    success &= LoadConfig(mUi->uWHomeDirBox, pConfig.homingAndBounds.ENABLE_W_HOME_DIR);
+    success &= LoadConfig(mUi->uXBedSizeSpinBox, pConfig.homingAndBounds.X_BED_SIZE);
+    success &= LoadConfig(mUi->uYBedSizeSpinBox, pConfig.homingAndBounds.Y_BED_SIZE);
+    success &= LoadConfig(mUi->uXMinPosSpinBox, pConfig.homingAndBounds.X_MIN_POS);
+    success &= LoadConfig(mUi->uYMinPosSpinBox, pConfig.homingAndBounds.Y_MIN_POS);
+    success &= LoadConfig(mUi->uZMinPosSpinBox, pConfig.homingAndBounds.Z_MIN_POS);
+    success &= LoadConfig(mUi->uXMaxPosSpinBox, pConfig.homingAndBounds.X_MAX_POS);
+    success &= LoadConfig(mUi->uYMaxPosSpinBox, pConfig.homingAndBounds.Y_MAX_POS);
+    success &= LoadConfig(mUi->uZMaxPosSpinBox, pConfig.homingAndBounds.Z_MAX_POS);
+    success &= LoadConfig(mUi->uXMinPosBox, pConfig.homingAndBounds.ENABLE_X_MIN_POS);
+    success &= LoadConfig(mUi->uYMinPosBox, pConfig.homingAndBounds.ENABLE_Y_MIN_POS);
+    success &= LoadConfig(mUi->uZMinPosBox, pConfig.homingAndBounds.ENABLE_Z_MIN_POS);
+    success &= LoadConfig(mUi->uXMaxPosBox, pConfig.homingAndBounds.ENABLE_X_MAX_POS);
+    success &= LoadConfig(mUi->uYMaxPosBox, pConfig.homingAndBounds.ENABLE_Y_MAX_POS);
+    success &= LoadConfig(mUi->uZMaxPosBox, pConfig.homingAndBounds.ENABLE_Z_MAX_POS);
+    success &= LoadConfig(mUi->uIMinPosSpinBox, pConfig.homingAndBounds.I_MIN_POS);
+    success &= LoadConfig(mUi->uJMinPosSpinBox, pConfig.homingAndBounds.J_MIN_POS);
+    success &= LoadConfig(mUi->uKMinPosSpinBox, pConfig.homingAndBounds.K_MIN_POS);
+    success &= LoadConfig(mUi->uIMaxPosSpinBox, pConfig.homingAndBounds.I_MAX_POS);
+    success &= LoadConfig(mUi->uJMaxPosSpinBox, pConfig.homingAndBounds.J_MAX_POS);
+    success &= LoadConfig(mUi->uKMaxPosSpinBox, pConfig.homingAndBounds.K_MAX_POS);
+    success &= LoadConfig(mUi->uIMinPosBox, pConfig.homingAndBounds.ENABLE_I_MIN_POS);
+    success &= LoadConfig(mUi->uJMinPosBox, pConfig.homingAndBounds.ENABLE_J_MIN_POS);
+    success &= LoadConfig(mUi->uKMinPosBox, pConfig.homingAndBounds.ENABLE_K_MIN_POS);
+    success &= LoadConfig(mUi->uIMaxPosBox, pConfig.homingAndBounds.ENABLE_I_MAX_POS);
+    success &= LoadConfig(mUi->uJMaxPosBox, pConfig.homingAndBounds.ENABLE_J_MAX_POS);
+    success &= LoadConfig(mUi->uKMaxPosBox, pConfig.homingAndBounds.ENABLE_K_MAX_POS);
+    success &= LoadConfig(mUi->uUMinPosSpinBox, pConfig.homingAndBounds.U_MIN_POS);
+    success &= LoadConfig(mUi->uVMinPosSpinBox, pConfig.homingAndBounds.V_MIN_POS);
+    success &= LoadConfig(mUi->uWMinPosSpinBox, pConfig.homingAndBounds.W_MIN_POS);
+    success &= LoadConfig(mUi->uUMaxPosSpinBox, pConfig.homingAndBounds.U_MAX_POS);
+    success &= LoadConfig(mUi->uVMaxPosSpinBox, pConfig.homingAndBounds.V_MAX_POS);
+    success &= LoadConfig(mUi->uWMaxPosSpinBox, pConfig.homingAndBounds.W_MAX_POS);
+    success &= LoadConfig(mUi->uUMinPosBox, pConfig.homingAndBounds.ENABLE_U_MIN_POS);
+    success &= LoadConfig(mUi->uVMinPosBox, pConfig.homingAndBounds.ENABLE_V_MIN_POS);
+    success &= LoadConfig(mUi->uWMinPosBox, pConfig.homingAndBounds.ENABLE_W_MIN_POS);
+    success &= LoadConfig(mUi->uUMaxPosBox, pConfig.homingAndBounds.ENABLE_U_MAX_POS);
+    success &= LoadConfig(mUi->uVMaxPosBox, pConfig.homingAndBounds.ENABLE_V_MAX_POS);
+    success &= LoadConfig(mUi->uWMaxPosBox, pConfig.homingAndBounds.ENABLE_W_MAX_POS);
+    success &= LoadConfig(mUi->uMinSoftwareEndstopsBox, pConfig.homingAndBounds.MIN_SOFTWARE_ENDSTOPS);
+    success &= LoadConfig(mUi->uMinSoftwareEndstopXBox, pConfig.homingAndBounds.MIN_SOFTWARE_ENDSTOP_X);
+    success &= LoadConfig(mUi->uMinSoftwareEndstopYBox, pConfig.homingAndBounds.MIN_SOFTWARE_ENDSTOP_Y);
+    success &= LoadConfig(mUi->uMinSoftwareEndstopZBox, pConfig.homingAndBounds.MIN_SOFTWARE_ENDSTOP_Z);
+    success &= LoadConfig(mUi->uMinSoftwareEndstopIBox, pConfig.homingAndBounds.MIN_SOFTWARE_ENDSTOP_I);
+    success &= LoadConfig(mUi->uMinSoftwareEndstopJBox, pConfig.homingAndBounds.MIN_SOFTWARE_ENDSTOP_J);
+    success &= LoadConfig(mUi->uMinSoftwareEndstopKBox, pConfig.homingAndBounds.MIN_SOFTWARE_ENDSTOP_K);
+    success &= LoadConfig(mUi->uMinSoftwareEndstopUBox, pConfig.homingAndBounds.MIN_SOFTWARE_ENDSTOP_U);
+    success &= LoadConfig(mUi->uMinSoftwareEndstopVBox, pConfig.homingAndBounds.MIN_SOFTWARE_ENDSTOP_V);
+    success &= LoadConfig(mUi->uMinSoftwareEndstopWBox, pConfig.homingAndBounds.MIN_SOFTWARE_ENDSTOP_W);
+    success &= LoadConfig(mUi->uMaxSoftwareEndstopsBox, pConfig.homingAndBounds.MAX_SOFTWARE_ENDSTOPS);
+    success &= LoadConfig(mUi->uMaxSoftwareEndstopXBox, pConfig.homingAndBounds.MAX_SOFTWARE_ENDSTOP_X);
+    success &= LoadConfig(mUi->uMaxSoftwareEndstopYBox, pConfig.homingAndBounds.MAX_SOFTWARE_ENDSTOP_Y);
+    success &= LoadConfig(mUi->uMaxSoftwareEndstopZBox, pConfig.homingAndBounds.MAX_SOFTWARE_ENDSTOP_Z);
+    success &= LoadConfig(mUi->uMaxSoftwareEndstopIBox, pConfig.homingAndBounds.MAX_SOFTWARE_ENDSTOP_I);
+    success &= LoadConfig(mUi->uMaxSoftwareEndstopJBox, pConfig.homingAndBounds.MAX_SOFTWARE_ENDSTOP_J);
+    success &= LoadConfig(mUi->uMaxSoftwareEndstopKBox, pConfig.homingAndBounds.MAX_SOFTWARE_ENDSTOP_K);
+    success &= LoadConfig(mUi->uMaxSoftwareEndstopUBox, pConfig.homingAndBounds.MAX_SOFTWARE_ENDSTOP_U);
+    success &= LoadConfig(mUi->uMaxSoftwareEndstopVBox, pConfig.homingAndBounds.MAX_SOFTWARE_ENDSTOP_V);
+    success &= LoadConfig(mUi->uMaxSoftwareEndstopWBox, pConfig.homingAndBounds.MAX_SOFTWARE_ENDSTOP_W);
+    success &= LoadConfig(mUi->uSoftEndstopsMenuItemBox, pConfig.homingAndBounds.SOFT_ENDSTOPS_MENU_ITEM);
 
     mIsLoading = false;
     return success;
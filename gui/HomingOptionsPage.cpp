@@ -26,11 +26,13 @@
 #include "HomingOptionsPage.h"
 #include "./ui_HomingOptionsPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 HomingOptionsPage::HomingOptionsPage(QWidget *pParent) :
-    AbstractPage(HOMING_OPTIONS_TEMPLATE_PATH, pParent),
+    AbstractPage(HOMING_OPTIONS_TEMPLATE_PATH, "homingOptions", pParent),
     mUi(new Ui::HomingOptionsPage)
 {
+    const TraceSpan span("HomingOptionsPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -102,54 +104,54 @@ void HomingOptionsPage::ResetValues()
     mIsLoading = false;
 }
 
-bool HomingOptionsPage::LoadFromJson(const QJsonObject &pJson)
+bool HomingOptionsPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uBedCenterAt00Box, pJson, "BED_CENTER_AT_0_0");
-    success &= LoadConfig(mUi->uManualXHomePosSpinBox, pJson, "MANUAL_X_HOME_POS");
-    success &= LoadConfig(mUi->uManualYHomePosSpinBox, pJson, "MANUAL_Y_HOME_POS");
-    success &= LoadConfig(mUi->uManualZHomePosSpinBox, pJson, "MANUAL_Z_HOME_POS");
-    success &= LoadConfig(mUi->uManualIHomePosSpinBox, pJson, "MANUAL_I_HOME_POS");
-    success &= LoadConfig(mUi->uManualJHomePosSpinBox, pJson, "MANUAL_J_HOME_POS");
-    success &= LoadConfig(mUi->uManualKHomePosSpinBox, pJson, "MANUAL_K_HOME_POS");
-    success &= LoadConfig(mUi->uManualUHomePosSpinBox, pJson, "MANUAL_U_HOME_POS");
-    success &= LoadConfig(mUi->uManualVHomePosSpinBox, pJson, "MANUAL_V_HOME_POS");
-    success &= LoadConfig(mUi->uManualWHomePosSpinBox, pJson, "MANUAL_W_HOME_POS");
-    success &= LoadConfig(mUi->uManualXHomePosBox, pJson, "ENABLE_MANUAL_X_HOME_POS");
-    success &= LoadConfig(mUi->uManualYHomePosBox, pJson, "ENABLE_MANUAL_Y_HOME_POS");
-    success &= LoadConfig(mUi->uManualZHomePosBox, pJson, "ENABLE_MANUAL_Z_HOME_POS");
-    success &= LoadConfig(mUi->uManualIHomePosBox, pJson, "ENABLE_MANUAL_I_HOME_POS");
-    success &= LoadConfig(mUi->uManualJHomePosBox, pJson, "ENABLE_MANUAL_J_HOME_POS");
-    success &= LoadConfig(mUi->uManualKHomePosBox, pJson, "ENABLE_MANUAL_K_HOME_POS");
-    success &= LoadConfig(mUi->uManualUHomePosBox, pJson, "ENABLE_MANUAL_U_HOME_POS");
-    success &= LoadConfig(mUi->uManualVHomePosBox, pJson, "ENABLE_MANUAL_V_HOME_POS");
-    success &= LoadConfig(mUi->uManualWHomePosBox, pJson, "ENABLE_MANUAL_W_HOME_POS");
-    success &= LoadConfig(mUi->uZSafeHomingBox, pJson, "Z_SAFE_HOMING");
-    success &= LoadConfig(mUi->uZSafeHomingXPointSpinBox, pJson, "Z_SAFE_HOMING_X_POINT");
-    success &= LoadConfig(mUi->uZSafeHomingYPointSpinBox, pJson, "Z_SAFE_HOMING_Y_POINT");
-    success &= LoadConfig(mUi->uZSafeHomingXPointBox, pJson, "ENABLE_Z_SAFE_HOMING_X_POINT");
-    success &= LoadConfig(mUi->uZSafeHomingYPointBox, pJson, "ENABLE_Z_SAFE_HOMING_Y_POINT");
-    success &= LoadConfig(mUi->uHomingFeedrateMmMEdit, pJson, "HOMING_FEEDRATE_MM_M");
-    success &= LoadConfig(mUi->uValidateHomingEndstopsBox, pJson, "VALIDATE_HOMING_ENDSTOPS");
-    success &= LoadConfig(mUi->uSkewCorrectionBox, pJson, "SKEW_CORRECTION");
-    success &= LoadConfig(mUi->uXyDiagAcSpinBox, pJson, "XY_DIAG_AC");
-    success &= LoadConfig(mUi->uXyDiagBdSpinBox, pJson, "XY_DIAG_BD");
-    success &= LoadConfig(mUi->uXySideAdSpinBox, pJson, "XY_SIDE_AD");
-    success &= LoadConfig(mUi->uXySkewFactorSpinBox, pJson, "XY_SKEW_FACTOR");
-    success &= LoadConfig(mUi->uXySkewFactorBox, pJson, "ENABLE_XY_SKEW_FACTOR");
-    success &= LoadConfig(mUi->uSkewCorrectionForZBox, pJson, "SKEW_CORRECTION_FOR_Z");
-    success &= LoadConfig(mUi->uXzDiagAcSpinBox, pJson, "XZ_DIAG_AC");
-    success &= LoadConfig(mUi->uXzDiagBdSpinBox, pJson, "XZ_DIAG_BD");
-    success &= LoadConfig(mUi->uYzDiagAcSpinBox, pJson, "YZ_DIAG_AC");
-    success &= LoadConfig(mUi->uYzDiagBdSpinBox, pJson, "YZ_DIAG_BD");
-    success &= LoadConfig(mUi->uYzSideAdSpinBox, pJson, "YZ_SIDE_AD");
-    success &= LoadConfig(mUi->uXzSkewFactorSpinBox, pJson, "XZ_SKEW_FACTOR");
-    success &= LoadConfig(mUi->uYzSkewFactorSpinBox, pJson, "YZ_SKEW_FACTOR");
-    success &= LoadConfig(mUi->uXzSkewFactorBox, pJson, "ENABLE_XZ_SKEW_FACTOR");
-    success &= LoadConfig(mUi->uYzSkewFactorBox, pJson, "ENABLE_YZ_SKEW_FACTOR");
-    success &= LoadConfig(mUi->uSkewCorrectionGcodeBox, pJson, "SKEW_CORRECTION_GCODE");
+    success &= LoadConfig(mUi->uBedCenterAt00Box, pConfig.homingOptions.BED_CENTER_AT_0_0);
+    success &= LoadConfig(mUi->uManualXHomePosSpinBox, pConfig.homingOptions.MANUAL_X_HOME_POS);
+    success &= LoadConfig(mUi->uManualYHomePosSpinBox, pConfig.homingOptions.MANUAL_Y_HOME_POS);
+    success &= LoadConfig(mUi->uManualZHomePosSpinBox, pConfig.homingOptions.MANUAL_Z_HOME_POS);
+    success &= LoadConfig(mUi->uManualIHomePosSpinBox, pConfig.homingOptions.MANUAL_I_HOME_POS);
+    success &= LoadConfig(mUi->uManualJHomePosSpinBox, pConfig.homingOptions.MANUAL_J_HOME_POS);
+    success &= LoadConfig(mUi->uManualKHomePosSpinBox, pConfig.homingOptions.MANUAL_K_HOME_POS);
+    success &= LoadConfig(mUi->uManualUHomePosSpinBox, pConfig.homingOptions.MANUAL_U_HOME_POS);
+    success &= LoadConfig(mUi->uManualVHomePosSpinBox, pConfig.homingOptions.MANUAL_V_HOME_POS);
+    success &= LoadConfig(mUi->uManualWHomePosSpinBox, pConfig.homingOptions.MANUAL_W_HOME_POS);
+    success &= LoadConfig(mUi->uManualXHomePosBox, pConfig.homingOptions.ENABLE_MANUAL_X_HOME_POS);
+    success &= LoadConfig(mUi->uManualYHomePosBox, pConfig.homingOptions.ENABLE_MANUAL_Y_HOME_POS);
+    success &= LoadConfig(mUi->uManualZHomePosBox, pConfig.homingOptions.ENABLE_MANUAL_Z_HOME_POS);
+    success &= LoadConfig(mUi->uManualIHomePosBox, pConfig.homingOptions.ENABLE_MANUAL_I_HOME_POS);
+    success &= LoadConfig(mUi->uManualJHomePosBox, pConfig.homingOptions.ENABLE_MANUAL_J_HOME_POS);
+    success &= LoadConfig(mUi->uManualKHomePosBox, pConfig.homingOptions.ENABLE_MANUAL_K_HOME_POS);
+    success &= LoadConfig(mUi->uManualUHomePosBox, pConfig.homingOptions.ENABLE_MANUAL_U_HOME_POS);
+    success &= LoadConfig(mUi->uManualVHomePosBox, pConfig.homingOptions.ENABLE_MANUAL_V_HOME_POS);
+    success &= LoadConfig(mUi->uManualWHomePosBox, pConfig.homingOptions.ENABLE_MANUAL_W_HOME_POS);
+    success &= LoadConfig(mUi->uZSafeHomingBox, pConfig.homingOptions.Z_SAFE_HOMING);
+    success &= LoadConfig(mUi->uZSafeHomingXPointSpinBox, pConfig.homingOptions.Z_SAFE_HOMING_X_POINT);
+    success &= LoadConfig(mUi->uZSafeHomingYPointSpinBox, pConfig.homingOptions.Z_SAFE_HOMING_Y_POINT);
+    success &= LoadConfig(mUi->uZSafeHomingXPointBox, pConfig.homingOptions.ENABLE_Z_SAFE_HOMING_X_POINT);
+    success &= LoadConfig(mUi->uZSafeHomingYPointBox, pConfig.homingOptions.ENABLE_Z_SAFE_HOMING_Y_POINT);
+    success &= LoadConfig(mUi->uHomingFeedrateMmMEdit, pConfig.homingOptions.HOMING_FEEDRATE_MM_M);
+    success &= LoadConfig(mUi->uValidateHomingEndstopsBox, pConfig.homingOptions.VALIDATE_HOMING_ENDSTOPS);
+    success &= LoadConfig(mUi->uSkewCorrectionBox, pConfig.homingOptions.SKEW_CORRECTION);
+    success &= LoadConfig(mUi->uXyDiagAcSpinBox, pConfig.homingOptions.XY_DIAG_AC);
+    success &= LoadConfig(mUi->uXyDiagBdSpinBox, pConfig.homingOptions.XY_DIAG_BD);
+    success &= LoadConfig(mUi->uXySideAdSpinBox, pConfig.homingOptions.XY_SIDE_AD);
+    success &= LoadConfig(mUi->uXySkewFactorSpinBox, pConfig.homingOptions.XY_SKEW_FACTOR);
+    success &= LoadConfig(mUi->uXySkewFactorBox, pConfig.homingOptions.ENABLE_XY_SKEW_FACTOR);
+    success &= LoadConfig(mUi->uSkewCorrectionForZBox, pConfig.homingOptions.SKEW_CORRECTION_FOR_Z);
+    success &= LoadConfig(mUi->uXzDiagAcSpinBox, pConfig.homingOptions.XZ_DIAG_AC);
+    success &= LoadConfig(mUi->uXzDiagBdSpinBox, pConfig.homingOptions.XZ_DIAG_BD);
+    success &= LoadConfig(mUi->uYzDiagAcSpinBox, pConfig.homingOptions.YZ_DIAG_AC);
+    success &= LoadConfig(mUi->uYzDiagBdSpinBox, pConfig.homingOptions.YZ_DIAG_BD);
+    success &= LoadConfig(mUi->uYzSideAdSpinBox, pConfig.homingOptions.YZ_SIDE_AD);
+    success &= LoadConfig(mUi->uXzSkewFactorSpinBox, pConfig.homingOptions.XZ_SKEW_FACTOR);
+    success &= LoadConfig(mUi->uYzSkewFactorSpinBox, pConfig.homingOptions.YZ_SKEW_FACTOR);
+    success &= LoadConfig(mUi->uXzSkewFactorBox, pConfig.homingOptions.ENABLE_XZ_SKEW_FACTOR);
+    success &= LoadConfig(mUi->uYzSkewFactorBox, pConfig.homingOptions.ENABLE_YZ_SKEW_FACTOR);
+    success &= LoadConfig(mUi->uSkewCorrectionGcodeBox, pConfig.homingOptions.SKEW_CORRECTION_GCODE);
 
     mIsLoading = false;
     return success;
@@ -26,11 +26,13 @@
 #include "KinematicsPage.h"
 #include "./ui_KinematicsPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 KinematicsPage::KinematicsPage(QWidget *pParent) :
-    AbstractPage(KINEMATICS_TEMPLATE_PATH, pParent),
+    AbstractPage(KINEMATICS_TEMPLATE_PATH, "kinematics", pParent),
     mUi(new Ui::KinematicsPage)
 {
+    const TraceSpan span("KinematicsPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -154,62 +156,62 @@ void KinematicsPage::ResetValues()
     mIsLoading = false;
 }
 
-bool KinematicsPage::LoadFromJson(const QJsonObject &pJson)
+bool KinematicsPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uCorexyBox, pJson, "COREXY");
-    success &= LoadConfig(mUi->uCorexzBox, pJson, "COREXZ");
-    success &= LoadConfig(mUi->uCoreyzBox, pJson, "COREYZ");
-    success &= LoadConfig(mUi->uCoreyxBox, pJson, "COREYX");
-    success &= LoadConfig(mUi->uCorezxBox, pJson, "COREZX");
-    success &= LoadConfig(mUi->uCorezyBox, pJson, "COREZY");
-    success &= LoadConfig(mUi->uMarkforgedXyBox, pJson, "MARKFORGED_XY");
-    success &= LoadConfig(mUi->uMarkforgedYxBox, pJson, "MARKFORGED_YX");
-    success &= LoadConfig(mUi->uBeltprinterBox, pJson, "BELTPRINTER");
-    success &= LoadConfig(mUi->uPolargraphBox, pJson, "POLARGRAPH");
-    success &= LoadConfig(mUi->uPolargraphMaxBeltLenSpinBox, pJson, "POLARGRAPH_MAX_BELT_LEN");
-    success &= LoadConfig(mUi->uDefaultSegmentsPerSecondSpinBox, pJson, "DEFAULT_SEGMENTS_PER_SECOND");
-    success &= LoadConfig(mUi->uDeltaBox, pJson, "DELTA");
-    success &= LoadConfig(mUi->uDeltaHomeToSafeZoneBox, pJson, "DELTA_HOME_TO_SAFE_ZONE");
-    success &= LoadConfig(mUi->uDeltaCalibrationMenuBox, pJson, "DELTA_CALIBRATION_MENU");
-    success &= LoadConfig(mUi->uDeltaAutoCalibrationBox, pJson, "DELTA_AUTO_CALIBRATION");
-    success &= LoadConfig(mUi->uDeltaCalibrationDefaultPointsSpinBox, pJson, "DELTA_CALIBRATION_DEFAULT_POINTS");
-    success &= LoadConfig(mUi->uProbeManuallyStepSpinBox, pJson, "PROBE_MANUALLY_STEP");
-    success &= LoadConfig(mUi->uDeltaPrintableRadiusSpinBox, pJson, "DELTA_PRINTABLE_RADIUS");
-    success &= LoadConfig(mUi->uDeltaMaxRadiusSpinBox, pJson, "DELTA_MAX_RADIUS");
-    success &= LoadConfig(mUi->uDeltaDiagonalRodSpinBox, pJson, "DELTA_DIAGONAL_ROD");
-    success &= LoadConfig(mUi->uDeltaHeightSpinBox, pJson, "DELTA_HEIGHT");
-    success &= LoadConfig(mUi->uDeltaEndstopAdjEdit, pJson, "DELTA_ENDSTOP_ADJ");
-    success &= LoadConfig(mUi->uDeltaRadiusSpinBox, pJson, "DELTA_RADIUS");
-    success &= LoadConfig(mUi->uDeltaTowerAngleTrimEdit, pJson, "DELTA_TOWER_ANGLE_TRIM");
-    success &= LoadConfig(mUi->uDeltaRadiusTrimTowerEdit, pJson, "DELTA_RADIUS_TRIM_TOWER");
-    success &= LoadConfig(mUi->uDeltaDiagonalRodTrimTowerEdit, pJson, "DELTA_DIAGONAL_ROD_TRIM_TOWER");
-    success &= LoadConfig(mUi->uDeltaRadiusTrimTowerBox, pJson, "ENABLE_DELTA_RADIUS_TRIM_TOWER");
-    success &= LoadConfig(mUi->uDeltaDiagonalRodTrimTowerBox, pJson, "ENABLE_DELTA_DIAGONAL_ROD_TRIM_TOWER");
-    success &= LoadConfig(mUi->uMorganScaraBox, pJson, "MORGAN_SCARA");
-    success &= LoadConfig(mUi->uMpScaraBox, pJson, "MP_SCARA");
-    success &= LoadConfig(mUi->uScaraLinkage1SpinBox, pJson, "SCARA_LINKAGE_1");
-    success &= LoadConfig(mUi->uScaraLinkage2SpinBox, pJson, "SCARA_LINKAGE_2");
-    success &= LoadConfig(mUi->uScaraOffsetXSpinBox, pJson, "SCARA_OFFSET_X");
-    success &= LoadConfig(mUi->uScaraOffsetYSpinBox, pJson, "SCARA_OFFSET_Y");
-    success &= LoadConfig(mUi->uDebugScaraKinematicsBox, pJson, "DEBUG_SCARA_KINEMATICS");
-    success &= LoadConfig(mUi->uScaraFeedrateScalingBox, pJson, "SCARA_FEEDRATE_SCALING");
-    success &= LoadConfig(mUi->uMiddleDeadZoneRSpinBox, pJson, "MIDDLE_DEAD_ZONE_R");
-    success &= LoadConfig(mUi->uThetaHomingOffsetSpinBox, pJson, "THETA_HOMING_OFFSET");
-    success &= LoadConfig(mUi->uPsiHomingOffsetSpinBox, pJson, "PSI_HOMING_OFFSET");
-    success &= LoadConfig(mUi->uScaraOffsetTheta1SpinBox, pJson, "SCARA_OFFSET_THETA1");
-    success &= LoadConfig(mUi->uScaraOffsetTheta2SpinBox, pJson, "SCARA_OFFSET_THETA2");
-    success &= LoadConfig(mUi->uAxelTparaBox, pJson, "AXEL_TPARA");
-    success &= LoadConfig(mUi->uDebugTparaKinematicsBox, pJson, "DEBUG_TPARA_KINEMATICS");
-    success &= LoadConfig(mUi->uTparaLinkage1SpinBox, pJson, "TPARA_LINKAGE_1");
-    success &= LoadConfig(mUi->uTparaLinkage2SpinBox, pJson, "TPARA_LINKAGE_2");
-    success &= LoadConfig(mUi->uTparaOffsetXSpinBox, pJson, "TPARA_OFFSET_X");
-    success &= LoadConfig(mUi->uTparaOffsetYSpinBox, pJson, "TPARA_OFFSET_Y");
-    success &= LoadConfig(mUi->uTparaOffsetZSpinBox, pJson, "TPARA_OFFSET_Z");
-    success &= LoadConfig(mUi->uArticulatedRobotArmBox, pJson, "ARTICULATED_ROBOT_ARM");
-    success &= LoadConfig(mUi->uFoamcutterXyuvBox, pJson, "FOAMCUTTER_XYUV");
+    success &= LoadConfig(mUi->uCorexyBox, pConfig.kinematics.COREXY);
+    success &= LoadConfig(mUi->uCorexzBox, pConfig.kinematics.COREXZ);
+    success &= LoadConfig(mUi->uCoreyzBox, pConfig.kinematics.COREYZ);
+    success &= LoadConfig(mUi->uCoreyxBox, pConfig.kinematics.COREYX);
+    success &= LoadConfig(mUi->uCorezxBox, pConfig.kinematics.COREZX);
+    success &= LoadConfig(mUi->uCorezyBox, pConfig.kinematics.COREZY);
+    success &= LoadConfig(mUi->uMarkforgedXyBox, pConfig.kinematics.MARKFORGED_XY);
+    success &= LoadConfig(mUi->uMarkforgedYxBox, pConfig.kinematics.MARKFORGED_YX);
+    success &= LoadConfig(mUi->uBeltprinterBox, pConfig.kinematics.BELTPRINTER);
+    success &= LoadConfig(mUi->uPolargraphBox, pConfig.kinematics.POLARGRAPH);
+    success &= LoadConfig(mUi->uPolargraphMaxBeltLenSpinBox, pConfig.kinematics.POLARGRAPH_MAX_BELT_LEN);
+    success &= LoadConfig(mUi->uDefaultSegmentsPerSecondSpinBox, pConfig.kinematics.DEFAULT_SEGMENTS_PER_SECOND);
+    success &= LoadConfig(mUi->uDeltaBox, pConfig.kinematics.DELTA);
+    success &= LoadConfig(mUi->uDeltaHomeToSafeZoneBox, pConfig.kinematics.DELTA_HOME_TO_SAFE_ZONE);
+    success &= LoadConfig(mUi->uDeltaCalibrationMenuBox, pConfig.kinematics.DELTA_CALIBRATION_MENU);
+    success &= LoadConfig(mUi->uDeltaAutoCalibrationBox, pConfig.kinematics.DELTA_AUTO_CALIBRATION);
+    success &= LoadConfig(mUi->uDeltaCalibrationDefaultPointsSpinBox, pConfig.kinematics.DELTA_CALIBRATION_DEFAULT_POINTS);
+    success &= LoadConfig(mUi->uProbeManuallyStepSpinBox, pConfig.kinematics.PROBE_MANUALLY_STEP);
+    success &= LoadConfig(mUi->uDeltaPrintableRadiusSpinBox, pConfig.kinematics.DELTA_PRINTABLE_RADIUS);
+    success &= LoadConfig(mUi->uDeltaMaxRadiusSpinBox, pConfig.kinematics.DELTA_MAX_RADIUS);
+    success &= LoadConfig(mUi->uDeltaDiagonalRodSpinBox, pConfig.kinematics.DELTA_DIAGONAL_ROD);
+    success &= LoadConfig(mUi->uDeltaHeightSpinBox, pConfig.kinematics.DELTA_HEIGHT);
+    success &= LoadConfig(mUi->uDeltaEndstopAdjEdit, pConfig.kinematics.DELTA_ENDSTOP_ADJ);
+    success &= LoadConfig(mUi->uDeltaRadiusSpinBox, pConfig.kinematics.DELTA_RADIUS);
+    success &= LoadConfig(mUi->uDeltaTowerAngleTrimEdit, pConfig.kinematics.DELTA_TOWER_ANGLE_TRIM);
+    success &= LoadConfig(mUi->uDeltaRadiusTrimTowerEdit, pConfig.kinematics.DELTA_RADIUS_TRIM_TOWER);
+    success &= LoadConfig(mUi->uDeltaDiagonalRodTrimTowerEdit, pConfig.kinematics.DELTA_DIAGONAL_ROD_TRIM_TOWER);
+    success &= LoadConfig(mUi->uDeltaRadiusTrimTowerBox, pConfig.kinematics.ENABLE_DELTA_RADIUS_TRIM_TOWER);
+    success &= LoadConfig(mUi->uDeltaDiagonalRodTrimTowerBox, pConfig.kinematics.ENABLE_DELTA_DIAGONAL_ROD_TRIM_TOWER);
+    success &= LoadConfig(mUi->uMorganScaraBox, pConfig.kinematics.MORGAN_SCARA);
+    success &= LoadConfig(mUi->uMpScaraBox, pConfig.kinematics.MP_SCARA);
+    success &= LoadConfig(mUi->uScaraLinkage1SpinBox, pConfig.kinematics.SCARA_LINKAGE_1);
+    success &= LoadConfig(mUi->uScaraLinkage2SpinBox, pConfig.kinematics.SCARA_LINKAGE_2);
+    success &= LoadConfig(mUi->uScaraOffsetXSpinBox, pConfig.kinematics.SCARA_OFFSET_X);
+    success &= LoadConfig(mUi->uScaraOffsetYSpinBox, pConfig.kinematics.SCARA_OFFSET_Y);
+    success &= LoadConfig(mUi->uDebugScaraKinematicsBox, pConfig.kinematics.DEBUG_SCARA_KINEMATICS);
+    success &= LoadConfig(mUi->uScaraFeedrateScalingBox, pConfig.kinematics.SCARA_FEEDRATE_SCALING);
+    success &= LoadConfig(mUi->uMiddleDeadZoneRSpinBox, pConfig.kinematics.MIDDLE_DEAD_ZONE_R);
+    success &= LoadConfig(mUi->uThetaHomingOffsetSpinBox, pConfig.kinematics.THETA_HOMING_OFFSET);
+    success &= LoadConfig(mUi->uPsiHomingOffsetSpinBox, pConfig.kinematics.PSI_HOMING_OFFSET);
+    success &= LoadConfig(mUi->uScaraOffsetTheta1SpinBox, pConfig.kinematics.SCARA_OFFSET_THETA1);
+    success &= LoadConfig(mUi->uScaraOffsetTheta2SpinBox, pConfig.kinematics.SCARA_OFFSET_THETA2);
+    success &= LoadConfig(mUi->uAxelTparaBox, pConfig.kinematics.AXEL_TPARA);
+    success &= LoadConfig(mUi->uDebugTparaKinematicsBox, pConfig.kinematics.DEBUG_TPARA_KINEMATICS);
+    success &= LoadConfig(mUi->uTparaLinkage1SpinBox, pConfig.kinematics.TPARA_LINKAGE_1);
+    success &= LoadConfig(mUi->uTparaLinkage2SpinBox, pConfig.kinematics.TPARA_LINKAGE_2);
+    success &= LoadConfig(mUi->uTparaOffsetXSpinBox, pConfig.kinematics.TPARA_OFFSET_X);
+    success &= LoadConfig(mUi->uTparaOffsetYSpinBox, pConfig.kinematics.TPARA_OFFSET_Y);
+    success &= LoadConfig(mUi->uTparaOffsetZSpinBox, pConfig.kinematics.TPARA_OFFSET_Z);
+    success &= LoadConfig(mUi->uArticulatedRobotArmBox, pConfig.kinematics.ARTICULATED_ROBOT_ARM);
+    success &= LoadConfig(mUi->uFoamcutterXyuvBox, pConfig.kinematics.FOAMCUTTER_XYUV);
 
     mIsLoading = false;
     return success;
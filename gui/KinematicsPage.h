@@ -52,11 +52,11 @@ public:
     /// \brief Resets all parameters on the page to their defaults
     void ResetValues(void) override;
 
-    /// \brief Loads the page parameters from the given JSON object
+    /// \brief Loads the page parameters from the given configuration
     ///
-    /// \param pJson: Reference to the JSON object
-    /// \return \b true, if all expected parameters where found in the JSON
-    bool LoadFromJson(const QJsonObject &pJson) override;
+    /// \param pConfig: Reference to the configuration
+    /// \return \b true, if all parameters could be set, e.g. every dropdown item exists
+    bool LoadFromConfiguration(const Configuration& pConfig) override;
 
     /// \brief Writes the page parameters into the given Configuration object
     ///
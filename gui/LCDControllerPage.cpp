@@ -26,11 +26,13 @@
 #include "LCDControllerPage.h"
 #include "./ui_LCDControllerPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 LCDControllerPage::LCDControllerPage(QWidget *pParent) :
-    AbstractPage(LCD_CONTROLLER_TEMPLATE_PATH, pParent),
+    AbstractPage(LCD_CONTROLLER_TEMPLATE_PATH, QString(), pParent),
     mUi(new Ui::LCDControllerPage)
 {
+    const TraceSpan span("LCDControllerPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -56,7 +58,7 @@ void LCDControllerPage::ResetValues()
     mIsLoading = false;
 }
 
-bool LCDControllerPage::LoadFromJson(const QJsonObject &pJson)
+bool LCDControllerPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
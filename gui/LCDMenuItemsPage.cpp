@@ -26,11 +26,13 @@
 #include "LCDMenuItemsPage.h"
 #include "./ui_LCDMenuItemsPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 LCDMenuItemsPage::LCDMenuItemsPage(QWidget *pParent) :
-    AbstractPage(LCD_MENU_ITEMS_TEMPLATE_PATH, pParent),
+    AbstractPage(LCD_MENU_ITEMS_TEMPLATE_PATH, "lcdMenuItems", pParent),
     mUi(new Ui::LCDMenuItemsPage)
 {
+    const TraceSpan span("LCDMenuItemsPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -59,13 +61,13 @@ void LCDMenuItemsPage::ResetValues()
     mIsLoading = false;
 }
 
-bool LCDMenuItemsPage::LoadFromJson(const QJsonObject &pJson)
+bool LCDMenuItemsPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uNoLcdMenusBox, pJson, "NO_LCD_MENUS");
-    success &= LoadConfig(mUi->uSlimLcdMenusBox, pJson, "SLIM_LCD_MENUS");
+    success &= LoadConfig(mUi->uNoLcdMenusBox, pConfig.lcdMenuItems.NO_LCD_MENUS);
+    success &= LoadConfig(mUi->uSlimLcdMenusBox, pConfig.lcdMenuItems.SLIM_LCD_MENUS);
 
     mIsLoading = false;
     return success;
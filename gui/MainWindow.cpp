@@ -25,6 +25,8 @@
 
 #include "MainWindow.h"
 #include "./ui_MainWindow.h"
+#include "Trace.h"
+#include "PerformanceWidget.h"
 
 #include <QFileDialog>
 #include <QDateTime>
@@ -35,15 +37,24 @@
 #include <QMessageBox>
 #include <QClipboard>
 #include <QTextDocumentFragment>
+#include <QTextDocument>
+#include <QSettings>
+#include <QSignalBlocker>
 
 MainWindow::MainWindow(QWidget *pParent)
     : QMainWindow(pParent)
     , mUi(new Ui::MainWindow)
     , mAboutDialog(this)
+    , mComparisonDialog(this)
     , mStatusLabel("Workspace: none")
     , mMarlinVersionLabel(QString("Marlin Version: v%0").arg(MARLIN_VERSION))
 {
-    mUi->setupUi(this);
+    const TraceSpan span("MainWindow::MainWindow");
+
+    {
+        const TraceSpan setupSpan("MainWindow::setupUi");
+        mUi->setupUi(this);
+    }
 
     setWindowTitle(QString("iMC - iLOOP Marlin Configurator v%0").arg(SW_VERSION));
 
@@ -52,21 +63,29 @@ MainWindow::MainWindow(QWidget *pParent)
 
     tabifyDockWidget(mUi->uConsoleDock, mUi->uCompilerOutputsDock);
     tabifyDockWidget(mUi->uCompilerOutputsDock, mUi->uCodePreviewDock);
+    tabifyDockWidget(mUi->uCodePreviewDock, mUi->uEffectiveDefinesDock);
+    tabifyDockWidget(mUi->uEffectiveDefinesDock, mUi->uPerformanceDock);
     resizeDocks(QList{static_cast<QDockWidget*>(mUi->uConsoleDock),
                       static_cast<QDockWidget*>(mUi->uCompilerOutputsDock),
-                      static_cast<QDockWidget*>(mUi->uCodePreviewDock)},
-                QList{dockHeight, dockHeight, dockHeight}, Qt::Vertical);
+                      static_cast<QDockWidget*>(mUi->uCodePreviewDock),
+                      static_cast<QDockWidget*>(mUi->uEffectiveDefinesDock),
+                      static_cast<QDockWidget*>(mUi->uPerformanceDock)},
+                QList{dockHeight, dockHeight, dockHeight, dockHeight, dockHeight}, Qt::Vertical);
 
     // Add dock widget view actions to menu
     mUi->menuView->addAction(mUi->uNavigationDock->toggleViewAction());
     mUi->menuView->addAction(mUi->uConsoleDock->toggleViewAction());
     mUi->menuView->addAction(mUi->uCompilerOutputsDock->toggleViewAction());
     mUi->menuView->addAction(mUi->uCodePreviewDock->toggleViewAction());
+    mUi->menuView->addAction(mUi->uEffectiveDefinesDock->toggleViewAction());
+    mUi->menuView->addAction(mUi->uPerformanceDock->toggleViewAction());
 
     mUi->menuView->actions().at(2)->setShortcut(QKeySequence("Alt+N"));
     mUi->menuView->actions().at(3)->setShortcut(QKeySequence("Alt+O"));
     mUi->menuView->actions().at(4)->setShortcut(QKeySequence("Alt+P"));
     mUi->menuView->actions().at(5)->setShortcut(QKeySequence("Alt+C"));
+    mUi->menuView->actions().at(6)->setShortcut(QKeySequence("Alt+D"));
+    mUi->menuView->actions().at(7)->setShortcut(QKeySequence("Alt+M"));
 
     for (auto&& page : findChildren<AbstractPage*>())
     {
@@ -74,6 +93,24 @@ MainWindow::MainWindow(QWidget *pParent)
         page->Init();
     }
 
+    mSnapshotPages = {
+        mUi->uFirmwarePage, mUi->uHardwarePage, mUi->uExtruderPage, mUi->uPowerSupplyPage,
+        mUi->uThermalSettingsPage, mUi->uKinematicsPage, mUi->uEndstopsPage, mUi->uMovementPage,
+        mUi->uStepperDriversPage, mUi->uHomingAndBoundsPage, mUi->uFilamentRunoutSensorPage, mUi->uBedLevelingPage,
+        mUi->uHomingOptionsPage, mUi->uUserInterfaceLanguagePage, mUi->uSDCardPage, mUi->uLCDMenuItemsPage,
+        mUi->uEncoderPage, mUi->uSpeakerPage
+    };
+    mStalePages.set();
+
+    // Connected before ConfigurationChangedSignal is forwarded, so that receivers get the changed page
+    for (size_t i = 0; i < mSnapshotPages.size(); ++i)
+    {
+        QObject::connect(mSnapshotPages.at(i), &AbstractPage::ConfigurationChangedSignal, this, [this, i]()
+        {
+            mStalePages.set(i);
+        });
+    }
+
     // Set console tab as current
     auto&& tabBar = this->findChild<QTabBar*>();
     if (nullptr != tabBar)
@@ -84,8 +121,14 @@ MainWindow::MainWindow(QWidget *pParent)
     // Initialize status bar
     mUi->statusBar->setSizeGripEnabled(false);
     mUi->statusBar->addWidget(&mStatusLabel);
+    mUi->statusBar->addPermanentWidget(&mDirtyFieldsLabel);
+    mUi->statusBar->addPermanentWidget(&mPinConflictLabel);
+    mUi->statusBar->addPermanentWidget(&mRebuildScopeLabel);
     mUi->statusBar->addPermanentWidget(&mMarlinVersionLabel);
 
+    constexpr auto performanceInterval = 1000;
+    mPerformanceTimer.setInterval(performanceInterval);
+
     uint8_t nextId = 0;
     for (auto& button : mUi->buttonGroup->buttons())
     {
@@ -105,6 +148,14 @@ MainWindow::MainWindow(QWidget *pParent)
     OnUpdatePreview(QStringList()); // Set to placeholder text
 
     mUi->uCancelButton->setVisible(false);
+
+    mUi->uActionUseCompilerCache->setChecked(QSettings().value("build/useCompilerCache", false).toBool());
+    mUi->uActionAutomationServer->setChecked(QSettings().value("automation/enabled", false).toBool());
+    mUi->uSaveSparseConfigurationAction->setChecked(QSettings().value("workspace/saveSparseConfiguration", false).toBool());
+
+    // Tracing may also be enabled by IMC_TRACE, which is not stored
+    const QSignalBlocker traceBlocker(mUi->uActionRecordTrace);
+    mUi->uActionRecordTrace->setChecked(Trace::IsEnabled());
 }
 
 MainWindow::~MainWindow()
@@ -144,6 +195,7 @@ void MainWindow::ConnectGuiSignalsAndSlots()
     for (auto&& page : findChildren<AbstractPage*>())
     {
         QObject::connect(page, &AbstractPage::UpdatePreviewSignal, this, &MainWindow::OnUpdatePreview);
+        QObject::connect(page, &AbstractPage::ConfigurationChangedSignal, this, &MainWindow::ConfigurationChangedSignal);
     }
 
     QObject::connect(mUi->uSaveWorkspaceAction, &QAction::triggered, this, &MainWindow::SaveProjectSignal);
@@ -153,6 +205,8 @@ void MainWindow::ConnectGuiSignalsAndSlots()
     QObject::connect(mUi->uResetConfigurationAction, &QAction::triggered, this, &MainWindow::OnResetConfiguration);
     QObject::connect(mUi->uResetConfigurationButton, &QPushButton::pressed, this, &MainWindow::OnResetConfiguration);
     QObject::connect(mUi->uResetCurrentPageAction, &QAction::triggered, this, &MainWindow::OnResetCurrentPage);
+    QObject::connect(mUi->uUndoAction, &QAction::triggered, this, &MainWindow::UndoSignal);
+    QObject::connect(mUi->uRedoAction, &QAction::triggered, this, &MainWindow::RedoSignal);
 
     QObject::connect(mUi->uDefaultViewportAction, &QAction::triggered, this, &MainWindow::OnSetDefaultViewport);
     QObject::connect(mUi->uExpandedViewportAction, &QAction::triggered, this, &MainWindow::OnSetExpandedViewport);
@@ -183,6 +237,53 @@ void MainWindow::ConnectGuiSignalsAndSlots()
         emit UploadSignal();
     });
 
+    QObject::connect(mUi->uEffectiveDefinesDock, &QDockWidget::visibilityChanged, this, [&](bool pVisible){
+        if (pVisible)
+        {
+            emit EffectiveDefinesRequestedSignal();
+        }
+    });
+
+    // The counters are only polled while somebody looks at them
+    QObject::connect(&mPerformanceTimer, &QTimer::timeout, this, &MainWindow::OnUpdatePerformance);
+    QObject::connect(mUi->uPerformanceDock, &QDockWidget::visibilityChanged, this, [&](bool pVisible){
+        if (pVisible)
+        {
+            OnUpdatePerformance();
+            mPerformanceTimer.start();
+        }
+        else
+        {
+            mPerformanceTimer.stop();
+        }
+    });
+
+    QObject::connect(mUi->uActionClearFirmwareCache, &QAction::triggered, this, &MainWindow::ClearFirmwareCacheSignal);
+    QObject::connect(mUi->uImportConfigurationsAction, &QAction::triggered, this, &MainWindow::ImportConfigurationsSignal);
+    QObject::connect(mUi->uQueryFleetAction, &QAction::triggered, this, &MainWindow::QueryFleetSignal);
+    QObject::connect(mUi->uAddFleetFolderAction, &QAction::triggered, this, &MainWindow::AddFleetFolderSignal);
+    QObject::connect(mUi->uCompareConfigurationsAction, &QAction::triggered, this, &MainWindow::CompareConfigurationsSignal);
+    QObject::connect(&mComparisonDialog, &ComparisonDialog::ExportSignal, this, &MainWindow::ExportComparisonSignal);
+
+    QObject::connect(mUi->uActionUseCompilerCache, &QAction::toggled, this, [&](bool pChecked){
+        QSettings().setValue("build/useCompilerCache", pChecked);
+    });
+
+    QObject::connect(mUi->uActionRecordTrace, &QAction::toggled, this, [&](bool pChecked){
+        QSettings().setValue("trace/enabled", pChecked);
+        Trace::SetEnabled(pChecked);
+    });
+    QObject::connect(mUi->uActionExportTrace, &QAction::triggered, this, &MainWindow::ExportTraceSignal);
+
+    QObject::connect(mUi->uActionAutomationServer, &QAction::toggled, this, [&](bool pChecked){
+        QSettings().setValue("automation/enabled", pChecked);
+        emit AutomationServerToggledSignal(pChecked);
+    });
+
+    QObject::connect(mUi->uSaveSparseConfigurationAction, &QAction::toggled, this, [&](bool pChecked){
+        QSettings().setValue("workspace/saveSparseConfiguration", pChecked);
+    });
+
     QObject::connect(mUi->uGenerateButton, &QPushButton::pressed, this, [&](){
         mUi->uConsoleDock->raise();
 
@@ -385,6 +486,11 @@ QString MainWindow::GetEnvironment() const
     return mUi->uHardwarePage->GetEnvironment();
 }
 
+QString MainWindow::GetMotherboard() const
+{
+    return mUi->uHardwarePage->GetMotherboard();
+}
+
 void MainWindow::ActivateCancelButton()
 {
     mUi->uGenerateButton->setEnabled(false);
@@ -447,12 +553,128 @@ bool MainWindow::IsBuildCanceled() const
     return mBuildCanceled;
 }
 
+bool MainWindow::IsCompilerCacheEnabled() const
+{
+    return mUi->uActionUseCompilerCache->isChecked();
+}
+
+bool MainWindow::IsAutomationServerEnabled() const
+{
+    return mUi->uActionAutomationServer->isChecked();
+}
+
+bool MainWindow::IsSparseConfigurationEnabled() const
+{
+    return mUi->uSaveSparseConfigurationAction->isChecked();
+}
+
+bool MainWindow::IsEffectiveDefinesVisible() const
+{
+    return mUi->uEffectiveDefinesDock->isVisible();
+}
+
+void MainWindow::ShowEffectiveDefines(const QHash<QString, QString>& pDefines, const QSet<QString>& pChanged)
+{
+    mUi->uEffectiveDefinesWidget->SetDefines(pDefines, pChanged);
+}
+
+void MainWindow::ShowComparison(const QStringList& pLabels, const QList<QStringList>& pRows, const QString& pSummary)
+{
+    mComparisonDialog.SetComparison(pLabels, pRows, pSummary);
+    mComparisonDialog.show();
+    mComparisonDialog.raise();
+}
+
+void MainWindow::SetEffectiveDefinesStatus(const QString& pText)
+{
+    mUi->uEffectiveDefinesWidget->SetStatus(pText);
+}
+
+void MainWindow::SetTemplateSize(qint64 pBytes)
+{
+    mMainTemplateBytes = pBytes;
+}
+
+void MainWindow::SetBuildJobState(const QString& pState)
+{
+    mUi->uPerformanceWidget->SetBuildJob(pState);
+}
+
+void MainWindow::OnUpdatePerformance()
+{
+    QList<PerformanceWidget::PageRow> rows;
+    rows.reserve(static_cast<int32_t>(mConfigPages.size()));
+
+    auto templateBytes = mMainTemplateBytes;
+
+    for (const auto* page : mConfigPages)
+    {
+        const auto statistics = page->GetStatistics();
+        templateBytes += statistics.templateBytes;
+        rows.append({page->objectName(), statistics});
+    }
+
+    // QTextDocument stores UTF-16, so each character takes two bytes
+    const auto documentBytes = [](const QTextDocument* pDocument)
+    {
+        return static_cast<qint64>(pDocument->characterCount()) * static_cast<qint64>(sizeof(QChar));
+    };
+
+    mUi->uPerformanceWidget->SetPageStatistics(rows);
+    mUi->uPerformanceWidget->SetMemory(templateBytes,
+                                       documentBytes(mUi->uPreviewEdit->document()),
+                                       documentBytes(mUi->uLogConsole->document()) + documentBytes(mUi->uCompilerConsole->document()));
+}
+
+void MainWindow::SetRebuildScope(const QString& pText, const QString& pToolTip)
+{
+    mRebuildScopeLabel.setText(pText);
+    mRebuildScopeLabel.setToolTip(pToolTip);
+}
+
+void MainWindow::SetPinConflicts(const QString& pText, const QString& pToolTip)
+{
+    mPinConflictLabel.setText(pText);
+    mPinConflictLabel.setToolTip(pToolTip);
+}
+
+void MainWindow::SetDirtyFields(const QString& pText, const QString& pToolTip)
+{
+    mDirtyFieldsLabel.setText(pText);
+    mDirtyFieldsLabel.setToolTip(pToolTip);
+}
+
+void MainWindow::SetTemplatePack(const QString& pDirectory, const QString& pMarlinVersion)
+{
+    for (auto&& page : mConfigPages)
+    {
+        page->SetTemplateDirectory(pDirectory);
+    }
+
+    mMarlinVersionLabel.setText(QString("Marlin Version: v%0").arg(pMarlinVersion));
+}
+
+int32_t MainWindow::SetHardwareCatalogs(const QStringList& pMotherboards, const QStringList& pThermistors, const QStringList& pDriverTypes)
+{
+    return mUi->uHardwarePage->AddMotherboards(pMotherboards)
+            + mUi->uThermalSettingsPage->AddThermistors(pThermistors)
+            + mUi->uStepperDriversPage->AddDriverTypes(pDriverTypes);
+}
+
+void MainWindow::SetBoardEnvironments(const QStringList& pEnvironments, const QHash<QString, QStringList>& pEnvironmentsByBoard)
+{
+    mUi->uHardwarePage->SetBoardEnvironments(pEnvironments, pEnvironmentsByBoard);
+}
+
 void MainWindow::ResetValues()
 {
     for (auto&& page : mConfigPages)
     {
         page->ResetValues();
     }
+    mStalePages.set();
+
+    emit ConfigurationChangedSignal();
 }
 
 void MainWindow::JumpToFirstConfigTab()
@@ -560,6 +782,8 @@ void MainWindow::OnResetCurrentPage()
         auto&& page = static_cast<AbstractPage*>(mUi->stackedWidget->currentWidget()->findChild<AbstractPage*>());
         page->ResetValues();
         page->OnUpdatePreview();
+        MarkStale(page);
+        emit ConfigurationChangedSignal();
         Log("Current page configuration resetted.", "rgb(249, 154, 0)");
     }
     else
@@ -573,21 +797,29 @@ void MainWindow::OnSetDefaultViewport()
     removeDockWidget(mUi->uConsoleDock);
     removeDockWidget(mUi->uCompilerOutputsDock);
     removeDockWidget(mUi->uCodePreviewDock);
+    removeDockWidget(mUi->uEffectiveDefinesDock);
+    removeDockWidget(mUi->uPerformanceDock);
     removeDockWidget(mUi->uNavigationDock);
 
     addDockWidget(Qt::BottomDockWidgetArea, mUi->uConsoleDock);
     addDockWidget(Qt::BottomDockWidgetArea, mUi->uCompilerOutputsDock);
     addDockWidget(Qt::BottomDockWidgetArea, mUi->uCodePreviewDock);
+    addDockWidget(Qt::BottomDockWidgetArea, mUi->uEffectiveDefinesDock);
+    addDockWidget(Qt::BottomDockWidgetArea, mUi->uPerformanceDock);
     addDockWidget(Qt::LeftDockWidgetArea, mUi->uNavigationDock);
 
     constexpr auto dockHeight = 200;
 
     tabifyDockWidget(mUi->uConsoleDock, mUi->uCompilerOutputsDock);
     tabifyDockWidget(mUi->uCompilerOutputsDock, mUi->uCodePreviewDock);
+    tabifyDockWidget(mUi->uCodePreviewDock, mUi->uEffectiveDefinesDock);
+    tabifyDockWidget(mUi->uEffectiveDefinesDock, mUi->uPerformanceDock);
     resizeDocks(QList{static_cast<QDockWidget*>(mUi->uConsoleDock),
                       static_cast<QDockWidget*>(mUi->uCompilerOutputsDock),
-                      static_cast<QDockWidget*>(mUi->uCodePreviewDock)},
-                QList{dockHeight, dockHeight, dockHeight}, Qt::Vertical);
+                      static_cast<QDockWidget*>(mUi->uCodePreviewDock),
+                      static_cast<QDockWidget*>(mUi->uEffectiveDefinesDock),
+                      static_cast<QDockWidget*>(mUi->uPerformanceDock)},
+                QList{dockHeight, dockHeight, dockHeight, dockHeight, dockHeight}, Qt::Vertical);
 
     mUi->uCodePreviewDock->setVisible(true);
     mUi->uCompilerOutputsDock->setVisible(true);
@@ -602,13 +834,20 @@ void MainWindow::OnSetExpandedViewport()
     removeDockWidget(mUi->uConsoleDock);
     removeDockWidget(mUi->uCompilerOutputsDock);
     removeDockWidget(mUi->uCodePreviewDock);
+    removeDockWidget(mUi->uEffectiveDefinesDock);
+    removeDockWidget(mUi->uPerformanceDock);
     removeDockWidget(mUi->uNavigationDock);
 
     addDockWidget(Qt::BottomDockWidgetArea, mUi->uConsoleDock);
     addDockWidget(Qt::BottomDockWidgetArea, mUi->uCompilerOutputsDock);
     addDockWidget(Qt::RightDockWidgetArea, mUi->uCodePreviewDock);
+    addDockWidget(Qt::RightDockWidgetArea, mUi->uEffectiveDefinesDock);
+    addDockWidget(Qt::RightDockWidgetArea, mUi->uPerformanceDock);
     addDockWidget(Qt::LeftDockWidgetArea, mUi->uNavigationDock);
 
+    tabifyDockWidget(mUi->uCodePreviewDock, mUi->uEffectiveDefinesDock);
+    tabifyDockWidget(mUi->uEffectiveDefinesDock, mUi->uPerformanceDock);
+
     constexpr auto dockHeight = 200;
 
     mUi->uCodePreviewDock->setVisible(true);
@@ -632,14 +871,35 @@ void MainWindow::OnSetExpandedViewport()
 
 Configuration MainWindow::FetchConfiguration()
 {
-    Configuration config;
+    return TakeSnapshot().ToConfiguration();
+}
 
-    for (auto&& page : mConfigPages)
+ConfigurationSnapshot MainWindow::TakeSnapshot()
+{
+    const TraceSpan span("MainWindow::TakeSnapshot");
+
+    for (size_t i = 0; i < mSnapshotPages.size(); ++i)
     {
-        page->FetchConfiguration(config);
+        if (mStalePages.test(i))
+        {
+            mSnapshotPages.at(i)->FetchConfiguration(mPageBuffer);
+            mSnapshot = mSnapshot.WithPage(i, mPageBuffer);
+        }
     }
+    mStalePages.reset();
 
-    return config;
+    return mSnapshot;
+}
+
+void MainWindow::MarkStale(const AbstractPage* pPage)
+{
+    for (size_t i = 0; i < mSnapshotPages.size(); ++i)
+    {
+        if (mSnapshotPages.at(i) == pPage)
+        {
+            mStalePages.set(i);
+        }
+    }
 }
 
 void MainWindow::ReplaceTags(QStringList& pOutput)
@@ -658,6 +918,14 @@ void MainWindow::SetWorkspace(const std::optional<QString>& pName)
 
 bool MainWindow::LoadConfigurationFromJson(const QJsonObject& pJson)
 {
+    const TraceSpan span("MainWindow::LoadConfigurationFromJson");
+
+    // Fields missing in sparse configurations are defaults, not incomplete data
+    if (Configuration::IsSparseJson(pJson))
+    {
+        return LoadConfigurationFromJson(Configuration::ExpandSparseJson(pJson));
+    }
+
     ResetValues();
 
     bool success = true;
@@ -826,9 +1094,134 @@ bool MainWindow::LoadConfigurationFromJson(const QJsonObject& pJson)
 
 #warning add remaining pages
 
+    mStalePages.set();
+    emit ConfigurationChangedSignal();
+
+    return success;
+}
+
+bool MainWindow::LoadConfiguration(const Configuration& pConfiguration)
+{
+    const TraceSpan span("MainWindow::LoadConfiguration");
+
+    // Every field is taken from the configuration, so the pages are not reset first
+    bool success = true;
+    for (auto&& page : mConfigPages)
+    {
+        success &= page->LoadFromConfiguration(pConfiguration);
+    }
+
+    mStalePages.set();
+    emit ConfigurationChangedSignal();
+
     return success;
 }
 
+bool MainWindow::ApplyConfigurationChanges(const QJsonObject& pChanges)
+{
+    const TraceSpan span("MainWindow::ApplyConfigurationChanges");
+
+    bool success = true;
+    for (size_t i = 0; i < mSnapshotPages.size(); ++i)
+    {
+        const auto changes = pChanges.value(ConfigurationSnapshot::PAGE_KEYS.at(i));
+        if (!changes.isObject())
+        {
+            continue;
+        }
+
+        // A page reset comes back as one batch, repainted once; fields missing in the JSON keep their values
+        auto&& page = mSnapshotPages.at(i);
+        page->setUpdatesEnabled(false);
+        page->LoadFromJson(changes.toObject());
+        page->setUpdatesEnabled(true);
+
+        mStalePages.set(i);
+
+        // The fields are partial, so instead of the result of LoadFromJson the values read back tell whether all were set
+        Configuration readBack;
+        page->FetchConfiguration(readBack);
+        const auto fields = readBack.ToJson().value(ConfigurationSnapshot::PAGE_KEYS.at(i)).toObject();
+        const auto changedFields = changes.toObject();
+        for (auto field = changedFields.constBegin(); field != changedFields.constEnd(); ++field)
+        {
+            success &= (fields.value(field.key()) == field.value());
+        }
+    }
+
+    if (nullptr != dynamic_cast<AbstractPage*>(mUi->stackedWidget->currentWidget()->findChild<AbstractPage*>()))
+    {
+        auto&& page = static_cast<AbstractPage*>(mUi->stackedWidget->currentWidget()->findChild<AbstractPage*>());
+        page->OnUpdatePreview();
+    }
+
+    emit ConfigurationChangedSignal();
+
+    return success;
+}
+
+void MainWindow::SetUndoAvailable(bool pCanUndo, bool pCanRedo)
+{
+    mUi->uUndoAction->setEnabled(pCanUndo);
+    mUi->uRedoAction->setEnabled(pCanRedo);
+}
+
+void MainWindow::SetImportAvailable(bool pAvailable)
+{
+    mUi->uImportConfigurationsAction->setEnabled(pAvailable);
+}
+
+void MainWindow::SetFleetQueryAvailable(bool pAvailable)
+{
+    mUi->uQueryFleetAction->setEnabled(pAvailable);
+    mUi->uAddFleetFolderAction->setEnabled(pAvailable);
+}
+
+void MainWindow::SetWorkspaceActionsAvailable(bool pAvailable)
+{
+    if (pAvailable)
+    {
+        for (auto&& action : std::as_const(mActionsDisabledForJob))
+        {
+            action->setEnabled(true);
+        }
+        for (auto&& widget : std::as_const(mWidgetsDisabledForJob))
+        {
+            widget->setEnabled(true);
+        }
+        mActionsDisabledForJob.clear();
+        mWidgetsDisabledForJob.clear();
+        return;
+    }
+
+    const std::array<QAction*, 12> actions{
+        mUi->uOpenWorkspaceAction, mUi->uSaveWorkspaceAction, mUi->uCloseWorkspaceAction, mUi->uResetConfigurationAction,
+        mUi->uActionGenerate, mUi->uActionBuild, mUi->uActionRebuild, mUi->uActionClean, mUi->uActionUpload,
+        mUi->uImportConfigurationsAction, mUi->uQueryFleetAction, mUi->uAddFleetFolderAction
+    };
+    for (auto&& action : actions)
+    {
+        if (action->isEnabled())
+        {
+            action->setEnabled(false);
+            mActionsDisabledForJob.append(action);
+        }
+    }
+
+    const std::array<QWidget*, 10> widgets{
+        mUi->uOpenWorkspaceButton, mUi->uSaveWorkspaceButton, mUi->uCloseWorkspaceButton, mUi->uResetConfigurationButton,
+        mUi->uGenerateButton, mUi->uBuildButton, mUi->uRebuildButton, mUi->uCleanButton, mUi->uUploadButton, mUi->uWelcomePage
+    };
+    for (auto&& widget : widgets)
+    {
+        if (widget->isEnabled())
+        {
+            widget->setEnabled(false);
+            mWidgetsDisabledForJob.append(widget);
+        }
+    }
+}
+
 void MainWindow::Log(const QString& pText, const QString& pColorString)
 {
     const auto timestamp = QDateTime::currentDateTime().toString(Qt::DateFormat::ISODate).replace('T', ' ');
@@ -27,12 +27,20 @@
 #define MAINWINDOW_H
 
 #include <QFileInfo>
+#include <QHash>
 #include <QMainWindow>
 #include <QLabel>
+#include <QSet>
+#include <QTimer>
+
+#include <array>
+#include <bitset>
 
 #include "AboutDialog.h"
+#include "ComparisonDialog.h"
 #include "AbstractPage.h"
 #include "Configuration.h"
+#include "ConfigurationSnapshot.h"
 
 // Forward declarations
 QT_BEGIN_NAMESPACE
@@ -70,6 +78,14 @@ public:
     /// \return The current configuration as a Configuration object
     Configuration FetchConfiguration(void);
 
+    /// \brief Takes an immutable snapshot of the current configuration
+    ///
+    /// Only pages changed since the last snapshot are read from their widgets, all other pages
+    /// are shared with the previous snapshot.
+    ///
+    /// \return The snapshot, safe to pass to other threads
+    ConfigurationSnapshot TakeSnapshot(void);
+
     /// \brief Setter for the project name on the GUI
     ///
     /// \param pName: The new project name to display or std::nullopt to display no name
@@ -77,16 +93,145 @@ public:
 
     bool LoadConfigurationFromJson(const QJsonObject& pJson);
 
+    /// \brief Loads all pages from a configuration
+    ///
+    /// \param pConfiguration: The configuration
+    /// \return \b true, if every page could take all of its parameters
+    bool LoadConfiguration(const Configuration& pConfiguration);
+
+    /// \brief Sets the given fields and keeps all others, e.g. to undo a change
+    ///
+    /// \param pChanges: The fields to set, grouped by page as in configuration.json
+    /// \return \b true, if the pages read back every field as given
+    bool ApplyConfigurationChanges(const QJsonObject& pChanges);
+
+    /// \brief Enables or disables the undo and redo actions
+    ///
+    /// \param pCanUndo: \b true, if a change can be undone
+    /// \param pCanRedo: \b true, if an undone change can be redone
+    void SetUndoAvailable(bool pCanUndo, bool pCanRedo);
+
+    /// \brief Enables or disables the import of configurations
+    ///
+    /// \param pAvailable: \b false, while an import is running
+    void SetImportAvailable(bool pAvailable);
+
+    /// \brief Enables or disables the fleet query
+    ///
+    /// \param pAvailable: \b false, while the fleet catalog is refreshed
+    void SetFleetQueryAvailable(bool pAvailable);
+
+    /// \brief Disables the actions that open, change or build the workspace while a background job runs
+    ///
+    /// Only the actions that were enabled are disabled and later enabled again, so the state set by
+    /// other jobs, e.g. a running build, is kept.
+    ///
+    /// \param pAvailable: \b false, while a background job is running
+    void SetWorkspaceActionsAvailable(bool pAvailable);
+
     void ReplaceTags(QStringList& pOutput);
 
     void JumpToFirstConfigTab(void);
 
     QString GetEnvironment(void) const;
 
+    /// \brief Returns the name of the selected motherboard
+    ///
+    /// \return The name, e.g. "BOARD_RAMPS_14_EFB"
+    QString GetMotherboard(void) const;
+
     void ActivateCancelButton(void);
     void DeactivateCancelButton(void);
     bool IsBuildCanceled(void) const;
 
+    /// \brief Returns whether builds should use the compiler cache
+    ///
+    /// \return \b true, if the compiler cache option is checked
+    bool IsCompilerCacheEnabled(void) const;
+
+    /// \brief Returns whether the automation server should run
+    ///
+    /// \return \b true, if the automation server option is checked
+    bool IsAutomationServerEnabled(void) const;
+
+    /// \brief Returns whether configuration.json files only store the settings that differ from the defaults
+    ///
+    /// \return \b true, if sparse configurations are saved
+    bool IsSparseConfigurationEnabled(void) const;
+
+    /// \brief Returns whether the effective defines are currently shown
+    ///
+    /// \return \b true, if the effective defines dock is visible and not hidden behind another tab
+    bool IsEffectiveDefinesVisible(void) const;
+
+    /// \brief Displays the result of an effective defines evaluation
+    ///
+    /// \param pDefines: Maps macro names to their definitions
+    /// \param pChanged: Names of the macros that changed with the evaluation
+    void ShowEffectiveDefines(const QHash<QString, QString>& pDefines, const QSet<QString>& pChanged);
+
+    /// \brief Shows configurations side by side
+    ///
+    /// \param pLabels: The names of the compared configurations
+    /// \param pRows: The differing fields as page, field and one value per configuration
+    /// \param pSummary: The text shown above the table
+    void ShowComparison(const QStringList& pLabels, const QList<QStringList>& pRows, const QString& pSummary);
+
+    /// \brief Sets the status text of the effective defines dock
+    ///
+    /// \param pText: The status text
+    void SetEffectiveDefinesStatus(const QString& pText);
+
+    /// \brief Sets the size of the main configuration template shown in the performance dock
+    ///
+    /// \param pBytes: The bytes held by the template lines
+    void SetTemplateSize(qint64 pBytes);
+
+    /// \brief Sets the build job state shown in the performance dock
+    ///
+    /// \param pState: The state, e.g. "Idle" or the running command
+    void SetBuildJobState(const QString& pState);
+
+    /// \brief Displays the estimated rebuild scope of the pending changes in the status bar
+    ///
+    /// \param pText: The text to display, empty to hide the estimate
+    /// \param pToolTip: Details about the changed defines and affected files
+    void SetRebuildScope(const QString& pText, const QString& pToolTip);
+
+    /// \brief Shows the pin conflicts of the current configuration in the status bar
+    ///
+    /// \param pText: The summary, cleared if empty
+    /// \param pToolTip: The conflicting pins and their users
+    void SetPinConflicts(const QString& pText, const QString& pToolTip);
+
+    /// \brief Shows the changes since the last generation and build in the status bar
+    ///
+    /// \param pText: The summary, cleared if empty
+    /// \param pToolTip: The changed fields
+    void SetDirtyFields(const QString& pText, const QString& pToolTip);
+
+    /// \brief Switches all pages to the given template pack
+    ///
+    /// \param pDirectory: Resource folder of the template pack
+    /// \param pMarlinVersion: The Marlin version of the pack, displayed in the status bar
+    void SetTemplatePack(const QString& pDirectory, const QString& pMarlinVersion);
+
+    /// \brief Replaces the hardware catalog items of the previous workspace with those of the opened workspace
+    ///
+    /// Items that are built in are not added again, empty lists restore the built-in items.
+    ///
+    /// \param pMotherboards: The motherboards in the format "Description [BOARD_NAME]"
+    /// \param pThermistors: The thermistor types in the format "Description [ID]"
+    /// \param pDriverTypes: The stepper driver type names
+    /// \return The number of added items
+    int32_t SetHardwareCatalogs(const QStringList& pMotherboards, const QStringList& pThermistors, const QStringList& pDriverTypes);
+
+    /// \brief Sets the environments of the opened workspace, ranked by the selected motherboard
+    ///
+    /// \param pEnvironments: All environments, the built-in list is kept if empty
+    /// \param pEnvironmentsByBoard: Maps the motherboard names to their recommended environments
+    void SetBoardEnvironments(const QStringList& pEnvironments, const QHash<QString, QStringList>& pEnvironmentsByBoard);
+
 signals:
     /// \brief Emitted when the current configuration should be exported as a C++ header file
     void GenerateSignal(void);
@@ -104,6 +249,46 @@ signals:
     void CleanSignal(void);
     void UploadSignal(void);
 
+    /// \brief Emitted when all cached firmware images should be removed
+    void ClearFirmwareCacheSignal(void);
+
+    /// \brief Emitted when existing Marlin configurations should be converted in batch
+    void ImportConfigurationsSignal(void);
+
+    /// \brief Emitted when the configurations of the fleet folders should be queried
+    void QueryFleetSignal(void);
+
+    /// \brief Emitted when a folder should be added to the fleet folders
+    void AddFleetFolderSignal(void);
+
+    /// \brief Emitted when the automation server option was toggled
+    ///
+    /// \param pEnabled: \b true, if the server should run
+    void AutomationServerToggledSignal(bool pEnabled);
+
+    /// \brief Emitted when the recorded trace should be saved
+    void ExportTraceSignal(void);
+
+    /// \brief Emitted when configurations should be compared
+    void CompareConfigurationsSignal(void);
+
+    /// \brief Emitted when the shown comparison should be exported
+    ///
+    /// \param pPath: The export file, a .json file or a .csv file
+    void ExportComparisonSignal(const QString& pPath);
+
+    /// \brief Emitted when the last configuration change should be undone
+    void UndoSignal(void);
+
+    /// \brief Emitted when the last undone configuration change should be redone
+    void RedoSignal(void);
+
+    /// \brief Emitted when the user changed a parameter or the configuration was reset or loaded
+    void ConfigurationChangedSignal(void);
+
+    /// \brief Emitted when the effective defines dock is shown
+    void EffectiveDefinesRequestedSignal(void);
+
 public slots:
     /// \brief Closes the current workspace and resets the configuration
     void OnCloseWorkspace(void);
@@ -128,19 +313,52 @@ protected:
 
     void UpdateActiveTabButtonColor(void);
 
+    /// \brief Marks a page to be read from its widgets with the next snapshot
+    ///
+    /// \param pPage: The page whose widgets changed
+    void MarkStale(const AbstractPage* pPage);
+
     /// \brief Sets the content of the code preview widget to the given code string
     ///
     /// \param pPreviewCode: Reference to the code to display
     void OnUpdatePreview(const QStringList& pPreviewCode);
 
+    /// \brief Refreshes the counters of the performance dock while it is visible
+    void OnUpdatePerformance(void);
+
 protected:
     Ui::MainWindow *mUi;
     AboutDialog mAboutDialog;
+    ComparisonDialog mComparisonDialog;
 
     std::vector<AbstractPage*> mConfigPages;
 
+    /// \brief The pages holding configuration data, in ConfigurationSnapshot page order
+    std::array<AbstractPage*, ConfigurationSnapshot::PAGE_COUNT> mSnapshotPages;
+
+    /// \brief Pages whose widgets changed since the last snapshot
+    std::bitset<ConfigurationSnapshot::PAGE_COUNT> mStalePages;
+
+    ConfigurationSnapshot mSnapshot;
+
+    /// \brief The actions and buttons disabled by SetWorkspaceActionsAvailable
+    QList<QAction*> mActionsDisabledForJob;
+    QList<QWidget*> mWidgetsDisabledForJob;
+
+    /// \brief Receives the page read from the widgets before it is copied into a snapshot
+    Configuration mPageBuffer;
+
     QLabel mStatusLabel;
     QLabel mMarlinVersionLabel;
+    QLabel mRebuildScopeLabel;
+    QLabel mPinConflictLabel;
+    QLabel mDirtyFieldsLabel;
+
+    /// \brief Polls the page counters for the performance dock
+    QTimer mPerformanceTimer;
+
+    /// \brief Bytes held by the main configuration template
+    qint64 mMainTemplateBytes{0};
 
     int8_t mLastCheckedButton = -1;
 
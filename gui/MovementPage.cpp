@@ -26,11 +26,13 @@
 #include "MovementPage.h"
 #include "./ui_MovementPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 MovementPage::MovementPage(QWidget *pParent) :
-    AbstractPage(MOVEMENT_TEMPLATE_PATH, pParent),
+    AbstractPage(MOVEMENT_TEMPLATE_PATH, "movement", pParent),
     mUi(new Ui::MovementPage)
 {
+    const TraceSpan span("MovementPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -100,49 +102,49 @@ void MovementPage::ResetValues()
     mIsLoading = false;
 }
 
-bool MovementPage::LoadFromJson(const QJsonObject &pJson)
+bool MovementPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uDistinctEFactorsBox, pJson, "DISTINCT_E_FACTORS");
-    success &= LoadConfig(mUi->uDefaultAxisStepsPerUnitEdit, pJson, "DEFAULT_AXIS_STEPS_PER_UNIT");
-    success &= LoadConfig(mUi->uDefaultMaxFeedrateEdit, pJson, "DEFAULT_MAX_FEEDRATE");
-    success &= LoadConfig(mUi->uLimitedMaxFrEditingBox, pJson, "LIMITED_MAX_FR_EDITING");
-    success &= LoadConfig(mUi->uMaxFeedrateEditValuesEdit, pJson, "MAX_FEEDRATE_EDIT_VALUES");
-    success &= LoadConfig(mUi->uDefaultMaxAccelerationEdit, pJson, "DEFAULT_MAX_ACCELERATION");
-    success &= LoadConfig(mUi->uLimitedMaxAccelEditingBox, pJson, "LIMITED_MAX_ACCEL_EDITING");
-    success &= LoadConfig(mUi->uMaxAccelEditValuesEdit, pJson, "MAX_ACCEL_EDIT_VALUES");
-    success &= LoadConfig(mUi->uDefaultAccelerationSpinBox, pJson, "DEFAULT_ACCELERATION");
-    success &= LoadConfig(mUi->uDefaultRetractAccelerationSpinBox, pJson, "DEFAULT_RETRACT_ACCELERATION");
-    success &= LoadConfig(mUi->uDefaultTravelAccelerationSpinBox, pJson, "DEFAULT_TRAVEL_ACCELERATION");
-    success &= LoadConfig(mUi->uClassicJerkBox, pJson, "CLASSIC_JERK");
-    success &= LoadConfig(mUi->uDefaultXjerkSpinBox, pJson, "DEFAULT_XJERK");
-    success &= LoadConfig(mUi->uDefaultYjerkSpinBox, pJson, "DEFAULT_YJERK");
-    success &= LoadConfig(mUi->uDefaultZjerkSpinBox, pJson, "DEFAULT_ZJERK");
-    success &= LoadConfig(mUi->uDefaultIjerkSpinBox, pJson, "DEFAULT_IJERK");
-    success &= LoadConfig(mUi->uDefaultJjerkSpinBox, pJson, "DEFAULT_JJERK");
-    success &= LoadConfig(mUi->uDefaultKjerkSpinBox, pJson, "DEFAULT_KJERK");
-    success &= LoadConfig(mUi->uDefaultUjerkSpinBox, pJson, "DEFAULT_UJERK");
-    success &= LoadConfig(mUi->uDefaultVjerkSpinBox, pJson, "DEFAULT_VJERK");
-    success &= LoadConfig(mUi->uDefaultWjerkSpinBox, pJson, "DEFAULT_WJERK");
-    success &= LoadConfig(mUi->uTravelExtraXyjerkSpinBox, pJson, "TRAVEL_EXTRA_XYJERK");
-    success &= LoadConfig(mUi->uTravelExtraXyjerkBox, pJson, "ENABLE_TRAVEL_EXTRA_XYJERK");
-    success &= LoadConfig(mUi->uLimitedJerkEditingBox, pJson, "LIMITED_JERK_EDITING");
-    success &= LoadConfig(mUi->uMaxJerkEditValuesEdit, pJson, "MAX_JERK_EDIT_VALUES");
-    success &= LoadConfig(mUi->uDefaultEjerkSpinBox, pJson, "DEFAULT_EJERK");
-    success &= LoadConfig(mUi->uJunctionDeviationMmSpinBox, pJson, "JUNCTION_DEVIATION_MM");
-    success &= LoadConfig(mUi->uJdHandleSmallSegmentsBox, pJson, "JD_HANDLE_SMALL_SEGMENTS");
-    success &= LoadConfig(mUi->uSCurveAccelerationBox, pJson, "S_CURVE_ACCELERATION");
-    success &= LoadConfig(mUi->uDefaultXjerkBox, pJson, "ENABLE_DEFAULT_XJERK");
-    success &= LoadConfig(mUi->uDefaultYjerkBox, pJson, "ENABLE_DEFAULT_YJERK");
-    success &= LoadConfig(mUi->uDefaultZjerkBox, pJson, "ENABLE_DEFAULT_ZJERK");
-    success &= LoadConfig(mUi->uDefaultIjerkBox, pJson, "ENABLE_DEFAULT_IJERK");
-    success &= LoadConfig(mUi->uDefaultJjerkBox, pJson, "ENABLE_DEFAULT_JJERK");
-    success &= LoadConfig(mUi->uDefaultKjerkBox, pJson, "ENABLE_DEFAULT_KJERK");
-    success &= LoadConfig(mUi->uDefaultUjerkBox, pJson, "ENABLE_DEFAULT_UJERK");
-    success &= LoadConfig(mUi->uDefaultVjerkBox, pJson, "ENABLE_DEFAULT_VJERK");
-    success &= LoadConfig(mUi->uDefaultWjerkBox, pJson, "ENABLE_DEFAULT_WJERK");
+    success &= LoadConfig(mUi->uDistinctEFactorsBox, pConfig.movement.DISTINCT_E_FACTORS);
+    success &= LoadConfig(mUi->uDefaultAxisStepsPerUnitEdit, pConfig.movement.DEFAULT_AXIS_STEPS_PER_UNIT);
+    success &= LoadConfig(mUi->uDefaultMaxFeedrateEdit, pConfig.movement.DEFAULT_MAX_FEEDRATE);
+    success &= LoadConfig(mUi->uLimitedMaxFrEditingBox, pConfig.movement.LIMITED_MAX_FR_EDITING);
+    success &= LoadConfig(mUi->uMaxFeedrateEditValuesEdit, pConfig.movement.MAX_FEEDRATE_EDIT_VALUES);
+    success &= LoadConfig(mUi->uDefaultMaxAccelerationEdit, pConfig.movement.DEFAULT_MAX_ACCELERATION);
+    success &= LoadConfig(mUi->uLimitedMaxAccelEditingBox, pConfig.movement.LIMITED_MAX_ACCEL_EDITING);
+    success &= LoadConfig(mUi->uMaxAccelEditValuesEdit, pConfig.movement.MAX_ACCEL_EDIT_VALUES);
+    success &= LoadConfig(mUi->uDefaultAccelerationSpinBox, pConfig.movement.DEFAULT_ACCELERATION);
+    success &= LoadConfig(mUi->uDefaultRetractAccelerationSpinBox, pConfig.movement.DEFAULT_RETRACT_ACCELERATION);
+    success &= LoadConfig(mUi->uDefaultTravelAccelerationSpinBox, pConfig.movement.DEFAULT_TRAVEL_ACCELERATION);
+    success &= LoadConfig(mUi->uClassicJerkBox, pConfig.movement.CLASSIC_JERK);
+    success &= LoadConfig(mUi->uDefaultXjerkSpinBox, pConfig.movement.DEFAULT_XJERK);
+    success &= LoadConfig(mUi->uDefaultYjerkSpinBox, pConfig.movement.DEFAULT_YJERK);
+    success &= LoadConfig(mUi->uDefaultZjerkSpinBox, pConfig.movement.DEFAULT_ZJERK);
+    success &= LoadConfig(mUi->uDefaultIjerkSpinBox, pConfig.movement.DEFAULT_IJERK);
+    success &= LoadConfig(mUi->uDefaultJjerkSpinBox, pConfig.movement.DEFAULT_JJERK);
+    success &= LoadConfig(mUi->uDefaultKjerkSpinBox, pConfig.movement.DEFAULT_KJERK);
+    success &= LoadConfig(mUi->uDefaultUjerkSpinBox, pConfig.movement.DEFAULT_UJERK);
+    success &= LoadConfig(mUi->uDefaultVjerkSpinBox, pConfig.movement.DEFAULT_VJERK);
+    success &= LoadConfig(mUi->uDefaultWjerkSpinBox, pConfig.movement.DEFAULT_WJERK);
+    success &= LoadConfig(mUi->uTravelExtraXyjerkSpinBox, pConfig.movement.TRAVEL_EXTRA_XYJERK);
+    success &= LoadConfig(mUi->uTravelExtraXyjerkBox, pConfig.movement.ENABLE_TRAVEL_EXTRA_XYJERK);
+    success &= LoadConfig(mUi->uLimitedJerkEditingBox, pConfig.movement.LIMITED_JERK_EDITING);
+    success &= LoadConfig(mUi->uMaxJerkEditValuesEdit, pConfig.movement.MAX_JERK_EDIT_VALUES);
+    success &= LoadConfig(mUi->uDefaultEjerkSpinBox, pConfig.movement.DEFAULT_EJERK);
+    success &= LoadConfig(mUi->uJunctionDeviationMmSpinBox, pConfig.movement.JUNCTION_DEVIATION_MM);
+    success &= LoadConfig(mUi->uJdHandleSmallSegmentsBox, pConfig.movement.JD_HANDLE_SMALL_SEGMENTS);
+    success &= LoadConfig(mUi->uSCurveAccelerationBox, pConfig.movement.S_CURVE_ACCELERATION);
+    success &= LoadConfig(mUi->uDefaultXjerkBox, pConfig.movement.ENABLE_DEFAULT_XJERK);
+    success &= LoadConfig(mUi->uDefaultYjerkBox, pConfig.movement.ENABLE_DEFAULT_YJERK);
+    success &= LoadConfig(mUi->uDefaultZjerkBox, pConfig.movement.ENABLE_DEFAULT_ZJERK);
+    success &= LoadConfig(mUi->uDefaultIjerkBox, pConfig.movement.ENABLE_DEFAULT_IJERK);
+    success &= LoadConfig(mUi->uDefaultJjerkBox, pConfig.movement.ENABLE_DEFAULT_JJERK);
+    success &= LoadConfig(mUi->uDefaultKjerkBox, pConfig.movement.ENABLE_DEFAULT_KJERK);
+    success &= LoadConfig(mUi->uDefaultUjerkBox, pConfig.movement.ENABLE_DEFAULT_UJERK);
+    success &= LoadConfig(mUi->uDefaultVjerkBox, pConfig.movement.ENABLE_DEFAULT_VJERK);
+    success &= LoadConfig(mUi->uDefaultWjerkBox, pConfig.movement.ENABLE_DEFAULT_WJERK);
 
     mIsLoading = false;
     return success;
@@ -0,0 +1,115 @@
+/*!
+ * \file PerformanceWidget.cpp
+ * \brief The PerformanceWidget class shows the live counters of iMC
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "PerformanceWidget.h"
+#include "./ui_PerformanceWidget.h"
+
+namespace
+{
+/// \brief Formats a byte count
+///
+/// \param pBytes: The byte count
+/// \return The size in KiB or MiB
+QString FormatBytes(qint64 pBytes)
+{
+    constexpr auto kibibyte = 1024.0;
+
+    if (pBytes < 1024 * 1024)
+    {
+        return QString("%0 KiB").arg(static_cast<double>(pBytes) / kibibyte, 0, 'f', 1);
+    }
+
+    return QString("%0 MiB").arg(static_cast<double>(pBytes) / (kibibyte * kibibyte), 0, 'f', 1);
+}
+
+/// \brief Formats a duration
+///
+/// \param pNanoseconds: The duration
+/// \return The duration in milliseconds
+QString FormatMilliseconds(qint64 pNanoseconds)
+{
+    return QString::number(static_cast<double>(pNanoseconds) / 1e6, 'f', 2);
+}
+}
+
+PerformanceWidget::PerformanceWidget(QWidget *pParent) :
+    QWidget(pParent),
+    mUi(new Ui::PerformanceWidget)
+{
+    mUi->setupUi(this);
+}
+
+PerformanceWidget::~PerformanceWidget()
+{
+    delete mUi;
+}
+
+void PerformanceWidget::SetPageStatistics(const QList<PageRow>& pRows)
+{
+    // A slow render stands out in the same color as other warnings
+    constexpr auto slowRenderNs = 50 * 1000 * 1000;
+    const QColor slowColor(249, 154, 0);
+
+    mUi->uPagesTable->setUpdatesEnabled(false);
+    mUi->uPagesTable->setRowCount(pRows.size());
+
+    for (int32_t row = 0; row < pRows.size(); ++row)
+    {
+        const auto& statistics = pRows.at(row).statistics;
+
+        const QStringList cells{pRows.at(row).page,
+                                QString::number(statistics.renders),
+                                FormatMilliseconds(statistics.lastRenderNs),
+                                FormatMilliseconds(statistics.p95RenderNs),
+                                QString::number(statistics.signalsReceived),
+                                FormatBytes(statistics.templateBytes)};
+
+        for (int32_t column = 0; column < cells.size(); ++column)
+        {
+            auto* item = mUi->uPagesTable->item(row, column);
+            if (nullptr == item)
+            {
+                item = new QTableWidgetItem();
+                item->setTextAlignment(column == 0 ? (Qt::AlignLeft | Qt::AlignVCenter) : (Qt::AlignRight | Qt::AlignVCenter));
+                mUi->uPagesTable->setItem(row, column, item);
+            }
+
+            item->setText(cells.at(column));
+            item->setForeground(statistics.p95RenderNs > slowRenderNs ? slowColor : QColor(Qt::white));
+        }
+    }
+
+    mUi->uPagesTable->setUpdatesEnabled(true);
+}
+
+void PerformanceWidget::SetMemory(qint64 pTemplateBytes, qint64 pPreviewBytes, qint64 pLogBytes)
+{
+    mUi->uMemoryLabel->setText(QString("Templates: %0 | Previews: %1 | Logs: %2").arg(FormatBytes(pTemplateBytes), FormatBytes(pPreviewBytes), FormatBytes(pLogBytes)));
+}
+
+void PerformanceWidget::SetBuildJob(const QString& pState)
+{
+    mUi->uBuildJobLabel->setText(QString("Build: %0").arg(pState));
+}
@@ -0,0 +1,85 @@
+/*!
+ * \file PerformanceWidget.h
+ * \brief The PerformanceWidget class shows the live counters of iMC
+ * \author Simon Buchholz
+ * \copyright Copyright (c) 2023, Simon Buchholz
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef PERFORMANCEWIDGET_H
+#define PERFORMANCEWIDGET_H
+
+#include "AbstractPage.h"
+
+#include <QList>
+#include <QWidget>
+
+// Forward declarations
+namespace Ui {
+class PerformanceWidget;
+}
+
+///
+/// \brief The PerformanceWidget class shows the live counters of iMC
+///
+/// Lists the code preview counters of each page, the memory held by templates, previews and logs
+/// and the state of the build job, so a slow PC can be told apart from slow iMC code.
+///
+class PerformanceWidget : public QWidget
+{
+    Q_OBJECT
+public:
+    /// \brief The counters of one page
+    struct PageRow
+    {
+        QString page;
+        AbstractPage::Statistics statistics;
+    };
+
+    /// \brief Constructor for PerformanceWidget
+    ///
+    /// \param pParent: Reference to the parent widget
+    explicit PerformanceWidget(QWidget *pParent = nullptr);
+
+    /// \brief Default destructor for PerformanceWidget
+    ~PerformanceWidget(void) override;
+
+    /// \brief Displays the counters of the pages
+    ///
+    /// \param pRows: One row per page
+    void SetPageStatistics(const QList<PageRow>& pRows);
+
+    /// \brief Displays the memory held by texts
+    ///
+    /// \param pTemplateBytes: Bytes of the loaded templates
+    /// \param pPreviewBytes: Bytes of the displayed code preview
+    /// \param pLogBytes: Bytes of the console and compiler outputs
+    void SetMemory(qint64 pTemplateBytes, qint64 pPreviewBytes, qint64 pLogBytes);
+
+    /// \brief Displays the state of the build job
+    ///
+    /// \param pState: The state, e.g. "Running platformio run -e mega2560"
+    void SetBuildJob(const QString& pState);
+
+private:
+    Ui::PerformanceWidget *mUi;
+};
+
+#endif // PERFORMANCEWIDGET_H
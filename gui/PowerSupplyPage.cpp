@@ -27,11 +27,13 @@
 #include "PowerSupplyPage.h"
 #include "./ui_PowerSupplyPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 PowerSupplyPage::PowerSupplyPage(QWidget *pParent) :
-    AbstractPage(POWERSUPPLY_TEMPLATE_PATH, pParent),
+    AbstractPage(POWERSUPPLY_TEMPLATE_PATH, "powerSupply", pParent),
     mUi(new Ui::PowerSupplyPage)
 {
+    const TraceSpan span("PowerSupplyPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -106,45 +108,45 @@ void PowerSupplyPage::ResetValues()
     mIsLoading = false;
 }
 
-bool PowerSupplyPage::LoadFromJson(const QJsonObject &pJson)
+bool PowerSupplyPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uPsuControlBox, pJson, "PSU_CONTROL");
-    success &= LoadConfig(mUi->uPsuNameEdit, pJson, "PSU_NAME");
-    success &= LoadConfig(mUi->uMksPwcBox, pJson, "MKS_PWC");
-    success &= LoadConfig(mUi->uPsOffConfirmBox, pJson, "PS_OFF_CONFIRM");
-    success &= LoadConfig(mUi->uPsOffSoundBox, pJson, "PS_OFF_SOUND");
-    success &= LoadConfig(mUi->uPsuActiveStateDropdown, pJson, "PSU_ACTIVE_STATE");
-    success &= LoadConfig(mUi->uPsuDefaultOffBox, pJson, "PSU_DEFAULT_OFF");
-    success &= LoadConfig(mUi->uPsuPowerupDelaySpinBox, pJson, "PSU_POWERUP_DELAY");
-    success &= LoadConfig(mUi->uLedPoweroffTimeoutSpinBox, pJson, "LED_POWEROFF_TIMEOUT");
-    success &= LoadConfig(mUi->uPowerOffTimerBox, pJson, "POWER_OFF_TIMER");
-    success &= LoadConfig(mUi->uPowerOffWaitForCooldownBox, pJson, "POWER_OFF_WAIT_FOR_COOLDOWN");
-    success &= LoadConfig(mUi->uPsuPowerupGcodeEdit, pJson, "PSU_POWERUP_GCODE");
-    success &= LoadConfig(mUi->uPsuPoweroffGcodeEdit, pJson, "PSU_POWEROFF_GCODE");
-    success &= LoadConfig(mUi->uAutoPowerControlBox, pJson, "AUTO_POWER_CONTROL");
-    success &= LoadConfig(mUi->uAutoPowerFansBox, pJson, "AUTO_POWER_FANS");
-    success &= LoadConfig(mUi->uAutoPowerEFansBox, pJson, "AUTO_POWER_E_FANS");
-    success &= LoadConfig(mUi->uAutoPowerControllerfanBox, pJson, "AUTO_POWER_CONTROLLERFAN");
-    success &= LoadConfig(mUi->uAutoPowerChamberFanBox, pJson, "AUTO_POWER_CHAMBER_FAN");
-    success &= LoadConfig(mUi->uAutoPowerCoolerFanBox, pJson, "AUTO_POWER_COOLER_FAN");
-    success &= LoadConfig(mUi->uPowerTimeoutSpinBox, pJson, "POWER_TIMEOUT");
-    success &= LoadConfig(mUi->uPowerOffDelaySpinBox, pJson, "POWER_OFF_DELAY");
-    success &= LoadConfig(mUi->uAutoPowerETempSpinBox, pJson, "AUTO_POWER_E_TEMP");
-    success &= LoadConfig(mUi->uAutoPowerChamberTempSpinBox, pJson, "AUTO_POWER_CHAMBER_TEMP");
-    success &= LoadConfig(mUi->uAutoPowerCoolerTempSpinBox, pJson, "AUTO_POWER_COOLER_TEMP");
-    success &= LoadConfig(mUi->uPsuNameBox, pJson, "ENABLE_PSU_NAME");
-    success &= LoadConfig(mUi->uPsuPowerupDelayBox, pJson, "ENABLE_PSU_POWERUP_DELAY");
-    success &= LoadConfig(mUi->uLedPoweroffTimeoutBox, pJson, "ENABLE_LED_POWEROFF_TIMEOUT");
-    success &= LoadConfig(mUi->uPsuPowerupGcodeBox, pJson, "ENABLE_PSU_POWERUP_GCODE");
-    success &= LoadConfig(mUi->uPsuPoweroffGcodeBox, pJson, "ENABLE_PSU_POWEROFF_GCODE");
-    success &= LoadConfig(mUi->uPowerTimeoutBox, pJson, "ENABLE_POWER_TIMEOUT");
-    success &= LoadConfig(mUi->uPowerOffDelayBox, pJson, "ENABLE_POWER_OFF_DELAY");
-    success &= LoadConfig(mUi->uAutoPowerETempBox, pJson, "ENABLE_AUTO_POWER_E_TEMP");
-    success &= LoadConfig(mUi->uAutoPowerChamberTempBox, pJson, "ENABLE_AUTO_POWER_CHAMBER_TEMP");
-    success &= LoadConfig(mUi->uAutoPowerCoolerTempBox, pJson, "ENABLE_AUTO_POWER_COOLER_TEMP");
+    success &= LoadConfig(mUi->uPsuControlBox, pConfig.powerSupply.PSU_CONTROL);
+    success &= LoadConfig(mUi->uPsuNameEdit, pConfig.powerSupply.PSU_NAME);
+    success &= LoadConfig(mUi->uMksPwcBox, pConfig.powerSupply.MKS_PWC);
+    success &= LoadConfig(mUi->uPsOffConfirmBox, pConfig.powerSupply.PS_OFF_CONFIRM);
+    success &= LoadConfig(mUi->uPsOffSoundBox, pConfig.powerSupply.PS_OFF_SOUND);
+    success &= LoadConfig(mUi->uPsuActiveStateDropdown, pConfig.powerSupply.PSU_ACTIVE_STATE);
+    success &= LoadConfig(mUi->uPsuDefaultOffBox, pConfig.powerSupply.PSU_DEFAULT_OFF);
+    success &= LoadConfig(mUi->uPsuPowerupDelaySpinBox, pConfig.powerSupply.PSU_POWERUP_DELAY);
+    success &= LoadConfig(mUi->uLedPoweroffTimeoutSpinBox, pConfig.powerSupply.LED_POWEROFF_TIMEOUT);
+    success &= LoadConfig(mUi->uPowerOffTimerBox, pConfig.powerSupply.POWER_OFF_TIMER);
+    success &= LoadConfig(mUi->uPowerOffWaitForCooldownBox, pConfig.powerSupply.POWER_OFF_WAIT_FOR_COOLDOWN);
+    success &= LoadConfig(mUi->uPsuPowerupGcodeEdit, pConfig.powerSupply.PSU_POWERUP_GCODE);
+    success &= LoadConfig(mUi->uPsuPoweroffGcodeEdit, pConfig.powerSupply.PSU_POWEROFF_GCODE);
+    success &= LoadConfig(mUi->uAutoPowerControlBox, pConfig.powerSupply.AUTO_POWER_CONTROL);
+    success &= LoadConfig(mUi->uAutoPowerFansBox, pConfig.powerSupply.AUTO_POWER_FANS);
+    success &= LoadConfig(mUi->uAutoPowerEFansBox, pConfig.powerSupply.AUTO_POWER_E_FANS);
+    success &= LoadConfig(mUi->uAutoPowerControllerfanBox, pConfig.powerSupply.AUTO_POWER_CONTROLLERFAN);
+    success &= LoadConfig(mUi->uAutoPowerChamberFanBox, pConfig.powerSupply.AUTO_POWER_CHAMBER_FAN);
+    success &= LoadConfig(mUi->uAutoPowerCoolerFanBox, pConfig.powerSupply.AUTO_POWER_COOLER_FAN);
+    success &= LoadConfig(mUi->uPowerTimeoutSpinBox, pConfig.powerSupply.POWER_TIMEOUT);
+    success &= LoadConfig(mUi->uPowerOffDelaySpinBox, pConfig.powerSupply.POWER_OFF_DELAY);
+    success &= LoadConfig(mUi->uAutoPowerETempSpinBox, pConfig.powerSupply.AUTO_POWER_E_TEMP);
+    success &= LoadConfig(mUi->uAutoPowerChamberTempSpinBox, pConfig.powerSupply.AUTO_POWER_CHAMBER_TEMP);
+    success &= LoadConfig(mUi->uAutoPowerCoolerTempSpinBox, pConfig.powerSupply.AUTO_POWER_COOLER_TEMP);
+    success &= LoadConfig(mUi->uPsuNameBox, pConfig.powerSupply.ENABLE_PSU_NAME);
+    success &= LoadConfig(mUi->uPsuPowerupDelayBox, pConfig.powerSupply.ENABLE_PSU_POWERUP_DELAY);
+    success &= LoadConfig(mUi->uLedPoweroffTimeoutBox, pConfig.powerSupply.ENABLE_LED_POWEROFF_TIMEOUT);
+    success &= LoadConfig(mUi->uPsuPowerupGcodeBox, pConfig.powerSupply.ENABLE_PSU_POWERUP_GCODE);
+    success &= LoadConfig(mUi->uPsuPoweroffGcodeBox, pConfig.powerSupply.ENABLE_PSU_POWEROFF_GCODE);
+    success &= LoadConfig(mUi->uPowerTimeoutBox, pConfig.powerSupply.ENABLE_POWER_TIMEOUT);
+    success &= LoadConfig(mUi->uPowerOffDelayBox, pConfig.powerSupply.ENABLE_POWER_OFF_DELAY);
+    success &= LoadConfig(mUi->uAutoPowerETempBox, pConfig.powerSupply.ENABLE_AUTO_POWER_E_TEMP);
+    success &= LoadConfig(mUi->uAutoPowerChamberTempBox, pConfig.powerSupply.ENABLE_AUTO_POWER_CHAMBER_TEMP);
+    success &= LoadConfig(mUi->uAutoPowerCoolerTempBox, pConfig.powerSupply.ENABLE_AUTO_POWER_COOLER_TEMP);
 
     mIsLoading = false;
     return success;
@@ -26,11 +26,13 @@
 #include "SDCardPage.h"
 #include "./ui_SDCardPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 SDCardPage::SDCardPage(QWidget *pParent) :
-    AbstractPage(SD_CARD_TEMPLATE_PATH, pParent),
+    AbstractPage(SD_CARD_TEMPLATE_PATH, "sdCard", pParent),
     mUi(new Ui::SDCardPage)
 {
+    const TraceSpan span("SDCardPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -59,13 +61,13 @@ void SDCardPage::ResetValues()
     mIsLoading = false;
 }
 
-bool SDCardPage::LoadFromJson(const QJsonObject &pJson)
+bool SDCardPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uSdsupportBox, pJson, "SDSUPPORT");
-    success &= LoadConfig(mUi->uSdCheckAndRetryBox, pJson, "SD_CHECK_AND_RETRY");
+    success &= LoadConfig(mUi->uSdsupportBox, pConfig.sdCard.SDSUPPORT);
+    success &= LoadConfig(mUi->uSdCheckAndRetryBox, pConfig.sdCard.SD_CHECK_AND_RETRY);
 
     mIsLoading = false;
     return success;
@@ -26,11 +26,13 @@
 #include "SpeakerPage.h"
 #include "./ui_SpeakerPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 SpeakerPage::SpeakerPage(QWidget *pParent) :
-    AbstractPage(SPEAKER_TEMPLATE_PATH, pParent),
+    AbstractPage(SPEAKER_TEMPLATE_PATH, "speaker", pParent),
     mUi(new Ui::SpeakerPage)
 {
+    const TraceSpan span("SpeakerPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -62,16 +64,16 @@ void SpeakerPage::ResetValues()
     mIsLoading = false;
 }
 
-bool SpeakerPage::LoadFromJson(const QJsonObject &pJson)
+bool SpeakerPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uSpeakerBox, pJson, "SPEAKER");
-    success &= LoadConfig(mUi->uLcdFeedbackFrequencyDurationMsSpinBox, pJson, "LCD_FEEDBACK_FREQUENCY_DURATION_MS");
-    success &= LoadConfig(mUi->uLcdFeedbackFrequencyDurationMsBox, pJson, "ENABLE_LCD_FEEDBACK_FREQUENCY_DURATION_MS");
-    success &= LoadConfig(mUi->uLcdFeedbackFrequencyHzSpinBox, pJson, "LCD_FEEDBACK_FREQUENCY_HZ");
-    success &= LoadConfig(mUi->uLcdFeedbackFrequencyHzBox, pJson, "ENABLE_LCD_FEEDBACK_FREQUENCY_HZ");
+    success &= LoadConfig(mUi->uSpeakerBox, pConfig.speaker.SPEAKER);
+    success &= LoadConfig(mUi->uLcdFeedbackFrequencyDurationMsSpinBox, pConfig.speaker.LCD_FEEDBACK_FREQUENCY_DURATION_MS);
+    success &= LoadConfig(mUi->uLcdFeedbackFrequencyDurationMsBox, pConfig.speaker.ENABLE_LCD_FEEDBACK_FREQUENCY_DURATION_MS);
+    success &= LoadConfig(mUi->uLcdFeedbackFrequencyHzSpinBox, pConfig.speaker.LCD_FEEDBACK_FREQUENCY_HZ);
+    success &= LoadConfig(mUi->uLcdFeedbackFrequencyHzBox, pConfig.speaker.ENABLE_LCD_FEEDBACK_FREQUENCY_HZ);
 
     mIsLoading = false;
     return success;
@@ -26,11 +26,16 @@
 #include "StepperDriversPage.h"
 #include "./ui_StepperDriversPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <array>
 
 StepperDriversPage::StepperDriversPage(QWidget *pParent) :
-    AbstractPage(STEPPER_DRIVERS_TEMPLATE_PATH, pParent),
+    AbstractPage(STEPPER_DRIVERS_TEMPLATE_PATH, "stepperDrivers", pParent),
     mUi(new Ui::StepperDriversPage)
 {
+    const TraceSpan span("StepperDriversPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -180,134 +185,134 @@ void StepperDriversPage::ResetValues()
     mIsLoading = false;
 }
 
-bool StepperDriversPage::LoadFromJson(const QJsonObject &pJson)
+bool StepperDriversPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uXDriverTypeDropdown, pJson, "X_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uYDriverTypeDropdown, pJson, "Y_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uZDriverTypeDropdown, pJson, "Z_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uX2DriverTypeDropdown, pJson, "X2_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uY2DriverTypeDropdown, pJson, "Y2_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uZ2DriverTypeDropdown, pJson, "Z2_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uZ3DriverTypeDropdown, pJson, "Z3_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uZ4DriverTypeDropdown, pJson, "Z4_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uXDriverTypeBox, pJson, "ENABLE_X_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uYDriverTypeBox, pJson, "ENABLE_Y_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uZDriverTypeBox, pJson, "ENABLE_Z_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uX2DriverTypeBox, pJson, "ENABLE_X2_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uY2DriverTypeBox, pJson, "ENABLE_Y2_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uZ2DriverTypeBox, pJson, "ENABLE_Z2_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uZ3DriverTypeBox, pJson, "ENABLE_Z3_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uZ4DriverTypeBox, pJson, "ENABLE_Z4_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uIDriverTypeDropdown, pJson, "I_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uJDriverTypeDropdown, pJson, "J_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uKDriverTypeDropdown, pJson, "K_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uIDriverTypeBox, pJson, "ENABLE_I_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uJDriverTypeBox, pJson, "ENABLE_J_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uKDriverTypeBox, pJson, "ENABLE_K_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uUDriverTypeDropdown, pJson, "U_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uVDriverTypeDropdown, pJson, "V_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uWDriverTypeDropdown, pJson, "W_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uUDriverTypeBox, pJson, "ENABLE_U_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uVDriverTypeBox, pJson, "ENABLE_V_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uWDriverTypeBox, pJson, "ENABLE_W_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE0DriverTypeDropdown, pJson, "E0_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE1DriverTypeDropdown, pJson, "E1_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE2DriverTypeDropdown, pJson, "E2_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE3DriverTypeDropdown, pJson, "E3_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE4DriverTypeDropdown, pJson, "E4_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE5DriverTypeDropdown, pJson, "E5_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE6DriverTypeDropdown, pJson, "E6_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE7DriverTypeDropdown, pJson, "E7_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE0DriverTypeBox, pJson, "ENABLE_E0_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE1DriverTypeBox, pJson, "ENABLE_E1_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE2DriverTypeBox, pJson, "ENABLE_E2_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE3DriverTypeBox, pJson, "ENABLE_E3_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE4DriverTypeBox, pJson, "ENABLE_E4_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE5DriverTypeBox, pJson, "ENABLE_E5_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE6DriverTypeBox, pJson, "ENABLE_E6_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uE7DriverTypeBox, pJson, "ENABLE_E7_DRIVER_TYPE");
-    success &= LoadConfig(mUi->uAxis4NameDropdown, pJson, "AXIS4_NAME");
-    success &= LoadConfig(mUi->uAxis5NameDropdown, pJson, "AXIS5_NAME");
-    success &= LoadConfig(mUi->uAxis6NameDropdown, pJson, "AXIS6_NAME");
-    success &= LoadConfig(mUi->uAxis4RotatesBox, pJson, "AXIS4_ROTATES");
-    success &= LoadConfig(mUi->uAxis5RotatesBox, pJson, "AXIS5_ROTATES");
-    success &= LoadConfig(mUi->uAxis6RotatesBox, pJson, "AXIS6_ROTATES");
-    success &= LoadConfig(mUi->uAxis7NameDropdown, pJson, "AXIS7_NAME");
-    success &= LoadConfig(mUi->uAxis8NameDropdown, pJson, "AXIS8_NAME");
-    success &= LoadConfig(mUi->uAxis9NameDropdown, pJson, "AXIS9_NAME");
-    success &= LoadConfig(mUi->uAxis7RotatesBox, pJson, "AXIS7_ROTATES");
-    success &= LoadConfig(mUi->uAxis8RotatesBox, pJson, "AXIS8_ROTATES");
-    success &= LoadConfig(mUi->uAxis9RotatesBox, pJson, "AXIS9_ROTATES");
-    success &= LoadConfig(mUi->uXEnableOnDropdown, pJson, "X_ENABLE_ON");
-    success &= LoadConfig(mUi->uYEnableOnDropdown, pJson, "Y_ENABLE_ON");
-    success &= LoadConfig(mUi->uZEnableOnDropdown, pJson, "Z_ENABLE_ON");
-    success &= LoadConfig(mUi->uEEnableOnDropdown, pJson, "E_ENABLE_ON");
-    success &= LoadConfig(mUi->uIEnableOnDropdown, pJson, "I_ENABLE_ON");
-    success &= LoadConfig(mUi->uJEnableOnDropdown, pJson, "J_ENABLE_ON");
-    success &= LoadConfig(mUi->uKEnableOnDropdown, pJson, "K_ENABLE_ON");
-    success &= LoadConfig(mUi->uUEnableOnDropdown, pJson, "U_ENABLE_ON");
-    success &= LoadConfig(mUi->uVEnableOnDropdown, pJson, "V_ENABLE_ON");
-    success &= LoadConfig(mUi->uWEnableOnDropdown, pJson, "W_ENABLE_ON");
-    success &= LoadConfig(mUi->uXEnableOnBox, pJson, "ENABLE_X_ENABLE_ON");
-    success &= LoadConfig(mUi->uYEnableOnBox, pJson, "ENABLE_Y_ENABLE_ON");
-    success &= LoadConfig(mUi->uZEnableOnBox, pJson, "ENABLE_Z_ENABLE_ON");
-    success &= LoadConfig(mUi->uEEnableOnBox, pJson, "ENABLE_E_ENABLE_ON");
-    success &= LoadConfig(mUi->uIEnableOnBox, pJson, "ENABLE_I_ENABLE_ON");
-    success &= LoadConfig(mUi->uJEnableOnBox, pJson, "ENABLE_J_ENABLE_ON");
-    success &= LoadConfig(mUi->uKEnableOnBox, pJson, "ENABLE_K_ENABLE_ON");
-    success &= LoadConfig(mUi->uUEnableOnBox, pJson, "ENABLE_U_ENABLE_ON");
-    success &= LoadConfig(mUi->uVEnableOnBox, pJson, "ENABLE_V_ENABLE_ON");
-    success &= LoadConfig(mUi->uWEnableOnBox, pJson, "ENABLE_W_ENABLE_ON");
-    success &= LoadConfig(mUi->uDisableXDropdown, pJson, "DISABLE_X");
-    success &= LoadConfig(mUi->uDisableYDropdown, pJson, "DISABLE_Y");
-    success &= LoadConfig(mUi->uDisableZDropdown, pJson, "DISABLE_Z");
-    success &= LoadConfig(mUi->uDisableEDropdown, pJson, "DISABLE_E");
-    success &= LoadConfig(mUi->uDisableIDropdown, pJson, "DISABLE_I");
-    success &= LoadConfig(mUi->uDisableJDropdown, pJson, "DISABLE_J");
-    success &= LoadConfig(mUi->uDisableKDropdown, pJson, "DISABLE_K");
-    success &= LoadConfig(mUi->uDisableUDropdown, pJson, "DISABLE_U");
-    success &= LoadConfig(mUi->uDisableVDropdown, pJson, "DISABLE_V");
-    success &= LoadConfig(mUi->uDisableWDropdown, pJson, "DISABLE_W");
-    success &= LoadConfig(mUi->uDisableXBox, pJson, "ENABLE_DISABLE_X");
-    success &= LoadConfig(mUi->uDisableYBox, pJson, "ENABLE_DISABLE_Y");
-    success &= LoadConfig(mUi->uDisableZBox, pJson, "ENABLE_DISABLE_Z");
-    success &= LoadConfig(mUi->uDisableIBox, pJson, "ENABLE_DISABLE_I");
-    success &= LoadConfig(mUi->uDisableJBox, pJson, "ENABLE_DISABLE_J");
-    success &= LoadConfig(mUi->uDisableKBox, pJson, "ENABLE_DISABLE_K");
-    success &= LoadConfig(mUi->uDisableUBox, pJson, "ENABLE_DISABLE_U");
-    success &= LoadConfig(mUi->uDisableVBox, pJson, "ENABLE_DISABLE_V");
-    success &= LoadConfig(mUi->uDisableWBox, pJson, "ENABLE_DISABLE_W");
-    success &= LoadConfig(mUi->uDisableInactiveExtruderBox, pJson, "DISABLE_INACTIVE_EXTRUDER");
-    success &= LoadConfig(mUi->uInvertXDirDropdown, pJson, "INVERT_X_DIR");
-    success &= LoadConfig(mUi->uInvertYDirDropdown, pJson, "INVERT_Y_DIR");
-    success &= LoadConfig(mUi->uInvertZDirDropdown, pJson, "INVERT_Z_DIR");
-    success &= LoadConfig(mUi->uInvertIDirDropdown, pJson, "INVERT_I_DIR");
-    success &= LoadConfig(mUi->uInvertJDirDropdown, pJson, "INVERT_J_DIR");
-    success &= LoadConfig(mUi->uInvertKDirDropdown, pJson, "INVERT_K_DIR");
-    success &= LoadConfig(mUi->uInvertUDirDropdown, pJson, "INVERT_U_DIR");
-    success &= LoadConfig(mUi->uInvertVDirDropdown, pJson, "INVERT_V_DIR");
-    success &= LoadConfig(mUi->uInvertWDirDropdown, pJson, "INVERT_W_DIR");
-    success &= LoadConfig(mUi->uInvertXDirBox, pJson, "ENABLE_INVERT_X_DIR");
-    success &= LoadConfig(mUi->uInvertYDirBox, pJson, "ENABLE_INVERT_Y_DIR");
-    success &= LoadConfig(mUi->uInvertZDirBox, pJson, "ENABLE_INVERT_Z_DIR");
-    success &= LoadConfig(mUi->uInvertIDirBox, pJson, "ENABLE_INVERT_I_DIR");
-    success &= LoadConfig(mUi->uInvertJDirBox, pJson, "ENABLE_INVERT_J_DIR");
-    success &= LoadConfig(mUi->uInvertKDirBox, pJson, "ENABLE_INVERT_K_DIR");
-    success &= LoadConfig(mUi->uInvertUDirBox, pJson, "ENABLE_INVERT_U_DIR");
-    success &= LoadConfig(mUi->uInvertVDirBox, pJson, "ENABLE_INVERT_V_DIR");
-    success &= LoadConfig(mUi->uInvertWDirBox, pJson, "ENABLE_INVERT_W_DIR");
-    success &= LoadConfig(mUi->uInvertE0DirDropdown, pJson, "INVERT_E0_DIR");
-    success &= LoadConfig(mUi->uInvertE1DirDropdown, pJson, "INVERT_E1_DIR");
-    success &= LoadConfig(mUi->uInvertE2DirDropdown, pJson, "INVERT_E2_DIR");
-    success &= LoadConfig(mUi->uInvertE3DirDropdown, pJson, "INVERT_E3_DIR");
-    success &= LoadConfig(mUi->uInvertE4DirDropdown, pJson, "INVERT_E4_DIR");
-    success &= LoadConfig(mUi->uInvertE5DirDropdown, pJson, "INVERT_E5_DIR");
-    success &= LoadConfig(mUi->uInvertE6DirDropdown, pJson, "INVERT_E6_DIR");
-    success &= LoadConfig(mUi->uInvertE7DirDropdown, pJson, "INVERT_E7_DIR");
-    success &= LoadConfig(mUi->uDisableReducedAccuracyWarningBox, pJson, "DISABLE_REDUCED_ACCURACY_WARNING");
+    success &= LoadConfig(mUi->uXDriverTypeDropdown, pConfig.stepperDrivers.X_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uYDriverTypeDropdown, pConfig.stepperDrivers.Y_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uZDriverTypeDropdown, pConfig.stepperDrivers.Z_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uX2DriverTypeDropdown, pConfig.stepperDrivers.X2_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uY2DriverTypeDropdown, pConfig.stepperDrivers.Y2_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uZ2DriverTypeDropdown, pConfig.stepperDrivers.Z2_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uZ3DriverTypeDropdown, pConfig.stepperDrivers.Z3_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uZ4DriverTypeDropdown, pConfig.stepperDrivers.Z4_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uXDriverTypeBox, pConfig.stepperDrivers.ENABLE_X_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uYDriverTypeBox, pConfig.stepperDrivers.ENABLE_Y_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uZDriverTypeBox, pConfig.stepperDrivers.ENABLE_Z_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uX2DriverTypeBox, pConfig.stepperDrivers.ENABLE_X2_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uY2DriverTypeBox, pConfig.stepperDrivers.ENABLE_Y2_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uZ2DriverTypeBox, pConfig.stepperDrivers.ENABLE_Z2_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uZ3DriverTypeBox, pConfig.stepperDrivers.ENABLE_Z3_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uZ4DriverTypeBox, pConfig.stepperDrivers.ENABLE_Z4_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uIDriverTypeDropdown, pConfig.stepperDrivers.I_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uJDriverTypeDropdown, pConfig.stepperDrivers.J_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uKDriverTypeDropdown, pConfig.stepperDrivers.K_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uIDriverTypeBox, pConfig.stepperDrivers.ENABLE_I_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uJDriverTypeBox, pConfig.stepperDrivers.ENABLE_J_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uKDriverTypeBox, pConfig.stepperDrivers.ENABLE_K_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uUDriverTypeDropdown, pConfig.stepperDrivers.U_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uVDriverTypeDropdown, pConfig.stepperDrivers.V_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uWDriverTypeDropdown, pConfig.stepperDrivers.W_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uUDriverTypeBox, pConfig.stepperDrivers.ENABLE_U_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uVDriverTypeBox, pConfig.stepperDrivers.ENABLE_V_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uWDriverTypeBox, pConfig.stepperDrivers.ENABLE_W_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE0DriverTypeDropdown, pConfig.stepperDrivers.E0_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE1DriverTypeDropdown, pConfig.stepperDrivers.E1_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE2DriverTypeDropdown, pConfig.stepperDrivers.E2_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE3DriverTypeDropdown, pConfig.stepperDrivers.E3_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE4DriverTypeDropdown, pConfig.stepperDrivers.E4_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE5DriverTypeDropdown, pConfig.stepperDrivers.E5_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE6DriverTypeDropdown, pConfig.stepperDrivers.E6_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE7DriverTypeDropdown, pConfig.stepperDrivers.E7_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE0DriverTypeBox, pConfig.stepperDrivers.ENABLE_E0_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE1DriverTypeBox, pConfig.stepperDrivers.ENABLE_E1_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE2DriverTypeBox, pConfig.stepperDrivers.ENABLE_E2_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE3DriverTypeBox, pConfig.stepperDrivers.ENABLE_E3_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE4DriverTypeBox, pConfig.stepperDrivers.ENABLE_E4_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE5DriverTypeBox, pConfig.stepperDrivers.ENABLE_E5_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE6DriverTypeBox, pConfig.stepperDrivers.ENABLE_E6_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uE7DriverTypeBox, pConfig.stepperDrivers.ENABLE_E7_DRIVER_TYPE);
+    success &= LoadConfig(mUi->uAxis4NameDropdown, pConfig.stepperDrivers.AXIS4_NAME);
+    success &= LoadConfig(mUi->uAxis5NameDropdown, pConfig.stepperDrivers.AXIS5_NAME);
+    success &= LoadConfig(mUi->uAxis6NameDropdown, pConfig.stepperDrivers.AXIS6_NAME);
+    success &= LoadConfig(mUi->uAxis4RotatesBox, pConfig.stepperDrivers.AXIS4_ROTATES);
+    success &= LoadConfig(mUi->uAxis5RotatesBox, pConfig.stepperDrivers.AXIS5_ROTATES);
+    success &= LoadConfig(mUi->uAxis6RotatesBox, pConfig.stepperDrivers.AXIS6_ROTATES);
+    success &= LoadConfig(mUi->uAxis7NameDropdown, pConfig.stepperDrivers.AXIS7_NAME);
+    success &= LoadConfig(mUi->uAxis8NameDropdown, pConfig.stepperDrivers.AXIS8_NAME);
+    success &= LoadConfig(mUi->uAxis9NameDropdown, pConfig.stepperDrivers.AXIS9_NAME);
+    success &= LoadConfig(mUi->uAxis7RotatesBox, pConfig.stepperDrivers.AXIS7_ROTATES);
+    success &= LoadConfig(mUi->uAxis8RotatesBox, pConfig.stepperDrivers.AXIS8_ROTATES);
+    success &= LoadConfig(mUi->uAxis9RotatesBox, pConfig.stepperDrivers.AXIS9_ROTATES);
+    success &= LoadConfig(mUi->uXEnableOnDropdown, pConfig.stepperDrivers.X_ENABLE_ON);
+    success &= LoadConfig(mUi->uYEnableOnDropdown, pConfig.stepperDrivers.Y_ENABLE_ON);
+    success &= LoadConfig(mUi->uZEnableOnDropdown, pConfig.stepperDrivers.Z_ENABLE_ON);
+    success &= LoadConfig(mUi->uEEnableOnDropdown, pConfig.stepperDrivers.E_ENABLE_ON);
+    success &= LoadConfig(mUi->uIEnableOnDropdown, pConfig.stepperDrivers.I_ENABLE_ON);
+    success &= LoadConfig(mUi->uJEnableOnDropdown, pConfig.stepperDrivers.J_ENABLE_ON);
+    success &= LoadConfig(mUi->uKEnableOnDropdown, pConfig.stepperDrivers.K_ENABLE_ON);
+    success &= LoadConfig(mUi->uUEnableOnDropdown, pConfig.stepperDrivers.U_ENABLE_ON);
+    success &= LoadConfig(mUi->uVEnableOnDropdown, pConfig.stepperDrivers.V_ENABLE_ON);
+    success &= LoadConfig(mUi->uWEnableOnDropdown, pConfig.stepperDrivers.W_ENABLE_ON);
+    success &= LoadConfig(mUi->uXEnableOnBox, pConfig.stepperDrivers.ENABLE_X_ENABLE_ON);
+    success &= LoadConfig(mUi->uYEnableOnBox, pConfig.stepperDrivers.ENABLE_Y_ENABLE_ON);
+    success &= LoadConfig(mUi->uZEnableOnBox, pConfig.stepperDrivers.ENABLE_Z_ENABLE_ON);
+    success &= LoadConfig(mUi->uEEnableOnBox, pConfig.stepperDrivers.ENABLE_E_ENABLE_ON);
+    success &= LoadConfig(mUi->uIEnableOnBox, pConfig.stepperDrivers.ENABLE_I_ENABLE_ON);
+    success &= LoadConfig(mUi->uJEnableOnBox, pConfig.stepperDrivers.ENABLE_J_ENABLE_ON);
+    success &= LoadConfig(mUi->uKEnableOnBox, pConfig.stepperDrivers.ENABLE_K_ENABLE_ON);
+    success &= LoadConfig(mUi->uUEnableOnBox, pConfig.stepperDrivers.ENABLE_U_ENABLE_ON);
+    success &= LoadConfig(mUi->uVEnableOnBox, pConfig.stepperDrivers.ENABLE_V_ENABLE_ON);
+    success &= LoadConfig(mUi->uWEnableOnBox, pConfig.stepperDrivers.ENABLE_W_ENABLE_ON);
+    success &= LoadConfig(mUi->uDisableXDropdown, pConfig.stepperDrivers.DISABLE_X);
+    success &= LoadConfig(mUi->uDisableYDropdown, pConfig.stepperDrivers.DISABLE_Y);
+    success &= LoadConfig(mUi->uDisableZDropdown, pConfig.stepperDrivers.DISABLE_Z);
+    success &= LoadConfig(mUi->uDisableEDropdown, pConfig.stepperDrivers.DISABLE_E);
+    success &= LoadConfig(mUi->uDisableIDropdown, pConfig.stepperDrivers.DISABLE_I);
+    success &= LoadConfig(mUi->uDisableJDropdown, pConfig.stepperDrivers.DISABLE_J);
+    success &= LoadConfig(mUi->uDisableKDropdown, pConfig.stepperDrivers.DISABLE_K);
+    success &= LoadConfig(mUi->uDisableUDropdown, pConfig.stepperDrivers.DISABLE_U);
+    success &= LoadConfig(mUi->uDisableVDropdown, pConfig.stepperDrivers.DISABLE_V);
+    success &= LoadConfig(mUi->uDisableWDropdown, pConfig.stepperDrivers.DISABLE_W);
+    success &= LoadConfig(mUi->uDisableXBox, pConfig.stepperDrivers.ENABLE_DISABLE_X);
+    success &= LoadConfig(mUi->uDisableYBox, pConfig.stepperDrivers.ENABLE_DISABLE_Y);
+    success &= LoadConfig(mUi->uDisableZBox, pConfig.stepperDrivers.ENABLE_DISABLE_Z);
+    success &= LoadConfig(mUi->uDisableIBox, pConfig.stepperDrivers.ENABLE_DISABLE_I);
+    success &= LoadConfig(mUi->uDisableJBox, pConfig.stepperDrivers.ENABLE_DISABLE_J);
+    success &= LoadConfig(mUi->uDisableKBox, pConfig.stepperDrivers.ENABLE_DISABLE_K);
+    success &= LoadConfig(mUi->uDisableUBox, pConfig.stepperDrivers.ENABLE_DISABLE_U);
+    success &= LoadConfig(mUi->uDisableVBox, pConfig.stepperDrivers.ENABLE_DISABLE_V);
+    success &= LoadConfig(mUi->uDisableWBox, pConfig.stepperDrivers.ENABLE_DISABLE_W);
+    success &= LoadConfig(mUi->uDisableInactiveExtruderBox, pConfig.stepperDrivers.DISABLE_INACTIVE_EXTRUDER);
+    success &= LoadConfig(mUi->uInvertXDirDropdown, pConfig.stepperDrivers.INVERT_X_DIR);
+    success &= LoadConfig(mUi->uInvertYDirDropdown, pConfig.stepperDrivers.INVERT_Y_DIR);
+    success &= LoadConfig(mUi->uInvertZDirDropdown, pConfig.stepperDrivers.INVERT_Z_DIR);
+    success &= LoadConfig(mUi->uInvertIDirDropdown, pConfig.stepperDrivers.INVERT_I_DIR);
+    success &= LoadConfig(mUi->uInvertJDirDropdown, pConfig.stepperDrivers.INVERT_J_DIR);
+    success &= LoadConfig(mUi->uInvertKDirDropdown, pConfig.stepperDrivers.INVERT_K_DIR);
+    success &= LoadConfig(mUi->uInvertUDirDropdown, pConfig.stepperDrivers.INVERT_U_DIR);
+    success &= LoadConfig(mUi->uInvertVDirDropdown, pConfig.stepperDrivers.INVERT_V_DIR);
+    success &= LoadConfig(mUi->uInvertWDirDropdown, pConfig.stepperDrivers.INVERT_W_DIR);
+    success &= LoadConfig(mUi->uInvertXDirBox, pConfig.stepperDrivers.ENABLE_INVERT_X_DIR);
+    success &= LoadConfig(mUi->uInvertYDirBox, pConfig.stepperDrivers.ENABLE_INVERT_Y_DIR);
+    success &= LoadConfig(mUi->uInvertZDirBox, pConfig.stepperDrivers.ENABLE_INVERT_Z_DIR);
+    success &= LoadConfig(mUi->uInvertIDirBox, pConfig.stepperDrivers.ENABLE_INVERT_I_DIR);
+    success &= LoadConfig(mUi->uInvertJDirBox, pConfig.stepperDrivers.ENABLE_INVERT_J_DIR);
+    success &= LoadConfig(mUi->uInvertKDirBox, pConfig.stepperDrivers.ENABLE_INVERT_K_DIR);
+    success &= LoadConfig(mUi->uInvertUDirBox, pConfig.stepperDrivers.ENABLE_INVERT_U_DIR);
+    success &= LoadConfig(mUi->uInvertVDirBox, pConfig.stepperDrivers.ENABLE_INVERT_V_DIR);
+    success &= LoadConfig(mUi->uInvertWDirBox, pConfig.stepperDrivers.ENABLE_INVERT_W_DIR);
+    success &= LoadConfig(mUi->uInvertE0DirDropdown, pConfig.stepperDrivers.INVERT_E0_DIR);
+    success &= LoadConfig(mUi->uInvertE1DirDropdown, pConfig.stepperDrivers.INVERT_E1_DIR);
+    success &= LoadConfig(mUi->uInvertE2DirDropdown, pConfig.stepperDrivers.INVERT_E2_DIR);
+    success &= LoadConfig(mUi->uInvertE3DirDropdown, pConfig.stepperDrivers.INVERT_E3_DIR);
+    success &= LoadConfig(mUi->uInvertE4DirDropdown, pConfig.stepperDrivers.INVERT_E4_DIR);
+    success &= LoadConfig(mUi->uInvertE5DirDropdown, pConfig.stepperDrivers.INVERT_E5_DIR);
+    success &= LoadConfig(mUi->uInvertE6DirDropdown, pConfig.stepperDrivers.INVERT_E6_DIR);
+    success &= LoadConfig(mUi->uInvertE7DirDropdown, pConfig.stepperDrivers.INVERT_E7_DIR);
+    success &= LoadConfig(mUi->uDisableReducedAccuracyWarningBox, pConfig.stepperDrivers.DISABLE_REDUCED_ACCURACY_WARNING);
 
     mIsLoading = false;
     return success;
@@ -516,3 +521,22 @@ void StepperDriversPage::ReplaceTags(QStringList& pOutput)
     ReplaceTag(pOutput, "#{INVERT_E7_DIR}", mUi->uInvertE7DirDropdown, false, "INVERT_E7_DIR");
     ReplaceTag(pOutput, "#{DISABLE_REDUCED_ACCURACY_WARNING}", mUi->uDisableReducedAccuracyWarningBox, "DISABLE_REDUCED_ACCURACY_WARNING");
 }
+
+int32_t StepperDriversPage::AddDriverTypes(const QStringList& pDriverTypes)
+{
+    const std::array<Dropdown*, 22> dropdowns{mUi->uXDriverTypeDropdown, mUi->uYDriverTypeDropdown, mUi->uZDriverTypeDropdown,
+                                              mUi->uX2DriverTypeDropdown, mUi->uY2DriverTypeDropdown, mUi->uZ2DriverTypeDropdown,
+                                              mUi->uZ3DriverTypeDropdown, mUi->uZ4DriverTypeDropdown, mUi->uIDriverTypeDropdown,
+                                              mUi->uJDriverTypeDropdown, mUi->uKDriverTypeDropdown, mUi->uUDriverTypeDropdown,
+                                              mUi->uVDriverTypeDropdown, mUi->uWDriverTypeDropdown, mUi->uE0DriverTypeDropdown,
+                                              mUi->uE1DriverTypeDropdown, mUi->uE2DriverTypeDropdown, mUi->uE3DriverTypeDropdown,
+                                              mUi->uE4DriverTypeDropdown, mUi->uE5DriverTypeDropdown, mUi->uE6DriverTypeDropdown,
+                                              mUi->uE7DriverTypeDropdown};
+
+    int32_t added = 0;
+    for (auto&& dropdown : dropdowns)
+    {
+        added = std::max(added, dropdown->SetAddedItems(pDriverTypes));
+    }
+    return added;
+}
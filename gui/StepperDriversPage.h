@@ -52,11 +52,11 @@ public:
     /// \brief Resets all parameters on the page to their defaults
     void ResetValues(void) override;
 
-    /// \brief Loads the page parameters from the given JSON object
+    /// \brief Loads the page parameters from the given configuration
     ///
-    /// \param pJson: Reference to the JSON object
-    /// \return \b true, if all expected parameters where found in the JSON
-    bool LoadFromJson(const QJsonObject &pJson) override;
+    /// \param pConfig: Reference to the configuration
+    /// \return \b true, if all parameters could be set, e.g. every dropdown item exists
+    bool LoadFromConfiguration(const Configuration& pConfig) override;
 
     /// \brief Writes the page parameters into the given Configuration object
     ///
@@ -69,6 +69,12 @@ public:
     /// \param pOutput: Reference to the text to replace tags in
     void ReplaceTags(QStringList& pOutput) override;
 
+    /// \brief Replaces the driver types added for the previous workspace with those of the opened workspace
+    ///
+    /// \param pDriverTypes: The driver type names
+    /// \return The number of added driver types
+    int32_t AddDriverTypes(const QStringList& pDriverTypes);
+
 protected:
     /// \brief Connects this widget's signals and slots
     void ConnectGuiSignalsAndSlots(void) override;
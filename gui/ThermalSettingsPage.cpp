@@ -26,11 +26,16 @@
 #include "ThermalSettingsPage.h"
 #include "./ui_ThermalSettingsPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
+
+#include <algorithm>
+#include <array>
 
 ThermalSettingsPage::ThermalSettingsPage(QWidget *pParent) :
-    AbstractPage(THERMALSETTINGS_TEMPLATE_PATH, pParent),
+    AbstractPage(THERMALSETTINGS_TEMPLATE_PATH, "thermalSettings", pParent),
     mUi(new Ui::ThermalSettingsPage)
 {
+    const TraceSpan span("ThermalSettingsPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -323,129 +328,129 @@ void ThermalSettingsPage::ResetValues()
     mIsLoading = false;
 }
 
-bool ThermalSettingsPage::LoadFromJson(const QJsonObject &pJson)
+bool ThermalSettingsPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uTempSensor0Dropdown, pJson, "TEMP_SENSOR_0");
-    success &= LoadConfig(mUi->uTempSensor1Dropdown, pJson, "TEMP_SENSOR_1");
-    success &= LoadConfig(mUi->uTempSensor2Dropdown, pJson, "TEMP_SENSOR_2");
-    success &= LoadConfig(mUi->uTempSensor3Dropdown, pJson, "TEMP_SENSOR_3");
-    success &= LoadConfig(mUi->uTempSensor4Dropdown, pJson, "TEMP_SENSOR_4");
-    success &= LoadConfig(mUi->uTempSensor5Dropdown, pJson, "TEMP_SENSOR_5");
-    success &= LoadConfig(mUi->uTempSensor6Dropdown, pJson, "TEMP_SENSOR_6");
-    success &= LoadConfig(mUi->uTempSensor7Dropdown, pJson, "TEMP_SENSOR_7");
-    success &= LoadConfig(mUi->uTempSensorBedDropdown, pJson, "TEMP_SENSOR_BED");
-    success &= LoadConfig(mUi->uTempSensorProbeDropdown, pJson, "TEMP_SENSOR_PROBE");
-    success &= LoadConfig(mUi->uTempSensorChamberDropdown, pJson, "TEMP_SENSOR_CHAMBER");
-    success &= LoadConfig(mUi->uTempSensorCoolerDropdown, pJson, "TEMP_SENSOR_COOLER");
-    success &= LoadConfig(mUi->uTempSensorBoardDropdown, pJson, "TEMP_SENSOR_BOARD");
-    success &= LoadConfig(mUi->uTempSensorRedundantDropdown, pJson, "TEMP_SENSOR_REDUNDANT");
-    success &= LoadConfig(mUi->uDummyThermistor998ValueSpinBox, pJson, "DUMMY_THERMISTOR_998_VALUE");
-    success &= LoadConfig(mUi->uDummyThermistor999ValueSpinBox, pJson, "DUMMY_THERMISTOR_999_VALUE");
-    success &= LoadConfig(mUi->uMax31865SensorOhms0SpinBox, pJson, "MAX31865_SENSOR_OHMS_0");
-    success &= LoadConfig(mUi->uMax31865CalibrationOhms0SpinBox, pJson, "MAX31865_CALIBRATION_OHMS_0");
-    success &= LoadConfig(mUi->uMax31865SensorOhms1SpinBox, pJson, "MAX31865_SENSOR_OHMS_1");
-    success &= LoadConfig(mUi->uMax31865CalibrationOhms1SpinBox, pJson, "MAX31865_CALIBRATION_OHMS_1");
-    success &= LoadConfig(mUi->uMax31865SensorOhms2SpinBox, pJson, "MAX31865_SENSOR_OHMS_2");
-    success &= LoadConfig(mUi->uMax31865CalibrationOhms2SpinBox, pJson, "MAX31865_CALIBRATION_OHMS_2");
-    success &= LoadConfig(mUi->uTempResidencyTimeSpinBox, pJson, "TEMP_RESIDENCY_TIME");
-    success &= LoadConfig(mUi->uTempWindowSpinBox, pJson, "TEMP_WINDOW");
-    success &= LoadConfig(mUi->uTempHysteresisSpinBox, pJson, "TEMP_HYSTERESIS");
-    success &= LoadConfig(mUi->uTempBedResidencyTimeSpinBox, pJson, "TEMP_BED_RESIDENCY_TIME");
-    success &= LoadConfig(mUi->uTempBedWindowSpinBox, pJson, "TEMP_BED_WINDOW");
-    success &= LoadConfig(mUi->uTempBedHysteresisSpinBox, pJson, "TEMP_BED_HYSTERESIS");
-    success &= LoadConfig(mUi->uTempChamberResidencyTimeSpinBox, pJson, "TEMP_CHAMBER_RESIDENCY_TIME");
-    success &= LoadConfig(mUi->uTempChamberWindowSpinBox, pJson, "TEMP_CHAMBER_WINDOW");
-    success &= LoadConfig(mUi->uTempChamberHysteresisSpinBox, pJson, "TEMP_CHAMBER_HYSTERESIS");
-    success &= LoadConfig(mUi->uTempSensorRedundantSourceDropdown, pJson, "TEMP_SENSOR_REDUNDANT_SOURCE");
-    success &= LoadConfig(mUi->uTempSensorRedundantTargetDropdown, pJson, "TEMP_SENSOR_REDUNDANT_TARGET");
-    success &= LoadConfig(mUi->uTempSensorRedundantMaxDiffSpinBox, pJson, "TEMP_SENSOR_REDUNDANT_MAX_DIFF");
-    success &= LoadConfig(mUi->uHeater0MintempSpinBox, pJson, "HEATER_0_MINTEMP");
-    success &= LoadConfig(mUi->uHeater1MintempSpinBox, pJson, "HEATER_1_MINTEMP");
-    success &= LoadConfig(mUi->uHeater2MintempSpinBox, pJson, "HEATER_2_MINTEMP");
-    success &= LoadConfig(mUi->uHeater3MintempSpinBox, pJson, "HEATER_3_MINTEMP");
-    success &= LoadConfig(mUi->uHeater4MintempSpinBox, pJson, "HEATER_4_MINTEMP");
-    success &= LoadConfig(mUi->uHeater5MintempSpinBox, pJson, "HEATER_5_MINTEMP");
-    success &= LoadConfig(mUi->uHeater6MintempSpinBox, pJson, "HEATER_6_MINTEMP");
-    success &= LoadConfig(mUi->uHeater7MintempSpinBox, pJson, "HEATER_7_MINTEMP");
-    success &= LoadConfig(mUi->uBedMintempSpinBox, pJson, "BED_MINTEMP");
-    success &= LoadConfig(mUi->uChamberMintempSpinBox, pJson, "CHAMBER_MINTEMP");
-    success &= LoadConfig(mUi->uHeater0MaxtempSpinBox, pJson, "HEATER_0_MAXTEMP");
-    success &= LoadConfig(mUi->uHeater1MaxtempSpinBox, pJson, "HEATER_1_MAXTEMP");
-    success &= LoadConfig(mUi->uHeater2MaxtempSpinBox, pJson, "HEATER_2_MAXTEMP");
-    success &= LoadConfig(mUi->uHeater3MaxtempSpinBox, pJson, "HEATER_3_MAXTEMP");
-    success &= LoadConfig(mUi->uHeater4MaxtempSpinBox, pJson, "HEATER_4_MAXTEMP");
-    success &= LoadConfig(mUi->uHeater5MaxtempSpinBox, pJson, "HEATER_5_MAXTEMP");
-    success &= LoadConfig(mUi->uHeater6MaxtempSpinBox, pJson, "HEATER_6_MAXTEMP");
-    success &= LoadConfig(mUi->uHeater7MaxtempSpinBox, pJson, "HEATER_7_MAXTEMP");
-    success &= LoadConfig(mUi->uBedMaxtempSpinBox, pJson, "BED_MAXTEMP");
-    success &= LoadConfig(mUi->uChamberMaxtempSpinBox, pJson, "CHAMBER_MAXTEMP");
-    success &= LoadConfig(mUi->uHotendOvershootSpinBox, pJson, "HOTEND_OVERSHOOT");
-    success &= LoadConfig(mUi->uBedOvershootSpinBox, pJson, "BED_OVERSHOOT");
-    success &= LoadConfig(mUi->uCoolerOvershootSpinBox, pJson, "COOLER_OVERSHOOT");
-    success &= LoadConfig(mUi->uPidtempBox, pJson, "PIDTEMP");
-    success &= LoadConfig(mUi->uMpctempBox, pJson, "MPCTEMP");
-    success &= LoadConfig(mUi->uBangMaxSpinBox, pJson, "BANG_MAX");
-    success &= LoadConfig(mUi->uPidMaxSpinBox, pJson, "PID_MAX");
-    success &= LoadConfig(mUi->uPidK1SpinBox, pJson, "PID_K1");
-    success &= LoadConfig(mUi->uPidDebugBox, pJson, "PID_DEBUG");
-    success &= LoadConfig(mUi->uPidParamsPerHotendBox, pJson, "PID_PARAMS_PER_HOTEND");
-    success &= LoadConfig(mUi->uDefaultKpListEdit, pJson, "DEFAULT_Kp_LIST");
-    success &= LoadConfig(mUi->uDefaultKiListEdit, pJson, "DEFAULT_Ki_LIST");
-    success &= LoadConfig(mUi->uDefaultKdListEdit, pJson, "DEFAULT_Kd_LIST");
-    success &= LoadConfig(mUi->uDefaultKpSpinBox, pJson, "DEFAULT_Kp");
-    success &= LoadConfig(mUi->uDefaultKiSpinBox, pJson, "DEFAULT_Ki");
-    success &= LoadConfig(mUi->uDefaultKdSpinBox, pJson, "DEFAULT_Kd");
-    success &= LoadConfig(mUi->uMpcEditMenuBox, pJson, "MPC_EDIT_MENU");
-    success &= LoadConfig(mUi->uMpcAutotuneMenuBox, pJson, "MPC_AUTOTUNE_MENU");
-    success &= LoadConfig(mUi->uMpcMaxSpinBox, pJson, "MPC_MAX");
-    success &= LoadConfig(mUi->uMpcHeaterPowerEdit, pJson, "MPC_HEATER_POWER");
-    success &= LoadConfig(mUi->uMpcIncludeFanBox, pJson, "MPC_INCLUDE_FAN");
-    success &= LoadConfig(mUi->uMpcBlockHeatCapacityEdit, pJson, "MPC_BLOCK_HEAT_CAPACITY");
-    success &= LoadConfig(mUi->uMpcSensorResponsivenessEdit, pJson, "MPC_SENSOR_RESPONSIVENESS");
-    success &= LoadConfig(mUi->uMpcAmbientXferCoeffEdit, pJson, "MPC_AMBIENT_XFER_COEFF");
-    success &= LoadConfig(mUi->uMpcAmbientXferCoeffFan255Edit, pJson, "MPC_AMBIENT_XFER_COEFF_FAN255");
-    success &= LoadConfig(mUi->uMpcFan0AllHotendsBox, pJson, "MPC_FAN_0_ALL_HOTENDS");
-    success &= LoadConfig(mUi->uMpcFan0ActiveHotendBox, pJson, "MPC_FAN_0_ACTIVE_HOTEND");
-    success &= LoadConfig(mUi->uFilamentHeatCapacityPermmEdit, pJson, "FILAMENT_HEAT_CAPACITY_PERMM");
-    success &= LoadConfig(mUi->uMpcSmoothingFactorSpinBox, pJson, "MPC_SMOOTHING_FACTOR");
-    success &= LoadConfig(mUi->uMpcMinAmbientChangeSpinBox, pJson, "MPC_MIN_AMBIENT_CHANGE");
-    success &= LoadConfig(mUi->uMpcSteadystateSpinBox, pJson, "MPC_STEADYSTATE");
-    success &= LoadConfig(mUi->uMpcTuningPosEdit, pJson, "MPC_TUNING_POS");
-    success &= LoadConfig(mUi->uMpcTuningEndZSpinBox, pJson, "MPC_TUNING_END_Z");
-    success &= LoadConfig(mUi->uPidtempbedBox, pJson, "PIDTEMPBED");
-    success &= LoadConfig(mUi->uBedLimitSwitchingBox, pJson, "BED_LIMIT_SWITCHING");
-    success &= LoadConfig(mUi->uMaxBedPowerSpinBox, pJson, "MAX_BED_POWER");
-    success &= LoadConfig(mUi->uMinBedPowerSpinBox, pJson, "MIN_BED_POWER");
-    success &= LoadConfig(mUi->uMinBedPowerBox, pJson, "ENABLE_MIN_BED_POWER");
-    success &= LoadConfig(mUi->uPidBedDebugBox, pJson, "PID_BED_DEBUG");
-    success &= LoadConfig(mUi->uDefaultBedkpSpinBox, pJson, "DEFAULT_bedKp");
-    success &= LoadConfig(mUi->uDefaultBedkiSpinBox, pJson, "DEFAULT_bedKi");
-    success &= LoadConfig(mUi->uDefaultBedkdSpinBox, pJson, "DEFAULT_bedKd");
-    success &= LoadConfig(mUi->uPidtempchamberBox, pJson, "PIDTEMPCHAMBER");
-    success &= LoadConfig(mUi->uChamberLimitSwitchingBox, pJson, "CHAMBER_LIMIT_SWITCHING");
-    success &= LoadConfig(mUi->uMaxChamberPowerSpinBox, pJson, "MAX_CHAMBER_POWER");
-    success &= LoadConfig(mUi->uMinChamberPowerSpinBox, pJson, "MIN_CHAMBER_POWER");
-    success &= LoadConfig(mUi->uMinChamberPowerBox, pJson, "ENABLE_MIN_CHAMBER_POWER");
-    success &= LoadConfig(mUi->uPidChamberDebugBox, pJson, "PID_CHAMBER_DEBUG");
-    success &= LoadConfig(mUi->uDefaultChamberkpSpinBox, pJson, "DEFAULT_chamberKp");
-    success &= LoadConfig(mUi->uDefaultChamberkiSpinBox, pJson, "DEFAULT_chamberKi");
-    success &= LoadConfig(mUi->uDefaultChamberkdSpinBox, pJson, "DEFAULT_chamberKd");
-    success &= LoadConfig(mUi->uPidOpenloopBox, pJson, "PID_OPENLOOP");
-    success &= LoadConfig(mUi->uSlowPwmHeatersBox, pJson, "SLOW_PWM_HEATERS");
-    success &= LoadConfig(mUi->uPidFunctionalRangeSpinBox, pJson, "PID_FUNCTIONAL_RANGE");
-    success &= LoadConfig(mUi->uPidEditMenuBox, pJson, "PID_EDIT_MENU");
-    success &= LoadConfig(mUi->uPidAutotuneMenuBox, pJson, "PID_AUTOTUNE_MENU");
-    success &= LoadConfig(mUi->uPreventColdExtrusionBox, pJson, "PREVENT_COLD_EXTRUSION");
-    success &= LoadConfig(mUi->uExtrudeMintempSpinBox, pJson, "EXTRUDE_MINTEMP");
-    success &= LoadConfig(mUi->uPreventLengthyExtrudeBox, pJson, "PREVENT_LENGTHY_EXTRUDE");
-    success &= LoadConfig(mUi->uExtrudeMaxlengthSpinBox, pJson, "EXTRUDE_MAXLENGTH");
-    success &= LoadConfig(mUi->uThermalProtectionHotendsBox, pJson, "THERMAL_PROTECTION_HOTENDS");
-    success &= LoadConfig(mUi->uThermalProtectionBedBox, pJson, "THERMAL_PROTECTION_BED");
-    success &= LoadConfig(mUi->uThermalProtectionChamberBox, pJson, "THERMAL_PROTECTION_CHAMBER");
-    success &= LoadConfig(mUi->uThermalProtectionCoolerBox, pJson, "THERMAL_PROTECTION_COOLER");
+    success &= LoadConfig(mUi->uTempSensor0Dropdown, pConfig.thermalSettings.TEMP_SENSOR_0);
+    success &= LoadConfig(mUi->uTempSensor1Dropdown, pConfig.thermalSettings.TEMP_SENSOR_1);
+    success &= LoadConfig(mUi->uTempSensor2Dropdown, pConfig.thermalSettings.TEMP_SENSOR_2);
+    success &= LoadConfig(mUi->uTempSensor3Dropdown, pConfig.thermalSettings.TEMP_SENSOR_3);
+    success &= LoadConfig(mUi->uTempSensor4Dropdown, pConfig.thermalSettings.TEMP_SENSOR_4);
+    success &= LoadConfig(mUi->uTempSensor5Dropdown, pConfig.thermalSettings.TEMP_SENSOR_5);
+    success &= LoadConfig(mUi->uTempSensor6Dropdown, pConfig.thermalSettings.TEMP_SENSOR_6);
+    success &= LoadConfig(mUi->uTempSensor7Dropdown, pConfig.thermalSettings.TEMP_SENSOR_7);
+    success &= LoadConfig(mUi->uTempSensorBedDropdown, pConfig.thermalSettings.TEMP_SENSOR_BED);
+    success &= LoadConfig(mUi->uTempSensorProbeDropdown, pConfig.thermalSettings.TEMP_SENSOR_PROBE);
+    success &= LoadConfig(mUi->uTempSensorChamberDropdown, pConfig.thermalSettings.TEMP_SENSOR_CHAMBER);
+    success &= LoadConfig(mUi->uTempSensorCoolerDropdown, pConfig.thermalSettings.TEMP_SENSOR_COOLER);
+    success &= LoadConfig(mUi->uTempSensorBoardDropdown, pConfig.thermalSettings.TEMP_SENSOR_BOARD);
+    success &= LoadConfig(mUi->uTempSensorRedundantDropdown, pConfig.thermalSettings.TEMP_SENSOR_REDUNDANT);
+    success &= LoadConfig(mUi->uDummyThermistor998ValueSpinBox, pConfig.thermalSettings.DUMMY_THERMISTOR_998_VALUE);
+    success &= LoadConfig(mUi->uDummyThermistor999ValueSpinBox, pConfig.thermalSettings.DUMMY_THERMISTOR_999_VALUE);
+    success &= LoadConfig(mUi->uMax31865SensorOhms0SpinBox, pConfig.thermalSettings.MAX31865_SENSOR_OHMS_0);
+    success &= LoadConfig(mUi->uMax31865CalibrationOhms0SpinBox, pConfig.thermalSettings.MAX31865_CALIBRATION_OHMS_0);
+    success &= LoadConfig(mUi->uMax31865SensorOhms1SpinBox, pConfig.thermalSettings.MAX31865_SENSOR_OHMS_1);
+    success &= LoadConfig(mUi->uMax31865CalibrationOhms1SpinBox, pConfig.thermalSettings.MAX31865_CALIBRATION_OHMS_1);
+    success &= LoadConfig(mUi->uMax31865SensorOhms2SpinBox, pConfig.thermalSettings.MAX31865_SENSOR_OHMS_2);
+    success &= LoadConfig(mUi->uMax31865CalibrationOhms2SpinBox, pConfig.thermalSettings.MAX31865_CALIBRATION_OHMS_2);
+    success &= LoadConfig(mUi->uTempResidencyTimeSpinBox, pConfig.thermalSettings.TEMP_RESIDENCY_TIME);
+    success &= LoadConfig(mUi->uTempWindowSpinBox, pConfig.thermalSettings.TEMP_WINDOW);
+    success &= LoadConfig(mUi->uTempHysteresisSpinBox, pConfig.thermalSettings.TEMP_HYSTERESIS);
+    success &= LoadConfig(mUi->uTempBedResidencyTimeSpinBox, pConfig.thermalSettings.TEMP_BED_RESIDENCY_TIME);
+    success &= LoadConfig(mUi->uTempBedWindowSpinBox, pConfig.thermalSettings.TEMP_BED_WINDOW);
+    success &= LoadConfig(mUi->uTempBedHysteresisSpinBox, pConfig.thermalSettings.TEMP_BED_HYSTERESIS);
+    success &= LoadConfig(mUi->uTempChamberResidencyTimeSpinBox, pConfig.thermalSettings.TEMP_CHAMBER_RESIDENCY_TIME);
+    success &= LoadConfig(mUi->uTempChamberWindowSpinBox, pConfig.thermalSettings.TEMP_CHAMBER_WINDOW);
+    success &= LoadConfig(mUi->uTempChamberHysteresisSpinBox, pConfig.thermalSettings.TEMP_CHAMBER_HYSTERESIS);
+    success &= LoadConfig(mUi->uTempSensorRedundantSourceDropdown, pConfig.thermalSettings.TEMP_SENSOR_REDUNDANT_SOURCE);
+    success &= LoadConfig(mUi->uTempSensorRedundantTargetDropdown, pConfig.thermalSettings.TEMP_SENSOR_REDUNDANT_TARGET);
+    success &= LoadConfig(mUi->uTempSensorRedundantMaxDiffSpinBox, pConfig.thermalSettings.TEMP_SENSOR_REDUNDANT_MAX_DIFF);
+    success &= LoadConfig(mUi->uHeater0MintempSpinBox, pConfig.thermalSettings.HEATER_0_MINTEMP);
+    success &= LoadConfig(mUi->uHeater1MintempSpinBox, pConfig.thermalSettings.HEATER_1_MINTEMP);
+    success &= LoadConfig(mUi->uHeater2MintempSpinBox, pConfig.thermalSettings.HEATER_2_MINTEMP);
+    success &= LoadConfig(mUi->uHeater3MintempSpinBox, pConfig.thermalSettings.HEATER_3_MINTEMP);
+    success &= LoadConfig(mUi->uHeater4MintempSpinBox, pConfig.thermalSettings.HEATER_4_MINTEMP);
+    success &= LoadConfig(mUi->uHeater5MintempSpinBox, pConfig.thermalSettings.HEATER_5_MINTEMP);
+    success &= LoadConfig(mUi->uHeater6MintempSpinBox, pConfig.thermalSettings.HEATER_6_MINTEMP);
+    success &= LoadConfig(mUi->uHeater7MintempSpinBox, pConfig.thermalSettings.HEATER_7_MINTEMP);
+    success &= LoadConfig(mUi->uBedMintempSpinBox, pConfig.thermalSettings.BED_MINTEMP);
+    success &= LoadConfig(mUi->uChamberMintempSpinBox, pConfig.thermalSettings.CHAMBER_MINTEMP);
+    success &= LoadConfig(mUi->uHeater0MaxtempSpinBox, pConfig.thermalSettings.HEATER_0_MAXTEMP);
+    success &= LoadConfig(mUi->uHeater1MaxtempSpinBox, pConfig.thermalSettings.HEATER_1_MAXTEMP);
+    success &= LoadConfig(mUi->uHeater2MaxtempSpinBox, pConfig.thermalSettings.HEATER_2_MAXTEMP);
+    success &= LoadConfig(mUi->uHeater3MaxtempSpinBox, pConfig.thermalSettings.HEATER_3_MAXTEMP);
+    success &= LoadConfig(mUi->uHeater4MaxtempSpinBox, pConfig.thermalSettings.HEATER_4_MAXTEMP);
+    success &= LoadConfig(mUi->uHeater5MaxtempSpinBox, pConfig.thermalSettings.HEATER_5_MAXTEMP);
+    success &= LoadConfig(mUi->uHeater6MaxtempSpinBox, pConfig.thermalSettings.HEATER_6_MAXTEMP);
+    success &= LoadConfig(mUi->uHeater7MaxtempSpinBox, pConfig.thermalSettings.HEATER_7_MAXTEMP);
+    success &= LoadConfig(mUi->uBedMaxtempSpinBox, pConfig.thermalSettings.BED_MAXTEMP);
+    success &= LoadConfig(mUi->uChamberMaxtempSpinBox, pConfig.thermalSettings.CHAMBER_MAXTEMP);
+    success &= LoadConfig(mUi->uHotendOvershootSpinBox, pConfig.thermalSettings.HOTEND_OVERSHOOT);
+    success &= LoadConfig(mUi->uBedOvershootSpinBox, pConfig.thermalSettings.BED_OVERSHOOT);
+    success &= LoadConfig(mUi->uCoolerOvershootSpinBox, pConfig.thermalSettings.COOLER_OVERSHOOT);
+    success &= LoadConfig(mUi->uPidtempBox, pConfig.thermalSettings.PIDTEMP);
+    success &= LoadConfig(mUi->uMpctempBox, pConfig.thermalSettings.MPCTEMP);
+    success &= LoadConfig(mUi->uBangMaxSpinBox, pConfig.thermalSettings.BANG_MAX);
+    success &= LoadConfig(mUi->uPidMaxSpinBox, pConfig.thermalSettings.PID_MAX);
+    success &= LoadConfig(mUi->uPidK1SpinBox, pConfig.thermalSettings.PID_K1);
+    success &= LoadConfig(mUi->uPidDebugBox, pConfig.thermalSettings.PID_DEBUG);
+    success &= LoadConfig(mUi->uPidParamsPerHotendBox, pConfig.thermalSettings.PID_PARAMS_PER_HOTEND);
+    success &= LoadConfig(mUi->uDefaultKpListEdit, pConfig.thermalSettings.DEFAULT_Kp_LIST);
+    success &= LoadConfig(mUi->uDefaultKiListEdit, pConfig.thermalSettings.DEFAULT_Ki_LIST);
+    success &= LoadConfig(mUi->uDefaultKdListEdit, pConfig.thermalSettings.DEFAULT_Kd_LIST);
+    success &= LoadConfig(mUi->uDefaultKpSpinBox, pConfig.thermalSettings.DEFAULT_Kp);
+    success &= LoadConfig(mUi->uDefaultKiSpinBox, pConfig.thermalSettings.DEFAULT_Ki);
+    success &= LoadConfig(mUi->uDefaultKdSpinBox, pConfig.thermalSettings.DEFAULT_Kd);
+    success &= LoadConfig(mUi->uMpcEditMenuBox, pConfig.thermalSettings.MPC_EDIT_MENU);
+    success &= LoadConfig(mUi->uMpcAutotuneMenuBox, pConfig.thermalSettings.MPC_AUTOTUNE_MENU);
+    success &= LoadConfig(mUi->uMpcMaxSpinBox, pConfig.thermalSettings.MPC_MAX);
+    success &= LoadConfig(mUi->uMpcHeaterPowerEdit, pConfig.thermalSettings.MPC_HEATER_POWER);
+    success &= LoadConfig(mUi->uMpcIncludeFanBox, pConfig.thermalSettings.MPC_INCLUDE_FAN);
+    success &= LoadConfig(mUi->uMpcBlockHeatCapacityEdit, pConfig.thermalSettings.MPC_BLOCK_HEAT_CAPACITY);
+    success &= LoadConfig(mUi->uMpcSensorResponsivenessEdit, pConfig.thermalSettings.MPC_SENSOR_RESPONSIVENESS);
+    success &= LoadConfig(mUi->uMpcAmbientXferCoeffEdit, pConfig.thermalSettings.MPC_AMBIENT_XFER_COEFF);
+    success &= LoadConfig(mUi->uMpcAmbientXferCoeffFan255Edit, pConfig.thermalSettings.MPC_AMBIENT_XFER_COEFF_FAN255);
+    success &= LoadConfig(mUi->uMpcFan0AllHotendsBox, pConfig.thermalSettings.MPC_FAN_0_ALL_HOTENDS);
+    success &= LoadConfig(mUi->uMpcFan0ActiveHotendBox, pConfig.thermalSettings.MPC_FAN_0_ACTIVE_HOTEND);
+    success &= LoadConfig(mUi->uFilamentHeatCapacityPermmEdit, pConfig.thermalSettings.FILAMENT_HEAT_CAPACITY_PERMM);
+    success &= LoadConfig(mUi->uMpcSmoothingFactorSpinBox, pConfig.thermalSettings.MPC_SMOOTHING_FACTOR);
+    success &= LoadConfig(mUi->uMpcMinAmbientChangeSpinBox, pConfig.thermalSettings.MPC_MIN_AMBIENT_CHANGE);
+    success &= LoadConfig(mUi->uMpcSteadystateSpinBox, pConfig.thermalSettings.MPC_STEADYSTATE);
+    success &= LoadConfig(mUi->uMpcTuningPosEdit, pConfig.thermalSettings.MPC_TUNING_POS);
+    success &= LoadConfig(mUi->uMpcTuningEndZSpinBox, pConfig.thermalSettings.MPC_TUNING_END_Z);
+    success &= LoadConfig(mUi->uPidtempbedBox, pConfig.thermalSettings.PIDTEMPBED);
+    success &= LoadConfig(mUi->uBedLimitSwitchingBox, pConfig.thermalSettings.BED_LIMIT_SWITCHING);
+    success &= LoadConfig(mUi->uMaxBedPowerSpinBox, pConfig.thermalSettings.MAX_BED_POWER);
+    success &= LoadConfig(mUi->uMinBedPowerSpinBox, pConfig.thermalSettings.MIN_BED_POWER);
+    success &= LoadConfig(mUi->uMinBedPowerBox, pConfig.thermalSettings.ENABLE_MIN_BED_POWER);
+    success &= LoadConfig(mUi->uPidBedDebugBox, pConfig.thermalSettings.PID_BED_DEBUG);
+    success &= LoadConfig(mUi->uDefaultBedkpSpinBox, pConfig.thermalSettings.DEFAULT_bedKp);
+    success &= LoadConfig(mUi->uDefaultBedkiSpinBox, pConfig.thermalSettings.DEFAULT_bedKi);
+    success &= LoadConfig(mUi->uDefaultBedkdSpinBox, pConfig.thermalSettings.DEFAULT_bedKd);
+    success &= LoadConfig(mUi->uPidtempchamberBox, pConfig.thermalSettings.PIDTEMPCHAMBER);
+    success &= LoadConfig(mUi->uChamberLimitSwitchingBox, pConfig.thermalSettings.CHAMBER_LIMIT_SWITCHING);
+    success &= LoadConfig(mUi->uMaxChamberPowerSpinBox, pConfig.thermalSettings.MAX_CHAMBER_POWER);
+    success &= LoadConfig(mUi->uMinChamberPowerSpinBox, pConfig.thermalSettings.MIN_CHAMBER_POWER);
+    success &= LoadConfig(mUi->uMinChamberPowerBox, pConfig.thermalSettings.ENABLE_MIN_CHAMBER_POWER);
+    success &= LoadConfig(mUi->uPidChamberDebugBox, pConfig.thermalSettings.PID_CHAMBER_DEBUG);
+    success &= LoadConfig(mUi->uDefaultChamberkpSpinBox, pConfig.thermalSettings.DEFAULT_chamberKp);
+    success &= LoadConfig(mUi->uDefaultChamberkiSpinBox, pConfig.thermalSettings.DEFAULT_chamberKi);
+    success &= LoadConfig(mUi->uDefaultChamberkdSpinBox, pConfig.thermalSettings.DEFAULT_chamberKd);
+    success &= LoadConfig(mUi->uPidOpenloopBox, pConfig.thermalSettings.PID_OPENLOOP);
+    success &= LoadConfig(mUi->uSlowPwmHeatersBox, pConfig.thermalSettings.SLOW_PWM_HEATERS);
+    success &= LoadConfig(mUi->uPidFunctionalRangeSpinBox, pConfig.thermalSettings.PID_FUNCTIONAL_RANGE);
+    success &= LoadConfig(mUi->uPidEditMenuBox, pConfig.thermalSettings.PID_EDIT_MENU);
+    success &= LoadConfig(mUi->uPidAutotuneMenuBox, pConfig.thermalSettings.PID_AUTOTUNE_MENU);
+    success &= LoadConfig(mUi->uPreventColdExtrusionBox, pConfig.thermalSettings.PREVENT_COLD_EXTRUSION);
+    success &= LoadConfig(mUi->uExtrudeMintempSpinBox, pConfig.thermalSettings.EXTRUDE_MINTEMP);
+    success &= LoadConfig(mUi->uPreventLengthyExtrudeBox, pConfig.thermalSettings.PREVENT_LENGTHY_EXTRUDE);
+    success &= LoadConfig(mUi->uExtrudeMaxlengthSpinBox, pConfig.thermalSettings.EXTRUDE_MAXLENGTH);
+    success &= LoadConfig(mUi->uThermalProtectionHotendsBox, pConfig.thermalSettings.THERMAL_PROTECTION_HOTENDS);
+    success &= LoadConfig(mUi->uThermalProtectionBedBox, pConfig.thermalSettings.THERMAL_PROTECTION_BED);
+    success &= LoadConfig(mUi->uThermalProtectionChamberBox, pConfig.thermalSettings.THERMAL_PROTECTION_CHAMBER);
+    success &= LoadConfig(mUi->uThermalProtectionCoolerBox, pConfig.thermalSettings.THERMAL_PROTECTION_COOLER);
 
     mIsLoading = false;
     return success;
@@ -695,3 +700,18 @@ void ThermalSettingsPage::ReplaceTags(QStringList& pOutput)
     ReplaceTag(pOutput, "#{PID_EDIT_MENU}", mUi->uPidEditMenuBox, "PID_EDIT_MENU");
     ReplaceTag(pOutput, "#{PID_AUTOTUNE_MENU}", mUi->uPidAutotuneMenuBox, "PID_AUTOTUNE_MENU");
 }
+
+int32_t ThermalSettingsPage::AddThermistors(const QStringList& pThermistors)
+{
+    const std::array<Dropdown*, 14> dropdowns{mUi->uTempSensor0Dropdown, mUi->uTempSensor1Dropdown, mUi->uTempSensor2Dropdown, mUi->uTempSensor3Dropdown,
+                                              mUi->uTempSensor4Dropdown, mUi->uTempSensor5Dropdown, mUi->uTempSensor6Dropdown, mUi->uTempSensor7Dropdown,
+                                              mUi->uTempSensorBedDropdown, mUi->uTempSensorProbeDropdown, mUi->uTempSensorChamberDropdown,
+                                              mUi->uTempSensorCoolerDropdown, mUi->uTempSensorBoardDropdown, mUi->uTempSensorRedundantDropdown};
+
+    int32_t added = 0;
+    for (auto&& dropdown : dropdowns)
+    {
+        added = std::max(added, dropdown->SetAddedItems(pThermistors, true));
+    }
+    return added;
+}
@@ -26,13 +26,15 @@
 #include "UserInterfaceLanguagePage.h"
 #include "./ui_UserInterfaceLanguagePage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 #include <QToolButton>
 
 UserInterfaceLanguagePage::UserInterfaceLanguagePage(QWidget *pParent) :
-    AbstractPage(USER_INTERFACE_LANGUAGE_TEMPLATE_PATH, pParent),
+    AbstractPage(USER_INTERFACE_LANGUAGE_TEMPLATE_PATH, "userInterfaceLanguage", pParent),
     mUi(new Ui::UserInterfaceLanguagePage)
 {
+    const TraceSpan span("UserInterfaceLanguagePage::setupUi");
     mUi->setupUi(this);
 
     // Set the clear button icon of the search box
@@ -73,14 +75,14 @@ void UserInterfaceLanguagePage::ResetValues()
     mIsLoading = false;
 }
 
-bool UserInterfaceLanguagePage::LoadFromJson(const QJsonObject &pJson)
+bool UserInterfaceLanguagePage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
 
-    success &= LoadConfig(mUi->uLcdLanguageDropdown, pJson, "LCD_LANGUAGE");
-    success &= LoadConfig(mUi->uDisplayCharsetHd44780Dropdown, pJson, "DISPLAY_CHARSET_HD44780");
-    success &= LoadConfig(mUi->uLcdInfoScreenStyleDropdown, pJson, "LCD_INFO_SCREEN_STYLE");
+    success &= LoadConfig(mUi->uLcdLanguageDropdown, pConfig.userInterfaceLanguage.LCD_LANGUAGE);
+    success &= LoadConfig(mUi->uDisplayCharsetHd44780Dropdown, pConfig.userInterfaceLanguage.DISPLAY_CHARSET_HD44780);
+    success &= LoadConfig(mUi->uLcdInfoScreenStyleDropdown, pConfig.userInterfaceLanguage.LCD_INFO_SCREEN_STYLE);
 
     mIsLoading = false;
     return success;
@@ -26,11 +26,13 @@
 #include "WelcomePage.h"
 #include "./ui_WelcomePage.h"
 #include "Configuration.h"
+#include "Trace.h"
 
 WelcomePage::WelcomePage(QWidget *pParent) :
     QWidget(pParent),
     mUi(new Ui::WelcomePage)
 {
+    const TraceSpan span("WelcomePage::setupUi");
     mUi->setupUi(this);
 
     QObject::connect(mUi->uOpenWorkspaceButton, &QPushButton::clicked, this, &WelcomePage::OpenWorkspaceSignal);
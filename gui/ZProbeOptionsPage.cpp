@@ -26,11 +26,13 @@
 #include "ZProbeOptionsPage.h"
 #include "./ui_ZProbeOptionsPage.h"
 #include "HelperFunctions.h"
+#include "Trace.h"
 
 ZProbeOptionsPage::ZProbeOptionsPage(QWidget *pParent) :
-    AbstractPage(Z_PROBE_OPTIONS_TEMPLATE_PATH, pParent),
+    AbstractPage(Z_PROBE_OPTIONS_TEMPLATE_PATH, QString(), pParent),
     mUi(new Ui::ZProbeOptionsPage)
 {
+    const TraceSpan span("ZProbeOptionsPage::setupUi");
     mUi->setupUi(this);
 }
 
@@ -56,7 +58,7 @@ void ZProbeOptionsPage::ResetValues()
     mIsLoading = false;
 }
 
-bool ZProbeOptionsPage::LoadFromJson(const QJsonObject &pJson)
+bool ZProbeOptionsPage::LoadFromConfiguration(const Configuration& pConfig)
 {
     bool success = true;
     mIsLoading = true;
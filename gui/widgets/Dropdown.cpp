@@ -26,6 +26,29 @@
 #include "Dropdown.h"
 
 #include <QAbstractItemView>
+#include <QSet>
+
+namespace
+{
+/// \brief Returns the text used to compare dropdown items
+///
+/// \param pText: The item text
+/// \param pMatchItemInBrackets: If true, the flag name in square brackets is returned
+/// \return The comparison key
+QString ItemKey(const QString& pText, bool pMatchItemInBrackets)
+{
+    if (pMatchItemInBrackets)
+    {
+        const auto begin = pText.lastIndexOf('[');
+        const auto end = pText.lastIndexOf(']');
+        if (begin >= 0 && end > begin)
+        {
+            return pText.mid(begin + 1, end - begin - 1);
+        }
+    }
+    return pText;
+}
+}
 
 Dropdown::Dropdown(QWidget *pParent) :
     QComboBox(pParent)
@@ -40,3 +63,43 @@ void Dropdown::Reset(const QString& pText)
 {
     setCurrentText(pText);
 }
+
+int32_t Dropdown::SetAddedItems(const QStringList& pItems, bool pMatchItemInBrackets)
+{
+    if (mBuiltInCount < 0)
+    {
+        mBuiltInCount = count();
+    }
+
+    const auto selectedKey = ItemKey(currentText(), pMatchItemInBrackets);
+    const auto addedSelected = currentIndex() >= mBuiltInCount;
+
+    while (count() > mBuiltInCount)
+    {
+        removeItem(count() - 1);
+    }
+
+    QSet<QString> keys;
+    for (int32_t i = 0; i < count(); ++i)
+    {
+        keys.insert(ItemKey(itemText(i), pMatchItemInBrackets));
+    }
+
+    int32_t added = 0;
+    for (const auto& item : pItems)
+    {
+        const auto key = ItemKey(item, pMatchItemInBrackets);
+        if (!keys.contains(key))
+        {
+            keys.insert(key);
+            addItem(item);
+            ++added;
+
+            if (addedSelected && key == selectedKey)
+            {
+                setCurrentIndex(count() - 1);
+            }
+        }
+    }
+    return added;
+}
@@ -27,6 +27,7 @@
 #define DROPDOWN_H
 
 #include <QComboBox>
+#include <QStringList>
 
 ///
 /// \brief The Dropdown class represents a dropdown menu
@@ -44,6 +45,20 @@ public:
     ~Dropdown(void) override;
 
     void Reset(const QString& pText);
+
+    /// \brief Replaces the items added by the previous call with the given items that are not built in
+    ///
+    /// Built-in items keep their position, so their item indices stay valid. An added item that is
+    /// selected stays selected if it is contained in the new items.
+    ///
+    /// \param pItems: The items to add, an empty list restores the built-in items
+    /// \param pMatchItemInBrackets: If true, items are compared by the flag name in square brackets
+    /// \return The number of added items
+    int32_t SetAddedItems(const QStringList& pItems, bool pMatchItemInBrackets = false);
+
+private:
+    /// \brief Number of items from the UI file, -1 until items are added
+    int32_t mBuiltInCount{-1};
 };
 
 #endif // DROPDOWN_H
@@ -24,8 +24,10 @@
  */
 
 #include "Application.h"
+#include "Trace.h"
 
 #include <QApplication>
+#include <QSettings>
 
 /// \brief The main function of the software
 ///
@@ -35,8 +37,13 @@
 int main(int argc, char *argv[])
 {
     QApplication a(argc, argv);
+    QApplication::setOrganizationName("iLOOP");
+    QApplication::setApplicationName("iMC");
     QApplication::setStyle("fusion");
 
+    // Enabled before the application is constructed, so the startup is traced as well
+    Trace::SetEnabled(qEnvironmentVariableIsSet("IMC_TRACE") || QSettings().value("trace/enabled", false).toBool());
+
     Application app;
     return a.exec();
 }